@@ -66,6 +66,7 @@
 #  WglContext                   - WGL context
 #  MagnumFont                   - Magnum bitmap font plugin
 #  MagnumFontConverter          - Magnum bitmap font converter plugin
+#  MeshBlobImporter             - Binary mesh blob importer plugin
 #  ObjImporter                  - OBJ importer plugin
 #  TgaImageConverter            - TGA image converter plugin
 #  TgaImporter                  - TGA importer plugin
@@ -73,6 +74,7 @@
 #  distancefieldconverter       - magnum-distancefieldconverter executable
 #  fontconverter                - magnum-fontconverter executable
 #  info                         - magnum-info executable
+#  meshblobconverter            - magnum-meshblobconverter executable
 #
 # Example usage with specifying additional components is::
 #
@@ -343,8 +345,8 @@ endif()
 # Component distinction (listing them explicitly to avoid mistakes with finding
 # components from other repositories)
 set(_MAGNUM_LIBRARY_COMPONENTS "^(Audio|DebugTools|MeshTools|Primitives|SceneGraph|Shaders|Shapes|Text|TextureTools|AndroidApplication|GlfwApplication|GlutApplication|GlxApplication|NaClApplication|Sdl2Application|XEglApplication|WindowlessCglApplication|WindowlessEglApplication|WindowlessGlxApplication|WindowlessIosApplication|WindowlessNaClApplication|WindowlessWglApplication|WindowlessWindowsEglApplication|CglContext|EglContext|GlxContext|WglContext)$")
-set(_MAGNUM_PLUGIN_COMPONENTS "^(MagnumFont|MagnumFontConverter|ObjImporter|TgaImageConverter|TgaImporter|WavAudioImporter)$")
-set(_MAGNUM_EXECUTABLE_COMPONENTS "^(distancefieldconverter|fontconverter|info)$")
+set(_MAGNUM_PLUGIN_COMPONENTS "^(MagnumFont|MagnumFontConverter|MeshBlobImporter|ObjImporter|TgaImageConverter|TgaImporter|WavAudioImporter)$")
+set(_MAGNUM_EXECUTABLE_COMPONENTS "^(distancefieldconverter|fontconverter|info|meshblobconverter)$")
 
 # Find all components
 foreach(_component ${Magnum_FIND_COMPONENTS})
@@ -575,11 +577,24 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         elseif(_component STREQUAL MeshTools)
             set(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES CompressIndices.h)
 
+            if(NOT CORRADE_TARGET_EMSCRIPTEN AND NOT CORRADE_TARGET_NACL)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+            endif()
+
         # Primitives library
         elseif(_component STREQUAL Primitives)
             set(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES Cube.h)
 
-        # No special setup for SceneGraph library
+        # SceneGraph library
+        elseif(_component STREQUAL SceneGraph)
+            if(NOT CORRADE_TARGET_EMSCRIPTEN AND NOT CORRADE_TARGET_NACL)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+            endif()
+
         # No special setup for Shaders library
         # No special setup for Shapes library
         # No special setup for Text library
@@ -587,6 +602,14 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         # TextureTools library
         elseif(_component STREQUAL TextureTools)
             set(_MAGNUM_${_COMPONENT}_INCLUDE_PATH_NAMES Atlas.h)
+
+        # ObjImporter plugin
+        elseif(_component STREQUAL ObjImporter)
+            if(NOT CORRADE_TARGET_EMSCRIPTEN AND NOT CORRADE_TARGET_NACL)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+            endif()
         endif()
 
         # Find library/plugin includes
@@ -26,6 +26,7 @@ cmake .. ^
     -DWITH_WGLCONTEXT=ON ^
     -DWITH_MAGNUMFONT=ON ^
     -DWITH_MAGNUMFONTCONVERTER=ON ^
+    -DWITH_MESHBLOBCONVERTER=ON ^
     -DWITH_OBJIMPORTER=ON ^
     -DWITH_TGAIMAGECONVERTER=ON ^
     -DWITH_TGAIMPORTER=ON ^
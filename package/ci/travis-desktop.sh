@@ -24,6 +24,7 @@ cmake .. \
     -DWITH_${PLATFORM_GL_API}CONTEXT=ON \
     -DWITH_MAGNUMFONT=ON \
     -DWITH_MAGNUMFONTCONVERTER=ON \
+    -DWITH_MESHBLOBCONVERTER=ON \
     -DWITH_OBJIMPORTER=ON \
     -DWITH_TGAIMAGECONVERTER=ON \
     -DWITH_TGAIMPORTER=ON \
@@ -0,0 +1,93 @@
+#ifndef Magnum_Implementation_parallel_h
+#define Magnum_Implementation_parallel_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+#include "Magnum/Types.h"
+
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+#include <thread>
+#endif
+
+/* Helpers for splitting data processing between threads. Header-only, so
+   the libraries using it need to link to the thread library themselves. */
+
+namespace Magnum { namespace Implementation {
+
+/* Minimal count of items processed by one thread, less work is not worth the
+   thread startup overhead */
+constexpr std::size_t ParallelMinCount = 65536;
+
+/* Count of threads worth using for given amount of work, at least one.
+   Thread count 0 means the count is taken from hardware concurrency. */
+inline std::size_t parallelThreadCount(const std::size_t count, const UnsignedInt threadCount, const std::size_t minCount = ParallelMinCount) {
+    #if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+    return std::max(std::size_t(1), std::min(std::size_t(threadCount ? threadCount : std::max(1u, std::thread::hardware_concurrency())), count/minCount));
+    #else
+    static_cast<void>(count);
+    static_cast<void>(threadCount);
+    static_cast<void>(minCount);
+    return 1;
+    #endif
+}
+
+/* Calls f(i) for each i in [0, threadCount), the first in the calling thread
+   and the others each in its own thread */
+template<class F> void runInParallel(const std::size_t threadCount, const F& f) {
+    #if !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+    if(threadCount > 1) {
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for(std::size_t i = 1; i != threadCount; ++i)
+            threads.emplace_back(std::cref(f), i);
+        f(std::size_t(0));
+        for(std::thread& thread: threads) thread.join();
+        return;
+    }
+    #endif
+
+    for(std::size_t i = 0; i != threadCount; ++i) f(i);
+}
+
+/* Calls f(begin, end) on contiguous chunks of [0, count), each chunk in its
+   own thread */
+template<class F> void forEachRange(const std::size_t count, const std::size_t threadCount, const F& f) {
+    if(threadCount <= 1) {
+        f(std::size_t(0), count);
+        return;
+    }
+
+    runInParallel(threadCount, [&](const std::size_t i) {
+        f(count*i/threadCount, count*(i + 1)/threadCount);
+    });
+}
+
+}}
+
+#endif
@@ -341,6 +341,9 @@ typedef Math::Range2D<Int> Range2Di;
 /** @brief Signed integer 3D range */
 typedef Math::Range3D<Int> Range3Di;
 
+/** @brief Float frustum */
+typedef Math::Frustum<Float> Frustum;
+
 /*@}*/
 
 /** @{ @name Double-precision types
@@ -441,6 +444,9 @@ typedef Math::Range2D<Double> Range2Dd;
 /** @brief Double 3D range */
 typedef Math::Range3D<Double> Range3Dd;
 
+/** @brief Double frustum */
+typedef Math::Frustum<Double> Frustumd;
+
 /*@}*/
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -587,6 +593,8 @@ template<class...> class ResourceManager;
 class Sampler;
 class Shader;
 
+template<class> class StridedArrayView;
+
 template<UnsignedInt> class Texture;
 #ifndef MAGNUM_TARGET_GLES
 typedef Texture<1> Texture1D;
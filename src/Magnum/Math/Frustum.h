@@ -0,0 +1,160 @@
+#ifndef Magnum_Math_Frustum_h
+#define Magnum_Math_Frustum_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Math::Frustum
+ */
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Vector4.h"
+
+#ifdef CORRADE_TARGET_WINDOWS /* I so HATE windef.h */
+#undef near
+#undef far
+#endif
+
+namespace Magnum { namespace Math {
+
+/**
+@brief Camera frustum
+
+Defined by six planes, each stored as @ref Vector4 with the plane normal in
+first three components and distance from origin in the last. Normals point
+inside the frustum, i.e. point @f$ \boldsymbol p @f$ is inside if
+@f$ \boldsymbol n \cdot \boldsymbol p + d \ge 0 @f$ for all planes. See
+@ref Geometry::Intersection for intersection tests.
+*/
+template<class T> class Frustum {
+    public:
+        /**
+         * @brief Create frustum from projection matrix
+         *
+         * Extracts the planes from rows of given projection (or combined
+         * projection and camera) matrix and normalizes them, so the plane
+         * equation gives signed distance.
+         */
+        static Frustum<T> fromMatrix(const Matrix4<T>& m);
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates frustum corresponding to identity projection, i.e. a cube
+         * from @f$ (-1, -1, -1) @f$ to @f$ (1, 1, 1) @f$.
+         */
+        constexpr /*implicit*/ Frustum(IdentityInitT = IdentityInit): _data{
+            {T(1), T(0), T(0), T(1)},
+            {T(-1), T(0), T(0), T(1)},
+            {T(0), T(1), T(0), T(1)},
+            {T(0), T(-1), T(0), T(1)},
+            {T(0), T(0), T(1), T(1)},
+            {T(0), T(0), T(-1), T(1)}} {}
+
+        /** @brief Construct without initializing the contents */
+        explicit Frustum(NoInitT): _data{Vector4<T>{NoInit}, Vector4<T>{NoInit}, Vector4<T>{NoInit}, Vector4<T>{NoInit}, Vector4<T>{NoInit}, Vector4<T>{NoInit}} {}
+
+        /** @brief Construct frustum from plane equations */
+        constexpr /*implicit*/ Frustum(const Vector4<T>& left, const Vector4<T>& right, const Vector4<T>& bottom, const Vector4<T>& top, const Vector4<T>& near, const Vector4<T>& far): _data{left, right, bottom, top, near, far} {}
+
+        /** @brief Equality comparison */
+        bool operator==(const Frustum<T>& other) const {
+            for(std::size_t i = 0; i != 6; ++i)
+                for(std::size_t j = 0; j != 4; ++j)
+                    if(!TypeTraits<T>::equals(_data[i][j], other._data[i][j])) return false;
+            return true;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const Frustum<T>& other) const {
+            return !operator==(other);
+        }
+
+        /**
+         * @brief Raw data
+         * @return One-dimensional array of 24 elements.
+         */
+        T* data() { return _data[0].data(); }
+        constexpr const T* data() const { return _data[0].data(); } /**< @overload */
+
+        /**
+         * @brief Plane at given position
+         *
+         * The planes are in order left, right, bottom, top, near, far.
+         */
+        constexpr Vector4<T> operator[](std::size_t i) const { return _data[i]; }
+
+        /** @brief Left plane */
+        constexpr Vector4<T> left() const { return _data[0]; }
+
+        /** @brief Right plane */
+        constexpr Vector4<T> right() const { return _data[1]; }
+
+        /** @brief Bottom plane */
+        constexpr Vector4<T> bottom() const { return _data[2]; }
+
+        /** @brief Top plane */
+        constexpr Vector4<T> top() const { return _data[3]; }
+
+        /** @brief Near plane */
+        constexpr Vector4<T> near() const { return _data[4]; }
+
+        /** @brief Far plane */
+        constexpr Vector4<T> far() const { return _data[5]; }
+
+    private:
+        Vector4<T> _data[6];
+};
+
+/** @debugoperator{Magnum::Math::Frustum} */
+template<class T> Corrade::Utility::Debug& operator<<(Corrade::Utility::Debug& debug, const Frustum<T>& value) {
+    debug << "Frustum({" << Corrade::Utility::Debug::nospace << value[0][0];
+    for(std::size_t i = 0; i != 6; ++i) {
+        if(i) debug << Corrade::Utility::Debug::nospace << "}, {"
+                    << Corrade::Utility::Debug::nospace << value[i][0];
+        for(std::size_t j = 1; j != 4; ++j)
+            debug << Corrade::Utility::Debug::nospace << "," << value[i][j];
+    }
+    return debug << Corrade::Utility::Debug::nospace << "})";
+}
+
+template<class T> Frustum<T> Frustum<T>::fromMatrix(const Matrix4<T>& m) {
+    Frustum<T> out{NoInit};
+    const Vector4<T> w = m.row(3);
+    for(std::size_t i = 0; i != 3; ++i) {
+        const Vector4<T> row = m.row(i);
+        out._data[i*2] = w + row;
+        out._data[i*2 + 1] = w - row;
+    }
+
+    for(Vector4<T>& plane: out._data)
+        plane /= plane.xyz().length();
+
+    return out;
+}
+
+}}
+
+#endif
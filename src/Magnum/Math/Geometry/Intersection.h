@@ -29,6 +29,10 @@
  * @brief Class @ref Magnum::Math::Geometry::Intersection
  */
 
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Math/Frustum.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Math/Vector3.h"
 
 namespace Magnum { namespace Math { namespace Geometry {
@@ -123,8 +127,110 @@ class Intersection {
             const T f = dot(planePosition, planeNormal);
             return (f-dot(planeNormal, p))/dot(planeNormal, r);
         }
+
+        /**
+         * @brief Intersection of a point and a frustum
+         * @param point         Point
+         * @param frustum       Frustum
+         * @return `true` if the point is on or inside the frustum, `false`
+         *      otherwise
+         *
+         * Checks for each plane of the frustum whether the point is on or
+         * behind the plane (i.e., in direction of its normal).
+         */
+        template<class T> static bool pointFrustum(const Vector3<T>& point, const Frustum<T>& frustum) {
+            for(std::size_t i = 0; i != 6; ++i) {
+                const Vector4<T> plane = frustum[i];
+                if(dot(plane.xyz(), point) + plane.w() < T(0)) return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Intersection of a sphere and a frustum
+         * @param center        Sphere center
+         * @param radius        Sphere radius
+         * @param frustum       Frustum
+         * @return `true` if the sphere is at least partially inside the
+         *      frustum, `false` otherwise
+         *
+         * Checks that distance of the sphere center from each plane of the
+         * frustum is not smaller than negative radius. The test is
+         * conservative --- spheres near frustum corners might be reported as
+         * intersecting even though they are completely outside.
+         * @see @ref sphereFrustum(Corrade::Containers::ArrayView<const Vector3<T>>, Corrade::Containers::ArrayView<const T>, const Frustum<T>&, Corrade::Containers::ArrayView<bool>)
+         */
+        template<class T> static bool sphereFrustum(const Vector3<T>& center, T radius, const Frustum<T>& frustum) {
+            for(std::size_t i = 0; i != 6; ++i) {
+                const Vector4<T> plane = frustum[i];
+                if(dot(plane.xyz(), center) + plane.w() < -radius) return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Intersection of a batch of spheres and a frustum
+         * @param centers       Sphere centers
+         * @param radii         Sphere radii
+         * @param frustum       Frustum
+         * @param[out] visible  Whether given sphere is at least partially
+         *      inside the frustum
+         * @return Count of spheres at least partially inside the frustum
+         *
+         * Equivalent to calling @ref sphereFrustum(const Vector3<T>&, T, const Frustum<T>&)
+         * for each sphere, but processes the spheres plane by plane without
+         * any branching, which allows the compiler to vectorize the loop.
+         * All views are expected to have the same size.
+         */
+        template<class T> static std::size_t sphereFrustum(Corrade::Containers::ArrayView<const Vector3<T>> centers, Corrade::Containers::ArrayView<const T> radii, const Frustum<T>& frustum, Corrade::Containers::ArrayView<bool> visible);
+
+        /**
+         * @brief Intersection of an axis-aligned box and a frustum
+         * @param box           Axis-aligned box
+         * @param frustum       Frustum
+         * @return `true` if the box is at least partially inside the frustum,
+         *      `false` otherwise
+         *
+         * For each plane of the frustum checks the box corner which is
+         * farthest in direction of the plane normal. Similarly to
+         * @ref sphereFrustum() the test is conservative.
+         */
+        template<class T> static bool boxFrustum(const Range3D<T>& box, const Frustum<T>& frustum) {
+            for(std::size_t i = 0; i != 6; ++i) {
+                const Vector4<T> plane = frustum[i];
+                const Vector3<T> corner{
+                    plane.x() < T(0) ? box.min().x() : box.max().x(),
+                    plane.y() < T(0) ? box.min().y() : box.max().y(),
+                    plane.z() < T(0) ? box.min().z() : box.max().z()};
+                if(dot(plane.xyz(), corner) + plane.w() < T(0)) return false;
+            }
+
+            return true;
+        }
 };
 
+template<class T> std::size_t Intersection::sphereFrustum(const Corrade::Containers::ArrayView<const Vector3<T>> centers, const Corrade::Containers::ArrayView<const T> radii, const Frustum<T>& frustum, const Corrade::Containers::ArrayView<bool> visible) {
+    CORRADE_ASSERT(centers.size() == radii.size() && centers.size() == visible.size(),
+        "Math::Geometry::Intersection::sphereFrustum(): expected views of the same size but got" << centers.size() << Corrade::Utility::Debug::nospace << "," << radii.size() << "and" << visible.size(), {});
+
+    const std::size_t count = centers.size();
+    for(std::size_t i = 0; i != count; ++i) visible[i] = true;
+
+    /* Plane by plane, so the inner loop does the same operation on all
+       spheres */
+    for(std::size_t p = 0; p != 6; ++p) {
+        const Vector4<T> plane = frustum[p];
+        for(std::size_t i = 0; i != count; ++i)
+            visible[i] = visible[i] & (plane.x()*centers[i].x() + plane.y()*centers[i].y() + plane.z()*centers[i].z() + plane.w() >= -radii[i]);
+    }
+
+    std::size_t visibleCount = 0;
+    for(std::size_t i = 0; i != count; ++i) visibleCount += visible[i];
+    return visibleCount;
+}
+
 }}}
 
 #endif
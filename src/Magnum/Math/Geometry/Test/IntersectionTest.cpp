@@ -34,15 +34,37 @@ struct IntersectionTest: Corrade::TestSuite::Tester {
 
     void planeLine();
     void lineLine();
+
+    void pointFrustum();
+    void sphereFrustum();
+    void sphereFrustumBatch();
+    void boxFrustum();
 };
 
 typedef Math::Vector2<Float> Vector2;
 typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+typedef Math::Frustum<Float> Frustum;
+typedef Math::Range3D<Float> Range3D;
 typedef Math::Constants<Float> Constants;
 
+/* Box from (-1, -2, -3) to (1, 2, 10) */
+const Frustum BoxFrustum{
+    {1.0f, 0.0f, 0.0f, 1.0f},
+    {-1.0f, 0.0f, 0.0f, 1.0f},
+    {0.0f, 1.0f, 0.0f, 2.0f},
+    {0.0f, -1.0f, 0.0f, 2.0f},
+    {0.0f, 0.0f, 1.0f, 3.0f},
+    {0.0f, 0.0f, -1.0f, 10.0f}};
+
 IntersectionTest::IntersectionTest() {
     addTests({&IntersectionTest::planeLine,
-              &IntersectionTest::lineLine});
+              &IntersectionTest::lineLine,
+
+              &IntersectionTest::pointFrustum,
+              &IntersectionTest::sphereFrustum,
+              &IntersectionTest::sphereFrustumBatch,
+              &IntersectionTest::boxFrustum});
 }
 
 void IntersectionTest::planeLine() {
@@ -97,6 +119,63 @@ void IntersectionTest::lineLine() {
         {0.0f, 0.0f}, {1.0f, 2.0f}), Constants::inf());
 }
 
+void IntersectionTest::pointFrustum() {
+    CORRADE_VERIFY(Intersection::pointFrustum({0.0f, 0.0f, 0.0f}, BoxFrustum));
+    CORRADE_VERIFY(Intersection::pointFrustum({1.0f, -2.0f, 10.0f}, BoxFrustum));
+    CORRADE_VERIFY(!Intersection::pointFrustum({1.5f, 0.0f, 0.0f}, BoxFrustum));
+    CORRADE_VERIFY(!Intersection::pointFrustum({0.0f, 0.0f, -3.5f}, BoxFrustum));
+}
+
+void IntersectionTest::sphereFrustum() {
+    /* Inside, intersecting a plane */
+    CORRADE_VERIFY(Intersection::sphereFrustum({0.0f, 0.0f, 0.0f}, 0.5f, BoxFrustum));
+    CORRADE_VERIFY(Intersection::sphereFrustum({1.5f, 0.0f, 0.0f}, 1.0f, BoxFrustum));
+
+    /* Outside, touching */
+    CORRADE_VERIFY(!Intersection::sphereFrustum({1.5f, 0.0f, 0.0f}, 0.25f, BoxFrustum));
+    CORRADE_VERIFY(Intersection::sphereFrustum({0.0f, 0.0f, 11.0f}, 1.0f, BoxFrustum));
+
+    /* Perspective frustum */
+    const Frustum perspective = Frustum::fromMatrix(Matrix4<Float>::perspectiveProjection(Deg<Float>(90.0f), 1.0f, 1.0f, 100.0f));
+    CORRADE_VERIFY(Intersection::sphereFrustum({0.0f, 0.0f, -50.0f}, 1.0f, perspective));
+    CORRADE_VERIFY(Intersection::sphereFrustum({49.0f, 0.0f, -50.0f}, 1.0f, perspective));
+    CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, 0.0f, 50.0f}, 1.0f, perspective));
+    CORRADE_VERIFY(!Intersection::sphereFrustum({0.0f, 0.0f, -102.0f}, 1.0f, perspective));
+}
+
+void IntersectionTest::sphereFrustumBatch() {
+    const Vector3 centers[]{
+        {0.0f, 0.0f, 0.0f},
+        {1.5f, 0.0f, 0.0f},
+        {1.5f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 11.0f},
+        {0.0f, -5.0f, 0.0f}};
+    const Float radii[]{0.5f, 1.0f, 0.25f, 1.0f, 2.0f};
+    bool visible[5];
+
+    CORRADE_COMPARE(Intersection::sphereFrustum<Float>(centers, radii, BoxFrustum, visible), 3);
+    CORRADE_VERIFY(visible[0]);
+    CORRADE_VERIFY(visible[1]);
+    CORRADE_VERIFY(!visible[2]);
+    CORRADE_VERIFY(visible[3]);
+    CORRADE_VERIFY(!visible[4]);
+
+    /* Same as the single-sphere variant */
+    for(std::size_t i = 0; i != 5; ++i)
+        CORRADE_COMPARE(visible[i], Intersection::sphereFrustum(centers[i], radii[i], BoxFrustum));
+}
+
+void IntersectionTest::boxFrustum() {
+    /* Inside, intersecting a plane, containing the frustum */
+    CORRADE_VERIFY(Intersection::boxFrustum(Range3D{{-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 0.5f}}, BoxFrustum));
+    CORRADE_VERIFY(Intersection::boxFrustum(Range3D{{0.5f, -0.5f, -0.5f}, {2.5f, 0.5f, 0.5f}}, BoxFrustum));
+    CORRADE_VERIFY(Intersection::boxFrustum(Range3D{{-50.0f, -50.0f, -50.0f}, {50.0f, 50.0f, 50.0f}}, BoxFrustum));
+
+    /* Outside */
+    CORRADE_VERIFY(!Intersection::boxFrustum(Range3D{{1.5f, -0.5f, -0.5f}, {2.5f, 0.5f, 0.5f}}, BoxFrustum));
+    CORRADE_VERIFY(!Intersection::boxFrustum(Range3D{{-0.5f, -0.5f, -10.0f}, {0.5f, 0.5f, -5.0f}}, BoxFrustum));
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Math::Geometry::Test::IntersectionTest)
@@ -0,0 +1,191 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Frustum.h"
+
+namespace Magnum { namespace Math { namespace Test {
+
+struct FrustumTest: Corrade::TestSuite::Tester {
+    explicit FrustumTest();
+
+    void construct();
+    void constructIdentity();
+    void constructNoInit();
+    void constructCopy();
+    void constructFromMatrixOrthographic();
+    void constructFromMatrixPerspective();
+
+    void access();
+    void compare();
+
+    void debug();
+};
+
+typedef Math::Deg<Float> Deg;
+typedef Math::Frustum<Float> Frustum;
+typedef Math::Matrix4<Float> Matrix4;
+typedef Math::Vector2<Float> Vector2;
+typedef Math::Vector3<Float> Vector3;
+typedef Math::Vector4<Float> Vector4;
+
+FrustumTest::FrustumTest() {
+    addTests({&FrustumTest::construct,
+              &FrustumTest::constructIdentity,
+              &FrustumTest::constructNoInit,
+              &FrustumTest::constructCopy,
+              &FrustumTest::constructFromMatrixOrthographic,
+              &FrustumTest::constructFromMatrixPerspective,
+
+              &FrustumTest::access,
+              &FrustumTest::compare,
+
+              &FrustumTest::debug});
+}
+
+void FrustumTest::construct() {
+    constexpr Frustum a{
+        {1.0f, 0.0f, 0.0f, 3.0f},
+        {-1.0f, 0.0f, 0.0f, 3.0f},
+        {0.0f, 1.0f, 0.0f, 2.0f},
+        {0.0f, -1.0f, 0.0f, 2.0f},
+        {0.0f, 0.0f, 1.0f, 1.0f},
+        {0.0f, 0.0f, -1.0f, 10.0f}};
+
+    CORRADE_COMPARE(a.left(), Vector4(1.0f, 0.0f, 0.0f, 3.0f));
+    CORRADE_COMPARE(a.right(), Vector4(-1.0f, 0.0f, 0.0f, 3.0f));
+    CORRADE_COMPARE(a.bottom(), Vector4(0.0f, 1.0f, 0.0f, 2.0f));
+    CORRADE_COMPARE(a.top(), Vector4(0.0f, -1.0f, 0.0f, 2.0f));
+    CORRADE_COMPARE(a.near(), Vector4(0.0f, 0.0f, 1.0f, 1.0f));
+    CORRADE_COMPARE(a.far(), Vector4(0.0f, 0.0f, -1.0f, 10.0f));
+}
+
+void FrustumTest::constructIdentity() {
+    constexpr Frustum a;
+    constexpr Frustum b{IdentityInit};
+
+    /* Identity projection matrix gives the same planes */
+    CORRADE_COMPARE(a, Frustum::fromMatrix(Matrix4{}));
+    CORRADE_COMPARE(b, a);
+    CORRADE_COMPARE(a.left(), Vector4(1.0f, 0.0f, 0.0f, 1.0f));
+    CORRADE_COMPARE(a.far(), Vector4(0.0f, 0.0f, -1.0f, 1.0f));
+}
+
+void FrustumTest::constructNoInit() {
+    Frustum a;
+    new(&a) Frustum{NoInit};
+    {
+        #if defined(__GNUC__) && __GNUC__*100 + __GNUC_MINOR__ >= 601 && __OPTIMIZE__
+        CORRADE_EXPECT_FAIL("GCC 6.1+ misoptimizes and overwrites the value.");
+        #endif
+        CORRADE_COMPARE(a, Frustum{});
+    }
+}
+
+void FrustumTest::constructCopy() {
+    constexpr Frustum a{
+        {1.0f, 0.0f, 0.0f, 3.0f},
+        {-1.0f, 0.0f, 0.0f, 3.0f},
+        {0.0f, 1.0f, 0.0f, 2.0f},
+        {0.0f, -1.0f, 0.0f, 2.0f},
+        {0.0f, 0.0f, 1.0f, 1.0f},
+        {0.0f, 0.0f, -1.0f, 10.0f}};
+    constexpr Frustum b{a};
+
+    CORRADE_COMPARE(b, a);
+}
+
+void FrustumTest::constructFromMatrixOrthographic() {
+    /* Box from (-2, -1, -1) to (2, 1, -10) in camera space */
+    const Frustum a = Frustum::fromMatrix(Matrix4::orthographicProjection({4.0f, 2.0f}, 1.0f, 10.0f));
+
+    CORRADE_COMPARE(a, (Frustum{
+        {1.0f, 0.0f, 0.0f, 2.0f},
+        {-1.0f, 0.0f, 0.0f, 2.0f},
+        {0.0f, 1.0f, 0.0f, 1.0f},
+        {0.0f, -1.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, -1.0f, -1.0f},
+        {0.0f, 0.0f, 1.0f, 10.0f}}));
+}
+
+void FrustumTest::constructFromMatrixPerspective() {
+    const Frustum a = Frustum::fromMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f));
+
+    /* Side planes are at 45 degrees, going through origin */
+    const Float s = Constants<Float>::sqrt2()/2.0f;
+    CORRADE_COMPARE(a.left(), Vector4(s, 0.0f, -s, 0.0f));
+    CORRADE_COMPARE(a.right(), Vector4(-s, 0.0f, -s, 0.0f));
+    CORRADE_COMPARE(a.bottom(), Vector4(0.0f, s, -s, 0.0f));
+    CORRADE_COMPARE(a.top(), Vector4(0.0f, -s, -s, 0.0f));
+    CORRADE_COMPARE(a.near(), Vector4(0.0f, 0.0f, -1.0f, -1.0f));
+    CORRADE_COMPARE(a.far(), Vector4(0.0f, 0.0f, 1.0f, 100.0f));
+}
+
+void FrustumTest::access() {
+    Frustum a{
+        {1.0f, 0.0f, 0.0f, 3.0f},
+        {-1.0f, 0.0f, 0.0f, 3.0f},
+        {0.0f, 1.0f, 0.0f, 2.0f},
+        {0.0f, -1.0f, 0.0f, 2.0f},
+        {0.0f, 0.0f, 1.0f, 1.0f},
+        {0.0f, 0.0f, -1.0f, 10.0f}};
+    constexpr Frustum ca;
+
+    CORRADE_COMPARE(a[2], Vector4(0.0f, 1.0f, 0.0f, 2.0f));
+    CORRADE_COMPARE(a.data()[7], 3.0f);
+    constexpr Vector4 top = ca[3];
+    constexpr Float dataLeft = *ca.data();
+    CORRADE_COMPARE(top, Vector4(0.0f, -1.0f, 0.0f, 1.0f));
+    CORRADE_COMPARE(dataLeft, 1.0f);
+
+    a.data()[23] = 5.0f;
+    CORRADE_COMPARE(a.far(), Vector4(0.0f, 0.0f, -1.0f, 5.0f));
+}
+
+void FrustumTest::compare() {
+    const Frustum a;
+    Frustum b;
+    b.data()[3] = 1.0f + TypeTraits<Float>::epsilon()/2.0f;
+    Frustum c;
+    c.data()[3] = 1.1f;
+
+    CORRADE_VERIFY(a == b);
+    CORRADE_VERIFY(a != c);
+}
+
+void FrustumTest::debug() {
+    std::ostringstream o;
+    Debug(&o) << Frustum{};
+
+    CORRADE_COMPARE(o.str(), "Frustum({1, 0, 0, 1}, {-1, 0, 0, 1}, "
+                                     "{0, 1, 0, 1}, {0, -1, 0, 1}, "
+                                     "{0, 0, 1, 1}, {0, 0, -1, 1})\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Math::Test::FrustumTest)
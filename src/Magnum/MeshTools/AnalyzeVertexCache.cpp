@@ -0,0 +1,54 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AnalyzeVertexCache.h"
+
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace MeshTools {
+
+VertexCacheStatistics analyzeVertexCache(const std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::analyzeVertexCache(): index count is not divisible by 3", {});
+
+    /* Same FIFO cache model as in Tipsify -- a vertex is in cache if less
+       than cacheSize other vertices were transformed after it */
+    std::size_t time = cacheSize + 1;
+    std::vector<std::size_t> timestamp(vertexCount);
+    UnsignedInt referencedVertexCount = 0;
+    for(const UnsignedInt v: indices) {
+        CORRADE_ASSERT(v < vertexCount, "MeshTools::analyzeVertexCache(): index" << v << "out of range for" << vertexCount << "vertices", {});
+
+        if(!timestamp[v]) ++referencedVertexCount;
+        if(time - timestamp[v] > cacheSize) timestamp[v] = time++;
+    }
+
+    VertexCacheStatistics statistics;
+    statistics.transformedVertexCount = time - cacheSize - 1;
+    statistics.acmr = indices.empty() ? 0.0f : Float(statistics.transformedVertexCount)*3/indices.size();
+    statistics.atvr = referencedVertexCount ? Float(statistics.transformedVertexCount)/referencedVertexCount : 0.0f;
+    return statistics;
+}
+
+}}
@@ -0,0 +1,84 @@
+#ifndef Magnum_MeshTools_AnalyzeVertexCache_h
+#define Magnum_MeshTools_AnalyzeVertexCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::VertexCacheStatistics, function @ref Magnum::MeshTools::analyzeVertexCache()
+ */
+
+#include <vector>
+
+#include "Magnum/Types.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Vertex cache statistics
+
+@see @ref analyzeVertexCache()
+*/
+struct VertexCacheStatistics {
+    /** @brief Count of vertex shader invocations */
+    UnsignedInt transformedVertexCount;
+
+    /**
+     * @brief Average cache miss ratio
+     *
+     * Transformed vertex count divided by triangle count. Ranges from `3.0`
+     * (no vertex reuse at all) down to about `0.5` for regular grids.
+     */
+    Float acmr;
+
+    /**
+     * @brief Average transformed vertex ratio
+     *
+     * Transformed vertex count divided by count of vertices referenced by
+     * the index array. Value of `1.0` means that each vertex is transformed
+     * only once, which is the optimum.
+     */
+    Float atvr;
+};
+
+/**
+@brief Analyze post-transform vertex cache efficiency
+@param indices      Index array
+@param vertexCount  Vertex count
+@param cacheSize    Post-transform vertex cache size
+
+Simulates a FIFO post-transform vertex cache of given size, which is the same
+model as used by @ref tipsify() and @ref optimizeOverdraw(), so the values
+can be used to compare the index order before and after optimization.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3. All indices are expected to be less than
+    @p vertexCount.
+*/
+VertexCacheStatistics MAGNUM_MESHTOOLS_EXPORT analyzeVertexCache(const std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize);
+
+}}
+
+#endif
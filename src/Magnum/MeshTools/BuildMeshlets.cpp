@@ -0,0 +1,195 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BuildMeshlets.h"
+
+#include <cmath>
+#include <limits>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+constexpr UnsignedInt NotInMeshlet = ~UnsignedInt{};
+
+/* Bounding sphere around center of the bounding box and normal cone. Cutoff
+   is sine of the cone half-angle, if the normals span a hemisphere or more,
+   the meshlet can't be culled. */
+void calculateBounds(Meshlet& meshlet, const std::vector<UnsignedInt>& vertices, const std::vector<UnsignedByte>& indices, const std::vector<Vector3>& positions) {
+    Vector3 min{std::numeric_limits<Float>::max()};
+    Vector3 max{-std::numeric_limits<Float>::max()};
+    for(std::size_t i = meshlet.vertexOffset; i != meshlet.vertexOffset + meshlet.vertexCount; ++i) {
+        min = Math::min(min, positions[vertices[i]]);
+        max = Math::max(max, positions[vertices[i]]);
+    }
+
+    meshlet.center = (min + max)*0.5f;
+    Float radiusSquared = 0.0f;
+    for(std::size_t i = meshlet.vertexOffset; i != meshlet.vertexOffset + meshlet.vertexCount; ++i)
+        radiusSquared = Math::max(radiusSquared, (positions[vertices[i]] - meshlet.center).dot());
+    meshlet.radius = std::sqrt(radiusSquared);
+
+    /* Average normal of all non-degenerate triangles is the cone axis */
+    std::vector<Vector3> normals;
+    normals.reserve(meshlet.triangleCount);
+    Vector3 axis;
+    for(std::size_t i = meshlet.indexOffset; i != meshlet.indexOffset + meshlet.triangleCount*3; i += 3) {
+        const Vector3& a = positions[vertices[meshlet.vertexOffset + indices[i]]];
+        const Vector3& b = positions[vertices[meshlet.vertexOffset + indices[i + 1]]];
+        const Vector3& c = positions[vertices[meshlet.vertexOffset + indices[i + 2]]];
+        const Vector3 normal = Math::cross(b - a, c - a);
+        const Float length = normal.length();
+        if(length == 0.0f) continue;
+
+        normals.push_back(normal/length);
+        axis += normals.back();
+    }
+
+    const Float axisLength = axis.length();
+    if(axisLength == 0.0f) {
+        meshlet.coneAxis = Vector3::zAxis();
+        meshlet.coneCutoff = 1.0f;
+        return;
+    }
+
+    meshlet.coneAxis = axis/axisLength;
+    Float minDot = 1.0f;
+    for(const Vector3& normal: normals)
+        minDot = Math::min(minDot, Math::dot(normal, meshlet.coneAxis));
+    meshlet.coneCutoff = minDot <= 0.0f ? 1.0f : std::sqrt(1.0f - minDot*minDot);
+}
+
+}
+
+Meshlets buildMeshlets(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt maxVertices, const UnsignedInt maxTriangles) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::buildMeshlets(): index count is not divisible by 3", {});
+    CORRADE_ASSERT(maxVertices >= 3 && maxVertices <= 256,
+        "MeshTools::buildMeshlets(): expected max vertex count between 3 and 256 but got" << maxVertices, {});
+    CORRADE_ASSERT(maxTriangles, "MeshTools::buildMeshlets(): max triangle count can't be zero", {});
+
+    const UnsignedInt vertexCount = positions.size();
+    const std::size_t triangleCount = indices.size()/3;
+
+    std::vector<UnsignedInt> liveTriangleCount, neighborOffset, neighbors;
+    Implementation::buildAdjacency(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+
+    /* Per-triangle emitted flag, per-vertex index in current meshlet */
+    std::vector<bool> emitted(triangleCount);
+    std::vector<UnsignedInt> localIndex(vertexCount, NotInMeshlet);
+
+    Meshlets out;
+    Meshlet current{};
+
+    const auto newVertexCount = [&](const std::size_t triangle) {
+        return UnsignedInt(localIndex[indices[triangle*3]] == NotInMeshlet) +
+               UnsignedInt(localIndex[indices[triangle*3 + 1]] == NotInMeshlet) +
+               UnsignedInt(localIndex[indices[triangle*3 + 2]] == NotInMeshlet);
+    };
+
+    const auto emit = [&](const std::size_t triangle) {
+        for(std::size_t i = triangle*3; i != triangle*3 + 3; ++i) {
+            const UnsignedInt v = indices[i];
+            if(localIndex[v] == NotInMeshlet) {
+                localIndex[v] = current.vertexCount++;
+                out.vertices.push_back(v);
+            }
+            out.indices.push_back(localIndex[v]);
+            --liveTriangleCount[v];
+        }
+        emitted[triangle] = true;
+        ++current.triangleCount;
+    };
+
+    const auto finish = [&]() {
+        if(!current.triangleCount) return;
+
+        calculateBounds(current, out.vertices, out.indices, positions);
+        out.meshlets.push_back(current);
+        for(std::size_t i = current.vertexOffset; i != out.vertices.size(); ++i)
+            localIndex[out.vertices[i]] = NotInMeshlet;
+
+        current = Meshlet{};
+        current.vertexOffset = out.vertices.size();
+        current.indexOffset = out.indices.size();
+    };
+
+    std::size_t scan = 0;
+    for(;;) {
+        /* Find triangle adjacent to the meshlet that adds the least new
+           vertices, on tie prefer the one with least remaining neighbors to
+           avoid leaving isolated triangles behind */
+        std::size_t best = triangleCount;
+        UnsignedInt bestNewVertexCount = 4, bestLiveCount = ~UnsignedInt{};
+        bool adjacentFound = false;
+        for(std::size_t i = current.vertexOffset; i != out.vertices.size(); ++i) {
+            const UnsignedInt v = out.vertices[i];
+            if(!liveTriangleCount[v]) continue;
+
+            for(UnsignedInt ti = neighborOffset[v]; ti != neighborOffset[v + 1]; ++ti) {
+                const UnsignedInt t = neighbors[ti];
+                if(emitted[t]) continue;
+
+                adjacentFound = true;
+                const UnsignedInt newCount = newVertexCount(t);
+                if(current.vertexCount + newCount > maxVertices) continue;
+
+                const UnsignedInt liveCount =
+                    liveTriangleCount[indices[t*3]] +
+                    liveTriangleCount[indices[t*3 + 1]] +
+                    liveTriangleCount[indices[t*3 + 2]];
+                if(newCount < bestNewVertexCount || (newCount == bestNewVertexCount && liveCount < bestLiveCount)) {
+                    best = t;
+                    bestNewVertexCount = newCount;
+                    bestLiveCount = liveCount;
+                }
+            }
+        }
+
+        /* Nothing adjacent fits, take next triangle in index order. Put it
+           into current meshlet only if there's nothing adjacent at all (i.e.
+           a disconnected part of the mesh was finished) and it fits,
+           otherwise start a new meshlet. */
+        if(best == triangleCount) {
+            while(scan != triangleCount && emitted[scan]) ++scan;
+            if(scan == triangleCount) break;
+
+            best = scan;
+            if(adjacentFound || current.vertexCount + newVertexCount(best) > maxVertices)
+                finish();
+        }
+
+        emit(best);
+        if(current.triangleCount == maxTriangles) finish();
+    }
+
+    finish();
+    return out;
+}
+
+}}
@@ -0,0 +1,162 @@
+#ifndef Magnum_MeshTools_BuildMeshlets_h
+#define Magnum_MeshTools_BuildMeshlets_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::MeshTools::Meshlet, @ref Magnum::MeshTools::Meshlets, function @ref Magnum::MeshTools::buildMeshlets()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Meshlet
+
+Description of one cluster produced by @ref buildMeshlets(). The layout is
+tightly packed and matches `std430` layout of an equivalent GLSL structure, so
+the whole array can be uploaded into a shader storage buffer as-is:
+@code
+struct Meshlet {
+    uint vertexOffset;
+    uint vertexCount;
+    uint indexOffset;
+    uint triangleCount;
+    vec3 center;
+    float radius;
+    vec3 coneAxis;
+    float coneCutoff;
+};
+@endcode
+*/
+struct Meshlet {
+    /** @brief Offset of the first vertex in @ref Meshlets::vertices */
+    UnsignedInt vertexOffset;
+
+    /** @brief Vertex count */
+    UnsignedInt vertexCount;
+
+    /** @brief Offset of the first index in @ref Meshlets::indices */
+    UnsignedInt indexOffset;
+
+    /** @brief Triangle count */
+    UnsignedInt triangleCount;
+
+    /** @brief Center of bounding sphere */
+    Vector3 center;
+
+    /** @brief Radius of bounding sphere */
+    Float radius;
+
+    /** @brief Normalized axis of the normal cone */
+    Vector3 coneAxis;
+
+    /**
+     * @brief Cutoff of the normal cone
+     *
+     * Sine of the cone half-angle. Value of `1.0f` means that the meshlet
+     * can't be culled based on its normals.
+     */
+    Float coneCutoff;
+};
+
+/**
+@brief Meshlets
+
+Output of @ref buildMeshlets(). All arrays are flat and can be directly
+uploaded into buffers.
+*/
+struct Meshlets {
+    /** @brief Meshlet descriptions */
+    std::vector<Meshlet> meshlets;
+
+    /**
+     * @brief Vertex indices
+     *
+     * Indices into the original vertex data, for each meshlet there is
+     * @ref Meshlet::vertexCount of them starting at
+     * @ref Meshlet::vertexOffset.
+     */
+    std::vector<UnsignedInt> vertices;
+
+    /**
+     * @brief Triangle indices
+     *
+     * Local indices into meshlet vertices, for each meshlet there is
+     * @ref Meshlet::triangleCount times three of them starting at
+     * @ref Meshlet::indexOffset.
+     */
+    std::vector<UnsignedByte> indices;
+};
+
+/**
+@brief Build meshlets
+@param indices          Triangle indices
+@param positions        Vertex positions
+@param maxVertices      Max vertex count in one meshlet
+@param maxTriangles     Max triangle count in one meshlet
+
+Splits the mesh into clusters of at most @p maxVertices vertices and
+@p maxTriangles triangles for cluster-based culling. Each meshlet indexes
+its vertices with 8-bit local indices, thus @p maxVertices can't be larger
+than `256`. The defaults are suitable for common mesh shader implementations.
+
+Meshlets are grown greedily over vertex-triangle adjacency, preferring
+triangles which add the least new vertices. When no adjacent triangle fits,
+the meshlet continues with the first unprocessed triangle in index order.
+For each meshlet a bounding sphere and a cone containing normals of all its
+triangles (assuming counterclockwise winding) is calculated. The whole
+meshlet is facing away from a camera if the following holds:
+@code
+dot(center - cameraPosition, coneAxis) >= coneCutoff*length(center - cameraPosition) + radius
+@endcode
+
+Example usage, uploading the data for use in a shader:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+MeshTools::Meshlets meshlets = MeshTools::buildMeshlets(indices, positions);
+
+Buffer meshletBuffer, vertexIndexBuffer, triangleBuffer;
+meshletBuffer.setData(meshlets.meshlets, BufferUsage::StaticDraw);
+vertexIndexBuffer.setData(meshlets.vertices, BufferUsage::StaticDraw);
+triangleBuffer.setData(meshlets.indices, BufferUsage::StaticDraw);
+@endcode
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+@see @ref tipsify(), @ref optimizeOverdraw()
+*/
+Meshlets MAGNUM_MESHTOOLS_EXPORT buildMeshlets(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt maxVertices = 64, UnsignedInt maxTriangles = 124);
+
+}}
+
+#endif
@@ -25,132 +25,239 @@
 
 #include "CombineIndexedArrays.h"
 
-#include <cstring>
-#include <unordered_map>
 #include <Corrade/Utility/Assert.h>
-#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Magnum.h"
+#include "Magnum/Implementation/parallel.h"
 
 namespace Magnum { namespace MeshTools {
 
-namespace Implementation {
+namespace {
 
-std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> interleaveAndCombineIndexArrays(const std::reference_wrapper<const std::vector<UnsignedInt>>* begin, const std::reference_wrapper<const std::vector<UnsignedInt>>* end) {
-    /* Array stride and size */
-    const UnsignedInt stride = end - begin;
-    const UnsignedInt inputSize = begin->get().size();
-    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
-    for(auto it = begin; it != end; ++it)
-        CORRADE_ASSERT(it->get().size() == inputSize, "MeshTools::combineIndexArrays(): the arrays don't have the same size", {});
-    #endif
+/* View on index tuples, either in separate arrays (step is 1) or in one
+   interleaved array (pointers to first few items, step equal to stride).
+   Avoids interleaving separate arrays into a temporary copy. */
+struct IndexTuples {
+    UnsignedInt operator()(const std::size_t tuple, const UnsignedInt component) const {
+        return arrays[component][tuple*step];
+    }
 
-    /* Interleave the arrays */
-    std::vector<UnsignedInt> interleavedArrays;
-    interleavedArrays.resize(inputSize*stride);
-    for(UnsignedInt offset = 0; offset != stride; ++offset) {
-        const auto& array = (begin+offset)->get();
-        for(UnsignedInt i = 0; i != inputSize; ++i)
-            interleavedArrays[offset + i*stride] = array[i];
+    UnsignedInt hash(const std::size_t tuple) const {
+        /* Combine the components and finalize with avalanche step from
+           MurmurHash3, which is enough for index data and way cheaper than
+           hashing the bytes */
+        UnsignedInt h = 0;
+        for(UnsignedInt i = 0; i != stride; ++i)
+            h = (h ^ (*this)(tuple, i))*0x9e3779b1u;
+        h ^= h >> 16;
+        h *= 0x85ebca6bu;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35u;
+        h ^= h >> 16;
+        return h;
     }
 
-    /* Combine them */
-    std::vector<UnsignedInt> combinedIndices;
-    std::tie(combinedIndices, interleavedArrays) = MeshTools::combineIndexArrays(interleavedArrays, stride);
-    return {combinedIndices, interleavedArrays};
+    bool equal(const std::size_t a, const std::size_t b) const {
+        for(UnsignedInt i = 0; i != stride; ++i)
+            if((*this)(a, i) != (*this)(b, i)) return false;
+        return true;
+    }
+
+    const UnsignedInt* const* arrays;
+    UnsignedInt stride;
+    std::size_t step;
+};
+
+constexpr UnsignedInt EmptySlot = ~UnsignedInt{};
+
+/* Minimal count of index tuples processed by one thread, smaller meshes are
+   not worth the thread startup overhead */
+constexpr std::size_t ParallelMinTupleCount = 128*1024;
+
+/* Open-addressed hash table of tuple indices with linear probing, at most
+   two-thirds full */
+std::vector<UnsignedInt> hashTable(const std::size_t count) {
+    std::size_t capacity = 16;
+    while(capacity < count + count/2) capacity <<= 1;
+    return std::vector<UnsignedInt>(capacity, EmptySlot);
 }
 
-std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::vector<UnsignedInt>>* const begin, const std::reference_wrapper<std::vector<UnsignedInt>>* const end) {
-    /* Interleave and combine the arrays */
-    std::vector<UnsignedInt> combinedIndices;
-    std::vector<UnsignedInt> interleavedCombinedArrays;
-    std::tie(combinedIndices, interleavedCombinedArrays) = Implementation::interleaveAndCombineIndexArrays(
-        /* This will bite me hard once. */
-        reinterpret_cast<const std::reference_wrapper<const std::vector<UnsignedInt>>*>(begin),
-        reinterpret_cast<const std::reference_wrapper<const std::vector<UnsignedInt>>*>(end));
+/* Looks up the tuple in the table. If it's there, returns index of its first
+   occurrence, otherwise puts it there and returns the tuple itself. */
+inline UnsignedInt findOrInsert(std::vector<UnsignedInt>& table, const IndexTuples& tuples, const UnsignedInt tuple, const UnsignedInt hash) {
+    const std::size_t mask = table.size() - 1;
+    for(std::size_t slot = hash & mask; ; slot = (slot + 1) & mask) {
+        if(table[slot] == EmptySlot) return table[slot] = tuple;
+        if(tuples.equal(table[slot], tuple)) return table[slot];
+    }
+}
 
-    /* Update the original indices */
-    const UnsignedInt stride = end - begin;
-    const UnsignedInt outputSize = interleavedCombinedArrays.size()/stride;
-    for(UnsignedInt offset = 0; offset != stride; ++offset) {
-        auto& array = (begin+offset)->get();
-        CORRADE_INTERNAL_ASSERT(array.size() >= outputSize);
-        array.resize(outputSize);
-        for(UnsignedInt i = 0; i != outputSize; ++i)
-            array[i] = interleavedCombinedArrays[offset + i*stride];
+/* Fills the combined index array and returns first occurrence of each unique
+   tuple. Unique tuples are numbered in order of their first occurrence. */
+std::vector<UnsignedInt> combineSerial(const IndexTuples& tuples, const std::size_t count, std::vector<UnsignedInt>& combined) {
+    std::vector<UnsignedInt> table = hashTable(count);
+    std::vector<UnsignedInt> firstOccurrences;
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedInt first = findOrInsert(table, tuples, i, tuples.hash(i));
+        if(first == i) {
+            combined[i] = firstOccurrences.size();
+            firstOccurrences.push_back(i);
+        } else combined[i] = combined[first];
     }
 
-    return combinedIndices;
+    return firstOccurrences;
 }
 
+/* Same as above, but the tuples are split into partitions based on hash and
+   each partition is deduplicated by a separate thread into its own table.
+   Partition-local IDs are then renumbered in order of first occurrence so
+   the result is the same as with combineSerial(). */
+std::vector<UnsignedInt> combineParallel(const IndexTuples& tuples, const std::size_t count, const UnsignedInt threadCount, std::vector<UnsignedInt>& combined) {
+    const auto partition = [threadCount](const UnsignedInt hash) {
+        return UnsignedInt((UnsignedLong(hash)*threadCount) >> 32);
+    };
+
+    /* Calculate hashes and partition sizes in contiguous chunks */
+    std::vector<UnsignedInt> hashes(count);
+    std::vector<std::size_t> partitionSizes(threadCount*threadCount);
+    Magnum::Implementation::runInParallel(threadCount, [&](const UnsignedInt chunk) {
+        std::size_t* const sizes = partitionSizes.data() + chunk*threadCount;
+        for(std::size_t i = count*chunk/threadCount, end = count*(chunk + 1)/threadCount; i != end; ++i) {
+            hashes[i] = tuples.hash(i);
+            ++sizes[partition(hashes[i])];
+        }
+    });
+
+    /* Deduplicate each partition, each thread goes through all hashes but
+       touches only its own tuples. Combined array temporarily contains
+       partition-local IDs. */
+    std::vector<std::vector<UnsignedInt>> firstOccurrences(threadCount);
+    Magnum::Implementation::runInParallel(threadCount, [&](const UnsignedInt p) {
+        std::size_t size = 0;
+        for(UnsignedInt chunk = 0; chunk != threadCount; ++chunk)
+            size += partitionSizes[chunk*threadCount + p];
+
+        std::vector<UnsignedInt> table = hashTable(size);
+        std::vector<UnsignedInt>& partitionFirstOccurrences = firstOccurrences[p];
+        for(std::size_t i = 0; i != count; ++i) {
+            if(partition(hashes[i]) != p) continue;
+
+            const UnsignedInt first = findOrInsert(table, tuples, i, hashes[i]);
+            if(first == i) {
+                combined[i] = partitionFirstOccurrences.size();
+                partitionFirstOccurrences.push_back(i);
+            } else combined[i] = combined[first];
+        }
+    });
+
+    /* Translate the local IDs to global ones in order of first occurrence */
+    std::vector<std::vector<UnsignedInt>> globalIds(threadCount);
+    std::size_t uniqueCount = 0;
+    for(UnsignedInt p = 0; p != threadCount; ++p) {
+        globalIds[p].resize(firstOccurrences[p].size());
+        uniqueCount += firstOccurrences[p].size();
+    }
+    std::vector<UnsignedInt> out;
+    out.reserve(uniqueCount);
+    for(std::size_t i = 0; i != count; ++i) {
+        const UnsignedInt p = partition(hashes[i]);
+        const UnsignedInt local = combined[i];
+        if(firstOccurrences[p][local] == i) {
+            globalIds[p][local] = out.size();
+            out.push_back(i);
+        }
+        combined[i] = globalIds[p][local];
+    }
+
+    return out;
 }
 
-namespace {
+std::vector<UnsignedInt> combine(const IndexTuples& tuples, const std::size_t count, const UnsignedInt threadCount, std::vector<UnsignedInt>& combined) {
+    combined.resize(count);
 
-class IndexHash {
-    public:
-        explicit IndexHash(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
+    const std::size_t resolvedThreadCount = Magnum::Implementation::parallelThreadCount(count, threadCount, ParallelMinTupleCount);
+    if(resolvedThreadCount > 1)
+        return combineParallel(tuples, count, resolvedThreadCount, combined);
 
-        std::size_t operator()(UnsignedInt key) const {
-            return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(indices.data()+key*stride), sizeof(UnsignedInt)*stride).byteArray());
-        }
+    return combineSerial(tuples, count, combined);
+}
 
-    private:
-        const std::vector<UnsignedInt>& indices;
-        UnsignedInt stride;
-};
+/* Copies unique tuples into new interleaved array */
+std::vector<UnsignedInt> interleaveUnique(const IndexTuples& tuples, const std::vector<UnsignedInt>& firstOccurrences) {
+    std::vector<UnsignedInt> out(firstOccurrences.size()*tuples.stride);
+    for(std::size_t i = 0; i != firstOccurrences.size(); ++i)
+        for(UnsignedInt j = 0; j != tuples.stride; ++j)
+            out[i*tuples.stride + j] = tuples(firstOccurrences[i], j);
+    return out;
+}
 
-class IndexEqual {
-    public:
-        explicit IndexEqual(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
+}
 
-        bool operator()(UnsignedInt a, UnsignedInt b) const {
-            return std::memcmp(indices.data()+a*stride, indices.data()+b*stride, sizeof(UnsignedInt)*stride) == 0;
-        }
+namespace Implementation {
 
-    private:
-        const std::vector<UnsignedInt>& indices;
-        UnsignedInt stride;
-};
+std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> interleaveAndCombineIndexArrays(const std::reference_wrapper<const std::vector<UnsignedInt>>* begin, const std::reference_wrapper<const std::vector<UnsignedInt>>* end, const UnsignedInt threadCount) {
+    /* Array stride and size */
+    const UnsignedInt stride = end - begin;
+    const std::size_t inputSize = begin->get().size();
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(auto it = begin; it != end; ++it)
+        CORRADE_ASSERT(it->get().size() == inputSize, "MeshTools::combineIndexArrays(): the arrays don't have the same size", {});
+    #endif
+
+    /* Combine the arrays directly, interleave only the unique combinations */
+    std::vector<const UnsignedInt*> arrays;
+    arrays.reserve(stride);
+    for(auto it = begin; it != end; ++it) arrays.push_back(it->get().data());
+    const IndexTuples tuples{arrays.data(), stride, 1};
 
+    std::vector<UnsignedInt> combinedIndices;
+    const std::vector<UnsignedInt> firstOccurrences = combine(tuples, inputSize, threadCount, combinedIndices);
+    return {std::move(combinedIndices), interleaveUnique(tuples, firstOccurrences)};
 }
 
-std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, const UnsignedInt stride) {
-    CORRADE_ASSERT(stride != 0, "MeshTools::combineIndexArrays(): stride can't be zero", {});
-    CORRADE_ASSERT(interleavedArrays.size() % stride == 0, "MeshTools::combineIndexArrays(): array size is not divisible by stride", {});
+std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::vector<UnsignedInt>>* const begin, const std::reference_wrapper<std::vector<UnsignedInt>>* const end, const UnsignedInt threadCount) {
+    /* Array stride and size */
+    const UnsignedInt stride = end - begin;
+    const std::size_t inputSize = begin->get().size();
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    for(auto it = begin; it != end; ++it)
+        CORRADE_ASSERT(it->get().size() == inputSize, "MeshTools::combineIndexArrays(): the arrays don't have the same size", {});
+    #endif
+
+    std::vector<const UnsignedInt*> arrays;
+    arrays.reserve(stride);
+    for(auto it = begin; it != end; ++it) arrays.push_back(it->get().data());
 
-    /* Hash map with index combinations, containing just indices into
-       interleavedArrays vector, hashing and comparison is done using IndexHash
-       and IndexEqual functors. Reserving more buckets than necessary (i.e. as
-       if each combination was unique). */
-    std::unordered_map<UnsignedInt, UnsignedInt, IndexHash, IndexEqual> indexCombinations(
-        interleavedArrays.size()/stride,
-        IndexHash(interleavedArrays, stride),
-        IndexEqual(interleavedArrays, stride));
-
-    /* Make the index combinations unique. Original indices into original
-       `interleavedArrays` array were 0, 1, 2, 3, ..., `combinedIndices`
-       contains new ones into new (shorter) `newInterleavedArrays` array. */
     std::vector<UnsignedInt> combinedIndices;
-    combinedIndices.reserve(interleavedArrays.size()/stride);
-    std::vector<UnsignedInt> newInterleavedArrays;
-    for(std::size_t oldIndex = 0, end = interleavedArrays.size()/stride; oldIndex != end; ++oldIndex) {
-        /* Try to insert new index combination to the map */
-        const auto result = indexCombinations.emplace(oldIndex, indexCombinations.size());
-
-        /* Add the (either new or already existing) index to resulting index array */
-        combinedIndices.push_back(result.first->second);
-
-        /* If this is new combination, copy it to new interleaved arrays */
-        if(result.second) newInterleavedArrays.insert(newInterleavedArrays.end(),
-            interleavedArrays.begin()+oldIndex*stride,
-            interleavedArrays.begin()+(oldIndex+1)*stride);
+    const std::vector<UnsignedInt> firstOccurrences = combine({arrays.data(), stride, 1}, inputSize, threadCount, combinedIndices);
+
+    /* Update the original indices in place. First occurrences are increasing
+       and never before their new position, so nothing gets overwritten
+       before being read. */
+    for(auto it = begin; it != end; ++it) {
+        std::vector<UnsignedInt>& array = it->get();
+        for(std::size_t i = 0; i != firstOccurrences.size(); ++i)
+            array[i] = array[firstOccurrences[i]];
+        array.resize(firstOccurrences.size());
     }
 
-    CORRADE_INTERNAL_ASSERT(combinedIndices.size() == interleavedArrays.size()/stride &&
-                            newInterleavedArrays.size() <= interleavedArrays.size());
+    return combinedIndices;
+}
 
-    return {std::move(combinedIndices), std::move(newInterleavedArrays)};
+}
+
+std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, const UnsignedInt stride, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(stride != 0, "MeshTools::combineIndexArrays(): stride can't be zero", {});
+    CORRADE_ASSERT(interleavedArrays.size() % stride == 0, "MeshTools::combineIndexArrays(): array size is not divisible by stride", {});
+
+    std::vector<const UnsignedInt*> arrays;
+    arrays.reserve(stride);
+    for(UnsignedInt i = 0; i != stride; ++i) arrays.push_back(interleavedArrays.data() + i);
+    const IndexTuples tuples{arrays.data(), stride, stride};
+
+    std::vector<UnsignedInt> combinedIndices;
+    const std::vector<UnsignedInt> firstOccurrences = combine(tuples, interleavedArrays.size()/stride, threadCount, combinedIndices);
+    return {std::move(combinedIndices), interleaveUnique(tuples, firstOccurrences)};
 }
 
 }}
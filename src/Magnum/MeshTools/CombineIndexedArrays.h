@@ -40,7 +40,7 @@
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
-    MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::vector<UnsignedInt>>* begin, const std::reference_wrapper<std::vector<UnsignedInt>>* end);
+    MAGNUM_MESHTOOLS_EXPORT std::vector<UnsignedInt> combineIndexArrays(const std::reference_wrapper<std::vector<UnsignedInt>>* begin, const std::reference_wrapper<std::vector<UnsignedInt>>* end, UnsignedInt threadCount);
 }
 
 /**
@@ -78,17 +78,24 @@ which can be then indexed with the combined index array:
 Again, first triangle in the mesh will have positions `a c f` and normals
 `B D E`.
 
-This function calls @ref combineIndexArrays(const std::vector<UnsignedInt>&, UnsignedInt)
-internally. See also @ref combineIndexedArrays() which does the vertex data
-reordering automatically.
+The combinations are deduplicated using an open-addressed hash table directly
+on the original arrays, without interleaving them first. If @p threadCount is
+larger than `1`, index combinations are split into partitions by their hash
+and each partition is deduplicated in a separate thread. Value of `0` means
+thread count reported by `std::thread::hardware_concurrency()`. Small arrays
+are always processed serially and the result is the same as with serial
+processing. On platforms without thread support the value is ignored.
+
+See also @ref combineIndexedArrays() which does the vertex data reordering
+automatically.
 */
-inline std::vector<UnsignedInt> combineIndexArrays(const std::vector<std::reference_wrapper<std::vector<UnsignedInt>>>& arrays) {
-    return Implementation::combineIndexArrays(&arrays[0], &arrays[0] + arrays.size());
+inline std::vector<UnsignedInt> combineIndexArrays(const std::vector<std::reference_wrapper<std::vector<UnsignedInt>>>& arrays, UnsignedInt threadCount = 1) {
+    return Implementation::combineIndexArrays(&arrays[0], &arrays[0] + arrays.size(), threadCount);
 }
 
 /** @overload */
-inline std::vector<UnsignedInt> combineIndexArrays(std::initializer_list<std::reference_wrapper<std::vector<UnsignedInt>>> arrays) {
-    return Implementation::combineIndexArrays(arrays.begin(), arrays.end());
+inline std::vector<UnsignedInt> combineIndexArrays(std::initializer_list<std::reference_wrapper<std::vector<UnsignedInt>>> arrays, UnsignedInt threadCount = 1) {
+    return Implementation::combineIndexArrays(arrays.begin(), arrays.end(), threadCount);
 }
 
 /**
@@ -110,13 +117,14 @@ And second pair value is the cleaned up interleaved array:
 
     0 1 2 3 5 4 0 4 1 6 3 1 2 1
 
+See above for description of @p threadCount.
 @see @ref combineIndexedArrays()
 */
-MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, UnsignedInt stride);
+MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> combineIndexArrays(const std::vector<UnsignedInt>& interleavedArrays, UnsignedInt stride, UnsignedInt threadCount = 1);
 
 namespace Implementation {
 
-MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> interleaveAndCombineIndexArrays(const std::reference_wrapper<const std::vector<UnsignedInt>>* begin, const std::reference_wrapper<const std::vector<UnsignedInt>>* end);
+MAGNUM_MESHTOOLS_EXPORT std::pair<std::vector<UnsignedInt>, std::vector<UnsignedInt>> interleaveAndCombineIndexArrays(const std::reference_wrapper<const std::vector<UnsignedInt>>* begin, const std::reference_wrapper<const std::vector<UnsignedInt>>* end, UnsignedInt threadCount = 1);
 
 template<class T> void writeCombinedArray(const UnsignedInt stride, const UnsignedInt offset, const std::vector<UnsignedInt>& interleavedCombinedIndexArrays, std::vector<T>& array) {
     /* Can't use duplicate() here because we aren't accessing the index data sequentially */
@@ -139,6 +147,19 @@ template<class T, class ...U> inline void writeCombinedArrays(UnsignedInt stride
     writeCombinedArrays(stride, offset + 1, interleavedCombinedIndexArrays, next...);
 }
 
+template<class ...T> std::vector<UnsignedInt> combineIndexedArrays(const UnsignedInt threadCount, const std::pair<const std::vector<UnsignedInt>&, std::vector<T>&>&... indexedArrays) {
+    /* Interleave and combine index arrays */
+    std::vector<UnsignedInt> combinedIndices;
+    std::vector<UnsignedInt> interleavedCombinedIndexArrays;
+    auto i = {std::ref(indexedArrays.first)...};
+    std::tie(combinedIndices, interleavedCombinedIndexArrays) = interleaveAndCombineIndexArrays(i.begin(), i.end(), threadCount);
+
+    /* Write combined arrays */
+    writeCombinedArrays(sizeof...(T), 0, interleavedCombinedIndexArrays, indexedArrays.second...);
+
+    return combinedIndices;
+}
+
 }
 
 /**
@@ -169,24 +190,31 @@ std::vector<UnsignedInt> indices = MeshTools::combineIndexedArrays(
 @endcode
 
 See @ref combineIndexArrays() documentation for more information about the
-procedure.
+procedure. The combination is done serially, use
+@ref combineIndexedArrays(UnsignedInt, const std::pair<const std::vector<UnsignedInt>&, std::vector<T>&>&...)
+to process large meshes in parallel.
 @todo Invent a way which avoids these overly verbose parameters (`std::pair`
     doesn't help)
 */
 /* Implementation note: It's done using tuples because it is more clear which
    parameter is index array and which is attribute array, mainly when both are
    of the same type. */
-template<class ...T> std::vector<UnsignedInt> combineIndexedArrays(const std::pair<const std::vector<UnsignedInt>&, std::vector<T>&>&... indexedArrays) {
-    /* Interleave and combine index arrays */
-    std::vector<UnsignedInt> combinedIndices;
-    std::vector<UnsignedInt> interleavedCombinedIndexArrays;
-    auto i = {std::ref(indexedArrays.first)...};
-    std::tie(combinedIndices, interleavedCombinedIndexArrays) = Implementation::interleaveAndCombineIndexArrays(i.begin(), i.end());
+template<class ...T> inline std::vector<UnsignedInt> combineIndexedArrays(const std::pair<const std::vector<UnsignedInt>&, std::vector<T>&>&... indexedArrays) {
+    return Implementation::combineIndexedArrays(1, indexedArrays...);
+}
 
-    /* Write combined arrays */
-    Implementation::writeCombinedArrays(sizeof...(T), 0, interleavedCombinedIndexArrays, indexedArrays.second...);
+/**
+@brief Combine indexed arrays using given thread count
+@param[in] threadCount          Thread count
+@param[in,out] indexedArrays    Index and attribute arrays
+@return Array with resulting indices
 
-    return combinedIndices;
+Same as @ref combineIndexedArrays(const std::pair<const std::vector<UnsignedInt>&, std::vector<T>&>&...),
+but the index combinations are deduplicated using given count of threads. See
+@ref combineIndexArrays() for description of @p threadCount.
+*/
+template<class ...T> inline std::vector<UnsignedInt> combineIndexedArrays(const UnsignedInt threadCount, const std::pair<const std::vector<UnsignedInt>&, std::vector<T>&>&... indexedArrays) {
+    return Implementation::combineIndexedArrays(threadCount, indexedArrays...);
 }
 
 }}
@@ -26,9 +26,10 @@
 #include "Compile.h"
 
 #include "Magnum/Buffer.h"
-#include "Magnum/Math/Vector3.h"
+#include "Magnum/Math/Color.h"
 #include "Magnum/MeshTools/CompressIndices.h"
 #include "Magnum/MeshTools/Interleave.h"
+#include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/MeshData2D.h"
 #include "Magnum/Trade/MeshData3D.h"
 
@@ -165,4 +166,68 @@ std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const
     return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer));
 }
 
+namespace {
+
+template<class T> void bindAttribute(Mesh& mesh, Buffer& buffer, const Trade::MeshAttributeData& attribute, const T& type) {
+    mesh.addVertexBuffer(buffer, attribute.offset(), type,
+        attribute.stride() - sizeof(typename T::Type));
+}
+
+}
+
+std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData& meshData, const BufferUsage usage) {
+    Mesh mesh;
+    mesh.setPrimitive(meshData.primitive());
+
+    /* Upload the vertex data as-is */
+    std::unique_ptr<Buffer> vertexBuffer{new Buffer{Buffer::TargetHint::Array}};
+    vertexBuffer->setData(meshData.vertexData(), usage);
+
+    /* Bind the first attribute of each known name directly at its offset and
+       stride, the rest (including custom attributes) is up to the user */
+    bool bound[UnsignedShort(Trade::MeshAttribute::Color) + 1]{};
+    for(UnsignedInt i = 0; i != meshData.attributeCount(); ++i) {
+        const Trade::MeshAttributeData& attribute = meshData.attributeData(i);
+        if(attribute.name() > Trade::MeshAttribute::Color || bound[UnsignedShort(attribute.name())])
+            continue;
+
+        if(attribute.name() == Trade::MeshAttribute::Position && attribute.format() == Trade::MeshAttributeFormat::Vector3)
+            bindAttribute(mesh, *vertexBuffer, attribute, Shaders::Generic3D::Position{});
+        else if(attribute.name() == Trade::MeshAttribute::Position && attribute.format() == Trade::MeshAttributeFormat::Vector2)
+            bindAttribute(mesh, *vertexBuffer, attribute, Shaders::Generic2D::Position{});
+        else if(attribute.name() == Trade::MeshAttribute::Normal && attribute.format() == Trade::MeshAttributeFormat::Vector3)
+            bindAttribute(mesh, *vertexBuffer, attribute, Shaders::Generic3D::Normal{});
+        else if(attribute.name() == Trade::MeshAttribute::TextureCoordinates && attribute.format() == Trade::MeshAttributeFormat::Vector2)
+            bindAttribute(mesh, *vertexBuffer, attribute, Shaders::Generic3D::TextureCoordinates{});
+        else if(attribute.name() == Trade::MeshAttribute::Color && attribute.format() == Trade::MeshAttributeFormat::Vector3)
+            bindAttribute(mesh, *vertexBuffer, attribute, Shaders::Generic3D::Color{});
+        else if(attribute.name() == Trade::MeshAttribute::Color && attribute.format() == Trade::MeshAttributeFormat::Vector4)
+            bindAttribute(mesh, *vertexBuffer, attribute, Attribute<Shaders::Generic3D::Color::Location, Color4>{});
+        else {
+            Warning() << "MeshTools::compile(): ignoring" << attribute.name() << "attribute of format" << attribute.format();
+            continue;
+        }
+
+        bound[UnsignedShort(attribute.name())] = true;
+    }
+
+    /* If indexed, upload the index data as-is as well. All indices are
+       expected to be in range of the vertex data, so that's the index range
+       passed to the mesh. */
+    std::unique_ptr<Buffer> indexBuffer;
+    if(meshData.isIndexed()) {
+        indexBuffer.reset(new Buffer{Buffer::TargetHint::ElementArray});
+        indexBuffer->setData(meshData.indexData(), usage);
+        mesh.setCount(meshData.indexCount());
+        if(meshData.vertexCount())
+            mesh.setIndexBuffer(*indexBuffer, 0, meshData.indexType(), 0, meshData.vertexCount() - 1);
+        else
+            mesh.setIndexBuffer(*indexBuffer, 0, meshData.indexType());
+
+    /* Else set vertex count */
+    } else mesh.setCount(meshData.vertexCount());
+
+    return std::make_tuple(std::move(mesh), std::move(vertexBuffer), std::move(indexBuffer));
+}
+
 }}
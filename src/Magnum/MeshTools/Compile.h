@@ -80,6 +80,25 @@ greater flexibility.
 */
 MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData3D& meshData, BufferUsage usage);
 
+/**
+@brief Compile generic mesh data
+
+Unlike @ref compile(const Trade::MeshData3D&, BufferUsage), the vertex and
+index data are uploaded as-is, without any interleaving or index packing, and
+the attributes are bound directly at their offsets and strides. The first
+position, normal, texture coordinate and color attribute is bound to the
+corresponding @ref Shaders::Generic3D attribute (or @ref Shaders::Generic2D
+one, if the positions are two-dimensional), four-component colors are bound as
+@ref Color4. Other attributes, including @ref Trade::MeshAttribute::Custom
+ones, are left for the user to bind from the returned vertex buffer. The
+@p usage parameter is used for both vertex and index buffer.
+
+The second returned buffer may be `nullptr` if the mesh is not indexed.
+
+@see @ref shaders-generic
+*/
+MAGNUM_MESHTOOLS_EXPORT std::tuple<Mesh, std::unique_ptr<Buffer>, std::unique_ptr<Buffer>> compile(const Trade::MeshData& meshData, BufferUsage usage);
+
 }}
 
 #endif
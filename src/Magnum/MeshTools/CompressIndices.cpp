@@ -25,70 +25,184 @@
 
 #include "CompressIndices.h"
 
-#include <cstring>
 #include <algorithm>
+#include <cstring>
+#include <limits>
 #include <Corrade/Containers/Array.h>
 
 #include "Magnum/Math/Functions.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAGNUM_MESHTOOLS_COMPRESS_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace Magnum { namespace MeshTools {
 
 namespace {
 
-template<class T> inline Containers::Array<char> compress(const std::vector<UnsignedInt>& indices) {
-    Containers::Array<char> buffer(indices.size()*sizeof(T));
-    for(std::size_t i = 0; i != indices.size(); ++i) {
-        T index = static_cast<T>(indices[i]);
-        std::memcpy(buffer.begin()+i*sizeof(T), &index, sizeof(T));
+#ifdef MAGNUM_MESHTOOLS_COMPRESS_SSE2
+/* SSE2 has only signed 32-bit comparison, flipping the highest bit makes it
+   work for unsigned values */
+inline __m128i flipSign(const __m128i a) {
+    return _mm_xor_si128(a, _mm_set1_epi32(-2147483647 - 1));
+}
+
+inline __m128i select(const __m128i mask, const __m128i a, const __m128i b) {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+#endif
+
+std::pair<UnsignedInt, UnsignedInt> minmax(const Containers::ArrayView<const UnsignedInt> indices) {
+    if(indices.empty()) return {0, 0};
+
+    UnsignedInt min = indices[0], max = indices[0];
+    std::size_t i = 0;
+
+    #ifdef MAGNUM_MESHTOOLS_COMPRESS_SSE2
+    if(indices.size() >= 4) {
+        __m128i vmin = flipSign(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indices.data())));
+        __m128i vmax = vmin;
+        for(i = 4; i + 4 <= indices.size(); i += 4) {
+            const __m128i v = flipSign(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indices.data() + i)));
+            vmin = select(_mm_cmplt_epi32(v, vmin), v, vmin);
+            vmax = select(_mm_cmpgt_epi32(v, vmax), v, vmax);
+        }
+
+        UnsignedInt mins[4], maxs[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(mins), flipSign(vmin));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(maxs), flipSign(vmax));
+        for(std::size_t j = 0; j != 4; ++j) {
+            min = std::min(min, mins[j]);
+            max = std::max(max, maxs[j]);
+        }
     }
+    #endif
 
-    return buffer;
+    for(; i != indices.size(); ++i) {
+        min = std::min(min, indices[i]);
+        max = std::max(max, indices[i]);
+    }
+
+    return {min, max};
 }
 
+/* Writes indices minus base to output of given type, starting at given
+   offset. The values are expected to fit. */
+template<class T> void narrowScalar(const Containers::ArrayView<const UnsignedInt> indices, const UnsignedInt base, T* const out, std::size_t i) {
+    for(; i != indices.size(); ++i)
+        out[i] = T(indices[i] - base);
 }
 
-std::tuple<Containers::Array<char>, Mesh::IndexType, UnsignedInt, UnsignedInt> compressIndices(const std::vector<UnsignedInt>& indices) {
-    /** @todo Performance hint when range can be represented by smaller value? */
-    const auto minmax = std::minmax_element(indices.begin(), indices.end());
-    Containers::Array<char> data;
-    Mesh::IndexType type;
-    switch(Math::log(256, *minmax.second)) {
+template<class T> void narrow(const Containers::ArrayView<const UnsignedInt> indices, const UnsignedInt base, T* const out) {
+    narrowScalar(indices, base, out, 0);
+}
+
+#ifdef MAGNUM_MESHTOOLS_COMPRESS_SSE2
+/* Sixteen values at once, the values fit into 8 bits so neither the signed
+   32-to-16-bit nor unsigned 16-to-8-bit saturation changes them */
+template<> void narrow(const Containers::ArrayView<const UnsignedInt> indices, const UnsignedInt base, UnsignedByte* const out) {
+    const __m128i vbase = _mm_set1_epi32(base);
+    const auto load = [&indices, &vbase](const std::size_t i) {
+        return _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indices.data() + i)), vbase);
+    };
+
+    std::size_t i = 0;
+    for(; i + 16 <= indices.size(); i += 16) {
+        const __m128i a = _mm_packs_epi32(load(i), load(i + 4));
+        const __m128i b = _mm_packs_epi32(load(i + 8), load(i + 12));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(a, b));
+    }
+
+    narrowScalar(indices, base, out, i);
+}
+
+/* Eight values at once. SSE2 has only signed 32-to-16-bit saturation, so the
+   values are shifted to signed range before packing and back after. */
+template<> void narrow(const Containers::ArrayView<const UnsignedInt> indices, const UnsignedInt base, UnsignedShort* const out) {
+    const __m128i vbase = _mm_set1_epi32(base + 32768);
+    const auto load = [&indices, &vbase](const std::size_t i) {
+        return _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indices.data() + i)), vbase);
+    };
+
+    std::size_t i = 0;
+    for(; i + 8 <= indices.size(); i += 8) {
+        const __m128i packed = _mm_packs_epi32(load(i), load(i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(packed, _mm_set1_epi16(-32768)));
+    }
+
+    narrowScalar(indices, base, out, i);
+}
+#endif
+
+/* No narrowing, just rebasing */
+template<> void narrow(const Containers::ArrayView<const UnsignedInt> indices, const UnsignedInt base, UnsignedInt* const out) {
+    if(!base) {
+        std::memcpy(out, indices.data(), indices.size()*sizeof(UnsignedInt));
+        return;
+    }
+
+    std::size_t i = 0;
+    #ifdef MAGNUM_MESHTOOLS_COMPRESS_SSE2
+    const __m128i vbase = _mm_set1_epi32(base);
+    for(; i + 4 <= indices.size(); i += 4)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_sub_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indices.data() + i)), vbase));
+    #endif
+    narrowScalar(indices, base, out, i);
+}
+
+template<class T> inline Containers::Array<char> compress(const Containers::ArrayView<const UnsignedInt> indices, const UnsignedInt base) {
+    Containers::Array<char> buffer(indices.size()*sizeof(T));
+    narrow<T>(indices, base, reinterpret_cast<T*>(buffer.data()));
+    return buffer;
+}
+
+std::pair<Containers::Array<char>, Mesh::IndexType> compress(const Containers::ArrayView<const UnsignedInt> indices, const UnsignedInt base, const UnsignedInt max) {
+    switch(Math::log(256, max)) {
         case 0:
-            data = compress<UnsignedByte>(indices);
-            type = Mesh::IndexType::UnsignedByte;
-            break;
+            return {compress<UnsignedByte>(indices, base), Mesh::IndexType::UnsignedByte};
         case 1:
-            data = compress<UnsignedShort>(indices);
-            type = Mesh::IndexType::UnsignedShort;
-            break;
-        case 2:
-        case 3:
-            data = compress<UnsignedInt>(indices);
-            type = Mesh::IndexType::UnsignedInt;
-            break;
-
+            return {compress<UnsignedShort>(indices, base), Mesh::IndexType::UnsignedShort};
         default:
-            CORRADE_ASSERT(false, "MeshTools::compressIndices(): no type able to index" << *minmax.second << "elements.", {});
+            return {compress<UnsignedInt>(indices, base), Mesh::IndexType::UnsignedInt};
     }
+}
 
-    return std::make_tuple(std::move(data), type, *minmax.first, *minmax.second);
 }
 
-template<class T> Containers::Array<T> compressIndicesAs(const std::vector<UnsignedInt>& indices) {
+std::tuple<Containers::Array<char>, Mesh::IndexType, UnsignedInt, UnsignedInt> compressIndices(const Containers::ArrayView<const UnsignedInt> indices) {
+    const std::pair<UnsignedInt, UnsignedInt> range = minmax(indices);
+    Containers::Array<char> data;
+    Mesh::IndexType type;
+    std::tie(data, type) = compress(indices, 0, range.second);
+    return std::make_tuple(std::move(data), type, range.first, range.second);
+}
+
+std::tuple<Containers::Array<char>, Mesh::IndexType, Int, UnsignedInt> compressIndicesWithBaseVertex(const Containers::ArrayView<const UnsignedInt> indices) {
+    const std::pair<UnsignedInt, UnsignedInt> range = minmax(indices);
+
+    /* Mesh::setBaseVertex() takes a signed value */
+    const UnsignedInt baseVertex = std::min(range.first, UnsignedInt(std::numeric_limits<Int>::max()));
+
+    Containers::Array<char> data;
+    Mesh::IndexType type;
+    std::tie(data, type) = compress(indices, baseVertex, range.second - baseVertex);
+    return std::make_tuple(std::move(data), type, Int(baseVertex), range.second - baseVertex);
+}
+
+template<class T> Containers::Array<T> compressIndicesAs(const Containers::ArrayView<const UnsignedInt> indices) {
     #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
-    const auto max = std::max_element(indices.begin(), indices.end());
-    CORRADE_ASSERT(Math::log(256, *max) < sizeof(T), "MeshTools::compressIndicesAs(): type too small to represent value" << *max, {});
+    const UnsignedInt max = minmax(indices).second;
+    CORRADE_ASSERT(Math::log(256, max) < sizeof(T), "MeshTools::compressIndicesAs(): type too small to represent value" << max, {});
     #endif
 
     Containers::Array<T> buffer(indices.size());
-    for(std::size_t i = 0; i != indices.size(); ++i)
-        buffer[i] = T(indices[i]);
-
+    narrow<T>(indices, 0, buffer.data());
     return buffer;
 }
 
-template Containers::Array<UnsignedByte> compressIndicesAs(const std::vector<UnsignedInt>& indices);
-template Containers::Array<UnsignedShort> compressIndicesAs(const std::vector<UnsignedInt>& indices);
-template Containers::Array<UnsignedInt> compressIndicesAs(const std::vector<UnsignedInt>& indices);
+template Containers::Array<UnsignedByte> compressIndicesAs(Containers::ArrayView<const UnsignedInt>);
+template Containers::Array<UnsignedShort> compressIndicesAs(Containers::ArrayView<const UnsignedInt>);
+template Containers::Array<UnsignedInt> compressIndicesAs(Containers::ArrayView<const UnsignedInt>);
 
 }}
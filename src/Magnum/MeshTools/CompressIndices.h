@@ -26,10 +26,12 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::compressIndices()
+ * @brief Function @ref Magnum::MeshTools::compressIndices(), @ref Magnum::MeshTools::compressIndicesWithBaseVertex(), @ref Magnum::MeshTools::compressIndicesAs()
  */
 
 #include <tuple>
+#include <vector>
+#include <Corrade/Containers/Array.h>
 
 #include "Magnum/Mesh.h"
 #include "Magnum/MeshTools/visibility.h"
@@ -39,12 +41,16 @@ namespace Magnum { namespace MeshTools {
 /**
 @brief Compress vertex indices
 @param indices  Index array
-@return Index range, type and compressed index array
+@return Compressed index array, type and index range
 
 This function takes index array and outputs them compressed to smallest
 possible size. For example when your indices have maximum number 463, it's
 wasteful to store them in array of 32bit integers, array of 16bit integers is
-sufficient.
+sufficient. The type is chosen based on the maximal index, see
+@ref compressIndicesWithBaseVertex() for a variant which takes the whole
+index range into account. On SSE2-capable platforms the range calculation and
+narrowing is done on multiple values at once. Empty array is compressed to an
+empty array of @ref Mesh::IndexType::UnsignedByte with zero range.
 
 Example usage:
 @code
@@ -66,7 +72,57 @@ mesh.setCount(indices.size())
 @see @ref compressIndicesAs()
 @todo Extract IndexType out of Mesh class
 */
-std::tuple<Containers::Array<char>, Mesh::IndexType, UnsignedInt, UnsignedInt> MAGNUM_MESHTOOLS_EXPORT compressIndices(const std::vector<UnsignedInt>& indices);
+std::tuple<Containers::Array<char>, Mesh::IndexType, UnsignedInt, UnsignedInt> MAGNUM_MESHTOOLS_EXPORT compressIndices(Containers::ArrayView<const UnsignedInt> indices);
+
+/** @overload */
+inline std::tuple<Containers::Array<char>, Mesh::IndexType, UnsignedInt, UnsignedInt> compressIndices(const std::vector<UnsignedInt>& indices) {
+    return compressIndices(Containers::ArrayView<const UnsignedInt>{indices.data(), indices.size()});
+}
+
+/**
+@brief Compress vertex indices relative to base vertex
+@param indices  Index array
+@return Compressed index array, type, base vertex and index range end
+
+Similar to @ref compressIndices(), but the minimal index is subtracted from
+all indices before compressing them, so the type is chosen based on the index
+range and not the maximal value. For example indices in range @f$ [ 70000, 70200 ] @f$
+are compressed to 8-bit values instead of 32-bit ones. The minimal index is
+returned as base vertex, index range of the compressed data starts at `0`.
+Because @ref Mesh::setBaseVertex() takes a signed value, the base vertex is
+clamped to `0x7fffffff`, indices larger than that are kept relative to
+it.
+
+Example usage:
+@code
+std::vector<UnsignedInt> indices;
+
+Containers::Array<char> indexData;
+Mesh::IndexType indexType;
+Int baseVertex;
+UnsignedInt indexEnd;
+std::tie(indexData, indexType, baseVertex, indexEnd) = MeshTools::compressIndicesWithBaseVertex(indices);
+
+Buffer indexBuffer;
+indexBuffer.setData(indexData, BufferUsage::StaticDraw);
+
+Mesh mesh;
+mesh.setCount(indices.size())
+    .setBaseVertex(baseVertex)
+    .setIndexBuffer(indexBuffer, 0, indexType, 0, indexEnd);
+@endcode
+
+Note that base vertex for indexed meshes requires OpenGL 3.2 or
+@extension{ARB,draw_elements_base_vertex} and is not available in OpenGL ES
+or WebGL, see @ref Mesh::setBaseVertex() for more information. There you can
+add the base vertex to offset of all vertex attributes instead.
+*/
+std::tuple<Containers::Array<char>, Mesh::IndexType, Int, UnsignedInt> MAGNUM_MESHTOOLS_EXPORT compressIndicesWithBaseVertex(Containers::ArrayView<const UnsignedInt> indices);
+
+/** @overload */
+inline std::tuple<Containers::Array<char>, Mesh::IndexType, Int, UnsignedInt> compressIndicesWithBaseVertex(const std::vector<UnsignedInt>& indices) {
+    return compressIndicesWithBaseVertex(Containers::ArrayView<const UnsignedInt>{indices.data(), indices.size()});
+}
 
 /**
 @brief Compress vertex indices as given type
@@ -83,12 +139,17 @@ Containers::Array<UnsignedShort> indexData = MeshTools::compressIndicesAs<Unsign
 
 @see @ref compressIndices()
 */
-template<class T> MAGNUM_MESHTOOLS_EXPORT Containers::Array<T> compressIndicesAs(const std::vector<UnsignedInt>& indices);
+template<class T> MAGNUM_MESHTOOLS_EXPORT Containers::Array<T> compressIndicesAs(Containers::ArrayView<const UnsignedInt> indices);
+
+/** @overload */
+template<class T> inline Containers::Array<T> compressIndicesAs(const std::vector<UnsignedInt>& indices) {
+    return compressIndicesAs<T>(Containers::ArrayView<const UnsignedInt>{indices.data(), indices.size()});
+}
 
 #if defined(CORRADE_TARGET_WINDOWS) && !defined(__MINGW32__)
-extern template MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedByte> compressIndicesAs<UnsignedByte>(const std::vector<UnsignedInt>& indices);
-extern template MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedShort> compressIndicesAs<UnsignedShort>(const std::vector<UnsignedInt>& indices);
-extern template MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> compressIndicesAs<UnsignedInt>(const std::vector<UnsignedInt>& indices);
+extern template MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedByte> compressIndicesAs<UnsignedByte>(Containers::ArrayView<const UnsignedInt>);
+extern template MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedShort> compressIndicesAs<UnsignedShort>(Containers::ArrayView<const UnsignedInt>);
+extern template MAGNUM_MESHTOOLS_EXPORT Containers::Array<UnsignedInt> compressIndicesAs<UnsignedInt>(Containers::ArrayView<const UnsignedInt>);
 #endif
 
 }}
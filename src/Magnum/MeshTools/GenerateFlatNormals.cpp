@@ -25,29 +25,54 @@
 
 #include "GenerateFlatNormals.h"
 
+#include "Magnum/Implementation/parallel.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 
 namespace Magnum { namespace MeshTools {
 
+namespace {
+
+void generateFlatNormalsRange(const UnsignedInt* const indices, const Vector3* const positions, Vector3* const normals, const std::size_t begin, const std::size_t end) {
+    /* Assuming counterclockwise winding */
+    for(std::size_t i = begin; i != end; ++i) {
+        const Vector3 normal = Math::cross(positions[indices[3*i + 2]] - positions[indices[3*i + 1]],
+                                           positions[indices[3*i]] - positions[indices[3*i + 1]]);
+
+        /* Degenerate faces get a zero normal instead of NaNs */
+        const Float length = normal.length();
+        normals[i] = length == 0.0f ? Vector3{} : normal/length;
+    }
+}
+
+}
+
+void generateFlatNormalsInto(const Containers::ArrayView<const UnsignedInt> indices, const Containers::ArrayView<const Vector3> positions, const Containers::ArrayView<Vector3> normals, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateFlatNormalsInto(): index count is not divisible by 3!", );
+    CORRADE_ASSERT(normals.size() == indices.size()/3,
+        "MeshTools::generateFlatNormalsInto(): expected" << indices.size()/3 << "normals but got" << normals.size(), );
+
+    const std::size_t count = normals.size();
+    Magnum::Implementation::forEachRange(count, Magnum::Implementation::parallelThreadCount(count, threadCount), [&](const std::size_t begin, const std::size_t end) {
+        generateFlatNormalsRange(indices, positions, normals, begin, end);
+    });
+}
+
 std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateFlatNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions) {
     CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateFlatNormals(): index count is not divisible by 3!", (std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>>()));
 
-    /* Create normal for every triangle (assuming counterclockwise winding) */
+    /* Create normal for every triangle */
+    std::vector<Vector3> normals(indices.size()/3);
+    generateFlatNormalsInto({indices.data(), indices.size()}, {positions.data(), positions.size()}, {normals.data(), normals.size()});
+
+    /* Use the same normal for all three vertices of the face */
     std::vector<UnsignedInt> normalIndices;
     normalIndices.reserve(indices.size());
-    std::vector<Vector3> normals;
-    normals.reserve(indices.size()/3);
-    for(std::size_t i = 0; i != indices.size(); i += 3) {
-        const Vector3 normal = Math::cross(positions[indices[i+2]]-positions[indices[i+1]],
-                                           positions[indices[i]]-positions[indices[i+1]]).normalized();
-
-        /* Use the same normal for all three vertices of the face */
-        normalIndices.push_back(normals.size());
-        normalIndices.push_back(normals.size());
-        normalIndices.push_back(normals.size());
-        normals.push_back(normal);
+    for(UnsignedInt i = 0; i != normals.size(); ++i) {
+        normalIndices.push_back(i);
+        normalIndices.push_back(i);
+        normalIndices.push_back(i);
     }
 
     /* Remove duplicate normals and return */
@@ -26,11 +26,12 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::generateFlatNormals()
+ * @brief Function @ref Magnum::MeshTools::generateFlatNormals(), @ref Magnum::MeshTools::generateFlatNormalsInto()
  */
 
 #include <tuple>
 #include <vector>
+#include <Corrade/Containers/ArrayView.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/MeshTools/visibility.h"
@@ -54,13 +55,32 @@ std::vector<Vector3> normals;
 std::tie(normalIndices, normals) = MeshTools::generateFlatNormals(vertexIndices, positions);
 @endcode
 You can then use @ref combineIndexedArrays() to combine normal and vertex array
-to use the same indices.
+to use the same indices. If you don't need the duplicates removed, use
+@ref generateFlatNormalsInto() instead, which is faster and doesn't allocate.
 
 @attention The function requires the mesh to have triangle faces, thus index
     count must be divisible by 3.
 */
 std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateFlatNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions);
 
+/**
+@brief Generate flat normals into existing array
+@param indices      Array of triangle face indices
+@param positions    Array of vertex positions
+@param normals      Where to put the normals, one for each face
+@param threadCount  Thread count
+
+Calculates normalized normal of each face, assuming counterclockwise winding.
+The i-th normal belongs to face consisting of indices `3*i` to `3*i + 2`, thus
+@p normals is expected to have exactly one third of @p indices size. Normals
+of degenerate faces are zero. If @p threadCount is other than `1`, large
+meshes are split into contiguous chunks processed in parallel, value of `0`
+means thread count reported by `std::thread::hardware_concurrency()`. On
+platforms without thread support the value is ignored.
+@see @ref generateSmoothNormalsInto()
+*/
+void MAGNUM_MESHTOOLS_EXPORT generateFlatNormalsInto(Containers::ArrayView<const UnsignedInt> indices, Containers::ArrayView<const Vector3> positions, Containers::ArrayView<Vector3> normals, UnsignedInt threadCount = 1);
+
 }}
 
 #endif
@@ -0,0 +1,203 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "GenerateSmoothNormals.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Implementation/parallel.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+Vector3 normalizedOrZero(const Vector3& vector) {
+    const Float length = vector.length();
+    return length == 0.0f ? Vector3{} : vector/length;
+}
+
+/* Contribution of given face to normals of its three corners. The cross
+   product length is twice the face area, which gives the area weighting, and
+   it's also the sine part of the angle at each corner. Returns the normalized
+   face normal. */
+Vector3 faceContributions(const UnsignedInt* const indices, const Vector3* const positions, const std::size_t face, Vector3(&contributions)[3]) {
+    const Vector3& a = positions[indices[3*face]];
+    const Vector3& b = positions[indices[3*face + 1]];
+    const Vector3& c = positions[indices[3*face + 2]];
+
+    /* Assuming counterclockwise winding */
+    const Vector3 normal = Math::cross(b - a, c - a);
+    const Float doubleArea = normal.length();
+    contributions[0] = normal*std::atan2(doubleArea, Math::dot(b - a, c - a));
+    contributions[1] = normal*std::atan2(doubleArea, Math::dot(c - b, a - b));
+    contributions[2] = normal*std::atan2(doubleArea, Math::dot(a - c, b - c));
+    return doubleArea == 0.0f ? Vector3{} : normal/doubleArea;
+}
+
+/* Calculates contributions of all faces to their corners and optionally also
+   normalized face normals */
+void cornerContributions(const Containers::ArrayView<const UnsignedInt> indices, const Containers::ArrayView<const Vector3> positions, std::vector<Vector3>& contributions, std::vector<Vector3>* const faceNormals, const UnsignedInt threadCount) {
+    contributions.resize(indices.size());
+    if(faceNormals) faceNormals->resize(indices.size()/3);
+
+    const std::size_t faceCount = indices.size()/3;
+    Magnum::Implementation::forEachRange(faceCount, Magnum::Implementation::parallelThreadCount(faceCount, threadCount), [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            Vector3 faceCorners[3];
+            const Vector3 faceNormal = faceContributions(indices, positions, i, faceCorners);
+            contributions[3*i] = faceCorners[0];
+            contributions[3*i + 1] = faceCorners[1];
+            contributions[3*i + 2] = faceCorners[2];
+            if(faceNormals) (*faceNormals)[i] = faceNormal;
+        }
+    });
+}
+
+/* Lists corners of each vertex, in order in which they are in the index
+   array. Corners of i-th vertex are in range given by i-th and (i + 1)-th
+   offset. */
+void vertexCorners(const Containers::ArrayView<const UnsignedInt> indices, const std::size_t vertexCount, std::vector<UnsignedInt>& offsets, std::vector<UnsignedInt>& corners) {
+    offsets.assign(vertexCount + 1, 0);
+    for(const UnsignedInt index: indices) ++offsets[index + 1];
+    for(std::size_t i = 0; i != vertexCount; ++i) offsets[i + 1] += offsets[i];
+
+    corners.resize(indices.size());
+    std::vector<UnsignedInt> position{offsets.begin(), offsets.end() - 1};
+    for(std::size_t i = 0; i != indices.size(); ++i)
+        corners[position[indices[i]]++] = i;
+}
+
+}
+
+void generateSmoothNormalsInto(const Containers::ArrayView<const UnsignedInt> indices, const Containers::ArrayView<const Vector3> positions, const Containers::ArrayView<Vector3> normals, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateSmoothNormalsInto(): index count is not divisible by 3!", );
+    CORRADE_ASSERT(normals.size() == positions.size(),
+        "MeshTools::generateSmoothNormalsInto(): expected" << positions.size() << "normals but got" << normals.size(), );
+
+    /* Single-threaded variant just accumulates the contributions directly */
+    if(Magnum::Implementation::parallelThreadCount(std::max(indices.size()/3, positions.size()), threadCount) == 1) {
+        for(Vector3& normal: normals) normal = {};
+        for(std::size_t i = 0; i != indices.size()/3; ++i) {
+            Vector3 contributions[3];
+            faceContributions(indices, positions, i, contributions);
+            normals[indices[3*i]] += contributions[0];
+            normals[indices[3*i + 1]] += contributions[1];
+            normals[indices[3*i + 2]] += contributions[2];
+        }
+        for(Vector3& normal: normals) normal = normalizedOrZero(normal);
+        return;
+    }
+
+    /* Otherwise calculate the contributions in parallel and then gather them
+       for each vertex, again in parallel. The corners are summed in the same
+       order as above, so the result is the same. */
+    std::vector<Vector3> contributions;
+    cornerContributions(indices, positions, contributions, nullptr, threadCount);
+    std::vector<UnsignedInt> offsets, corners;
+    vertexCorners(indices, positions.size(), offsets, corners);
+
+    const std::size_t vertexThreadCount = Magnum::Implementation::parallelThreadCount(positions.size(), threadCount);
+    Magnum::Implementation::forEachRange(positions.size(), vertexThreadCount, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            Vector3 normal;
+            for(std::size_t j = offsets[i]; j != offsets[i + 1]; ++j)
+                normal += contributions[corners[j]];
+            normals[i] = normalizedOrZero(normal);
+        }
+    });
+}
+
+std::vector<Vector3> generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateSmoothNormals(): index count is not divisible by 3!", {});
+
+    std::vector<Vector3> normals(positions.size());
+    generateSmoothNormalsInto({indices.data(), indices.size()}, {positions.data(), positions.size()}, {normals.data(), normals.size()}, threadCount);
+    return normals;
+}
+
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const Rad creaseAngle, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::generateSmoothNormals(): index count is not divisible by 3!", (std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>>()));
+
+    std::vector<Vector3> contributions, faceNormals;
+    cornerContributions({indices.data(), indices.size()}, {positions.data(), positions.size()}, contributions, &faceNormals, threadCount);
+    std::vector<UnsignedInt> offsets, corners;
+    vertexCorners({indices.data(), indices.size()}, positions.size(), offsets, corners);
+
+    /* For each corner sum contributions of all faces sharing the vertex that
+       are within the crease angle. Corners of one vertex ending up with the
+       same normal share it, the normal index is first local to the vertex. */
+    const Float creaseCos = Math::cos(creaseAngle);
+    std::vector<Vector3> cornerNormals(indices.size());
+    std::vector<UnsignedInt> normalIndices(indices.size());
+    std::vector<UnsignedInt> normalOffsets(positions.size() + 1);
+    const std::size_t vertexThreadCount = Magnum::Implementation::parallelThreadCount(positions.size(), threadCount);
+    Magnum::Implementation::forEachRange(positions.size(), vertexThreadCount, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            UnsignedInt normalCount = 0;
+            for(std::size_t j = offsets[i]; j != offsets[i + 1]; ++j) {
+                const Vector3& faceNormal = faceNormals[corners[j]/3];
+                Vector3 normal;
+                for(std::size_t k = offsets[i]; k != offsets[i + 1]; ++k)
+                    if(j == k || Math::dot(faceNormal, faceNormals[corners[k]/3]) >= creaseCos)
+                        normal += contributions[corners[k]];
+                normal = normalizedOrZero(normal);
+                cornerNormals[corners[j]] = normal;
+
+                /* Reuse normal of a previous corner, if the same */
+                std::size_t previous = offsets[i];
+                while(previous != j && cornerNormals[corners[previous]] != normal)
+                    ++previous;
+                normalIndices[corners[j]] = previous == j ?
+                    normalCount++ : normalIndices[corners[previous]];
+            }
+
+            /* Vertices without any face get one zero normal */
+            normalOffsets[i + 1] = std::max(normalCount, 1u);
+        }
+    });
+
+    for(std::size_t i = 0; i != positions.size(); ++i)
+        normalOffsets[i + 1] += normalOffsets[i];
+
+    /* Make the normal indices global and put the normals into place */
+    std::vector<Vector3> normals(normalOffsets.back());
+    Magnum::Implementation::forEachRange(positions.size(), vertexThreadCount, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i) {
+            for(std::size_t j = offsets[i]; j != offsets[i + 1]; ++j) {
+                UnsignedInt& normalIndex = normalIndices[corners[j]];
+                normalIndex += normalOffsets[i];
+                normals[normalIndex] = cornerNormals[corners[j]];
+            }
+        }
+    });
+
+    return std::make_tuple(std::move(normalIndices), std::move(normals));
+}
+
+}}
@@ -0,0 +1,115 @@
+#ifndef Magnum_MeshTools_GenerateSmoothNormals_h
+#define Magnum_MeshTools_GenerateSmoothNormals_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::generateSmoothNormals(), @ref Magnum::MeshTools::generateSmoothNormalsInto()
+ */
+
+#include <tuple>
+#include <vector>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Angle.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Generate smooth normals into existing array
+@param indices      Array of triangle face indices
+@param positions    Array of vertex positions
+@param normals      Where to put the normals, one for each vertex
+@param threadCount  Thread count
+
+Calculates normal of each vertex as a normalized sum of normals of all faces
+sharing the vertex, assuming counterclockwise winding. Each face normal is
+weighted by the face area and by the angle the face has at given vertex, so
+large faces and faces with a wide angle at the vertex have larger influence
+than slivers. Vertices are
+distinguished by their index, thus faces that share only the vertex position
+but not its index (for example along texture seams) aren't smoothed together.
+Normals of vertices not referenced by any face or having only degenerate faces
+are zero. The @p normals array is expected to have the same size as
+@p positions.
+
+If @p threadCount is other than `1`, large meshes are processed in parallel,
+value of `0` means thread count reported by
+`std::thread::hardware_concurrency()`. On platforms without thread support the
+value is ignored. The output is the same regardless of thread count.
+@see @ref generateFlatNormalsInto()
+*/
+void MAGNUM_MESHTOOLS_EXPORT generateSmoothNormalsInto(Containers::ArrayView<const UnsignedInt> indices, Containers::ArrayView<const Vector3> positions, Containers::ArrayView<Vector3> normals, UnsignedInt threadCount = 1);
+
+/**
+@brief Generate smooth normals
+@param indices      Array of triangle face indices
+@param positions    Array of vertex positions
+@param threadCount  Thread count
+@return Normal for each vertex
+
+Allocates the output and calls @ref generateSmoothNormalsInto(), see its
+documentation for more information. The normals share indices with
+positions:
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+
+std::vector<Vector3> normals = MeshTools::generateSmoothNormals(indices, positions);
+@endcode
+*/
+std::vector<Vector3> MAGNUM_MESHTOOLS_EXPORT generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt threadCount = 1);
+
+/**
+@brief Generate smooth normals with hard edges
+@param indices      Array of triangle face indices
+@param positions    Array of vertex positions
+@param creaseAngle  Crease angle
+@param threadCount  Thread count
+@return Normal indices and vectors
+
+Similar to @ref generateSmoothNormals(const std::vector<UnsignedInt>&, const std::vector<Vector3>&, UnsignedInt),
+but a face contributes to the normal of a face corner only if the angle
+between the two faces is not larger than @p creaseAngle. Edges sharper than
+that thus stay hard and a vertex can get more than one normal. Normals of the
+same vertex are stored next to each other and vertices are in the original
+order, so if no edge is sharper than @p creaseAngle, the normal indices are
+the same as @p indices. Every vertex has at least one normal, vertices not
+referenced by any face get a zero one.
+@code
+std::vector<UnsignedInt> normalIndices;
+std::vector<Vector3> normals;
+std::tie(normalIndices, normals) = MeshTools::generateSmoothNormals(indices, positions, Deg(60.0f));
+@endcode
+You can then use @ref combineIndexedArrays() to combine normal and vertex array
+to use the same indices.
+*/
+std::tuple<std::vector<UnsignedInt>, std::vector<Vector3>> MAGNUM_MESHTOOLS_EXPORT generateSmoothNormals(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, Rad creaseAngle, UnsignedInt threadCount = 1);
+
+}}
+
+#endif
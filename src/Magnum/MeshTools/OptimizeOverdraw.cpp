@@ -0,0 +1,182 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "OptimizeOverdraw.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Simulated FIFO cache, the same model as in Tipsify */
+class VertexCache {
+    public:
+        explicit VertexCache(std::size_t vertexCount, std::size_t cacheSize): _cacheSize{cacheSize}, _time{cacheSize + 1}, _timestamp(vertexCount) {}
+
+        /* Flushes the whole cache */
+        void flush() { _time += _cacheSize + 1; }
+
+        /* Returns count of cache misses caused by given triangle */
+        UnsignedInt triangle(const UnsignedInt* const t) {
+            UnsignedInt misses = 0;
+            for(std::size_t i = 0; i != 3; ++i) {
+                if(_time - _timestamp[t[i]] <= _cacheSize) continue;
+                _timestamp[t[i]] = _time++;
+                ++misses;
+            }
+            return misses;
+        }
+
+    private:
+        const std::size_t _cacheSize;
+        std::size_t _time;
+        std::vector<std::size_t> _timestamp;
+};
+
+}
+
+void optimizeOverdraw(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const std::size_t cacheSize, const Float threshold) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::optimizeOverdraw(): index count is not divisible by 3", );
+    #ifndef CORRADE_NO_ASSERT
+    for(const UnsignedInt index: indices)
+        CORRADE_ASSERT(index < positions.size(), "MeshTools::optimizeOverdraw(): index" << index << "out of range for" << positions.size() << "vertices", );
+    #endif
+
+    const std::size_t triangleCount = indices.size()/3;
+    if(!triangleCount) return;
+
+    /* Hard cluster boundaries, placed where all three vertices of a triangle
+       miss the cache. That usually means the optimizer started a new patch
+       and reordering there doesn't affect cache efficiency. The first
+       cluster always starts at 0, even if the first triangle is
+       degenerate. */
+    std::vector<std::size_t> hardBoundaries;
+    {
+        VertexCache cache{positions.size(), cacheSize};
+        for(std::size_t i = 0; i != triangleCount; ++i)
+            if(cache.triangle(indices.data() + i*3) == 3 || !i)
+                hardBoundaries.push_back(i);
+        hardBoundaries.push_back(triangleCount);
+    }
+
+    /* Soft cluster boundaries. Each hard cluster is split further whenever
+       the running cache miss ratio gets below threshold times the miss ratio
+       of the whole cluster. */
+    std::vector<std::size_t> boundaries;
+    boundaries.reserve(hardBoundaries.size());
+    {
+        VertexCache cache{positions.size(), cacheSize};
+        for(std::size_t c = 0; c + 1 < hardBoundaries.size(); ++c) {
+            const std::size_t begin = hardBoundaries[c];
+            const std::size_t end = hardBoundaries[c + 1];
+
+            cache.flush();
+            UnsignedInt clusterMisses = 0;
+            for(std::size_t i = begin; i != end; ++i)
+                clusterMisses += cache.triangle(indices.data() + i*3);
+            const Float clusterThreshold = threshold*clusterMisses/(end - begin);
+
+            cache.flush();
+            boundaries.push_back(begin);
+            UnsignedInt misses = 0;
+            std::size_t triangles = 0;
+            for(std::size_t i = begin; i != end; ++i) {
+                misses += cache.triangle(indices.data() + i*3);
+                ++triangles;
+                if(Float(misses) <= clusterThreshold*triangles) {
+                    /* The next cluster may get drawn after any other, so it
+                       has to start with a cold cache */
+                    boundaries.push_back(i + 1);
+                    cache.flush();
+                    misses = 0;
+                    triangles = 0;
+                }
+            }
+
+            /* The last cluster is usually just a few leftover triangles with
+               poor cache efficiency, merge it with the previous one. If the
+               last cluster ended exactly at the end, this removes the
+               superfluous boundary. */
+            if(boundaries.back() != begin) boundaries.pop_back();
+        }
+        boundaries.push_back(triangleCount);
+    }
+
+    /* Mesh centroid */
+    Vector3 meshCentroid;
+    for(const Vector3& position: positions) meshCentroid += position;
+    meshCentroid /= positions.size();
+
+    /* Sort key for each cluster -- how much the cluster faces outwards from
+       the mesh centroid. Cluster centroid is weighted by triangle area, the
+       normal is the sum of area-weighted triangle normals. */
+    const std::size_t clusterCount = boundaries.size() - 1;
+    std::vector<std::pair<Float, std::size_t>> keys;
+    keys.reserve(clusterCount);
+    for(std::size_t cluster = 0; cluster != clusterCount; ++cluster) {
+        Vector3 centroid, normal;
+        Float area = 0.0f;
+        for(std::size_t i = boundaries[cluster]; i != boundaries[cluster + 1]; ++i) {
+            const Vector3& a = positions[indices[i*3 + 0]];
+            const Vector3& b = positions[indices[i*3 + 1]];
+            const Vector3& c = positions[indices[i*3 + 2]];
+            const Vector3 n = Math::cross(b - a, c - a);
+            const Float triangleArea = n.length();
+
+            centroid += (a + b + c)*(triangleArea/3.0f);
+            normal += n;
+            area += triangleArea;
+        }
+
+        /* Degenerate clusters have no meaningful orientation */
+        Float key = 0.0f;
+        const Float normalLength = normal.length();
+        if(area > 0.0f && normalLength > 0.0f)
+            key = Math::dot(centroid/area - meshCentroid, normal/normalLength);
+        keys.emplace_back(-key, cluster);
+    }
+
+    /* Outward-facing clusters first, keep the original order otherwise */
+    std::stable_sort(keys.begin(), keys.end(), [](const std::pair<Float, std::size_t>& a, const std::pair<Float, std::size_t>& b) {
+        return a.first < b.first;
+    });
+
+    std::vector<UnsignedInt> outputIndices;
+    outputIndices.reserve(indices.size());
+    for(const auto& key: keys)
+        outputIndices.insert(outputIndices.end(),
+            indices.begin() + boundaries[key.second]*3,
+            indices.begin() + boundaries[key.second + 1]*3);
+
+    /* Swap original index buffer with optimized */
+    using std::swap;
+    swap(indices, outputIndices);
+}
+
+}}
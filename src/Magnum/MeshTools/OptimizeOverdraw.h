@@ -0,0 +1,70 @@
+#ifndef Magnum_MeshTools_OptimizeOverdraw_h
+#define Magnum_MeshTools_OptimizeOverdraw_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeOverdraw()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Reorder triangle clusters to reduce overdraw
+@param[in,out] indices  Index array to operate on
+@param[in] positions    Vertex positions
+@param[in] cacheSize    Post-transform vertex cache size
+@param[in] threshold    Allowed vertex cache efficiency degradation
+
+Splits the index array into clusters and sorts them so the outward-facing
+clusters are drawn first, which makes them likely to occlude the rest of the
+mesh from any viewpoint. Algorithm used: *Pedro V. Sander, Diego Nehab, and
+Joshua Barczak - Fast Triangle Reordering for Vertex Locality and Reduced
+Overdraw, SIGGRAPH 2007*, the same paper as @ref tipsify().
+
+The index array is expected to be already optimized for the vertex cache of
+@p cacheSize using @ref tipsify(). Cluster boundaries are placed where the
+simulated cache gets fully flushed, which keeps the vertex cache efficiency
+intact. The clusters are then further split as long as their average cache
+miss ratio stays under @p threshold times the ratio of the original cluster,
+so value of `1.0` gives the least clusters and the best vertex cache
+efficiency, while larger values allow more freedom in reordering at the
+expense of vertex throughput. Use @ref analyzeVertexCache() to measure the
+result.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3. All indices are expected to be less than
+    @p positions size.
+*/
+void MAGNUM_MESHTOOLS_EXPORT optimizeOverdraw(std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, std::size_t cacheSize, Float threshold = 1.05f);
+
+}}
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef Magnum_MeshTools_OptimizeVertexFetch_h
+#define Magnum_MeshTools_OptimizeVertexFetch_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::optimizeVertexFetch(), @ref Magnum::MeshTools::optimizeVertexFetchRemap()
+ */
+
+#include <vector>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Types.h"
+#include "Magnum/MeshTools/visibility.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Renumber vertices in order of first use
+@param[in,out] indices  Index array to operate on
+@param[in] vertexCount  Vertex count
+@return Remapping table with new vertex ID for each original vertex
+
+Renumbers the vertices so they are referenced in increasing order, which
+makes vertex fetch during rendering as linear as possible. The relative
+triangle order is not changed, so this should be done as the last step after
+@ref tipsify() and @ref optimizeOverdraw(). Vertices not referenced by the
+index array get ID `0xffffffffu` in the returned table. Use
+@ref optimizeVertexFetch(std::vector<UnsignedInt>&, std::vector<T>&, std::vector<U>&...)
+to renumber the vertices and reorder the attribute arrays in one step.
+
+@attention All indices are expected to be less than @p vertexCount.
+*/
+std::vector<UnsignedInt> MAGNUM_MESHTOOLS_EXPORT optimizeVertexFetchRemap(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount);
+
+namespace Implementation {
+    inline void optimizeVertexFetchRemapData(const std::vector<UnsignedInt>&, UnsignedInt) {}
+
+    template<class T, class ...U> void optimizeVertexFetchRemapData(const std::vector<UnsignedInt>& remap, const UnsignedInt vertexCount, std::vector<T>& first, std::vector<U>&... next) {
+        CORRADE_ASSERT(first.size() == remap.size(),
+            "MeshTools::optimizeVertexFetch(): attribute arrays don't have the same size, expected" << remap.size() << "but got" << first.size(), );
+
+        std::vector<T> out(vertexCount);
+        for(std::size_t i = 0; i != remap.size(); ++i)
+            if(remap[i] != 0xffffffffu) out[remap[i]] = first[i];
+        std::swap(first, out);
+
+        optimizeVertexFetchRemapData(remap, vertexCount, next...);
+    }
+}
+
+/**
+@brief Reorder vertices for linear vertex fetch
+@param[in,out] indices      Index array to operate on
+@param[in,out] first        First attribute array
+@param[in,out] next         Other attribute arrays
+@return New vertex count
+
+Renumbers the vertices using @ref optimizeVertexFetchRemap() and reorders all
+attribute arrays accordingly. Vertices not referenced by the index array are
+removed. All attribute arrays are expected to have the same size.
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+std::vector<Vector3> normals;
+std::vector<Vector2> textureCoordinates;
+
+MeshTools::tipsify(indices, positions.size(), 24);
+MeshTools::optimizeOverdraw(indices, positions, 24);
+MeshTools::optimizeVertexFetch(indices, positions, normals, textureCoordinates);
+@endcode
+*/
+template<class T, class ...U> UnsignedInt optimizeVertexFetch(std::vector<UnsignedInt>& indices, std::vector<T>& first, std::vector<U>&... next) {
+    const std::vector<UnsignedInt> remap = optimizeVertexFetchRemap(indices, first.size());
+
+    UnsignedInt vertexCount = 0;
+    for(const UnsignedInt id: remap)
+        if(id != 0xffffffffu) ++vertexCount;
+
+    Implementation::optimizeVertexFetchRemapData(remap, vertexCount, first, next...);
+    return vertexCount;
+}
+
+}}
+
+#endif
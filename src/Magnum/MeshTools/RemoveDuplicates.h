@@ -29,11 +29,9 @@
  * @brief Function @ref Magnum::MeshTools::removeDuplicates()
  */
 
-#include <limits>
-#include <numeric>
-#include <unordered_map>
+#include <cstdint>
+#include <cstring>
 #include <vector>
-#include <Corrade/Utility/MurmurHash2.h>
 
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Functions.h"
@@ -41,12 +39,74 @@
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
-    template<std::size_t size> class VectorHash {
-        public:
-            std::size_t operator()(const Math::Vector<size, std::size_t>& data) const {
-                return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(&data), sizeof(data)).byteArray());
+    /* Size of an open-addressing hash table for given maximal item count,
+       keeping the load factor at most 0.5 */
+    inline std::size_t removeDuplicatesTableSize(const std::size_t count) {
+        std::size_t size = 16;
+        while(size < count*2) size <<= 1;
+        return size;
+    }
+
+    /* Combines the value into the hash. The table is indexed using the
+       lowest bits, so the high bits are mixed into them. */
+    inline std::uint64_t removeDuplicatesHash(std::uint64_t hash, const std::uint64_t value) {
+        hash = (hash ^ value)*0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ull;
+        return hash ^ (hash >> 33);
+    }
+
+    /* Hash of bit representation of the vector */
+    template<class Vector> std::uint64_t removeDuplicatesExactHash(const Vector& vector) {
+        static_assert(sizeof(typename Vector::Type) <= sizeof(std::uint64_t), "unsupported vector type");
+        std::uint64_t hash = 0;
+        for(std::size_t i = 0; i != Vector::Size; ++i) {
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, vector.data() + i, sizeof(typename Vector::Type));
+            hash = removeDuplicatesHash(hash, bits);
+        }
+        return hash;
+    }
+
+    /* Hash of a grid cell */
+    template<std::size_t size> std::uint64_t removeDuplicatesCellHash(const Math::Vector<size, Int>& cell) {
+        std::uint64_t hash = 0;
+        for(std::size_t i = 0; i != size; ++i)
+            hash = removeDuplicatesHash(hash, UnsignedInt(cell[i]));
+        return hash;
+    }
+
+    template<class Vector> std::vector<UnsignedInt> removeDuplicatesExact(std::vector<Vector>& data) {
+        /* Table of unique vector IDs, ~UnsignedInt{} is an empty slot */
+        const std::size_t mask = removeDuplicatesTableSize(data.size()) - 1;
+        std::vector<UnsignedInt> table(mask + 1, ~UnsignedInt{});
+
+        std::vector<UnsignedInt> indices(data.size());
+        UnsignedInt uniqueCount = 0;
+        for(std::size_t i = 0; i != data.size(); ++i) {
+            const Vector v = data[i];
+            for(std::size_t slot = removeDuplicatesExactHash(v) & mask; ; slot = (slot + 1) & mask) {
+                const UnsignedInt id = table[slot];
+
+                /* New vector, copy it to new (earlier) position in the
+                   array */
+                if(id == ~UnsignedInt{}) {
+                    table[slot] = uniqueCount;
+                    data[uniqueCount] = v;
+                    indices[i] = uniqueCount++;
+                    break;
+                }
+
+                if(std::memcmp(&data[id], &v, sizeof(Vector)) == 0) {
+                    indices[i] = id;
+                    break;
+                }
             }
-    };
+        }
+
+        data.resize(uniqueCount);
+        return indices;
+    }
 }
 
 /**
@@ -56,11 +116,17 @@ namespace Implementation {
     melt together
 @return Index array and unique data
 
-Removes duplicate data from the array by collapsing them into buckets of size
-@p epsilon. First vector in given bucket is used, other ones are thrown away,
-no interpolation is done. Note that this function is meant to be used for
-floating-point data (or generally with non-zero @p epsilon), for discrete data
-the usual sorting method is much more efficient.
+Removes duplicate data from the array by merging each vector with the first
+earlier unique vector that differs from it in all components by less than
+@p epsilon. No interpolation is done, the unique vectors keep their original
+order. If @p epsilon is zero, only bit-exact duplicates are removed, which is
+considerably faster.
+
+The vectors are hashed into a uniform grid with cell size of eight epsilons,
+so each vector is compared only with unique vectors in the same cell and, if
+it is near the cell border, in at most @f$ 2^n - 1 @f$ neighboring cells,
+where @f$ n @f$ is the vector size. The whole operation is done in a single
+pass.
 
 If you want to remove duplicate data from already indexed array, first remove
 duplicates as if the array wasn't indexed at all and then use @ref duplicate()
@@ -93,6 +159,15 @@ std::vector<UnsignedInt> indices = MeshTools::combineIndexedArrays(
 @endcode
 */
 template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vector>& data, typename Vector::Type epsilon = Math::TypeTraits<typename Vector::Type>::epsilon()) {
+    if(data.empty()) return {};
+
+    /* Fast path for exact matches */
+    if(epsilon == typename Vector::Type(0))
+        return Implementation::removeDuplicatesExact(data);
+
+    typedef Math::Vector<Vector::Size, Double> VectorDouble;
+    typedef Math::Vector<Vector::Size, Int> Cell;
+
     /* Get bounds */
     Vector min = data[0], max = data[0];
     for(const auto& v: data) {
@@ -100,61 +175,86 @@ template<class Vector> std::vector<UnsignedInt> removeDuplicates(std::vector<Vec
         max = Math::max(v, max);
     }
 
-    /* Make epsilon so large that std::size_t can index all vectors inside the
-       bounds. */
-    epsilon = Math::max(epsilon, typename Vector::Type((max-min).max()/std::numeric_limits<std::size_t>::max()));
-
-    /* Resulting index array */
-    std::vector<UnsignedInt> resultIndices(data.size());
-    std::iota(resultIndices.begin(), resultIndices.end(), 0);
-
-    /* Table containing original vector index for each discretized vector.
-       Reserving more buckets than necessary (i.e. as if each vector was
-       unique). */
-    std::unordered_map<Math::Vector<Vector::Size, std::size_t>, UnsignedInt, Implementation::VectorHash<Vector::Size>> table(data.size());
-
-    /* Index array for each pass, new data array */
-    std::vector<UnsignedInt> indices;
-    indices.reserve(data.size());
-
-    /* First go with original coordinates, then move them by epsilon/2 in each
-       direction. */
-    Vector moved;
-    for(std::size_t moving = 0; moving <= Vector::Size; ++moving) {
-        /* Go through all vectors */
-        for(std::size_t i = 0; i != data.size(); ++i) {
-            /* Try to insert new vertex to the table */
-            const Math::Vector<Vector::Size, std::size_t> v((data[i] + moved - min)/epsilon);
-            const auto result = table.emplace(v, table.size());
-
-            /* Add the (either new or already existing) index to index array */
-            indices.push_back(result.first->second);
+    /* Cell size is eight epsilons, so vectors nearer than epsilon are either
+       in the same cell or, if the vector is near the cell border, in the
+       neighbor cell on that side. Make it so large that Int can index all
+       cells inside the bounds. */
+    const Double cellSize = Math::max(8.0*Double(epsilon), Double((max - min).max())/Double(1 << 30));
+    const Double border = Double(epsilon)/cellSize;
+
+    /* Open-addressing table of cells, each slot containing ID of last unique
+       vector in given cell or ~UnsignedInt{} if empty. Other unique vectors
+       in the same cell are linked through the `next` array. Reserving as if
+       each vector was unique. */
+    const std::size_t mask = Implementation::removeDuplicatesTableSize(data.size()) - 1;
+    std::vector<UnsignedInt> table(mask + 1, ~UnsignedInt{});
+    std::vector<UnsignedInt> next;
+    std::vector<Cell> cells;
+    next.reserve(data.size());
+    cells.reserve(data.size());
+
+    /* Slot for given cell, either empty or containing vectors from that
+       cell */
+    const auto find = [&](const Cell& cell) {
+        std::size_t slot = Implementation::removeDuplicatesCellHash(cell) & mask;
+        while(table[slot] != ~UnsignedInt{} && cells[table[slot]] != cell)
+            slot = (slot + 1) & mask;
+        return slot;
+    };
 
-            /* If this is new combination, copy the data to new (earlier)
-               possition in the array */
-            if(result.second && i != table.size()-1) data[table.size()-1] = data[i];
+    std::vector<UnsignedInt> indices(data.size());
+    UnsignedInt uniqueCount = 0;
+    for(std::size_t i = 0; i != data.size(); ++i) {
+        const Vector v = data[i];
+
+        /* Cell containing the vector and direction to the neighbor cell in
+           each dimension, if the vector is nearer to its border than
+           epsilon */
+        const VectorDouble position = VectorDouble(v - min)/cellSize;
+        Cell cell, direction;
+        std::size_t neighbors = 0;
+        for(std::size_t j = 0; j != Vector::Size; ++j) {
+            cell[j] = Int(position[j]);
+            const Double fraction = position[j] - cell[j];
+            direction[j] = fraction < border ? -1 : fraction > 1.0 - border ? 1 : 0;
+            if(direction[j]) neighbors |= std::size_t(1) << j;
         }
 
-        /* Shrink the data array */
-        CORRADE_INTERNAL_ASSERT(data.size() >= table.size());
-        data.resize(table.size());
-
-        /* Remap the resulting index array */
-        for(auto& i: resultIndices) i = indices[i];
-
-        /* Finished */
-        if(moving == Vector::Size) continue;
+        /* Find the earliest unique vector nearer than epsilon in the cell
+           and all neighbors near enough. Going through all subsets of the
+           neighbor directions. */
+        UnsignedInt found = ~UnsignedInt{};
+        std::size_t slot;
+        for(std::size_t neighbor = neighbors; ; neighbor = (neighbor - 1) & neighbors) {
+            Cell neighborCell = cell;
+            for(std::size_t j = 0; j != Vector::Size; ++j)
+                if(neighbor & (std::size_t(1) << j)) neighborCell[j] += direction[j];
+
+            slot = find(neighborCell);
+            for(UnsignedInt id = table[slot]; id != ~UnsignedInt{}; id = next[id])
+                if(id < found && (Math::abs(data[id] - v) < Vector(epsilon)).all())
+                    found = id;
+
+            /* The cell itself is the last, its slot is used below */
+            if(!neighbor) break;
+        }
 
-        /* Move vertex coordinates by epsilon/2 in next direction */
-        moved = Vector();
-        moved[moving] = epsilon/2;
+        if(found != ~UnsignedInt{}) {
+            indices[i] = found;
+            continue;
+        }
 
-        /* Clear the structures for next pass */
-        table.clear();
-        indices.clear();
+        /* New vector, copy it to new (earlier) position in the array and
+           add it to the table */
+        next.push_back(table[slot]);
+        cells.push_back(cell);
+        table[slot] = uniqueCount;
+        data[uniqueCount] = v;
+        indices[i] = uniqueCount++;
     }
 
-    return resultIndices;
+    data.resize(uniqueCount);
+    return indices;
 }
 
 }}
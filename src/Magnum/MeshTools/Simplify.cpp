@@ -0,0 +1,527 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Simplify.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/OptimizeVertexFetch.h"
+#include "Magnum/MeshTools/Tipsify.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Weights of attribute differences in the collapse error, relative to
+   squared distance in mesh of unit size */
+constexpr Double NormalWeight = 0.01;
+constexpr Double TextureCoordinateWeight = 0.01;
+
+/* Weight of planes perpendicular to boundary edges, relative to triangle
+   area */
+constexpr Double BoundaryWeight = 10.0;
+
+enum class VertexKind: UnsignedByte {
+    /* Can collapse onto any neighbor */
+    Manifold,
+
+    /* On open boundary, can collapse only along the boundary */
+    Boundary,
+
+    /* On attribute seam or non-manifold edge, can't collapse */
+    Locked
+};
+
+/* Symmetric 4x4 matrix of the quadric with sum of weights of its planes */
+struct Quadric {
+    Double a00, a11, a22, a01, a02, a12, b0, b1, b2, c, w;
+
+    Quadric& operator+=(const Quadric& other) {
+        a00 += other.a00; a11 += other.a11; a22 += other.a22;
+        a01 += other.a01; a02 += other.a02; a12 += other.a12;
+        b0 += other.b0; b1 += other.b1; b2 += other.b2;
+        c += other.c;
+        w += other.w;
+        return *this;
+    }
+
+    /* Weighted average of squared distance from the planes */
+    Double error(const Vector3d& p) const {
+        if(w == 0.0) return 0.0;
+        const Double r =
+            a00*p.x()*p.x() + a11*p.y()*p.y() + a22*p.z()*p.z() +
+            2.0*(a01*p.x()*p.y() + a02*p.x()*p.z() + a12*p.y()*p.z()) +
+            2.0*(b0*p.x() + b1*p.y() + b2*p.z()) + c;
+        return std::abs(r)/w;
+    }
+};
+
+/* Quadric of plane going through a point with given unit normal */
+Quadric planeQuadric(const Vector3d& normal, const Vector3d& point, const Double weight) {
+    const Double d = -Math::dot(normal, point);
+    return Quadric{
+        weight*normal.x()*normal.x(), weight*normal.y()*normal.y(), weight*normal.z()*normal.z(),
+        weight*normal.x()*normal.y(), weight*normal.x()*normal.z(), weight*normal.y()*normal.z(),
+        weight*normal.x()*d, weight*normal.y()*d, weight*normal.z()*d,
+        weight*d*d,
+        weight};
+}
+
+struct PositionHash {
+    std::size_t operator()(const Vector3& position) const {
+        UnsignedInt data[3];
+        std::memcpy(data, position.data(), sizeof(data));
+        return std::size_t(((data[0]*73856093u) ^ (data[1]*19349663u) ^ (data[2]*83492791u)));
+    }
+};
+
+/* Vector3::operator==() is fuzzy, which wouldn't be consistent with the
+   hash above */
+struct PositionEqual {
+    bool operator()(const Vector3& a, const Vector3& b) const {
+        return std::memcmp(a.data(), b.data(), sizeof(Vector3)) == 0;
+    }
+};
+
+struct Collapse {
+    UnsignedInt from, to;
+    Double error;
+};
+
+/* Keeps the state between successive simplifications so the LOD chain
+   accumulates error relative to the original mesh */
+class Simplifier {
+    public:
+        explicit Simplifier(const Trade::MeshData3D& mesh);
+
+        const std::vector<UnsignedInt>& indices() const { return _indices; }
+
+        Float error() const { return Float(std::sqrt(_error)); }
+
+        /* Returns false if no collapse was possible */
+        bool simplify(std::size_t targetIndexCount, Float targetError);
+
+    private:
+        /* Triangles around given vertex in current adjacency */
+        const UnsignedInt* trianglesBegin(const UnsignedInt vertex) const {
+            return _neighbors.data() + _neighborOffset[vertex];
+        }
+        const UnsignedInt* trianglesEnd(const UnsignedInt vertex) const {
+            return _neighbors.data() + _neighborOffset[vertex + 1];
+        }
+
+        bool hasVertex(UnsignedInt triangle, UnsignedInt vertex) const;
+        UnsignedInt sharedTriangleCount(UnsignedInt from, UnsignedInt to) const;
+        bool canCollapse(UnsignedInt from, UnsignedInt to, UnsignedInt sharedCount) const;
+        Double collapseError(UnsignedInt from, UnsignedInt to) const;
+        bool preservesTopology(UnsignedInt from, UnsignedInt to, UnsignedInt sharedCount) const;
+        bool flipsTriangle(UnsignedInt from, UnsignedInt to) const;
+        std::size_t pass(std::size_t targetIndexCount, Double errorLimit);
+
+        std::vector<UnsignedInt> _indices;
+        std::vector<Vector3d> _positions;
+        const std::vector<Vector3>* _normals;
+        const std::vector<Vector2>* _textureCoordinates;
+        std::vector<VertexKind> _kinds;
+        std::vector<Quadric> _quadrics;
+        Double _error;
+
+        /* Vertex-triangle adjacency, rebuilt in each pass */
+        std::vector<UnsignedInt> _liveTriangleCount, _neighborOffset, _neighbors;
+};
+
+Simplifier::Simplifier(const Trade::MeshData3D& mesh): _indices(mesh.indices()), _normals{mesh.hasNormals() ? &mesh.normals(0) : nullptr}, _textureCoordinates{mesh.hasTextureCoords2D() ? &mesh.textureCoords2D(0) : nullptr}, _error{} {
+    const std::vector<Vector3>& positions = mesh.positions(0);
+    const UnsignedInt vertexCount = positions.size();
+
+    /* Scale the mesh to unit size so the error is relative */
+    Vector3 min{Constants::inf()}, max{-Constants::inf()};
+    for(const Vector3& position: positions) {
+        min = Math::min(min, position);
+        max = Math::max(max, position);
+    }
+    const Float size = vertexCount ? (max - min).max() : 0.0f;
+    const Double scale = size > 0.0f ? 1.0/size : 1.0;
+    _positions.reserve(vertexCount);
+    for(const Vector3& position: positions)
+        _positions.push_back(Vector3d(position - min)*scale);
+
+    /* Vertices with the same position, which are on seams */
+    std::vector<UnsignedInt> remap(vertexCount);
+    _kinds.assign(vertexCount, VertexKind::Manifold);
+    {
+        std::unordered_map<Vector3, UnsignedInt, PositionHash, PositionEqual> unique;
+        unique.reserve(vertexCount);
+        for(UnsignedInt i = 0; i != vertexCount; ++i) {
+            const auto result = unique.emplace(positions[i], i);
+            remap[i] = result.first->second;
+            if(!result.second) {
+                _kinds[i] = VertexKind::Locked;
+                _kinds[remap[i]] = VertexKind::Locked;
+            }
+        }
+    }
+
+    /* Directed edges of the mesh with vertices welded by position. Edge
+       without its opposite is on boundary, edge present more than once is
+       non-manifold. */
+    std::vector<UnsignedLong> edges;
+    edges.reserve(_indices.size());
+    for(std::size_t i = 0; i != _indices.size(); i += 3) for(std::size_t j = 0; j != 3; ++j)
+        edges.push_back(UnsignedLong(remap[_indices[i + j]]) << 32 | remap[_indices[i + (j + 1)%3]]);
+    std::sort(edges.begin(), edges.end());
+    const auto edgeCount = [&edges](const UnsignedInt a, const UnsignedInt b) {
+        const auto range = std::equal_range(edges.begin(), edges.end(), UnsignedLong(a) << 32 | b);
+        return std::size_t(range.second - range.first);
+    };
+
+    /* Plane quadrics of all triangles, weighted by area, and quadrics of
+       planes perpendicular to boundary edges */
+    _quadrics.assign(vertexCount, Quadric{});
+    std::vector<bool> lockedRemap(vertexCount);
+    for(std::size_t i = 0; i != _indices.size(); i += 3) {
+        const Vector3d normal = Math::cross(_positions[_indices[i + 1]] - _positions[_indices[i]], _positions[_indices[i + 2]] - _positions[_indices[i]]);
+        const Double area = normal.length();
+        if(area == 0.0) continue;
+
+        const Vector3d unitNormal = normal/area;
+        const Quadric quadric = planeQuadric(unitNormal, _positions[_indices[i]], area*0.5);
+        for(std::size_t j = 0; j != 3; ++j) _quadrics[_indices[i + j]] += quadric;
+
+        for(std::size_t j = 0; j != 3; ++j) {
+            const UnsignedInt a = _indices[i + j], b = _indices[i + (j + 1)%3];
+            if(edgeCount(remap[a], remap[b]) > 1 || edgeCount(remap[b], remap[a]) > 1) {
+                lockedRemap[remap[a]] = lockedRemap[remap[b]] = true;
+                continue;
+            }
+            if(edgeCount(remap[b], remap[a])) continue;
+
+            const Vector3d edge = _positions[b] - _positions[a];
+            const Double length = edge.length();
+            if(length == 0.0) continue;
+
+            const Quadric boundary = planeQuadric(Math::cross(edge, unitNormal)/length, _positions[a], length*length*BoundaryWeight);
+            _quadrics[a] += boundary;
+            _quadrics[b] += boundary;
+            if(_kinds[a] == VertexKind::Manifold) _kinds[a] = VertexKind::Boundary;
+            if(_kinds[b] == VertexKind::Manifold) _kinds[b] = VertexKind::Boundary;
+        }
+    }
+
+    for(UnsignedInt i = 0; i != vertexCount; ++i)
+        if(lockedRemap[remap[i]]) _kinds[i] = VertexKind::Locked;
+}
+
+bool Simplifier::hasVertex(const UnsignedInt triangle, const UnsignedInt vertex) const {
+    return _indices[triangle*3] == vertex ||
+           _indices[triangle*3 + 1] == vertex ||
+           _indices[triangle*3 + 2] == vertex;
+}
+
+UnsignedInt Simplifier::sharedTriangleCount(const UnsignedInt from, const UnsignedInt to) const {
+    UnsignedInt count = 0;
+    for(const UnsignedInt* t = trianglesBegin(from); t != trianglesEnd(from); ++t)
+        if(hasVertex(*t, to)) ++count;
+    return count;
+}
+
+bool Simplifier::canCollapse(const UnsignedInt from, const UnsignedInt to, const UnsignedInt sharedCount) const {
+    switch(_kinds[from]) {
+        case VertexKind::Manifold:
+            return sharedCount == 2;
+        case VertexKind::Boundary:
+            return sharedCount == 1 && _kinds[to] == VertexKind::Boundary;
+        case VertexKind::Locked:
+            return false;
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* Removed vertex gets its attributes interpolated from the triangle its
+   position falls into after the collapse, the error is the difference from
+   its original attributes. Thus the collapse is free if the attributes are
+   linear across the surface. */
+Double Simplifier::collapseError(const UnsignedInt from, const UnsignedInt to) const {
+    const Double error = _quadrics[from].error(_positions[to]);
+    if(!_normals && !_textureCoordinates) return error;
+
+    Double attributeError = Constants::inf();
+    for(const UnsignedInt* t = trianglesBegin(from); t != trianglesEnd(from); ++t) {
+        if(hasVertex(*t, to)) continue;
+
+        std::size_t i = 0;
+        while(_indices[*t*3 + i] != from) ++i;
+        const UnsignedInt b = _indices[*t*3 + (i + 1)%3];
+        const UnsignedInt c = _indices[*t*3 + (i + 2)%3];
+
+        /* Barycentric coordinates of the removed vertex in the new triangle,
+           clamped to be inside */
+        const Vector3d e0 = _positions[b] - _positions[to];
+        const Vector3d e1 = _positions[c] - _positions[to];
+        const Vector3d e2 = _positions[from] - _positions[to];
+        const Double d00 = Math::dot(e0, e0), d01 = Math::dot(e0, e1), d11 = Math::dot(e1, e1);
+        const Double d20 = Math::dot(e2, e0), d21 = Math::dot(e2, e1);
+        const Double denominator = d00*d11 - d01*d01;
+        if(denominator == 0.0) continue;
+        Double wb = Math::max(0.0, (d11*d20 - d01*d21)/denominator);
+        Double wc = Math::max(0.0, (d00*d21 - d01*d20)/denominator);
+        if(wb + wc > 1.0) {
+            wb /= wb + wc;
+            wc = 1.0 - wb;
+        }
+        const Float w[]{Float(1.0 - wb - wc), Float(wb), Float(wc)};
+
+        Double triangleError = 0.0;
+        if(_normals) {
+            const std::vector<Vector3>& n = *_normals;
+            triangleError += NormalWeight*(n[from] - (n[to]*w[0] + n[b]*w[1] + n[c]*w[2])).dot();
+        }
+        if(_textureCoordinates) {
+            const std::vector<Vector2>& tc = *_textureCoordinates;
+            triangleError += TextureCoordinateWeight*(tc[from] - (tc[to]*w[0] + tc[b]*w[1] + tc[c]*w[2])).dot();
+        }
+        attributeError = Math::min(attributeError, triangleError);
+    }
+
+    /* No triangle left around the vertex, compare with the target directly */
+    if(attributeError == Constants::inf()) {
+        attributeError = 0.0;
+        if(_normals)
+            attributeError += NormalWeight*((*_normals)[from] - (*_normals)[to]).dot();
+        if(_textureCoordinates)
+            attributeError += TextureCoordinateWeight*((*_textureCoordinates)[from] - (*_textureCoordinates)[to]).dot();
+    }
+
+    return error + attributeError;
+}
+
+/* Link condition, vertices can share only the vertices opposite to the
+   collapsed edge, otherwise the collapse would create duplicate triangles or
+   non-manifold edges */
+bool Simplifier::preservesTopology(const UnsignedInt from, const UnsignedInt to, const UnsignedInt sharedCount) const {
+    UnsignedInt commonCount = 0;
+    for(const UnsignedInt* a = trianglesBegin(from); a != trianglesEnd(from); ++a) for(std::size_t i = 0; i != 3; ++i) {
+        const UnsignedInt vertex = _indices[*a*3 + i];
+        if(vertex == from || vertex == to) continue;
+
+        /* Count each common vertex just once */
+        bool seen = false;
+        for(const UnsignedInt* b = trianglesBegin(from); b != a && !seen; ++b)
+            seen = hasVertex(*b, vertex);
+        for(std::size_t j = 0; j != i && !seen; ++j)
+            seen = _indices[*a*3 + j] == vertex;
+        if(seen) continue;
+
+        for(const UnsignedInt* b = trianglesBegin(to); b != trianglesEnd(to); ++b) if(hasVertex(*b, vertex)) {
+            ++commonCount;
+            break;
+        }
+    }
+
+    return commonCount == sharedCount;
+}
+
+bool Simplifier::flipsTriangle(const UnsignedInt from, const UnsignedInt to) const {
+    for(const UnsignedInt* t = trianglesBegin(from); t != trianglesEnd(from); ++t) {
+        if(hasVertex(*t, to)) continue;
+
+        /* Rotate the triangle so the collapsed vertex is first */
+        std::size_t i = 0;
+        while(_indices[*t*3 + i] != from) ++i;
+        const Vector3d& b = _positions[_indices[*t*3 + (i + 1)%3]];
+        const Vector3d& c = _positions[_indices[*t*3 + (i + 2)%3]];
+
+        const Vector3d before = Math::cross(b - _positions[from], c - _positions[from]);
+        const Vector3d after = Math::cross(b - _positions[to], c - _positions[to]);
+        if(Math::dot(before, after) <= 0.0) return true;
+    }
+
+    return false;
+}
+
+std::size_t Simplifier::pass(const std::size_t targetIndexCount, const Double errorLimit) {
+    const UnsignedInt vertexCount = _positions.size();
+    Implementation::buildAdjacency(_indices, vertexCount, _liveTriangleCount, _neighborOffset, _neighbors);
+
+    /* Unique edges */
+    std::vector<UnsignedLong> edges;
+    edges.reserve(_indices.size());
+    for(std::size_t i = 0; i != _indices.size(); i += 3) for(std::size_t j = 0; j != 3; ++j) {
+        const UnsignedInt a = _indices[i + j], b = _indices[i + (j + 1)%3];
+        edges.push_back(UnsignedLong(Math::min(a, b)) << 32 | Math::max(a, b));
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    /* Cheaper direction of each edge that can be collapsed */
+    std::vector<Collapse> collapses;
+    for(const UnsignedLong edge: edges) {
+        const UnsignedInt a = edge >> 32, b = edge & 0xffffffffu;
+        const UnsignedInt sharedCount = sharedTriangleCount(a, b);
+        const bool ab = canCollapse(a, b, sharedCount), ba = canCollapse(b, a, sharedCount);
+        if(!ab && !ba) continue;
+
+        const Double errorAB = ab ? collapseError(a, b) : Constants::inf();
+        const Double errorBA = ba ? collapseError(b, a) : Constants::inf();
+        if(errorAB <= errorBA) collapses.push_back({a, b, errorAB});
+        else collapses.push_back({b, a, errorBA});
+    }
+    std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+        return a.error < b.error;
+    });
+
+    /* Each collapse removes about two triangles, collapses much more
+       expensive than the ones needed for reaching the target are left for
+       the next pass, when the cheaper ones might become available again */
+    std::size_t triangleCount = _indices.size()/3;
+    const std::size_t neededCollapseCount = (triangleCount - targetIndexCount/3)/2;
+    const Double passErrorLimit = collapses.empty() ? 0.0 : Math::min(errorLimit,
+        collapses[Math::min(neededCollapseCount, collapses.size() - 1)].error*1.5);
+
+    /* Collapse target for each vertex, vertices that are involved in a
+       collapse in this pass are locked until the next pass */
+    std::vector<UnsignedInt> target(vertexCount);
+    for(UnsignedInt i = 0; i != vertexCount; ++i) target[i] = i;
+    std::vector<bool> locked(vertexCount);
+    std::size_t collapseCount = 0;
+    for(const Collapse& collapse: collapses) {
+        if(collapse.error > passErrorLimit || triangleCount*3 <= targetIndexCount) break;
+        if(locked[collapse.from] || locked[collapse.to]) continue;
+
+        const UnsignedInt sharedCount = sharedTriangleCount(collapse.from, collapse.to);
+        if(!preservesTopology(collapse.from, collapse.to, sharedCount) || flipsTriangle(collapse.from, collapse.to))
+            continue;
+
+        target[collapse.from] = collapse.to;
+        _quadrics[collapse.to] += _quadrics[collapse.from];
+        _error = Math::max(_error, collapse.error);
+        triangleCount -= sharedCount;
+        ++collapseCount;
+
+        for(const UnsignedInt* t = trianglesBegin(collapse.from); t != trianglesEnd(collapse.from); ++t)
+            for(std::size_t i = 0; i != 3; ++i) locked[_indices[*t*3 + i]] = true;
+    }
+
+    if(!collapseCount) return 0;
+
+    /* Apply the collapses and remove degenerate triangles */
+    std::size_t out = 0;
+    for(std::size_t i = 0; i != _indices.size(); i += 3) {
+        const UnsignedInt a = target[_indices[i]], b = target[_indices[i + 1]], c = target[_indices[i + 2]];
+        if(a == b || b == c || c == a) continue;
+        _indices[out++] = a;
+        _indices[out++] = b;
+        _indices[out++] = c;
+    }
+    _indices.resize(out);
+
+    return collapseCount;
+}
+
+bool Simplifier::simplify(const std::size_t targetIndexCount, const Float targetError) {
+    const Double errorLimit = Double(targetError)*Double(targetError);
+    bool collapsed = false;
+    while(_indices.size() > targetIndexCount && pass(targetIndexCount, errorLimit))
+        collapsed = true;
+    return collapsed;
+}
+
+}
+
+std::vector<UnsignedInt> simplifyIndices(const Trade::MeshData3D& mesh, const std::size_t targetIndexCount, const Float targetError, Float* const resultError) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles && mesh.isIndexed(),
+        "MeshTools::simplifyIndices(): expected indexed triangle mesh", {});
+
+    Simplifier simplifier{mesh};
+    simplifier.simplify(targetIndexCount, targetError);
+    if(resultError) *resultError = simplifier.error();
+    return simplifier.indices();
+}
+
+Trade::MeshData3D simplify(const Trade::MeshData3D& mesh, const std::size_t targetIndexCount, const Float targetError, Float* const resultError) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles && mesh.isIndexed(),
+        "MeshTools::simplify(): expected indexed triangle mesh",
+        (Trade::MeshData3D{MeshPrimitive::Triangles, {}, {{}}, {}, {}}));
+
+    Simplifier simplifier{mesh};
+    simplifier.simplify(targetIndexCount, targetError);
+    if(resultError) *resultError = simplifier.error();
+
+    /* Keep only the used vertices */
+    std::vector<UnsignedInt> indices = simplifier.indices();
+    const std::vector<UnsignedInt> remap = optimizeVertexFetchRemap(indices, mesh.positions(0).size());
+    UnsignedInt vertexCount = 0;
+    for(const UnsignedInt id: remap)
+        if(id != 0xffffffffu) ++vertexCount;
+
+    std::vector<std::vector<Vector3>> positions(mesh.positionArrayCount());
+    for(UnsignedInt i = 0; i != positions.size(); ++i) {
+        positions[i] = mesh.positions(i);
+        Implementation::optimizeVertexFetchRemapData(remap, vertexCount, positions[i]);
+    }
+    std::vector<std::vector<Vector3>> normals(mesh.normalArrayCount());
+    for(UnsignedInt i = 0; i != normals.size(); ++i) {
+        normals[i] = mesh.normals(i);
+        Implementation::optimizeVertexFetchRemapData(remap, vertexCount, normals[i]);
+    }
+    std::vector<std::vector<Vector2>> textureCoords2D(mesh.textureCoords2DArrayCount());
+    for(UnsignedInt i = 0; i != textureCoords2D.size(); ++i) {
+        textureCoords2D[i] = mesh.textureCoords2D(i);
+        Implementation::optimizeVertexFetchRemapData(remap, vertexCount, textureCoords2D[i]);
+    }
+
+    return Trade::MeshData3D{MeshPrimitive::Triangles, std::move(indices), std::move(positions), std::move(normals), std::move(textureCoords2D)};
+}
+
+std::vector<std::vector<UnsignedInt>> simplifyLodChain(const Trade::MeshData3D& mesh, const UnsignedInt levelCount, const Float ratio, const Float targetError) {
+    CORRADE_ASSERT(mesh.primitive() == MeshPrimitive::Triangles && mesh.isIndexed(),
+        "MeshTools::simplifyLodChain(): expected indexed triangle mesh", {});
+    CORRADE_ASSERT(ratio > 0.0f && ratio < 1.0f,
+        "MeshTools::simplifyLodChain(): expected ratio between 0 and 1 but got" << ratio, {});
+
+    std::vector<std::vector<UnsignedInt>> levels;
+    if(!levelCount) return levels;
+
+    Simplifier simplifier{mesh};
+    levels.push_back(simplifier.indices());
+    for(UnsignedInt i = 1; i != levelCount; ++i) {
+        const std::size_t targetIndexCount = std::size_t(levels.back().size()*ratio)/3*3;
+        if(!simplifier.simplify(targetIndexCount, targetError)) break;
+        levels.push_back(simplifier.indices());
+    }
+
+    return levels;
+}
+
+}}
@@ -0,0 +1,124 @@
+#ifndef Magnum_MeshTools_Simplify_h
+#define Magnum_MeshTools_Simplify_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::MeshTools::simplifyIndices(), @ref Magnum::MeshTools::simplify(), @ref Magnum::MeshTools::simplifyLodChain()
+ */
+
+#include <vector>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace MeshTools {
+
+/**
+@brief Simplify mesh indices
+@param mesh             Indexed triangle mesh
+@param targetIndexCount Target index count
+@param targetError      Max allowed error relative to mesh size
+@param[out] resultError Resulting error relative to mesh size
+@return Simplified index array referencing vertices of the original mesh
+
+Reduces triangle count of the mesh using edge collapses ordered by quadric
+error metric. The vertices are collapsed onto their neighbors instead of
+being moved to new positions, so the returned indices can be used with the
+original vertex data. The error is calculated from the first position array.
+If the mesh has normals or texture coordinates, difference between the first
+array of these and the value interpolated at the collapsed vertex is included
+in the error as well, so attributes varying linearly across the surface don't
+prevent the simplification. The simplification stops when the index count is at or
+below @p targetIndexCount or when no collapse is possible without exceeding
+@p targetError. Error of `0.01f` means a distance of about 1% of the largest
+mesh bounding box dimension.
+
+Vertices on open mesh boundaries only collapse along the boundary. Vertices
+sharing position with other vertices (i.e., on seams where normals or texture
+coordinates are discontinuous) and vertices on non-manifold edges are kept to
+avoid cracks. Collapses that would flip a triangle or make the mesh
+non-manifold are not performed.
+@see @ref simplify(), @ref simplifyLodChain(), @ref optimizeVertexFetch()
+*/
+std::vector<UnsignedInt> MAGNUM_MESHTOOLS_EXPORT simplifyIndices(const Trade::MeshData3D& mesh, std::size_t targetIndexCount, Float targetError = 0.01f, Float* resultError = nullptr);
+
+/**
+@brief Simplify mesh
+
+Same as @ref simplifyIndices(), but returns a mesh with vertex data
+containing only vertices referenced by the simplified index array, ordered
+for linear vertex fetch. All attribute arrays of the original mesh are
+preserved. Importer state is not copied.
+*/
+Trade::MeshData3D MAGNUM_MESHTOOLS_EXPORT simplify(const Trade::MeshData3D& mesh, std::size_t targetIndexCount, Float targetError = 0.01f, Float* resultError = nullptr);
+
+/**
+@brief Create level-of-detail chain
+@param mesh         Indexed triangle mesh
+@param levelCount   Max count of levels, including the original
+@param ratio        Ratio of index count of each level to previous level
+@param targetError  Max allowed error of the last level relative to mesh size
+@return Index arrays of all levels, each referencing vertices of the original
+    mesh
+
+The first level is the original index array, each next level is simplified
+from the previous one so the whole chain is created in time comparable to a
+single @ref simplifyIndices() call, with error accumulated relative to the
+original mesh. If a level can't be simplified without exceeding
+@p targetError, the chain ends there, thus it can have less than
+@p levelCount levels.
+
+All levels share the original vertex data, so it's possible to upload it just
+once and switch only the index buffer based on distance:
+@code
+Trade::MeshData3D data;
+
+std::vector<std::vector<UnsignedInt>> lods = MeshTools::simplifyLodChain(data, 4);
+
+Buffer vertices;
+vertices.setData(MeshTools::interleave(data.positions(0), data.normals(0)), BufferUsage::StaticDraw);
+
+std::vector<Buffer> indices(lods.size());
+std::vector<Mesh> meshes(lods.size());
+for(std::size_t i = 0; i != lods.size(); ++i) {
+    Containers::Array<char> indexData;
+    Mesh::IndexType indexType;
+    UnsignedInt indexStart, indexEnd;
+    std::tie(indexData, indexType, indexStart, indexEnd) = MeshTools::compressIndices(lods[i]);
+    indices[i].setData(indexData, BufferUsage::StaticDraw);
+
+    meshes[i].setCount(lods[i].size())
+        .addVertexBuffer(vertices, 0, Shaders::Phong::Position{}, Shaders::Phong::Normal{})
+        .setIndexBuffer(indices[i], 0, indexType, indexStart, indexEnd);
+}
+@endcode
+*/
+std::vector<std::vector<UnsignedInt>> MAGNUM_MESHTOOLS_EXPORT simplifyLodChain(const Trade::MeshData3D& mesh, UnsignedInt levelCount, Float ratio = 0.5f, Float targetError = 0.05f);
+
+}}
+
+#endif
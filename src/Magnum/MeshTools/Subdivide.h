@@ -26,12 +26,15 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::subdivide()
+ * @brief Function @ref Magnum::MeshTools::subdivide(), @ref Magnum::MeshTools::subdivideWelded()
  */
 
 #include <vector>
+#include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 
+#include "Magnum/Types.h"
+
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
@@ -70,7 +73,8 @@ template<class Vertex, class Interpolator> class Subdivide {
     two adjacent vertices: `Vertex interpolator(Vertex a, Vertex b)`
 
 Goes through all triangle faces and subdivides them into four new. Removing
-duplicate vertices in the mesh is up to user.
+duplicate vertices in the mesh is up to user. Use @ref subdivideWelded() to
+create shared vertices on shared edges directly.
 */
 template<class Vertex, class Interpolator> inline void subdivide(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, Interpolator interpolator) {
     Implementation::Subdivide<Vertex, Interpolator>(indices, vertices)(interpolator);
@@ -114,6 +118,121 @@ template<class Vertex, class Interpolator> void Subdivide<Vertex, Interpolator>:
 
 }
 
+namespace Implementation {
+
+/* Open-addressed hash table of edge midpoints, storing only the new vertex
+   ID. The edge endpoints are looked up in the edge array. */
+inline UnsignedInt subdivideEdgeHash(const UnsignedInt a, const UnsignedInt b) {
+    UnsignedInt h = a*0x9e3779b1u ^ (b + 0x7f4a7c15u + (a << 6) + (a >> 2));
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/* Subdivides the index array in place, each triangle is replaced with its
+   four children so the adjacent triangles stay close in memory. Endpoints of
+   edges for the new vertices (with IDs starting at vertexCount) are written
+   to edges, two for each new vertex. */
+inline void subdivideWeldedIndices(std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, std::vector<UnsignedInt>& midpoints, std::vector<UnsignedInt>& table, std::vector<UnsignedInt>& edges) {
+    const std::size_t indexCount = indices.size();
+
+    /* Up to 3 unique edges per triangle, keep the load below 0.75 */
+    std::size_t tableSize = 1;
+    while(tableSize < indexCount + indexCount/3) tableSize <<= 1;
+    table.assign(tableSize, 0xffffffffu);
+    edges.clear();
+
+    /* Assign new vertex IDs to unique edges in order of first occurrence */
+    midpoints.resize(indexCount);
+    for(std::size_t i = 0; i != indexCount; ++i) {
+        const UnsignedInt first = indices[i], second = indices[i - i%3 + (i + 1)%3];
+        const UnsignedInt a = first < second ? first : second;
+        const UnsignedInt b = first < second ? second : first;
+
+        std::size_t slot = subdivideEdgeHash(a, b) & (tableSize - 1);
+        for(;;) {
+            const UnsignedInt id = table[slot];
+            if(id == 0xffffffffu) {
+                table[slot] = midpoints[i] = vertexCount + edges.size()/2;
+                edges.push_back(a);
+                edges.push_back(b);
+                break;
+            }
+
+            const std::size_t edge = std::size_t(id - vertexCount)*2;
+            if(edges[edge] == a && edges[edge + 1] == b) {
+                midpoints[i] = id;
+                break;
+            }
+
+            slot = (slot + 1) & (tableSize - 1);
+        }
+    }
+
+    /* Expand from the back so no triangle is overwritten before it's read,
+       the children are the same as in subdivide() */
+    indices.resize(indexCount*4);
+    for(std::size_t i = indexCount; i != 0; ) {
+        i -= 3;
+        const UnsignedInt o0 = indices[i], o1 = indices[i + 1], o2 = indices[i + 2];
+        const UnsignedInt n0 = midpoints[i], n1 = midpoints[i + 1], n2 = midpoints[i + 2];
+        UnsignedInt* out = indices.data() + i*4;
+        out[0] = n0; out[1] = n1; out[2] = n2;
+        out[3] = o0; out[4] = n0; out[5] = n2;
+        out[6] = n0; out[7] = o1; out[8] = n1;
+        out[9] = n2; out[10] = n1; out[11] = o2;
+    }
+}
+
+}
+
+/**
+@brief Subdivide the mesh with shared edge midpoints
+@tparam Vertex          Vertex data type
+@tparam Interpolator    See `interpolator` function parameter
+@param[in,out] indices  Index array to operate on
+@param[in,out] vertices Vertex array to operate on
+@param interpolator     Functor or function pointer which interpolates
+    two adjacent vertices: `Vertex interpolator(Vertex a, Vertex b)`
+@param levelCount       Count of subdivision levels
+
+Like @ref subdivide(), but creates just one new vertex for each unique edge,
+so triangles sharing an edge also share its midpoint and the output doesn't
+need @ref removeDuplicates() afterwards. The edges are identified by vertex
+IDs, thus the input is expected to be already without duplicates. Each
+triangle is replaced with its four children in place, the index and vertex
+arrays are grown to their final size just once for each level. Multiple
+levels are done at once if @p levelCount is larger than `1`, which is
+equivalent to calling the function repeatedly, but reuses the temporary
+memory.
+@code
+std::vector<UnsignedInt> indices;
+std::vector<Vector3> positions;
+MeshTools::subdivideWelded(indices, positions, [](const Vector3& a, const Vector3& b) {
+    return (a+b).normalized();
+}, 3);
+@endcode
+*/
+template<class Vertex, class Interpolator> void subdivideWelded(std::vector<UnsignedInt>& indices, std::vector<Vertex>& vertices, Interpolator interpolator, const UnsignedInt levelCount = 1) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::subdivideWelded(): index count is not divisible by 3!", );
+
+    std::size_t finalIndexCount = indices.size();
+    for(UnsignedInt i = 0; i != levelCount; ++i) finalIndexCount *= 4;
+    indices.reserve(finalIndexCount);
+
+    std::vector<UnsignedInt> midpoints, table, edges;
+    for(UnsignedInt level = 0; level != levelCount; ++level) {
+        Implementation::subdivideWeldedIndices(indices, vertices.size(), midpoints, table, edges);
+
+        vertices.reserve(vertices.size() + edges.size()/2);
+        for(std::size_t i = 0; i != edges.size(); i += 2)
+            vertices.push_back(interpolator(vertices[edges[i]], vertices[edges[i + 1]]));
+    }
+}
+
 }}
 
 #endif
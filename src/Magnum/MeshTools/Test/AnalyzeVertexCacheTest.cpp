@@ -0,0 +1,131 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/AnalyzeVertexCache.h"
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct AnalyzeVertexCacheTest: TestSuite::Tester {
+    explicit AnalyzeVertexCacheTest();
+
+    void wrongIndexCount();
+    void indexOutOfRange();
+
+    void empty();
+    void analyze();
+    void unreferencedVertices();
+    void tipsified();
+};
+
+AnalyzeVertexCacheTest::AnalyzeVertexCacheTest() {
+    addTests({&AnalyzeVertexCacheTest::wrongIndexCount,
+              &AnalyzeVertexCacheTest::indexOutOfRange,
+
+              &AnalyzeVertexCacheTest::empty,
+              &AnalyzeVertexCacheTest::analyze,
+              &AnalyzeVertexCacheTest::unreferencedVertices,
+              &AnalyzeVertexCacheTest::tipsified});
+}
+
+void AnalyzeVertexCacheTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    MeshTools::analyzeVertexCache({0, 1}, 2, 16);
+    CORRADE_COMPARE(ss.str(), "MeshTools::analyzeVertexCache(): index count is not divisible by 3\n");
+}
+
+void AnalyzeVertexCacheTest::indexOutOfRange() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    MeshTools::analyzeVertexCache({0, 1, 3}, 3, 16);
+    CORRADE_COMPARE(ss.str(), "MeshTools::analyzeVertexCache(): index 3 out of range for 3 vertices\n");
+}
+
+void AnalyzeVertexCacheTest::empty() {
+    const VertexCacheStatistics statistics = MeshTools::analyzeVertexCache({}, 0, 16);
+    CORRADE_COMPARE(statistics.transformedVertexCount, 0);
+    CORRADE_COMPARE(statistics.acmr, 0.0f);
+    CORRADE_COMPARE(statistics.atvr, 0.0f);
+}
+
+void AnalyzeVertexCacheTest::analyze() {
+    const std::vector<UnsignedInt> indices{0, 1, 2, 1, 2, 3};
+
+    /* Everything fits into the cache */
+    {
+        const VertexCacheStatistics statistics = MeshTools::analyzeVertexCache(indices, 4, 3);
+        CORRADE_COMPARE(statistics.transformedVertexCount, 4);
+        CORRADE_COMPARE(statistics.acmr, 2.0f);
+        CORRADE_COMPARE(statistics.atvr, 1.0f);
+
+    /* Only the last vertex stays in the cache, which isn't enough for any
+       reuse */
+    } {
+        const VertexCacheStatistics statistics = MeshTools::analyzeVertexCache(indices, 4, 1);
+        CORRADE_COMPARE(statistics.transformedVertexCount, 6);
+        CORRADE_COMPARE(statistics.acmr, 3.0f);
+        CORRADE_COMPARE(statistics.atvr, 1.5f);
+    }
+}
+
+void AnalyzeVertexCacheTest::unreferencedVertices() {
+    /* Vertices 0 and 2 are not referenced, so they don't count towards
+       ATVR */
+    const VertexCacheStatistics statistics = MeshTools::analyzeVertexCache({1, 3, 4}, 5, 16);
+    CORRADE_COMPARE(statistics.transformedVertexCount, 3);
+    CORRADE_COMPARE(statistics.acmr, 3.0f);
+    CORRADE_COMPARE(statistics.atvr, 1.0f);
+}
+
+void AnalyzeVertexCacheTest::tipsified() {
+    /* Grid of 32x32 quads, row by row, which thrashes a small cache on every
+       row */
+    constexpr UnsignedInt Size = 32;
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt y = 0; y != Size; ++y) for(UnsignedInt x = 0; x != Size; ++x) {
+        const UnsignedInt i = y*(Size + 1) + x;
+        indices.insert(indices.end(), {i, i + 1, i + Size + 1,
+                                       i + Size + 1, i + 1, i + Size + 2});
+    }
+    constexpr UnsignedInt VertexCount = (Size + 1)*(Size + 1);
+
+    const VertexCacheStatistics before = MeshTools::analyzeVertexCache(indices, VertexCount, 12);
+    MeshTools::tipsify(indices, VertexCount, 12);
+    const VertexCacheStatistics after = MeshTools::analyzeVertexCache(indices, VertexCount, 12);
+
+    CORRADE_COMPARE(before.transformedVertexCount, 2*Size*(Size + 1));
+    CORRADE_VERIFY(after.acmr < before.acmr);
+    CORRADE_VERIFY(after.atvr < before.atvr);
+    CORRADE_VERIFY(after.atvr >= 1.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::AnalyzeVertexCacheTest)
@@ -0,0 +1,95 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshTools/BuildMeshlets.h"
+#include "Magnum/MeshTools/Tipsify.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Test/BenchmarkTimer.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct BuildMeshletsBenchmark: TestSuite::Tester {
+    explicit BuildMeshletsBenchmark();
+
+    void icosphere();
+    void icosphereTipsified();
+    void icosphereSmallMeshlets();
+};
+
+BuildMeshletsBenchmark::BuildMeshletsBenchmark() {
+    addTests({&BuildMeshletsBenchmark::icosphere,
+              &BuildMeshletsBenchmark::icosphereTipsified,
+              &BuildMeshletsBenchmark::icosphereSmallMeshlets});
+}
+
+namespace {
+    /* 327680 triangles, 163842 vertices */
+    constexpr UnsignedInt Subdivisions = 7;
+
+    /* Runs the function a few times and prints the best time together with
+       meshlet statistics, returns output of the last run */
+    Meshlets measure(const char* name, const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt maxVertices, const UnsignedInt maxTriangles) {
+        Meshlets meshlets;
+        Magnum::Test::BenchmarkTimer timer;
+        for(std::size_t i = 0; i != 3; ++i) timer.measure([&]() {
+            meshlets = MeshTools::buildMeshlets(indices, positions, maxVertices, maxTriangles);
+        });
+
+        Debug() << "   " << name << timer.milliseconds() << "ms," << meshlets.meshlets.size() << "meshlets, on average"
+            << Float(meshlets.vertices.size())/meshlets.meshlets.size() << "vertices and"
+            << Float(indices.size()/3)/meshlets.meshlets.size() << "triangles";
+        return meshlets;
+    }
+}
+
+void BuildMeshletsBenchmark::icosphere() {
+    const Trade::MeshData3D icosphere = Primitives::Icosphere::solid(Subdivisions);
+
+    const Meshlets meshlets = measure("buildMeshlets()", icosphere.indices(), icosphere.positions(0), 64, 124);
+    CORRADE_COMPARE(meshlets.indices.size(), icosphere.indices().size());
+}
+
+void BuildMeshletsBenchmark::icosphereTipsified() {
+    const Trade::MeshData3D icosphere = Primitives::Icosphere::solid(Subdivisions);
+    std::vector<UnsignedInt> indices = icosphere.indices();
+    MeshTools::tipsify(indices, icosphere.positions(0).size(), 24);
+
+    const Meshlets meshlets = measure("buildMeshlets() on tipsified mesh", indices, icosphere.positions(0), 64, 124);
+    CORRADE_COMPARE(meshlets.indices.size(), indices.size());
+}
+
+void BuildMeshletsBenchmark::icosphereSmallMeshlets() {
+    const Trade::MeshData3D icosphere = Primitives::Icosphere::solid(Subdivisions);
+
+    const Meshlets meshlets = measure("buildMeshlets() with 32/64 limits", icosphere.indices(), icosphere.positions(0), 32, 64);
+    CORRADE_COMPARE(meshlets.indices.size(), icosphere.indices().size());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::BuildMeshletsBenchmark)
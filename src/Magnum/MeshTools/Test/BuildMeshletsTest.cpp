@@ -0,0 +1,215 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <array>
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/BuildMeshlets.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct BuildMeshletsTest: TestSuite::Tester {
+    explicit BuildMeshletsTest();
+
+    void wrongIndexCount();
+    void wrongLimits();
+
+    void empty();
+    void grid();
+    void gridTriangleLimit();
+    void disconnected();
+    void closed();
+
+    void verifyMeshlets(const Meshlets& meshlets, const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, UnsignedInt maxVertices, UnsignedInt maxTriangles);
+};
+
+BuildMeshletsTest::BuildMeshletsTest() {
+    addTests({&BuildMeshletsTest::wrongIndexCount,
+              &BuildMeshletsTest::wrongLimits,
+
+              &BuildMeshletsTest::empty,
+              &BuildMeshletsTest::grid,
+              &BuildMeshletsTest::gridTriangleLimit,
+              &BuildMeshletsTest::disconnected,
+              &BuildMeshletsTest::closed});
+}
+
+namespace {
+    /* Flat grid of size*size quads in the XY plane, facing +Z */
+    void grid(const UnsignedInt size, std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+        for(UnsignedInt y = 0; y != size + 1; ++y) for(UnsignedInt x = 0; x != size + 1; ++x)
+            positions.emplace_back(Float(x), Float(y), 0.0f);
+        for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+            const UnsignedInt i = y*(size + 1) + x;
+            indices.insert(indices.end(), {i, i + 1, i + size + 2,
+                                           i, i + size + 2, i + size + 1});
+        }
+    }
+}
+
+/* Checks limits and that the meshlets contain all original triangles
+   exactly once, with all vertices inside the bounding sphere */
+void BuildMeshletsTest::verifyMeshlets(const Meshlets& meshlets, const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions, const UnsignedInt maxVertices, const UnsignedInt maxTriangles) {
+    auto triangles = [](const std::vector<UnsignedInt>& indices) {
+        std::vector<std::array<UnsignedInt, 3>> out;
+        for(std::size_t i = 0; i != indices.size(); i += 3) {
+            /* Rotate to have the smallest index first to preserve winding */
+            const std::size_t first = std::min_element(indices.begin() + i, indices.begin() + i + 3) - indices.begin() - i;
+            out.push_back({{indices[i + first], indices[i + (first + 1)%3], indices[i + (first + 2)%3]}});
+        }
+        std::sort(out.begin(), out.end());
+        return out;
+    };
+
+    std::vector<UnsignedInt> reconstructed;
+    std::size_t vertexOffset = 0, indexOffset = 0;
+    for(const Meshlet& meshlet: meshlets.meshlets) {
+        CORRADE_COMPARE(meshlet.vertexOffset, vertexOffset);
+        CORRADE_COMPARE(meshlet.indexOffset, indexOffset);
+        CORRADE_VERIFY(meshlet.vertexCount <= maxVertices);
+        CORRADE_VERIFY(meshlet.triangleCount <= maxTriangles);
+        CORRADE_VERIFY(meshlet.triangleCount);
+        vertexOffset += meshlet.vertexCount;
+        indexOffset += meshlet.triangleCount*3;
+
+        for(std::size_t i = meshlet.indexOffset; i != meshlet.indexOffset + meshlet.triangleCount*3; ++i) {
+            CORRADE_VERIFY(meshlets.indices[i] < meshlet.vertexCount);
+            reconstructed.push_back(meshlets.vertices[meshlet.vertexOffset + meshlets.indices[i]]);
+        }
+
+        for(std::size_t i = meshlet.vertexOffset; i != meshlet.vertexOffset + meshlet.vertexCount; ++i)
+            CORRADE_VERIFY((positions[meshlets.vertices[i]] - meshlet.center).length() <= meshlet.radius*1.0001f);
+    }
+
+    CORRADE_COMPARE(vertexOffset, meshlets.vertices.size());
+    CORRADE_COMPARE(indexOffset, meshlets.indices.size());
+    CORRADE_VERIFY(triangles(reconstructed) == triangles(indices));
+}
+
+void BuildMeshletsTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    MeshTools::buildMeshlets({0, 1}, {{}, {}});
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::buildMeshlets(): index count is not divisible by 3\n");
+}
+
+void BuildMeshletsTest::wrongLimits() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    MeshTools::buildMeshlets({}, {}, 2);
+    MeshTools::buildMeshlets({}, {}, 257);
+    MeshTools::buildMeshlets({}, {}, 64, 0);
+
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::buildMeshlets(): expected max vertex count between 3 and 256 but got 2\n"
+        "MeshTools::buildMeshlets(): expected max vertex count between 3 and 256 but got 257\n"
+        "MeshTools::buildMeshlets(): max triangle count can't be zero\n");
+}
+
+void BuildMeshletsTest::empty() {
+    const Meshlets meshlets = MeshTools::buildMeshlets({}, {});
+    CORRADE_VERIFY(meshlets.meshlets.empty());
+    CORRADE_VERIFY(meshlets.vertices.empty());
+    CORRADE_VERIFY(meshlets.indices.empty());
+}
+
+void BuildMeshletsTest::grid() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    Test::grid(32, indices, positions);
+
+    const Meshlets meshlets = MeshTools::buildMeshlets(indices, positions, 64, 124);
+    verifyMeshlets(meshlets, indices, positions, 64, 124);
+
+    /* At least 17 meshlets are needed because of the triangle limit. Compact
+       meshlets shouldn't need many more. */
+    CORRADE_VERIFY(meshlets.meshlets.size() >= 17);
+    CORRADE_VERIFY(meshlets.meshlets.size() <= 24);
+
+    /* All meshlets are facing +Z */
+    for(const Meshlet& meshlet: meshlets.meshlets) {
+        CORRADE_COMPARE(meshlet.coneAxis, Vector3::zAxis());
+        CORRADE_COMPARE(meshlet.coneCutoff, 0.0f);
+    }
+}
+
+void BuildMeshletsTest::gridTriangleLimit() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    Test::grid(10, indices, positions);
+
+    const Meshlets meshlets = MeshTools::buildMeshlets(indices, positions, 256, 16);
+    verifyMeshlets(meshlets, indices, positions, 256, 16);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 13);
+}
+
+void BuildMeshletsTest::disconnected() {
+    const std::vector<UnsignedInt> indices{0, 1, 2, 3, 4, 5};
+    const std::vector<Vector3> positions{
+        {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+        {5.0f, 0.0f, 0.0f}, {6.0f, 0.0f, 0.0f}, {5.0f, 1.0f, 0.0f}};
+
+    /* Both triangles fit into one meshlet */
+    Meshlets meshlets = MeshTools::buildMeshlets(indices, positions);
+    verifyMeshlets(meshlets, indices, positions, 64, 124);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 1);
+    CORRADE_COMPARE(meshlets.vertices, (std::vector<UnsignedInt>{0, 1, 2, 3, 4, 5}));
+    CORRADE_COMPARE(meshlets.indices, (std::vector<UnsignedByte>{0, 1, 2, 3, 4, 5}));
+    CORRADE_COMPARE(meshlets.meshlets[0].center, (Vector3{3.0f, 0.5f, 0.0f}));
+
+    /* Not enough vertices, each triangle is a separate meshlet */
+    meshlets = MeshTools::buildMeshlets(indices, positions, 5);
+    verifyMeshlets(meshlets, indices, positions, 5, 124);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 2);
+}
+
+void BuildMeshletsTest::closed() {
+    /* Tetrahedron with outward-facing triangles */
+    const std::vector<UnsignedInt> indices{0, 2, 1, 0, 1, 3, 1, 2, 3, 2, 0, 3};
+    const std::vector<Vector3> positions{
+        {0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}};
+
+    Meshlets meshlets = MeshTools::buildMeshlets(indices, positions);
+    verifyMeshlets(meshlets, indices, positions, 64, 124);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 1);
+
+    /* Normals are in all directions, the meshlet can't be culled */
+    CORRADE_COMPARE(meshlets.meshlets[0].coneCutoff, 1.0f);
+
+    /* Just the bottom and front face, the cone is between them */
+    meshlets = MeshTools::buildMeshlets({0, 2, 1, 0, 1, 3}, positions);
+    CORRADE_COMPARE(meshlets.meshlets.size(), 1);
+    CORRADE_COMPARE(meshlets.meshlets[0].coneAxis, (Vector3{0.0f, -1.0f, -1.0f}).normalized());
+    CORRADE_COMPARE(meshlets.meshlets[0].coneCutoff, 1.0f/Constants::sqrt2());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::BuildMeshletsTest)
@@ -0,0 +1,217 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/MurmurHash2.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/CombineIndexedArrays.h"
+#include "Magnum/Test/BenchmarkTimer.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct CombineIndexArraysBenchmark: TestSuite::Tester {
+    explicit CombineIndexArraysBenchmark();
+
+    void smallPreviousImplementation();
+    void small();
+    void smallParallel();
+
+    void large();
+    void largeParallel();
+};
+
+CombineIndexArraysBenchmark::CombineIndexArraysBenchmark() {
+    addTests({&CombineIndexArraysBenchmark::smallPreviousImplementation,
+              &CombineIndexArraysBenchmark::small,
+              &CombineIndexArraysBenchmark::smallParallel,
+
+              &CombineIndexArraysBenchmark::large,
+              &CombineIndexArraysBenchmark::largeParallel});
+}
+
+namespace {
+    /* Position, normal and texture coordinate indices of a grid with 1M and
+       50M index tuples, with each vertex shared by six triangles like in
+       a typical OBJ file */
+    constexpr std::size_t SmallCount = 1000*1000;
+    constexpr std::size_t LargeCount = 50*1000*1000;
+
+    struct Indices {
+        std::vector<UnsignedInt> positions, normals, textureCoordinates;
+    };
+
+    const Indices& indices(const std::size_t count) {
+        static Indices small, large;
+        Indices& out = count == SmallCount ? small : large;
+        if(!out.positions.empty()) return out;
+
+        const UnsignedInt size = UnsignedInt(std::sqrt(count/6));
+        out.positions.reserve(count);
+        for(UnsignedInt i = 0; out.positions.size() < count; ++i) {
+            const UnsignedInt y = (i/size) % size, x = i % size;
+            const UnsignedInt v = y*(size + 1) + x;
+            out.positions.insert(out.positions.end(), {v, v + 1, v + size + 1,
+                                                       v + size + 1, v + 1, v + size + 2});
+        }
+        out.positions.resize(count);
+
+        /* Normals are smooth except for every seventh vertex, texture
+           coordinates have a seam at every 16th column */
+        out.normals.resize(count);
+        out.textureCoordinates.resize(count);
+        for(std::size_t i = 0; i != count; ++i) {
+            const UnsignedInt p = out.positions[i];
+            out.normals[i] = p % 7 ? p : p + UnsignedInt(i % 3);
+            out.textureCoordinates[i] = p % 16 ? p : p + UnsignedInt(i % 2);
+        }
+
+        return out;
+    }
+
+    class IndexHash {
+        public:
+            explicit IndexHash(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
+
+            std::size_t operator()(UnsignedInt key) const {
+                return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(indices.data()+key*stride), sizeof(UnsignedInt)*stride).byteArray());
+            }
+
+        private:
+            const std::vector<UnsignedInt>& indices;
+            UnsignedInt stride;
+    };
+
+    class IndexEqual {
+        public:
+            explicit IndexEqual(const std::vector<UnsignedInt>& indices, UnsignedInt stride): indices(indices), stride(stride) {}
+
+            bool operator()(UnsignedInt a, UnsignedInt b) const {
+                return std::memcmp(indices.data()+a*stride, indices.data()+b*stride, sizeof(UnsignedInt)*stride) == 0;
+            }
+
+        private:
+            const std::vector<UnsignedInt>& indices;
+            UnsignedInt stride;
+    };
+
+    /* Implementation before the hash table rewrite, interleaving the arrays
+       and deduplicating them with std::unordered_map */
+    std::vector<UnsignedInt> combineIndexArraysPreviousImplementation(std::vector<UnsignedInt>& a, std::vector<UnsignedInt>& b, std::vector<UnsignedInt>& c) {
+        const std::size_t size = a.size();
+        std::vector<UnsignedInt> interleavedArrays(size*3);
+        for(std::size_t i = 0; i != size; ++i) {
+            interleavedArrays[i*3 + 0] = a[i];
+            interleavedArrays[i*3 + 1] = b[i];
+            interleavedArrays[i*3 + 2] = c[i];
+        }
+
+        std::unordered_map<UnsignedInt, UnsignedInt, IndexHash, IndexEqual> indexCombinations(
+            size, IndexHash(interleavedArrays, 3), IndexEqual(interleavedArrays, 3));
+        std::vector<UnsignedInt> combinedIndices;
+        combinedIndices.reserve(size);
+        std::vector<UnsignedInt> newInterleavedArrays;
+        for(std::size_t oldIndex = 0; oldIndex != size; ++oldIndex) {
+            const auto result = indexCombinations.emplace(oldIndex, indexCombinations.size());
+            combinedIndices.push_back(result.first->second);
+            if(result.second) newInterleavedArrays.insert(newInterleavedArrays.end(),
+                interleavedArrays.begin()+oldIndex*3,
+                interleavedArrays.begin()+(oldIndex+1)*3);
+        }
+
+        const std::size_t outputSize = newInterleavedArrays.size()/3;
+        a.resize(outputSize);
+        b.resize(outputSize);
+        c.resize(outputSize);
+        for(std::size_t i = 0; i != outputSize; ++i) {
+            a[i] = newInterleavedArrays[i*3 + 0];
+            b[i] = newInterleavedArrays[i*3 + 1];
+            c[i] = newInterleavedArrays[i*3 + 2];
+        }
+
+        return combinedIndices;
+    }
+
+    /* Runs the function on a fresh copy of the data a few times and prints
+       the best time, returns output of the last run */
+    template<class F> std::vector<UnsignedInt> measure(const char* name, const std::size_t count, const std::size_t iterations, F f) {
+        std::vector<UnsignedInt> result;
+        Magnum::Test::BenchmarkTimer timer;
+        for(std::size_t i = 0; i != iterations; ++i) {
+            Indices data = indices(count);
+            timer.measure([&]() { result = f(data); });
+        }
+
+        Debug() << "   " << name << timer.milliseconds() << "ms";
+        return result;
+    }
+
+    std::vector<UnsignedInt> expectedSmall() {
+        Indices data = indices(SmallCount);
+        return combineIndexArraysPreviousImplementation(data.positions, data.normals, data.textureCoordinates);
+    }
+}
+
+void CombineIndexArraysBenchmark::smallPreviousImplementation() {
+    const std::vector<UnsignedInt> result = measure("previous implementation", SmallCount, 3, [](Indices& data) {
+        return combineIndexArraysPreviousImplementation(data.positions, data.normals, data.textureCoordinates);
+    });
+    CORRADE_COMPARE(result.size(), SmallCount);
+}
+
+void CombineIndexArraysBenchmark::small() {
+    const std::vector<UnsignedInt> result = measure("combineIndexArrays()", SmallCount, 3, [](Indices& data) {
+        return MeshTools::combineIndexArrays({data.positions, data.normals, data.textureCoordinates});
+    });
+    CORRADE_VERIFY(result == expectedSmall());
+}
+
+void CombineIndexArraysBenchmark::smallParallel() {
+    const std::vector<UnsignedInt> result = measure("combineIndexArrays() on all threads", SmallCount, 3, [](Indices& data) {
+        return MeshTools::combineIndexArrays({data.positions, data.normals, data.textureCoordinates}, 0);
+    });
+    CORRADE_VERIFY(result == expectedSmall());
+}
+
+void CombineIndexArraysBenchmark::large() {
+    const std::vector<UnsignedInt> result = measure("combineIndexArrays()", LargeCount, 1, [](Indices& data) {
+        return MeshTools::combineIndexArrays({data.positions, data.normals, data.textureCoordinates});
+    });
+    CORRADE_COMPARE(result.size(), LargeCount);
+}
+
+void CombineIndexArraysBenchmark::largeParallel() {
+    const std::vector<UnsignedInt> result = measure("combineIndexArrays() on all threads", LargeCount, 1, [](Indices& data) {
+        return MeshTools::combineIndexArrays({data.positions, data.normals, data.textureCoordinates}, 0);
+    });
+    CORRADE_COMPARE(result.size(), LargeCount);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CombineIndexArraysBenchmark)
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
 #include <functional>
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
@@ -37,13 +38,37 @@ struct CombineIndexedArraysTest: TestSuite::Tester {
 
     void wrongIndexCount();
     void indexArrays();
+    void indexArraysInterleaved();
+    void indexArraysLarge();
+    void indexArraysParallel();
     void indexedArrays();
+    void indexedArraysParallel();
 };
 
 CombineIndexedArraysTest::CombineIndexedArraysTest() {
     addTests({&CombineIndexedArraysTest::wrongIndexCount,
               &CombineIndexedArraysTest::indexArrays,
-              &CombineIndexedArraysTest::indexedArrays});
+              &CombineIndexedArraysTest::indexArraysInterleaved,
+              &CombineIndexedArraysTest::indexArraysLarge,
+              &CombineIndexedArraysTest::indexArraysParallel,
+              &CombineIndexedArraysTest::indexedArrays,
+              &CombineIndexedArraysTest::indexedArraysParallel});
+}
+
+namespace {
+    /* Large enough to be processed on more threads, about 1/8 of the
+       combinations is unique */
+    constexpr std::size_t LargeCount = 1024*1024;
+
+    std::vector<UnsignedInt> largeIndices(const UnsignedInt seed, const UnsignedInt modulo) {
+        std::vector<UnsignedInt> out(LargeCount);
+        UnsignedInt state = seed;
+        for(UnsignedInt& i: out) {
+            state = state*1664525u + 1013904223u;
+            i = (state >> 8) % modulo;
+        }
+        return out;
+    }
 }
 
 void CombineIndexedArraysTest::wrongIndexCount() {
@@ -68,6 +93,55 @@ void CombineIndexedArraysTest::indexArrays() {
     CORRADE_COMPARE(c, (std::vector<UnsignedInt>{6, 7}));
 }
 
+void CombineIndexedArraysTest::indexArraysInterleaved() {
+    std::vector<UnsignedInt> result;
+    std::vector<UnsignedInt> interleaved;
+    std::tie(result, interleaved) = MeshTools::combineIndexArrays(
+        std::vector<UnsignedInt>{0, 1, 2, 3, 5, 4, 0, 1, 0, 4, 1, 6, 3, 1, 2, 3, 2, 1}, 2);
+
+    CORRADE_COMPARE(result, (std::vector<UnsignedInt>{0, 1, 2, 0, 3, 4, 5, 1, 6}));
+    CORRADE_COMPARE(interleaved, (std::vector<UnsignedInt>{0, 1, 2, 3, 5, 4, 0, 4, 1, 6, 3, 1, 2, 1}));
+}
+
+void CombineIndexedArraysTest::indexArraysLarge() {
+    const std::vector<UnsignedInt> originalA = largeIndices(1, 512);
+    const std::vector<UnsignedInt> originalB = largeIndices(2, 256);
+    std::vector<UnsignedInt> a = originalA;
+    std::vector<UnsignedInt> b = originalB;
+
+    const std::vector<UnsignedInt> result = MeshTools::combineIndexArrays({a, b});
+    CORRADE_COMPARE(result.size(), LargeCount);
+    CORRADE_VERIFY(a.size() < LargeCount);
+    CORRADE_COMPARE(a.size(), b.size());
+
+    /* All combinations are unique and indexing them gives back the
+       original */
+    std::vector<UnsignedInt> combinations(a.size());
+    for(std::size_t i = 0; i != a.size(); ++i)
+        combinations[i] = a[i]*256 + b[i];
+    std::sort(combinations.begin(), combinations.end());
+    CORRADE_VERIFY(std::adjacent_find(combinations.begin(), combinations.end()) == combinations.end());
+    for(std::size_t i = 0; i != LargeCount; ++i) {
+        if(a[result[i]] == originalA[i] && b[result[i]] == originalB[i]) continue;
+        CORRADE_VERIFY(false);
+    }
+}
+
+void CombineIndexedArraysTest::indexArraysParallel() {
+    std::vector<UnsignedInt> a = largeIndices(1, 512);
+    std::vector<UnsignedInt> b = largeIndices(2, 256);
+    std::vector<UnsignedInt> parallelA = a;
+    std::vector<UnsignedInt> parallelB = b;
+
+    const std::vector<UnsignedInt> result = MeshTools::combineIndexArrays({a, b});
+    const std::vector<UnsignedInt> parallelResult = MeshTools::combineIndexArrays({parallelA, parallelB}, 4);
+
+    /* The output should be exactly the same as with serial processing */
+    CORRADE_VERIFY(parallelResult == result);
+    CORRADE_VERIFY(parallelA == a);
+    CORRADE_VERIFY(parallelB == b);
+}
+
 void CombineIndexedArraysTest::indexedArrays() {
     std::vector<UnsignedInt> a{0, 1, 0};
     std::vector<UnsignedInt> b{3, 4, 3};
@@ -87,6 +161,31 @@ void CombineIndexedArraysTest::indexedArrays() {
     CORRADE_COMPARE(array3, (std::vector<UnsignedInt>{6, 7}));
 }
 
+void CombineIndexedArraysTest::indexedArraysParallel() {
+    const std::vector<UnsignedInt> a = largeIndices(1, 512);
+    const std::vector<UnsignedInt> b = largeIndices(2, 256);
+
+    /* Attribute data equal to the indices, so the combined attributes are
+       the cleaned up index arrays */
+    std::vector<UnsignedInt> array1(512), array2(256);
+    for(std::size_t i = 0; i != array1.size(); ++i) array1[i] = i;
+    for(std::size_t i = 0; i != array2.size(); ++i) array2[i] = i;
+    std::vector<UnsignedInt> parallelArray1 = array1;
+    std::vector<UnsignedInt> parallelArray2 = array2;
+
+    const std::vector<UnsignedInt> result = MeshTools::combineIndexedArrays(
+        std::make_pair(std::cref(a), std::ref(array1)),
+        std::make_pair(std::cref(b), std::ref(array2)));
+    const std::vector<UnsignedInt> parallelResult = MeshTools::combineIndexedArrays(3,
+        std::make_pair(std::cref(a), std::ref(parallelArray1)),
+        std::make_pair(std::cref(b), std::ref(parallelArray2)));
+
+    /* The output should be exactly the same as with serial processing */
+    CORRADE_VERIFY(parallelResult == result);
+    CORRADE_VERIFY(parallelArray1 == array1);
+    CORRADE_VERIFY(parallelArray2 == array2);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CombineIndexedArraysTest)
@@ -0,0 +1,123 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/CompressIndices.h"
+#include "Magnum/Test/BenchmarkTimer.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct CompressIndicesBenchmark: TestSuite::Tester {
+    explicit CompressIndicesBenchmark();
+
+    void shortPreviousImplementation();
+    void compressShort();
+    void compressShortWithBaseVertex();
+};
+
+CompressIndicesBenchmark::CompressIndicesBenchmark() {
+    addTests({&CompressIndicesBenchmark::shortPreviousImplementation,
+              &CompressIndicesBenchmark::compressShort,
+              &CompressIndicesBenchmark::compressShortWithBaseVertex});
+}
+
+namespace {
+    /* 16M indices in range of 16-bit type */
+    constexpr std::size_t Count = 16*1024*1024;
+
+    const std::vector<UnsignedInt>& indices() {
+        static const std::vector<UnsignedInt> indices = []() {
+            std::vector<UnsignedInt> out(Count);
+            for(std::size_t i = 0; i != Count; ++i)
+                out[i] = (i*7919) % 65536;
+            return out;
+        }();
+        return indices;
+    }
+
+    /* Implementation before vectorization, with the range calculated using
+       std::minmax_element() and each element narrowed through memcpy() */
+    UnsignedInt previousMax;
+
+    Containers::Array<char> compressShortPreviousImplementation(const std::vector<UnsignedInt>& indices) {
+        const auto minmax = std::minmax_element(indices.begin(), indices.end());
+        previousMax = *minmax.second;
+
+        Containers::Array<char> buffer(indices.size()*sizeof(UnsignedShort));
+        for(std::size_t i = 0; i != indices.size(); ++i) {
+            UnsignedShort index = static_cast<UnsignedShort>(indices[i]);
+            std::memcpy(buffer.begin()+i*sizeof(UnsignedShort), &index, sizeof(UnsignedShort));
+        }
+
+        return buffer;
+    }
+
+    /* Runs the function a few times and prints the best time, returns output
+       of the last run */
+    template<class F> Containers::Array<char> measure(const char* name, F f) {
+        Containers::Array<char> result;
+        Magnum::Test::BenchmarkTimer timer;
+        for(std::size_t i = 0; i != 3; ++i)
+            timer.measure([&]() { result = f(indices()); });
+
+        Debug() << "   " << name << timer.milliseconds() << "ms";
+        return result;
+    }
+}
+
+void CompressIndicesBenchmark::shortPreviousImplementation() {
+    Containers::Array<char> result = measure("previous implementation", compressShortPreviousImplementation);
+    CORRADE_COMPARE(result.size(), Count*2);
+    CORRADE_COMPARE(previousMax, 65535);
+}
+
+void CompressIndicesBenchmark::compressShort() {
+    Containers::Array<char> result = measure("compressIndices()", [](const std::vector<UnsignedInt>& indices) {
+        return std::get<0>(MeshTools::compressIndices(indices));
+    });
+
+    Containers::Array<char> expected = compressShortPreviousImplementation(indices());
+    CORRADE_COMPARE(result.size(), expected.size());
+    CORRADE_VERIFY(std::memcmp(result.data(), expected.data(), expected.size()) == 0);
+}
+
+void CompressIndicesBenchmark::compressShortWithBaseVertex() {
+    Containers::Array<char> result = measure("compressIndicesWithBaseVertex()", [](const std::vector<UnsignedInt>& indices) {
+        return std::get<0>(MeshTools::compressIndicesWithBaseVertex(indices));
+    });
+
+    Containers::Array<char> expected = compressShortPreviousImplementation(indices());
+    CORRADE_COMPARE(result.size(), expected.size());
+    CORRADE_VERIFY(std::memcmp(result.data(), expected.data(), expected.size()) == 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::CompressIndicesBenchmark)
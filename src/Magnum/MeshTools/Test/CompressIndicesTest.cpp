@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
 #include <sstream>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -39,6 +40,13 @@ struct CompressIndicesTest: TestSuite::Tester {
     void compressChar();
     void compressShort();
     void compressInt();
+    void compressEmpty();
+    void compressView();
+    void compressLarge();
+
+    void compressWithBaseVertexChar();
+    void compressWithBaseVertexShort();
+    void compressWithBaseVertexLarge();
 
     void compressAsShort();
 };
@@ -47,10 +55,36 @@ CompressIndicesTest::CompressIndicesTest() {
     addTests({&CompressIndicesTest::compressChar,
               &CompressIndicesTest::compressShort,
               &CompressIndicesTest::compressInt,
+              &CompressIndicesTest::compressEmpty,
+              &CompressIndicesTest::compressView,
+              &CompressIndicesTest::compressLarge,
+
+              &CompressIndicesTest::compressWithBaseVertexChar,
+              &CompressIndicesTest::compressWithBaseVertexShort,
+              &CompressIndicesTest::compressWithBaseVertexLarge,
 
               &CompressIndicesTest::compressAsShort});
 }
 
+namespace {
+    /* Enough values to go through both the vectorized and scalar code
+       paths */
+    std::vector<UnsignedInt> largeIndices(const UnsignedInt base, const UnsignedInt range) {
+        std::vector<UnsignedInt> indices(1037);
+        for(std::size_t i = 0; i != indices.size(); ++i)
+            indices[i] = base + (i*7919) % (range + 1);
+        indices[523] = base + range;
+        indices[1031] = base;
+        return indices;
+    }
+
+    template<class T> std::vector<T> decompress(const Containers::Array<char>& data) {
+        std::vector<T> out(data.size()/sizeof(T));
+        std::memcpy(out.data(), data.data(), data.size());
+        return out;
+    }
+}
+
 void CompressIndicesTest::compressChar() {
     Containers::Array<char> data;
     Mesh::IndexType type;
@@ -114,6 +148,134 @@ void CompressIndicesTest::compressInt() {
     }
 }
 
+void CompressIndicesTest::compressEmpty() {
+    Containers::Array<char> data;
+    Mesh::IndexType type;
+    UnsignedInt start, end;
+    std::tie(data, type, start, end) = MeshTools::compressIndices(std::vector<UnsignedInt>{});
+
+    CORRADE_COMPARE(start, 0);
+    CORRADE_COMPARE(end, 0);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedByte);
+    CORRADE_VERIFY(data.empty());
+}
+
+void CompressIndicesTest::compressView() {
+    const UnsignedInt indices[]{1, 256, 0, 5};
+
+    Containers::Array<char> data;
+    Mesh::IndexType type;
+    UnsignedInt start, end;
+    std::tie(data, type, start, end) = MeshTools::compressIndices(indices);
+
+    CORRADE_COMPARE(start, 0);
+    CORRADE_COMPARE(end, 256);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedShort);
+    CORRADE_COMPARE(decompress<UnsignedShort>(data),
+        (std::vector<UnsignedShort>{1, 256, 0, 5}));
+}
+
+void CompressIndicesTest::compressLarge() {
+    Containers::Array<char> data;
+    Mesh::IndexType type;
+    UnsignedInt start, end;
+
+    const std::vector<UnsignedInt> chars = largeIndices(0, 255);
+    std::tie(data, type, start, end) = MeshTools::compressIndices(chars);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedByte);
+    CORRADE_COMPARE(start, 0);
+    CORRADE_COMPARE(end, 255);
+    CORRADE_COMPARE(decompress<UnsignedByte>(data), std::vector<UnsignedByte>(chars.begin(), chars.end()));
+
+    const std::vector<UnsignedInt> shorts = largeIndices(0, 65535);
+    std::tie(data, type, start, end) = MeshTools::compressIndices(shorts);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedShort);
+    CORRADE_COMPARE(start, 0);
+    CORRADE_COMPARE(end, 65535);
+    CORRADE_COMPARE(decompress<UnsignedShort>(data), std::vector<UnsignedShort>(shorts.begin(), shorts.end()));
+
+    const std::vector<UnsignedInt> ints = largeIndices(3, 0xfffffff0u);
+    std::tie(data, type, start, end) = MeshTools::compressIndices(ints);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedInt);
+    CORRADE_COMPARE(start, 3);
+    CORRADE_COMPARE(end, 0xfffffff3u);
+    CORRADE_COMPARE(decompress<UnsignedInt>(data), ints);
+}
+
+void CompressIndicesTest::compressWithBaseVertexChar() {
+    Containers::Array<char> data;
+    Mesh::IndexType type;
+    Int baseVertex;
+    UnsignedInt end;
+    std::tie(data, type, baseVertex, end) = MeshTools::compressIndicesWithBaseVertex(
+        std::vector<UnsignedInt>{70001, 70002, 70255, 70000, 70004});
+
+    CORRADE_COMPARE(baseVertex, 70000);
+    CORRADE_COMPARE(end, 255);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedByte);
+    CORRADE_COMPARE(decompress<UnsignedByte>(data),
+        (std::vector<UnsignedByte>{1, 2, 255, 0, 4}));
+}
+
+void CompressIndicesTest::compressWithBaseVertexShort() {
+    Containers::Array<char> data;
+    Mesh::IndexType type;
+    Int baseVertex;
+    UnsignedInt end;
+    std::tie(data, type, baseVertex, end) = MeshTools::compressIndicesWithBaseVertex(
+        std::vector<UnsignedInt>{1000000, 1000256, 1065535});
+
+    CORRADE_COMPARE(baseVertex, 1000000);
+    CORRADE_COMPARE(end, 65535);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedShort);
+    CORRADE_COMPARE(decompress<UnsignedShort>(data),
+        (std::vector<UnsignedShort>{0, 256, 65535}));
+}
+
+void CompressIndicesTest::compressWithBaseVertexLarge() {
+    Containers::Array<char> data;
+    Mesh::IndexType type;
+    Int baseVertex;
+    UnsignedInt end;
+
+    const std::vector<UnsignedInt> chars = largeIndices(0x7fffff00u, 255);
+    std::tie(data, type, baseVertex, end) = MeshTools::compressIndicesWithBaseVertex(chars);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedByte);
+    CORRADE_COMPARE(baseVertex, 0x7fffff00);
+    CORRADE_COMPARE(end, 255);
+    std::vector<UnsignedByte> expectedChars;
+    for(UnsignedInt i: chars) expectedChars.push_back(i - 0x7fffff00u);
+    CORRADE_COMPARE(decompress<UnsignedByte>(data), expectedChars);
+
+    const std::vector<UnsignedInt> shorts = largeIndices(100000, 65535);
+    std::tie(data, type, baseVertex, end) = MeshTools::compressIndicesWithBaseVertex(shorts);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedShort);
+    CORRADE_COMPARE(baseVertex, 100000);
+    CORRADE_COMPARE(end, 65535);
+    std::vector<UnsignedShort> expectedShorts;
+    for(UnsignedInt i: shorts) expectedShorts.push_back(i - 100000);
+    CORRADE_COMPARE(decompress<UnsignedShort>(data), expectedShorts);
+
+    const std::vector<UnsignedInt> ints = largeIndices(5, 70000);
+    std::tie(data, type, baseVertex, end) = MeshTools::compressIndicesWithBaseVertex(ints);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedInt);
+    CORRADE_COMPARE(baseVertex, 5);
+    CORRADE_COMPARE(end, 70000);
+    std::vector<UnsignedInt> expectedInts;
+    for(UnsignedInt i: ints) expectedInts.push_back(i - 5);
+    CORRADE_COMPARE(decompress<UnsignedInt>(data), expectedInts);
+
+    /* Base vertex is clamped to what Mesh::setBaseVertex() accepts */
+    const std::vector<UnsignedInt> clamped = largeIndices(0xffffff00u, 255);
+    std::tie(data, type, baseVertex, end) = MeshTools::compressIndicesWithBaseVertex(clamped);
+    CORRADE_COMPARE(type, Mesh::IndexType::UnsignedInt);
+    CORRADE_COMPARE(baseVertex, 0x7fffffff);
+    CORRADE_COMPARE(end, 0x80000000u);
+    std::vector<UnsignedInt> expectedClamped;
+    for(UnsignedInt i: clamped) expectedClamped.push_back(i - 0x7fffffffu);
+    CORRADE_COMPARE(decompress<UnsignedInt>(data), expectedClamped);
+}
+
 void CompressIndicesTest::compressAsShort() {
     CORRADE_COMPARE_AS(MeshTools::compressIndicesAs<UnsignedShort>({123, 456}),
         Containers::Array<UnsignedShort>::from(123, 456),
@@ -25,6 +25,7 @@
 
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/GenerateFlatNormals.h"
@@ -36,11 +37,23 @@ struct GenerateFlatNormalsTest: TestSuite::Tester {
 
     void wrongIndexCount();
     void generate();
+
+    void intoWrongIndexCount();
+    void intoWrongNormalCount();
+    void into();
+    void intoDegenerate();
+    void intoMultithreaded();
 };
 
 GenerateFlatNormalsTest::GenerateFlatNormalsTest() {
     addTests({&GenerateFlatNormalsTest::wrongIndexCount,
-              &GenerateFlatNormalsTest::generate});
+              &GenerateFlatNormalsTest::generate,
+
+              &GenerateFlatNormalsTest::intoWrongIndexCount,
+              &GenerateFlatNormalsTest::intoWrongNormalCount,
+              &GenerateFlatNormalsTest::into,
+              &GenerateFlatNormalsTest::intoDegenerate,
+              &GenerateFlatNormalsTest::intoMultithreaded});
 }
 
 void GenerateFlatNormalsTest::wrongIndexCount() {
@@ -81,6 +94,84 @@ void GenerateFlatNormalsTest::generate() {
     }));
 }
 
+void GenerateFlatNormalsTest::intoWrongIndexCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    const UnsignedInt indices[]{0, 1};
+    const Vector3 positions[2];
+    MeshTools::generateFlatNormalsInto(indices, positions, nullptr);
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateFlatNormalsInto(): index count is not divisible by 3!\n");
+}
+
+void GenerateFlatNormalsTest::intoWrongNormalCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    const UnsignedInt indices[]{0, 1, 2, 2, 1, 0};
+    const Vector3 positions[3];
+    Vector3 normals[3];
+    MeshTools::generateFlatNormalsInto(indices, positions, normals);
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateFlatNormalsInto(): expected 2 normals but got 3\n");
+}
+
+void GenerateFlatNormalsTest::into() {
+    /* Same as above, without removing duplicates */
+    const UnsignedInt indices[]{
+        0, 1, 2,
+        1, 2, 3,
+        2, 1, 0
+    };
+    const Vector3 positions[]{
+        {-1.0f, 0.0f, 0.0f},
+        {0.0f, -1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f}
+    };
+    Vector3 normals[3];
+    MeshTools::generateFlatNormalsInto(indices, positions, normals);
+
+    CORRADE_COMPARE(normals[0], Vector3::zAxis());
+    CORRADE_COMPARE(normals[1], -Vector3::zAxis());
+    CORRADE_COMPARE(normals[2], -Vector3::zAxis());
+}
+
+void GenerateFlatNormalsTest::intoDegenerate() {
+    const UnsignedInt indices[]{0, 1, 2};
+    const Vector3 positions[]{
+        {1.0f, 0.0f, 0.0f},
+        {2.0f, 0.0f, 0.0f},
+        {3.0f, 0.0f, 0.0f}
+    };
+    Vector3 normals[1]{Vector3{1.0f}};
+    MeshTools::generateFlatNormalsInto(indices, positions, normals);
+
+    /* Zero instead of NaN */
+    CORRADE_COMPARE(normals[0], Vector3{});
+}
+
+void GenerateFlatNormalsTest::intoMultithreaded() {
+    /* Grid of 256x256 quads, each column slanted differently, large enough
+       to be processed in more than one thread */
+    constexpr UnsignedInt Size = 256;
+    std::vector<Vector3> positions;
+    for(UnsignedInt y = 0; y <= Size; ++y)
+        for(UnsignedInt x = 0; x <= Size; ++x)
+            positions.emplace_back(Float(x), Float(y), Float(x*x%7));
+    std::vector<UnsignedInt> indices;
+    for(UnsignedInt y = 0; y != Size; ++y) for(UnsignedInt x = 0; x != Size; ++x) {
+        const UnsignedInt i = y*(Size + 1) + x;
+        indices.insert(indices.end(), {i, i + 1, i + Size + 2, i, i + Size + 2, i + Size + 1});
+    }
+
+    std::vector<Vector3> expected(indices.size()/3);
+    std::vector<Vector3> normals(indices.size()/3);
+    MeshTools::generateFlatNormalsInto({indices.data(), indices.size()}, {positions.data(), positions.size()}, {expected.data(), expected.size()});
+    MeshTools::generateFlatNormalsInto({indices.data(), indices.size()}, {positions.data(), positions.size()}, {normals.data(), normals.size()}, 4);
+    CORRADE_COMPARE_AS(normals, expected, TestSuite::Compare::Container);
+    CORRADE_COMPARE(normals[1], (Vector3{-1.0f, 0.0f, 1.0f}.normalized()));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateFlatNormalsTest)
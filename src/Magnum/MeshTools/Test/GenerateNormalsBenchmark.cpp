@@ -0,0 +1,126 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <functional>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/GenerateFlatNormals.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
+#include "Magnum/Test/BenchmarkTimer.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateNormalsBenchmark: TestSuite::Tester {
+    explicit GenerateNormalsBenchmark();
+
+    void flat();
+    void flatInto();
+    void smooth();
+    void smoothCrease();
+};
+
+GenerateNormalsBenchmark::GenerateNormalsBenchmark() {
+    addTests({&GenerateNormalsBenchmark::flat,
+              &GenerateNormalsBenchmark::flatInto,
+              &GenerateNormalsBenchmark::smooth,
+              &GenerateNormalsBenchmark::smoothCrease});
+}
+
+namespace {
+    /* 1310720 triangles, 655362 vertices */
+    constexpr UnsignedInt Subdivisions = 8;
+
+    /* Runs the function a few times and prints the best time */
+    void measure(const char* name, const std::function<void()>& f) {
+        Magnum::Test::BenchmarkTimer timer;
+        for(std::size_t i = 0; i != 3; ++i) timer.measure(f);
+
+        Debug() << "   " << name << timer.milliseconds() << "ms";
+    }
+}
+
+void GenerateNormalsBenchmark::flat() {
+    const Trade::MeshData3D icosphere = Primitives::Icosphere::solid(Subdivisions);
+
+    std::vector<UnsignedInt> normalIndices;
+    std::vector<Vector3> normals;
+    measure("generateFlatNormals() with duplicate removal", [&]() {
+        std::tie(normalIndices, normals) = MeshTools::generateFlatNormals(icosphere.indices(), icosphere.positions(0));
+    });
+    CORRADE_COMPARE(normalIndices.size(), icosphere.indices().size());
+}
+
+void GenerateNormalsBenchmark::flatInto() {
+    const Trade::MeshData3D icosphere = Primitives::Icosphere::solid(Subdivisions);
+    const std::vector<UnsignedInt>& indices = icosphere.indices();
+    const std::vector<Vector3>& positions = icosphere.positions(0);
+
+    std::vector<Vector3> normals(indices.size()/3);
+    measure("generateFlatNormalsInto()", [&]() {
+        MeshTools::generateFlatNormalsInto({indices.data(), indices.size()}, {positions.data(), positions.size()}, {normals.data(), normals.size()});
+    });
+    measure("generateFlatNormalsInto() on all threads", [&]() {
+        MeshTools::generateFlatNormalsInto({indices.data(), indices.size()}, {positions.data(), positions.size()}, {normals.data(), normals.size()}, 0);
+    });
+    CORRADE_COMPARE(normals.size(), indices.size()/3);
+}
+
+void GenerateNormalsBenchmark::smooth() {
+    const Trade::MeshData3D icosphere = Primitives::Icosphere::solid(Subdivisions);
+
+    std::vector<Vector3> normals;
+    measure("generateSmoothNormals()", [&]() {
+        normals = MeshTools::generateSmoothNormals(icosphere.indices(), icosphere.positions(0));
+    });
+    measure("generateSmoothNormals() on all threads", [&]() {
+        normals = MeshTools::generateSmoothNormals(icosphere.indices(), icosphere.positions(0), 0);
+    });
+
+    /* Sphere normals point out of the center */
+    CORRADE_COMPARE(normals[17], icosphere.positions(0)[17].normalized());
+}
+
+void GenerateNormalsBenchmark::smoothCrease() {
+    const Trade::MeshData3D icosphere = Primitives::Icosphere::solid(Subdivisions);
+
+    std::vector<UnsignedInt> normalIndices;
+    std::vector<Vector3> normals;
+    measure("generateSmoothNormals() with crease angle", [&]() {
+        std::tie(normalIndices, normals) = MeshTools::generateSmoothNormals(icosphere.indices(), icosphere.positions(0), Deg(30.0f));
+    });
+    measure("generateSmoothNormals() with crease angle on all threads", [&]() {
+        std::tie(normalIndices, normals) = MeshTools::generateSmoothNormals(icosphere.indices(), icosphere.positions(0), Deg(30.0f), 0);
+    });
+
+    /* No hard edges on a sphere */
+    CORRADE_COMPARE(normals.size(), icosphere.positions(0).size());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateNormalsBenchmark)
@@ -0,0 +1,308 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/GenerateSmoothNormals.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct GenerateSmoothNormalsTest: TestSuite::Tester {
+    explicit GenerateSmoothNormalsTest();
+
+    void wrongIndexCount();
+    void wrongNormalCount();
+
+    void cube();
+    void weighted();
+    void unreferencedAndDegenerate();
+    void multithreaded();
+
+    void creaseWrongIndexCount();
+    void creaseCube();
+    void creaseNoHardEdges();
+    void creasePartial();
+    void creaseMultithreaded();
+};
+
+GenerateSmoothNormalsTest::GenerateSmoothNormalsTest() {
+    addTests({&GenerateSmoothNormalsTest::wrongIndexCount,
+              &GenerateSmoothNormalsTest::wrongNormalCount,
+
+              &GenerateSmoothNormalsTest::cube,
+              &GenerateSmoothNormalsTest::weighted,
+              &GenerateSmoothNormalsTest::unreferencedAndDegenerate,
+              &GenerateSmoothNormalsTest::multithreaded,
+
+              &GenerateSmoothNormalsTest::creaseWrongIndexCount,
+              &GenerateSmoothNormalsTest::creaseCube,
+              &GenerateSmoothNormalsTest::creaseNoHardEdges,
+              &GenerateSmoothNormalsTest::creasePartial,
+              &GenerateSmoothNormalsTest::creaseMultithreaded});
+}
+
+namespace {
+    /* Cube with shared vertices, each side split differently */
+    const std::vector<Vector3> cubePositions{
+        {-1.0f, -1.0f,  1.0f},
+        { 1.0f, -1.0f,  1.0f},
+        { 1.0f,  1.0f,  1.0f},
+        {-1.0f,  1.0f,  1.0f},
+        {-1.0f, -1.0f, -1.0f},
+        { 1.0f, -1.0f, -1.0f},
+        { 1.0f,  1.0f, -1.0f},
+        {-1.0f,  1.0f, -1.0f}
+    };
+    const std::vector<UnsignedInt> cubeIndices{
+        0, 1, 2, 0, 2, 3, /* +Z */
+        1, 5, 6, 1, 6, 2, /* +X */
+        3, 2, 6, 3, 6, 7, /* +Y */
+        5, 4, 7, 5, 7, 6, /* -Z */
+        4, 0, 3, 4, 3, 7, /* -X */
+        4, 5, 1, 4, 1, 0  /* -Y */
+    };
+
+    /* Grid of Size*Size quads, bumpy enough to have varying normals and
+       large enough to be processed in more than one thread */
+    constexpr UnsignedInt GridSize = 256;
+
+    void grid(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+        for(UnsignedInt y = 0; y <= GridSize; ++y)
+            for(UnsignedInt x = 0; x <= GridSize; ++x)
+                positions.emplace_back(Float(x), Float(y), Float((x*x + y)%5));
+        for(UnsignedInt y = 0; y != GridSize; ++y) for(UnsignedInt x = 0; x != GridSize; ++x) {
+            const UnsignedInt i = y*(GridSize + 1) + x;
+            indices.insert(indices.end(), {i, i + 1, i + GridSize + 2, i, i + GridSize + 2, i + GridSize + 1});
+        }
+    }
+}
+
+void GenerateSmoothNormalsTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals({0, 1}, {{}, {}});
+    const UnsignedInt indices[]{0, 1};
+    const Vector3 positions[2];
+    Vector3 normalsInto[2];
+    MeshTools::generateSmoothNormalsInto(indices, positions, normalsInto);
+
+    CORRADE_VERIFY(normals.empty());
+    CORRADE_COMPARE(ss.str(),
+        "MeshTools::generateSmoothNormals(): index count is not divisible by 3!\n"
+        "MeshTools::generateSmoothNormalsInto(): index count is not divisible by 3!\n");
+}
+
+void GenerateSmoothNormalsTest::wrongNormalCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    const UnsignedInt indices[]{0, 1, 2};
+    const Vector3 positions[3];
+    Vector3 normals[2];
+    MeshTools::generateSmoothNormalsInto(indices, positions, normals);
+
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateSmoothNormalsInto(): expected 3 normals but got 2\n");
+}
+
+void GenerateSmoothNormalsTest::cube() {
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals(cubeIndices, cubePositions);
+
+    /* Each corner has a 90° angle in each of its three sides, regardless of
+       how many triangles it's split into, so the normals point exactly out
+       of the corners */
+    CORRADE_COMPARE(normals.size(), 8);
+    for(std::size_t i = 0; i != normals.size(); ++i)
+        CORRADE_COMPARE(normals[i], cubePositions[i].normalized());
+}
+
+void GenerateSmoothNormalsTest::weighted() {
+    /* Vertex 0 shared by a large triangle in the XY plane, a small one in
+       the YZ plane and a triangle with a narrow angle at vertex 0 in the YZ
+       plane of the same area as the small one */
+    const std::vector<Vector3> positions{
+        {0.0f, 0.0f, 0.0f},
+        {2.0f, 0.0f, 0.0f},
+        {0.0f, 2.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.0f, 1.0f, 1.0f}
+    };
+
+    /* Twice the area of the large one, same angle at vertex 0 */
+    const std::vector<Vector3> areaNormals = MeshTools::generateSmoothNormals({
+        0, 1, 2,
+        0, 3, 4
+    }, positions);
+    CORRADE_COMPARE(areaNormals[0], (Vector3{-1.0f, 0.0f, 4.0f}.normalized()));
+
+    /* Same area, the angle at vertex 0 is 45° instead of 90° */
+    const std::vector<Vector3> angleNormals = MeshTools::generateSmoothNormals({
+        0, 3, 5,
+        0, 1, 4
+    }, {positions[0], {1.0f, 0.0f, 0.0f}, positions[2], positions[3], {0.0f, 1.0f, 0.0f}, positions[5]});
+    CORRADE_COMPARE(angleNormals[0], (Vector3{-1.0f, 0.0f, 2.0f}.normalized()));
+}
+
+void GenerateSmoothNormalsTest::unreferencedAndDegenerate() {
+    const std::vector<Vector3> positions{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {2.0f, 0.0f, 0.0f},
+        {5.0f, 5.0f, 5.0f}
+    };
+    Vector3 normals[4]{Vector3{1.0f}, Vector3{1.0f}, Vector3{1.0f}, Vector3{1.0f}};
+    const UnsignedInt indices[]{0, 1, 2};
+    MeshTools::generateSmoothNormalsInto(indices, {positions.data(), positions.size()}, normals);
+
+    /* Zeros instead of NaNs or garbage */
+    CORRADE_COMPARE(normals[0], Vector3{});
+    CORRADE_COMPARE(normals[1], Vector3{});
+    CORRADE_COMPARE(normals[2], Vector3{});
+    CORRADE_COMPARE(normals[3], Vector3{});
+}
+
+void GenerateSmoothNormalsTest::multithreaded() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(indices, positions);
+
+    const std::vector<Vector3> expected = MeshTools::generateSmoothNormals(indices, positions);
+    const std::vector<Vector3> normals = MeshTools::generateSmoothNormals(indices, positions, 4);
+    CORRADE_COMPARE_AS(normals, expected, TestSuite::Compare::Container);
+
+    /* The grid is not flat */
+    CORRADE_VERIFY(expected[GridSize + 3] != Vector3::zAxis());
+}
+
+void GenerateSmoothNormalsTest::creaseWrongIndexCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    std::vector<UnsignedInt> normalIndices;
+    std::vector<Vector3> normals;
+    std::tie(normalIndices, normals) = MeshTools::generateSmoothNormals({0, 1}, {{}, {}}, Deg(30.0f));
+
+    CORRADE_VERIFY(normalIndices.empty());
+    CORRADE_VERIFY(normals.empty());
+    CORRADE_COMPARE(ss.str(), "MeshTools::generateSmoothNormals(): index count is not divisible by 3!\n");
+}
+
+void GenerateSmoothNormalsTest::creaseCube() {
+    std::vector<UnsignedInt> normalIndices;
+    std::vector<Vector3> normals;
+    std::tie(normalIndices, normals) = MeshTools::generateSmoothNormals(cubeIndices, cubePositions, Deg(45.0f));
+
+    /* All edges are hard, each vertex has a normal for each side */
+    CORRADE_COMPARE(normals.size(), 24);
+    CORRADE_COMPARE(normalIndices.size(), cubeIndices.size());
+    for(std::size_t i = 0; i != cubeIndices.size(); ++i) {
+        const std::size_t side = i/6;
+        const Vector3 expected = side == 0 ? Vector3::zAxis() :
+                                 side == 1 ? Vector3::xAxis() :
+                                 side == 2 ? Vector3::yAxis() :
+                                 side == 3 ? -Vector3::zAxis() :
+                                 side == 4 ? -Vector3::xAxis() :
+                                             -Vector3::yAxis();
+        CORRADE_COMPARE(normals[normalIndices[i]], expected);
+    }
+
+    /* Normals of the same vertex are next to each other */
+    CORRADE_COMPARE(normalIndices[0]/3, 0);
+    CORRADE_COMPARE(normalIndices[1]/3, 1);
+    CORRADE_COMPARE(normalIndices[23]/3, 6);
+}
+
+void GenerateSmoothNormalsTest::creaseNoHardEdges() {
+    std::vector<UnsignedInt> normalIndices;
+    std::vector<Vector3> normals;
+    std::tie(normalIndices, normals) = MeshTools::generateSmoothNormals(cubeIndices, cubePositions, Deg(120.0f));
+
+    /* Same as without the crease angle, the indices are kept */
+    CORRADE_COMPARE_AS(normalIndices, cubeIndices, TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(normals, MeshTools::generateSmoothNormals(cubeIndices, cubePositions),
+        TestSuite::Compare::Container);
+}
+
+void GenerateSmoothNormalsTest::creasePartial() {
+    /* Flat quad in XY with a 30° bend along the Y axis and a 90° wall along
+       the X axis, unreferenced vertex at the end */
+    const std::vector<Vector3> positions{
+        {0.0f, 0.0f, 0.0f},
+        {1.0f, 0.0f, 0.0f},
+        {1.0f, 1.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f},
+        {-Math::cos(Deg(30.0f)), 1.0f, Math::sin(Deg(30.0f))},
+        {-Math::cos(Deg(30.0f)), 0.0f, Math::sin(Deg(30.0f))},
+        {1.0f, 0.0f, 1.0f},
+        {0.0f, 0.0f, 1.0f},
+        {7.0f, 7.0f, 7.0f}
+    };
+    const std::vector<UnsignedInt> indices{
+        0, 1, 2, 0, 2, 3, /* flat */
+        5, 0, 3, 5, 3, 4, /* bent by 30° */
+        0, 6, 7, 0, 1, 6  /* wall at 90° */
+    };
+    std::vector<UnsignedInt> normalIndices;
+    std::vector<Vector3> normals;
+    std::tie(normalIndices, normals) = MeshTools::generateSmoothNormals(indices, positions, Deg(45.0f));
+
+    /* Vertex 0 has one normal shared by the flat and the bent part and
+       another for the wall */
+    CORRADE_COMPARE(normalIndices[0], normalIndices[3]);
+    CORRADE_COMPARE(normalIndices[0], normalIndices[7]);
+    CORRADE_VERIFY(normalIndices[0] != normalIndices[12]);
+    CORRADE_COMPARE(normals[normalIndices[12]], -Vector3::yAxis());
+    CORRADE_COMPARE(normals[normalIndices[0]].y(), 0.0f);
+    CORRADE_VERIFY(normals[normalIndices[0]].x() > 0.0f);
+
+    /* Vertex 2 is only in the flat part */
+    CORRADE_COMPARE(normals[normalIndices[2]], Vector3::zAxis());
+
+    /* 0 and 1 have two normals, the rest one */
+    CORRADE_COMPARE(normals.size(), 11);
+    CORRADE_COMPARE(normals.back(), Vector3{});
+}
+
+void GenerateSmoothNormalsTest::creaseMultithreaded() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    grid(indices, positions);
+
+    std::vector<UnsignedInt> expectedIndices, normalIndices;
+    std::vector<Vector3> expected, normals;
+    std::tie(expectedIndices, expected) = MeshTools::generateSmoothNormals(indices, positions, Deg(30.0f));
+    std::tie(normalIndices, normals) = MeshTools::generateSmoothNormals(indices, positions, Deg(30.0f), 4);
+    CORRADE_COMPARE_AS(normalIndices, expectedIndices, TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(normals, expected, TestSuite::Compare::Container);
+
+    /* Some edges are hard */
+    CORRADE_VERIFY(expected.size() > positions.size());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::GenerateSmoothNormalsTest)
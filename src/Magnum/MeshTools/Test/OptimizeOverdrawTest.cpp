@@ -0,0 +1,145 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <tuple>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/AnalyzeVertexCache.h"
+#include "Magnum/MeshTools/OptimizeOverdraw.h"
+#include "Magnum/MeshTools/Tipsify.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct OptimizeOverdrawTest: TestSuite::Tester {
+    explicit OptimizeOverdrawTest();
+
+    void wrongIndexCount();
+    void indexOutOfRange();
+
+    void empty();
+    void outwardFirst();
+    void sphere();
+};
+
+OptimizeOverdrawTest::OptimizeOverdrawTest() {
+    addTests({&OptimizeOverdrawTest::wrongIndexCount,
+              &OptimizeOverdrawTest::indexOutOfRange,
+
+              &OptimizeOverdrawTest::empty,
+              &OptimizeOverdrawTest::outwardFirst,
+              &OptimizeOverdrawTest::sphere});
+}
+
+namespace {
+
+/* UV sphere, rings*segments quads, vertices on the seam are not shared */
+void uvSphere(const UnsignedInt rings, const UnsignedInt segments, std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+    for(UnsignedInt r = 0; r <= rings; ++r) {
+        const Float theta = Constants::pi()*r/rings;
+        for(UnsignedInt s = 0; s <= segments; ++s) {
+            const Float phi = 2.0f*Constants::pi()*s/segments;
+            positions.emplace_back(std::sin(theta)*std::cos(phi), std::cos(theta), std::sin(theta)*std::sin(phi));
+        }
+    }
+
+    for(UnsignedInt r = 0; r != rings; ++r) for(UnsignedInt s = 0; s != segments; ++s) {
+        const UnsignedInt i = r*(segments + 1) + s;
+        indices.insert(indices.end(), {i, i + 1, i + segments + 1,
+                                       i + segments + 1, i + 1, i + segments + 2});
+    }
+}
+
+}
+
+void OptimizeOverdrawTest::wrongIndexCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    std::vector<UnsignedInt> indices{0, 1};
+    MeshTools::optimizeOverdraw(indices, std::vector<Vector3>(2), 16);
+    CORRADE_COMPARE(ss.str(), "MeshTools::optimizeOverdraw(): index count is not divisible by 3\n");
+}
+
+void OptimizeOverdrawTest::indexOutOfRange() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    std::vector<UnsignedInt> indices{0, 1, 3};
+    MeshTools::optimizeOverdraw(indices, std::vector<Vector3>(3), 16);
+    CORRADE_COMPARE(ss.str(), "MeshTools::optimizeOverdraw(): index 3 out of range for 3 vertices\n");
+}
+
+void OptimizeOverdrawTest::empty() {
+    std::vector<UnsignedInt> indices;
+    MeshTools::optimizeOverdraw(indices, {}, 16);
+    CORRADE_VERIFY(indices.empty());
+}
+
+void OptimizeOverdrawTest::outwardFirst() {
+    /* Two disjoint triangles both facing +Z, the first one on the -Z side
+       of the mesh (thus facing inwards), the second one on the +Z side
+       (facing outwards) */
+    const std::vector<Vector3> positions{
+        {-1.0f, -1.0f, -1.0f}, {1.0f, -1.0f, -1.0f}, {0.0f, 1.0f, -1.0f},
+        {-1.0f, -1.0f, 1.0f}, {1.0f, -1.0f, 1.0f}, {0.0f, 1.0f, 1.0f}};
+    std::vector<UnsignedInt> indices{0, 1, 2, 3, 4, 5};
+
+    MeshTools::optimizeOverdraw(indices, positions, 16);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{3, 4, 5, 0, 1, 2}));
+}
+
+void OptimizeOverdrawTest::sphere() {
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    uvSphere(32, 64, indices, positions);
+
+    MeshTools::tipsify(indices, positions.size(), 16);
+    const VertexCacheStatistics before = MeshTools::analyzeVertexCache(indices, positions.size(), 16);
+
+    std::vector<UnsignedInt> optimized = indices;
+    MeshTools::optimizeOverdraw(optimized, positions, 16, 1.05f);
+    const VertexCacheStatistics after = MeshTools::analyzeVertexCache(optimized, positions.size(), 16);
+
+    /* The triangles are only reordered */
+    CORRADE_COMPARE(optimized.size(), indices.size());
+    auto triangles = [](const std::vector<UnsignedInt>& indices) {
+        std::vector<std::tuple<UnsignedInt, UnsignedInt, UnsignedInt>> out;
+        for(std::size_t i = 0; i != indices.size(); i += 3)
+            out.emplace_back(indices[i], indices[i + 1], indices[i + 2]);
+        std::sort(out.begin(), out.end());
+        return out;
+    };
+    CORRADE_VERIFY(triangles(optimized) == triangles(indices));
+    CORRADE_VERIFY(optimized != indices);
+
+    /* The cache efficiency doesn't degrade more than the threshold allows */
+    CORRADE_VERIFY(after.acmr <= before.acmr*1.05f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeOverdrawTest)
@@ -0,0 +1,94 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/OptimizeVertexFetch.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct OptimizeVertexFetchTest: TestSuite::Tester {
+    explicit OptimizeVertexFetchTest();
+
+    void remapIndexOutOfRange();
+    void differentAttributeSizes();
+
+    void remap();
+    void optimize();
+};
+
+OptimizeVertexFetchTest::OptimizeVertexFetchTest() {
+    addTests({&OptimizeVertexFetchTest::remapIndexOutOfRange,
+              &OptimizeVertexFetchTest::differentAttributeSizes,
+
+              &OptimizeVertexFetchTest::remap,
+              &OptimizeVertexFetchTest::optimize});
+}
+
+void OptimizeVertexFetchTest::remapIndexOutOfRange() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    std::vector<UnsignedInt> indices{0, 1, 5};
+    MeshTools::optimizeVertexFetchRemap(indices, 3);
+    CORRADE_COMPARE(ss.str(), "MeshTools::optimizeVertexFetchRemap(): index 5 out of range for 3 vertices\n");
+}
+
+void OptimizeVertexFetchTest::differentAttributeSizes() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+    std::vector<UnsignedInt> indices{0, 1, 2};
+    std::vector<Vector3> positions(3);
+    std::vector<Vector2> textureCoordinates(4);
+    MeshTools::optimizeVertexFetch(indices, positions, textureCoordinates);
+    CORRADE_COMPARE(ss.str(), "MeshTools::optimizeVertexFetch(): attribute arrays don't have the same size, expected 3 but got 4\n");
+}
+
+void OptimizeVertexFetchTest::remap() {
+    std::vector<UnsignedInt> indices{4, 2, 5, 5, 2, 0, 4, 0, 2};
+    const std::vector<UnsignedInt> remap = MeshTools::optimizeVertexFetchRemap(indices, 7);
+
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 3, 0, 3, 1}));
+    CORRADE_COMPARE(remap, (std::vector<UnsignedInt>{3, 0xffffffffu, 1, 0xffffffffu, 0, 2, 0xffffffffu}));
+}
+
+void OptimizeVertexFetchTest::optimize() {
+    std::vector<UnsignedInt> indices{4, 2, 5, 5, 2, 0, 4, 0, 2};
+    std::vector<Int> data{0, 10, 20, 30, 40, 50, 60};
+    std::vector<Vector2i> data2{{0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}, {5, 5}, {6, 6}};
+
+    CORRADE_COMPARE(MeshTools::optimizeVertexFetch(indices, data, data2), 4);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 3, 0, 3, 1}));
+
+    /* Data are in order of first use, unused vertices are removed */
+    CORRADE_COMPARE(data, (std::vector<Int>{40, 20, 50, 0}));
+    CORRADE_COMPARE(data2, (std::vector<Vector2i>{{4, 4}, {2, 2}, {5, 5}, {0, 0}}));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::OptimizeVertexFetchTest)
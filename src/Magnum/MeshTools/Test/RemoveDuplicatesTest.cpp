@@ -26,6 +26,7 @@
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
@@ -34,10 +35,18 @@ struct RemoveDuplicatesTest: TestSuite::Tester {
     explicit RemoveDuplicatesTest();
 
     void removeDuplicates();
+    void removeDuplicatesCellBoundary();
+    void removeDuplicatesExact();
+    void removeDuplicatesEmpty();
+    void removeDuplicatesBruteForce();
 };
 
 RemoveDuplicatesTest::RemoveDuplicatesTest() {
-    addTests({&RemoveDuplicatesTest::removeDuplicates});
+    addTests({&RemoveDuplicatesTest::removeDuplicates,
+              &RemoveDuplicatesTest::removeDuplicatesCellBoundary,
+              &RemoveDuplicatesTest::removeDuplicatesExact,
+              &RemoveDuplicatesTest::removeDuplicatesEmpty,
+              &RemoveDuplicatesTest::removeDuplicatesBruteForce});
 }
 
 void RemoveDuplicatesTest::removeDuplicates() {
@@ -59,6 +68,78 @@ void RemoveDuplicatesTest::removeDuplicates() {
     }));
 }
 
+void RemoveDuplicatesTest::removeDuplicatesCellBoundary() {
+    /* Vectors near each other but on different sides of a cell boundary
+       (cell size is 0.8, origin is at the first vector) should be merged */
+    std::vector<Vector3> data{
+        {0.0f, 0.0f, 0.0f},
+        {0.79f, 1.0f, 0.0f},
+        {0.81f, 1.0f, 0.0f},
+        {0.81f, 1.09f, 0.09f},
+        {0.92f, 1.0f, 0.0f}
+    };
+
+    const std::vector<UnsignedInt> indices = MeshTools::removeDuplicates(data, 0.1f);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 1, 1, 2}));
+    CORRADE_COMPARE(data, (std::vector<Vector3>{
+        {0.0f, 0.0f, 0.0f},
+        {0.79f, 1.0f, 0.0f},
+        {0.92f, 1.0f, 0.0f}
+    }));
+}
+
+void RemoveDuplicatesTest::removeDuplicatesExact() {
+    std::vector<Vector2> data{
+        {1.0f, 0.0f},
+        {1.0f, 0.000001f},
+        {0.0f, 4.0f},
+        {1.0f, 0.0f},
+        {1.0f, 0.000001f}
+    };
+
+    /* Only the exactly same vectors are merged */
+    const std::vector<UnsignedInt> indices = MeshTools::removeDuplicates(data, 0.0f);
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{0, 1, 2, 0, 1}));
+    CORRADE_COMPARE(data.size(), 3);
+    CORRADE_COMPARE(data[0], Vector2(1.0f, 0.0f));
+    CORRADE_COMPARE(data[2], Vector2(0.0f, 4.0f));
+}
+
+void RemoveDuplicatesTest::removeDuplicatesEmpty() {
+    std::vector<Vector3> data;
+    CORRADE_VERIFY(MeshTools::removeDuplicates(data).empty());
+    CORRADE_VERIFY(MeshTools::removeDuplicates(data, 0.0f).empty());
+}
+
+void RemoveDuplicatesTest::removeDuplicatesBruteForce() {
+    /* Points on a lattice with tiny offsets, so there are both clusters of
+       duplicates and vectors just outside of epsilon */
+    std::vector<Vector3> original;
+    for(std::size_t i = 0; i != 2000; ++i)
+        original.emplace_back(Float(i*7%13)*0.05f + Float(i%3)*0.004f,
+                              Float(i*11%17)*0.05f - Float(i%5)*0.003f,
+                              Float(i*5%7)*0.05f);
+
+    std::vector<Vector3> data = original;
+    const std::vector<UnsignedInt> indices = MeshTools::removeDuplicates(data, 0.01f);
+
+    /* Each vector is merged with the earliest unique vector nearer than
+       epsilon */
+    std::vector<Vector3> expected;
+    std::vector<UnsignedInt> expectedIndices;
+    for(const Vector3& v: original) {
+        std::size_t found = 0;
+        for(; found != expected.size(); ++found)
+            if((Math::abs(expected[found] - v) < Vector3(0.01f)).all()) break;
+        if(found == expected.size()) expected.push_back(v);
+        expectedIndices.push_back(found);
+    }
+
+    CORRADE_COMPARE(data.size(), expected.size());
+    CORRADE_VERIFY(data.size() < original.size());
+    CORRADE_COMPARE(indices, expectedIndices);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::RemoveDuplicatesTest)
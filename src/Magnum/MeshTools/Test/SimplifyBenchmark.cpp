@@ -0,0 +1,83 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/MeshTools/Simplify.h"
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Test/BenchmarkTimer.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct SimplifyBenchmark: TestSuite::Tester {
+    explicit SimplifyBenchmark();
+
+    void simplifyIndices();
+    void lodChain();
+};
+
+SimplifyBenchmark::SimplifyBenchmark() {
+    addTests({&SimplifyBenchmark::simplifyIndices,
+              &SimplifyBenchmark::lodChain});
+}
+
+namespace {
+    /* 81920 triangles, 40962 vertices */
+    constexpr UnsignedInt Subdivisions = 6;
+}
+
+void SimplifyBenchmark::simplifyIndices() {
+    const Trade::MeshData3D icosphere = Primitives::Icosphere::solid(Subdivisions);
+
+    std::vector<UnsignedInt> indices;
+    Float error{};
+    Magnum::Test::BenchmarkTimer timer;
+    for(std::size_t i = 0; i != 3; ++i) timer.measure([&]() {
+        indices = MeshTools::simplifyIndices(icosphere, icosphere.indices().size()/10, 0.05f, &error);
+    });
+
+    Debug() << "    simplifyIndices() to 10%:" << timer.milliseconds() << "ms," << indices.size()/3 << "triangles, error" << error;
+    CORRADE_VERIFY(indices.size() <= icosphere.indices().size()/10);
+}
+
+void SimplifyBenchmark::lodChain() {
+    const Trade::MeshData3D icosphere = Primitives::Icosphere::solid(Subdivisions);
+
+    std::vector<std::vector<UnsignedInt>> levels;
+    Magnum::Test::BenchmarkTimer timer;
+    for(std::size_t i = 0; i != 3; ++i) timer.measure([&]() {
+        levels = MeshTools::simplifyLodChain(icosphere, 6, 0.5f, 0.05f);
+    });
+
+    Debug d;
+    d << "    simplifyLodChain() with 6 levels:" << timer.milliseconds() << "ms, triangle counts";
+    for(const std::vector<UnsignedInt>& level: levels) d << level.size()/3;
+    CORRADE_COMPARE(levels.size(), 6);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SimplifyBenchmark)
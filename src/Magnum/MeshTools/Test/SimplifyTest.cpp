@@ -0,0 +1,278 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Simplify.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct SimplifyTest: TestSuite::Tester {
+    explicit SimplifyTest();
+
+    void wrongPrimitive();
+    void wrongRatio();
+
+    void plane();
+    void planeTextureSeam();
+    void errorLimit();
+    void closed();
+    void lodChain();
+    void compactVertices();
+};
+
+SimplifyTest::SimplifyTest() {
+    addTests({&SimplifyTest::wrongPrimitive,
+              &SimplifyTest::wrongRatio,
+
+              &SimplifyTest::plane,
+              &SimplifyTest::planeTextureSeam,
+              &SimplifyTest::errorLimit,
+              &SimplifyTest::closed,
+              &SimplifyTest::lodChain,
+              &SimplifyTest::compactVertices});
+}
+
+namespace {
+    /* Grid of size*size quads in the XY plane, facing +Z, with Z coordinate
+       given by the height function */
+    template<class F> Trade::MeshData3D grid(const UnsignedInt size, F height) {
+        std::vector<UnsignedInt> indices;
+        std::vector<Vector3> positions;
+        std::vector<Vector2> textureCoordinates;
+        for(UnsignedInt y = 0; y != size + 1; ++y) for(UnsignedInt x = 0; x != size + 1; ++x) {
+            positions.emplace_back(Float(x), Float(y), height(Float(x), Float(y)));
+            textureCoordinates.emplace_back(Float(x)/size, Float(y)/size);
+        }
+        for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+            const UnsignedInt i = y*(size + 1) + x;
+            indices.insert(indices.end(), {i, i + 1, i + size + 2,
+                                           i, i + size + 2, i + size + 1});
+        }
+
+        return Trade::MeshData3D{MeshPrimitive::Triangles, std::move(indices), {std::move(positions)}, {}, {std::move(textureCoordinates)}};
+    }
+
+    Trade::MeshData3D planeMesh(const UnsignedInt size) {
+        return grid(size, [](Float, Float) { return 0.0f; });
+    }
+
+    /* Area of all triangles, if any of them isn't facing +Z, returns -1 */
+    Float planeArea(const std::vector<UnsignedInt>& indices, const std::vector<Vector3>& positions) {
+        Float area = 0.0f;
+        for(std::size_t i = 0; i != indices.size(); i += 3) {
+            const Vector3 normal = Math::cross(positions[indices[i + 1]] - positions[indices[i]], positions[indices[i + 2]] - positions[indices[i]]);
+            if(normal.z() <= 0.0f) return -1.0f;
+            area += normal.z()*0.5f;
+        }
+        return area;
+    }
+}
+
+void SimplifyTest::wrongPrimitive() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const Trade::MeshData3D lines{MeshPrimitive::Lines, {0, 1}, {{{}, {}}}, {}, {}};
+    const Trade::MeshData3D nonIndexed{MeshPrimitive::Triangles, {}, {{{}, {}, {}}}, {}, {}};
+    simplifyIndices(lines, 0);
+    simplify(nonIndexed, 0);
+    simplifyLodChain(lines, 3);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::simplifyIndices(): expected indexed triangle mesh\n"
+        "MeshTools::simplify(): expected indexed triangle mesh\n"
+        "MeshTools::simplifyLodChain(): expected indexed triangle mesh\n");
+}
+
+void SimplifyTest::wrongRatio() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    simplifyLodChain(planeMesh(2), 3, 1.0f);
+    CORRADE_COMPARE(out.str(), "MeshTools::simplifyLodChain(): expected ratio between 0 and 1 but got 1\n");
+}
+
+void SimplifyTest::plane() {
+    const Trade::MeshData3D mesh = planeMesh(10);
+
+    /* Everything except the corners can be collapsed without any error, the
+       boundary and the orientation is preserved */
+    Float error = -1.0f;
+    const std::vector<UnsignedInt> indices = simplifyIndices(mesh, 0, 0.001f, &error);
+    CORRADE_COMPARE(indices.size(), 6);
+    CORRADE_COMPARE(error, 0.0f);
+    CORRADE_COMPARE(planeArea(indices, mesh.positions(0)), 100.0f);
+}
+
+void SimplifyTest::planeTextureSeam() {
+    /* Split the plane in the middle, duplicating the vertices on the seam
+       with different texture coordinates */
+    Trade::MeshData3D mesh = planeMesh(10);
+    std::vector<UnsignedInt> indices = mesh.indices();
+    std::vector<Vector3> positions = mesh.positions(0);
+    std::vector<Vector2> textureCoordinates = mesh.textureCoords2D(0);
+    for(UnsignedInt y = 0; y != 11; ++y) {
+        positions.push_back(positions[y*11 + 5]);
+        textureCoordinates.push_back(textureCoordinates[y*11 + 5] + Vector2::xAxis());
+    }
+    for(std::size_t i = 0; i != indices.size(); i += 3) {
+        /* Triangles right of the seam */
+        if(positions[indices[i]].x() + positions[indices[i + 1]].x() + positions[indices[i + 2]].x() <= 15.0f) continue;
+        for(std::size_t j = 0; j != 3; ++j) if(positions[indices[i + j]].x() == 5.0f)
+            indices[i + j] = 121 + indices[i + j]/11;
+    }
+
+    const Trade::MeshData3D seam{MeshPrimitive::Triangles, indices, {positions}, {}, {textureCoordinates}};
+    const std::vector<UnsignedInt> result = simplifyIndices(seam, 0, 0.001f);
+    CORRADE_VERIFY(result.size() < indices.size()/4);
+    CORRADE_COMPARE(planeArea(result, positions), 100.0f);
+
+    /* All seam vertices are still used on both sides */
+    std::vector<bool> used(positions.size());
+    for(const UnsignedInt index: result) used[index] = true;
+    for(UnsignedInt y = 0; y != 11; ++y) {
+        CORRADE_VERIFY(used[y*11 + 5]);
+        CORRADE_VERIFY(used[121 + y]);
+    }
+}
+
+void SimplifyTest::errorLimit() {
+    const Trade::MeshData3D mesh = grid(20, [](Float x, Float y) {
+        return Math::sin(Rad(x*0.5f))*Math::cos(Rad(y*0.5f));
+    });
+
+    /* Stops before reaching the target because of the error */
+    Float error;
+    const std::vector<UnsignedInt> indices = simplifyIndices(mesh, 0, 0.01f, &error);
+    CORRADE_VERIFY(indices.size() > 6*10);
+    CORRADE_VERIFY(indices.size() < mesh.indices().size());
+    CORRADE_VERIFY(error > 0.0f);
+    CORRADE_VERIFY(error <= 0.01f);
+
+    /* Larger error allows to go further */
+    Float largerError;
+    const std::vector<UnsignedInt> larger = simplifyIndices(mesh, 0, 0.1f, &largerError);
+    CORRADE_VERIFY(larger.size() < indices.size());
+    CORRADE_VERIFY(largerError <= 0.1f);
+}
+
+void SimplifyTest::closed() {
+    /* Cube made of 6 subdivided faces, welded to a closed mesh */
+    std::vector<UnsignedInt> indices;
+    std::vector<Vector3> positions;
+    const UnsignedInt size = 8;
+    const auto vertex = [&positions](const Vector3& position) {
+        for(UnsignedInt i = 0; i != positions.size(); ++i)
+            if(positions[i] == position) return i;
+        positions.push_back(position);
+        return UnsignedInt(positions.size() - 1);
+    };
+    for(Int axis = 0; axis != 3; ++axis) for(Int side = 0; side != 2; ++side) {
+        Vector3 normal, u, v;
+        normal[axis] = side ? 1.0f : -1.0f;
+        u[(axis + 1)%3] = 1.0f;
+        v[(axis + 2)%3] = 1.0f;
+        if(!side) std::swap(u, v);
+        for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+            const auto corner = [&](UnsignedInt cx, UnsignedInt cy) {
+                return vertex(normal + u*(2.0f*cx/size - 1.0f) + v*(2.0f*cy/size - 1.0f));
+            };
+            indices.insert(indices.end(), {
+                corner(x, y), corner(x + 1, y), corner(x + 1, y + 1),
+                corner(x, y), corner(x + 1, y + 1), corner(x, y + 1)});
+        }
+    }
+
+    const Trade::MeshData3D mesh{MeshPrimitive::Triangles, indices, {positions}, {}, {}};
+    Float error;
+    const std::vector<UnsignedInt> result = simplifyIndices(mesh, 0, 0.001f, &error);
+    CORRADE_COMPARE(error, 0.0f);
+
+    /* The flat faces get reduced, all cube corners are kept and the mesh
+       stays closed with positive volume equal to the original */
+    CORRADE_VERIFY(result.size() < indices.size()/8);
+    Float volume = 0.0f;
+    for(std::size_t i = 0; i != result.size(); i += 3)
+        volume += Math::dot(positions[result[i]], Math::cross(positions[result[i + 1]], positions[result[i + 2]]))/6.0f;
+    CORRADE_COMPARE(volume, 8.0f);
+}
+
+void SimplifyTest::lodChain() {
+    const Trade::MeshData3D mesh = grid(32, [](Float x, Float y) {
+        return Math::sin(Rad(x*0.25f))*Math::cos(Rad(y*0.25f));
+    });
+
+    const std::vector<std::vector<UnsignedInt>> levels = simplifyLodChain(mesh, 4, 0.5f, 0.1f);
+    CORRADE_COMPARE(levels.size(), 4);
+    CORRADE_COMPARE_AS(levels[0], mesh.indices(), TestSuite::Compare::Container);
+    for(std::size_t i = 1; i != levels.size(); ++i) {
+        CORRADE_VERIFY(levels[i].size() <= levels[i - 1].size()/2);
+        CORRADE_VERIFY(levels[i].size() > levels[i - 1].size()/4);
+        CORRADE_COMPARE(levels[i].size() % 3, 0);
+    }
+
+    /* Zero levels */
+    CORRADE_VERIFY(simplifyLodChain(mesh, 0).empty());
+
+    /* The chain ends early if the mesh can't be simplified further */
+    const std::vector<std::vector<UnsignedInt>> planeLevels = simplifyLodChain(planeMesh(4), 10, 0.5f, 0.001f);
+    CORRADE_VERIFY(planeLevels.size() < 10);
+    CORRADE_COMPARE(planeLevels.back().size(), 6);
+}
+
+void SimplifyTest::compactVertices() {
+    const Trade::MeshData3D mesh = planeMesh(10);
+
+    Float error;
+    const Trade::MeshData3D simplified = simplify(mesh, 0, 0.001f, &error);
+    CORRADE_COMPARE(error, 0.0f);
+    CORRADE_COMPARE(simplified.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(simplified.indices().size(), 6);
+    CORRADE_COMPARE(simplified.positionArrayCount(), 1);
+    CORRADE_COMPARE(simplified.normalArrayCount(), 0);
+    CORRADE_COMPARE(simplified.textureCoords2DArrayCount(), 1);
+
+    /* Only the four corners are left, texture coordinates matching */
+    CORRADE_COMPARE(simplified.positions(0).size(), 4);
+    CORRADE_COMPARE(simplified.textureCoords2D(0).size(), 4);
+    for(std::size_t i = 0; i != 4; ++i) {
+        const Vector3 position = simplified.positions(0)[i];
+        CORRADE_VERIFY(position.x() == 0.0f || position.x() == 10.0f);
+        CORRADE_VERIFY(position.y() == 0.0f || position.y() == 10.0f);
+        CORRADE_COMPARE(simplified.textureCoords2D(0)[i], position.xy()/10.0f);
+    }
+    CORRADE_COMPARE(planeArea(simplified.indices(), simplified.positions(0)), 100.0f);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SimplifyTest)
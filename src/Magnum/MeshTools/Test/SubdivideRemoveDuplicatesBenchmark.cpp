@@ -23,62 +23,177 @@
     DEALINGS IN THE SOFTWARE.
 */
 
-#include "SubdivideRemoveDuplicatesBenchmark.h"
-
-#include <QtTest/QTest>
-
-#include "Magnum/Primitives/Icosphere.h"
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/MurmurHash2.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Subdivide.h"
-
-QTEST_APPLESS_MAIN(Magnum::MeshTools::Test::SubdivideRemoveDuplicatesBenchmark)
+#include "Magnum/Primitives/Icosphere.h"
+#include "Magnum/Test/BenchmarkTimer.h"
+#include "Magnum/Trade/MeshData3D.h"
 
 namespace Magnum { namespace MeshTools { namespace Test {
 
-void SubdivideRemoveDuplicatesBenchmark::subdivide() {
-    QBENCHMARK {
-        Primitives::Icosphere<0> icosphere;
-
-        /* Subdivide 5 times */
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-    }
+struct SubdivideRemoveDuplicatesBenchmark: TestSuite::Tester {
+    explicit SubdivideRemoveDuplicatesBenchmark();
+
+    void subdivide();
+    void subdivideAndRemoveDuplicatesMeshAfter();
+    void subdivideAndRemoveDuplicatesMeshBetween();
+    void subdivideWelded();
+
+    void removeDuplicatesMultiPass();
+    void removeDuplicates();
+    void removeDuplicatesExact();
+};
+
+SubdivideRemoveDuplicatesBenchmark::SubdivideRemoveDuplicatesBenchmark() {
+    addTests({&SubdivideRemoveDuplicatesBenchmark::subdivide,
+              &SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshAfter,
+              &SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshBetween,
+              &SubdivideRemoveDuplicatesBenchmark::subdivideWelded,
+
+              &SubdivideRemoveDuplicatesBenchmark::removeDuplicatesMultiPass,
+              &SubdivideRemoveDuplicatesBenchmark::removeDuplicates,
+              &SubdivideRemoveDuplicatesBenchmark::removeDuplicatesExact});
 }
 
-void SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshAfter() {
-    QBENCHMARK {
-        Primitives::Icosphere<0> icosphere;
+namespace {
+    /* 327672 vertices before removing duplicates, 10*4^7 + 2 after */
+    constexpr UnsignedInt Subdivisions = 7;
+    constexpr std::size_t UniqueCount = 163842;
 
-        /* Subdivide 5 times */
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
+    Vector3 interpolator(const Vector3& a, const Vector3& b) {
+        return (a+b).normalized();
+    }
+
+    /* Runs the function a few times on a fresh icosahedron and prints the
+       best time */
+    template<class Prepare, class F> std::size_t measure(const char* name, Prepare prepare, F f) {
+        std::size_t count = 0;
+        Magnum::Test::BenchmarkTimer timer;
+        for(std::size_t i = 0; i != 3; ++i) {
+            Trade::MeshData3D icosahedron = Primitives::Icosphere::solid(0);
+            std::vector<UnsignedInt> indices = icosahedron.indices();
+            std::vector<Vector3> positions = icosahedron.positions(0);
+            prepare(indices, positions);
+
+            timer.start();
+            f(indices, positions);
+            timer.stop();
+            count = positions.size();
+        }
+
+        Debug() << "   " << name << timer.microseconds() << "us," << count << "vertices";
+        return count;
+    }
 
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
+    void noPrepare(std::vector<UnsignedInt>&, std::vector<Vector3>&) {}
+
+    void subdivideAll(std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+        for(UnsignedInt i = 0; i != Subdivisions; ++i)
+            MeshTools::subdivide(indices, positions, interpolator);
     }
+
+    /* The original implementation doing a hash map pass for each dimension,
+       for comparison */
+    template<std::size_t size> struct VectorHash {
+        std::size_t operator()(const Math::Vector<size, std::size_t>& data) const {
+            return *reinterpret_cast<const std::size_t*>(Utility::MurmurHash2()(reinterpret_cast<const char*>(&data), sizeof(data)).byteArray());
+        }
+    };
+
+    template<class Vector> std::vector<UnsignedInt> removeDuplicatesMultiPassImplementation(std::vector<Vector>& data, typename Vector::Type epsilon) {
+        Vector min = data[0], max = data[0];
+        for(const auto& v: data) {
+            min = Math::min(v, min);
+            max = Math::max(v, max);
+        }
+
+        epsilon = Math::max(epsilon, typename Vector::Type((max-min).max()/std::numeric_limits<std::size_t>::max()));
+
+        std::vector<UnsignedInt> resultIndices(data.size());
+        std::iota(resultIndices.begin(), resultIndices.end(), 0);
+
+        std::unordered_map<Math::Vector<Vector::Size, std::size_t>, UnsignedInt, VectorHash<Vector::Size>> table(data.size());
+
+        std::vector<UnsignedInt> indices;
+        indices.reserve(data.size());
+
+        Vector moved;
+        for(std::size_t moving = 0; moving <= Vector::Size; ++moving) {
+            for(std::size_t i = 0; i != data.size(); ++i) {
+                const Math::Vector<Vector::Size, std::size_t> v((data[i] + moved - min)/epsilon);
+                const auto result = table.emplace(v, table.size());
+                indices.push_back(result.first->second);
+                if(result.second && i != table.size()-1) data[table.size()-1] = data[i];
+            }
+
+            data.resize(table.size());
+            for(auto& i: resultIndices) i = indices[i];
+
+            if(moving == Vector::Size) continue;
+
+            moved = Vector();
+            moved[moving] = epsilon/2;
+
+            table.clear();
+            indices.clear();
+        }
+
+        return resultIndices;
+    }
+}
+
+void SubdivideRemoveDuplicatesBenchmark::subdivide() {
+    measure("subdivide:", noPrepare, subdivideAll);
+}
+
+void SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshAfter() {
+    CORRADE_COMPARE(measure("subdivide, remove duplicates after:", noPrepare, [](std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+        subdivideAll(indices, positions);
+        indices = MeshTools::duplicate(indices, MeshTools::removeDuplicates(positions));
+    }), UniqueCount);
 }
 
 void SubdivideRemoveDuplicatesBenchmark::subdivideAndRemoveDuplicatesMeshBetween() {
-    QBENCHMARK {
-        Primitives::Icosphere<0> icosphere;
-
-        /* Subdivide 5 times */
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-        MeshTools::subdivide(*icosphere.indices(), *icosphere.positions(0), interpolator);
-        MeshTools::removeDuplicates(*icosphere.indices(), *icosphere.positions(0));
-    }
+    CORRADE_COMPARE(measure("subdivide, remove duplicates between:", noPrepare, [](std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+        for(UnsignedInt i = 0; i != Subdivisions; ++i) {
+            MeshTools::subdivide(indices, positions, interpolator);
+            indices = MeshTools::duplicate(indices, MeshTools::removeDuplicates(positions));
+        }
+    }), UniqueCount);
+}
+
+void SubdivideRemoveDuplicatesBenchmark::subdivideWelded() {
+    CORRADE_COMPARE(measure("subdivide welded:", noPrepare, [](std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+        MeshTools::subdivideWelded(indices, positions, interpolator, Subdivisions);
+    }), UniqueCount);
+}
+
+void SubdivideRemoveDuplicatesBenchmark::removeDuplicatesMultiPass() {
+    CORRADE_COMPARE(measure("remove duplicates, original multi-pass:", subdivideAll, [](std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+        indices = MeshTools::duplicate(indices, removeDuplicatesMultiPassImplementation(positions, Math::TypeTraits<Float>::epsilon()));
+    }), UniqueCount);
+}
+
+void SubdivideRemoveDuplicatesBenchmark::removeDuplicates() {
+    CORRADE_COMPARE(measure("remove duplicates:", subdivideAll, [](std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+        indices = MeshTools::duplicate(indices, MeshTools::removeDuplicates(positions));
+    }), UniqueCount);
+}
+
+void SubdivideRemoveDuplicatesBenchmark::removeDuplicatesExact() {
+    CORRADE_COMPARE(measure("remove duplicates, exact:", subdivideAll, [](std::vector<UnsignedInt>& indices, std::vector<Vector3>& positions) {
+        indices = MeshTools::duplicate(indices, MeshTools::removeDuplicates(positions, 0.0f));
+    }), UniqueCount);
 }
 
 }}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SubdivideRemoveDuplicatesBenchmark)
@@ -26,6 +26,7 @@
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Subdivide.h"
 
@@ -36,6 +37,11 @@ struct SubdivideTest: TestSuite::Tester {
 
     void wrongIndexCount();
     void subdivide();
+
+    void weldedWrongIndexCount();
+    void welded();
+    void weldedMultipleLevels();
+    void weldedClosed();
 };
 
 namespace {
@@ -48,7 +54,12 @@ inline Vector1 interpolator(Vector1 a, Vector1 b) { return (a[0]+b[0])/2; }
 
 SubdivideTest::SubdivideTest() {
     addTests({&SubdivideTest::wrongIndexCount,
-              &SubdivideTest::subdivide});
+              &SubdivideTest::subdivide,
+
+              &SubdivideTest::weldedWrongIndexCount,
+              &SubdivideTest::welded,
+              &SubdivideTest::weldedMultipleLevels,
+              &SubdivideTest::weldedClosed});
 }
 
 void SubdivideTest::wrongIndexCount() {
@@ -72,6 +83,60 @@ void SubdivideTest::subdivide() {
     CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{4, 5, 6, 7, 8, 9, 0, 4, 6, 4, 1, 5, 6, 5, 2, 1, 7, 9, 7, 2, 8, 9, 8, 3}));
 }
 
+void SubdivideTest::weldedWrongIndexCount() {
+    std::stringstream ss;
+    Error redirectError{&ss};
+
+    std::vector<Vector1> positions;
+    std::vector<UnsignedInt> indices{0, 1};
+    MeshTools::subdivideWelded(indices, positions, interpolator);
+    CORRADE_COMPARE(ss.str(), "MeshTools::subdivideWelded(): index count is not divisible by 3!\n");
+}
+
+void SubdivideTest::welded() {
+    std::vector<Vector1> positions{0, 2, 6, 8};
+    std::vector<UnsignedInt> indices{0, 1, 2, 1, 2, 3};
+    MeshTools::subdivideWelded(indices, positions, interpolator);
+
+    /* The 1-2 edge midpoint is shared, children of each triangle are next to
+       each other */
+    CORRADE_VERIFY(positions == (std::vector<Vector1>{0, 2, 6, 8, 1, 4, 3, 7, 5}));
+    CORRADE_COMPARE(indices, (std::vector<UnsignedInt>{4, 5, 6, 0, 4, 6, 4, 1, 5, 6, 5, 2, 5, 7, 8, 1, 5, 8, 5, 2, 7, 8, 7, 3}));
+}
+
+void SubdivideTest::weldedMultipleLevels() {
+    std::vector<Vector1> positions{0, 2, 6, 8};
+    std::vector<UnsignedInt> indices{0, 1, 2, 1, 2, 3};
+    std::vector<Vector1> positionsExpected{positions};
+    std::vector<UnsignedInt> indicesExpected{indices};
+
+    MeshTools::subdivideWelded(indices, positions, interpolator, 3);
+    for(std::size_t i = 0; i != 3; ++i)
+        MeshTools::subdivideWelded(indicesExpected, positionsExpected, interpolator);
+
+    CORRADE_COMPARE(indices.size(), 6*64);
+    CORRADE_COMPARE(indices, indicesExpected);
+    CORRADE_VERIFY(positions == positionsExpected);
+}
+
+void SubdivideTest::weldedClosed() {
+    /* Tetrahedron, each level adds one vertex per edge, which is 3/2 of
+       triangle count on a closed mesh */
+    std::vector<Vector3> positions{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}};
+    std::vector<UnsignedInt> indices{0, 2, 1, 0, 1, 3, 1, 2, 3, 0, 3, 2};
+    MeshTools::subdivideWelded(indices, positions, [](const Vector3& a, const Vector3& b) {
+        return (a + b)*0.5f;
+    }, 2);
+
+    CORRADE_COMPARE(indices.size(), 4*16*3);
+    CORRADE_COMPARE(positions.size(), 4 + 6 + 24);
+
+    /* No duplicates were created */
+    std::vector<Vector3> unique{positions};
+    MeshTools::removeDuplicates(unique);
+    CORRADE_COMPARE(unique.size(), positions.size());
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::SubdivideTest)
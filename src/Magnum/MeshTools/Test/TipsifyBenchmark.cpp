@@ -0,0 +1,227 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <stack>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/MeshTools/Tipsify.h"
+#include "Magnum/Test/BenchmarkTimer.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct TipsifyBenchmark: TestSuite::Tester {
+    explicit TipsifyBenchmark();
+
+    void largeMeshPreviousImplementation();
+    void largeMesh();
+    void largeMeshScratch();
+
+    void smallMeshesPreviousImplementation();
+    void smallMeshes();
+    void smallMeshesScratch();
+};
+
+TipsifyBenchmark::TipsifyBenchmark() {
+    addTests({&TipsifyBenchmark::largeMeshPreviousImplementation,
+              &TipsifyBenchmark::largeMesh,
+              &TipsifyBenchmark::largeMeshScratch,
+
+              &TipsifyBenchmark::smallMeshesPreviousImplementation,
+              &TipsifyBenchmark::smallMeshes,
+              &TipsifyBenchmark::smallMeshesScratch});
+}
+
+namespace {
+    constexpr std::size_t CacheSize = 24;
+
+    /* One large mesh with 2M triangles and 4096 small ones with 512 triangles
+       each */
+    constexpr UnsignedInt LargeSize = 1000;
+    constexpr UnsignedInt SmallSize = 16;
+    constexpr UnsignedInt SmallCount = 4096;
+
+    /* Grid of size*size quads, row by row */
+    std::vector<UnsignedInt> grid(const UnsignedInt size) {
+        std::vector<UnsignedInt> indices;
+        indices.reserve(size*size*6);
+        for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+            const UnsignedInt i = y*(size + 1) + x;
+            indices.insert(indices.end(), {i, i + 1, i + size + 1,
+                                           i + size + 1, i + 1, i + size + 2});
+        }
+        return indices;
+    }
+
+    /* Implementation before scratch memory support, with a std::stack for
+       dead-end vertices, std::vector<bool> for emitted triangles and a
+       temporary vector of candidates allocated in each iteration */
+    void tipsifyPreviousImplementation(std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+        std::vector<UnsignedInt> liveTriangleCount, neighborPosition, neighbors;
+        Implementation::Tipsify{indices, vertexCount}.buildAdjacency(liveTriangleCount, neighborPosition, neighbors);
+
+        UnsignedInt time = cacheSize+1;
+        std::vector<UnsignedInt> timestamp(vertexCount);
+        std::vector<bool> emitted(indices.size()/3);
+        std::stack<UnsignedInt> deadEndStack;
+        std::vector<UnsignedInt> outputIndices;
+        outputIndices.reserve(indices.size());
+
+        UnsignedInt fanningVertex = 0;
+        UnsignedInt i = 0;
+        while(fanningVertex != 0xFFFFFFFFu) {
+            std::vector<UnsignedInt> candidates;
+
+            for(UnsignedInt ti = neighborPosition[fanningVertex]; ti != neighborPosition[fanningVertex+1]; ++ti) {
+                const UnsignedInt t = neighbors[ti];
+                if(emitted[t]) continue;
+                emitted[t] = true;
+
+                for(UnsignedInt vi = 0; vi != 3; ++vi) {
+                    const UnsignedInt v = indices[vi + t*3];
+                    outputIndices.push_back(v);
+                    deadEndStack.push(v);
+                    candidates.push_back(v);
+                    --liveTriangleCount[v];
+                    if(time-timestamp[v] > cacheSize)
+                        timestamp[v] = time++;
+                }
+            }
+
+            fanningVertex = 0xFFFFFFFFu;
+            Int candidatePriority = -1;
+            for(UnsignedInt v: candidates) {
+                if(!liveTriangleCount[v]) continue;
+                Int priority = 0;
+                if(time-timestamp[v]+2*liveTriangleCount[v] <= cacheSize)
+                    priority = time-timestamp[v];
+                if(priority > candidatePriority) {
+                    fanningVertex = v;
+                    candidatePriority = priority;
+                }
+            }
+
+            if(fanningVertex == 0xFFFFFFFFu) {
+                while(!deadEndStack.empty()) {
+                    const UnsignedInt d = deadEndStack.top();
+                    deadEndStack.pop();
+                    if(!liveTriangleCount[d]) continue;
+                    fanningVertex = d;
+                    break;
+                }
+
+                while(++i < vertexCount) {
+                    if(!liveTriangleCount[i]) continue;
+                    fanningVertex = i;
+                    break;
+                }
+            }
+        }
+
+        std::swap(indices, outputIndices);
+    }
+
+    /* Runs the function a few times on fresh meshes and prints the best
+       time, returns the processed meshes from the last run */
+    template<class F> std::vector<std::vector<UnsignedInt>> measure(const char* name, const UnsignedInt size, const UnsignedInt count, F f) {
+        const std::vector<UnsignedInt> original = grid(size);
+        std::vector<std::vector<UnsignedInt>> meshes;
+        Magnum::Test::BenchmarkTimer timer;
+        for(std::size_t i = 0; i != 3; ++i) {
+            meshes.assign(count, original);
+
+            timer.start();
+            for(std::vector<UnsignedInt>& indices: meshes)
+                f(indices, (size + 1)*(size + 1));
+            timer.stop();
+        }
+
+        Debug() << "   " << name << timer.milliseconds() << "ms";
+        return meshes;
+    }
+
+    /* Scratch memory shared by all calls */
+    std::vector<UnsignedInt> scratch;
+
+    void tipsifyScratch(std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount) {
+        MeshTools::tipsify({indices.data(), indices.size()}, vertexCount, CacheSize, {reinterpret_cast<char*>(scratch.data()), scratch.size()*4});
+    }
+}
+
+void TipsifyBenchmark::largeMeshPreviousImplementation() {
+    const auto meshes = measure("previous implementation", LargeSize, 1, [](std::vector<UnsignedInt>& indices, UnsignedInt vertexCount) {
+        tipsifyPreviousImplementation(indices, vertexCount, CacheSize);
+    });
+    CORRADE_COMPARE(meshes[0].size(), LargeSize*LargeSize*6);
+}
+
+void TipsifyBenchmark::largeMesh() {
+    const auto meshes = measure("tipsify()", LargeSize, 1, [](std::vector<UnsignedInt>& indices, UnsignedInt vertexCount) {
+        MeshTools::tipsify(indices, vertexCount, CacheSize);
+    });
+
+    std::vector<UnsignedInt> expected = grid(LargeSize);
+    tipsifyPreviousImplementation(expected, (LargeSize + 1)*(LargeSize + 1), CacheSize);
+    CORRADE_VERIFY(meshes[0] == expected);
+}
+
+void TipsifyBenchmark::largeMeshScratch() {
+    scratch.resize(MeshTools::tipsifyScratchSize(LargeSize*LargeSize*6, (LargeSize + 1)*(LargeSize + 1), CacheSize)/4 + 1);
+    const auto meshes = measure("tipsify() with scratch memory", LargeSize, 1, tipsifyScratch);
+
+    std::vector<UnsignedInt> expected = grid(LargeSize);
+    tipsifyPreviousImplementation(expected, (LargeSize + 1)*(LargeSize + 1), CacheSize);
+    CORRADE_VERIFY(meshes[0] == expected);
+}
+
+void TipsifyBenchmark::smallMeshesPreviousImplementation() {
+    const auto meshes = measure("previous implementation", SmallSize, SmallCount, [](std::vector<UnsignedInt>& indices, UnsignedInt vertexCount) {
+        tipsifyPreviousImplementation(indices, vertexCount, CacheSize);
+    });
+    CORRADE_COMPARE(meshes.size(), SmallCount);
+}
+
+void TipsifyBenchmark::smallMeshes() {
+    const auto meshes = measure("tipsify()", SmallSize, SmallCount, [](std::vector<UnsignedInt>& indices, UnsignedInt vertexCount) {
+        MeshTools::tipsify(indices, vertexCount, CacheSize);
+    });
+
+    std::vector<UnsignedInt> expected = grid(SmallSize);
+    tipsifyPreviousImplementation(expected, (SmallSize + 1)*(SmallSize + 1), CacheSize);
+    CORRADE_VERIFY(meshes.back() == expected);
+}
+
+void TipsifyBenchmark::smallMeshesScratch() {
+    scratch.resize(MeshTools::tipsifyScratchSize(SmallSize*SmallSize*6, (SmallSize + 1)*(SmallSize + 1), CacheSize)/4 + 1);
+    const auto meshes = measure("tipsify() with scratch memory", SmallSize, SmallCount, tipsifyScratch);
+
+    std::vector<UnsignedInt> expected = grid(SmallSize);
+    tipsifyPreviousImplementation(expected, (SmallSize + 1)*(SmallSize + 1), CacheSize);
+    CORRADE_VERIFY(meshes.back() == expected);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TipsifyBenchmark)
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Magnum.h"
@@ -35,6 +36,12 @@ struct TipsifyTest: TestSuite::Tester {
 
     void buildAdjacency();
     void tipsify();
+
+    void scratch();
+    void scratchReuse();
+    void scratchEmpty();
+    void scratchTooSmall();
+    void scratchWrongIndexCount();
 };
 
 /*
@@ -79,11 +86,28 @@ namespace {
     };
 
     constexpr std::size_t VertexCount = 19;
+
+    /* Grid of size*size quads, row by row */
+    std::vector<UnsignedInt> grid(const UnsignedInt size) {
+        std::vector<UnsignedInt> indices;
+        for(UnsignedInt y = 0; y != size; ++y) for(UnsignedInt x = 0; x != size; ++x) {
+            const UnsignedInt i = y*(size + 1) + x;
+            indices.insert(indices.end(), {i, i + 1, i + size + 1,
+                                           i + size + 1, i + 1, i + size + 2});
+        }
+        return indices;
+    }
 }
 
 TipsifyTest::TipsifyTest() {
     addTests({&TipsifyTest::buildAdjacency,
-              &TipsifyTest::tipsify});
+              &TipsifyTest::tipsify,
+
+              &TipsifyTest::scratch,
+              &TipsifyTest::scratchReuse,
+              &TipsifyTest::scratchEmpty,
+              &TipsifyTest::scratchTooSmall,
+              &TipsifyTest::scratchWrongIndexCount});
 }
 
 void TipsifyTest::buildAdjacency() {
@@ -159,6 +183,62 @@ void TipsifyTest::tipsify() {
     }));
 }
 
+void TipsifyTest::scratch() {
+    /* Same output as with the allocating variant */
+    std::vector<UnsignedInt> expected = Indices;
+    MeshTools::tipsify(expected, VertexCount, 3);
+
+    std::vector<UnsignedInt> indices = Indices;
+    std::vector<UnsignedInt> scratch(MeshTools::tipsifyScratchSize(indices.size(), VertexCount, 3)/4 + 1);
+    MeshTools::tipsify({indices.data(), indices.size()}, VertexCount, 3, {reinterpret_cast<char*>(scratch.data()), scratch.size()*4});
+    CORRADE_COMPARE(indices, expected);
+}
+
+void TipsifyTest::scratchReuse() {
+    /* Sized for the largest mesh, large enough to overflow the dead-end
+       stack */
+    std::vector<UnsignedInt> scratch(MeshTools::tipsifyScratchSize(64*64*6, 65*65, 16)/4 + 1);
+    for(const UnsignedInt size: {64, 5, 32}) {
+        std::vector<UnsignedInt> expected = grid(size);
+        MeshTools::tipsify(expected, (size + 1)*(size + 1), 16);
+
+        std::vector<UnsignedInt> indices = grid(size);
+        MeshTools::tipsify({indices.data(), indices.size()}, (size + 1)*(size + 1), 16, {reinterpret_cast<char*>(scratch.data()), scratch.size()*4});
+        CORRADE_COMPARE(indices, expected);
+    }
+}
+
+void TipsifyTest::scratchEmpty() {
+    std::vector<UnsignedInt> indices;
+    MeshTools::tipsify({indices.data(), indices.size()}, 0, 16, nullptr);
+    CORRADE_VERIFY(indices.empty());
+}
+
+void TipsifyTest::scratchTooSmall() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::vector<UnsignedInt> indices = Indices;
+    const std::size_t size = MeshTools::tipsifyScratchSize(indices.size(), VertexCount, 3);
+    /* One element more, so the misaligned view below fits into it too */
+    std::vector<UnsignedInt> scratch(size/4 + 1);
+    MeshTools::tipsify({indices.data(), indices.size()}, VertexCount, 3, {reinterpret_cast<char*>(scratch.data()), size - 1});
+    MeshTools::tipsify({indices.data(), indices.size()}, VertexCount, 3, {reinterpret_cast<char*>(scratch.data()) + 1, size});
+    CORRADE_COMPARE(indices, Indices);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::tipsify(): expected at least " + std::to_string(size) + " bytes of scratch memory but got " + std::to_string(size - 1) + "\n"
+        "MeshTools::tipsify(): scratch memory is not aligned to four bytes\n");
+}
+
+void TipsifyTest::scratchWrongIndexCount() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    std::vector<UnsignedInt> indices{0, 1};
+    MeshTools::tipsify({indices.data(), indices.size()}, 2, 3, nullptr);
+    CORRADE_COMPARE(out.str(), "MeshTools::tipsify(): index count is not divisible by 3\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TipsifyTest)
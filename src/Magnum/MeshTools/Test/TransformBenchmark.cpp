@@ -0,0 +1,107 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/MeshTools/Transform.h"
+#include "Magnum/Test/BenchmarkTimer.h"
+
+namespace Magnum { namespace MeshTools { namespace Test {
+
+struct TransformBenchmark: TestSuite::Tester {
+    explicit TransformBenchmark();
+
+    void matrix();
+    void dualQuaternion();
+};
+
+TransformBenchmark::TransformBenchmark() {
+    addTests({&TransformBenchmark::matrix,
+              &TransformBenchmark::dualQuaternion});
+}
+
+namespace {
+    constexpr std::size_t Count = 16*1024*1024;
+
+    std::vector<Vector3> points() {
+        std::vector<Vector3> out;
+        out.reserve(Count);
+        for(std::size_t i = 0; i != Count; ++i)
+            out.emplace_back(Float(i%1021), Float(i%509), Float(i%257));
+        return out;
+    }
+
+    /* Runs the function a few times on fresh data and prints the best time */
+    template<class F> std::vector<Vector3> measure(const char* name, F f) {
+        std::vector<Vector3> data;
+        Magnum::Test::BenchmarkTimer timer;
+        for(std::size_t i = 0; i != 3; ++i) {
+            data = points();
+            timer.measure([&]() { f(data); });
+        }
+
+        Debug() << "   " << name << timer.milliseconds() << "ms";
+        return data;
+    }
+
+    Containers::ArrayView<char> view(std::vector<Vector3>& data) {
+        return {reinterpret_cast<char*>(data.data()), data.size()*sizeof(Vector3)};
+    }
+}
+
+void TransformBenchmark::matrix() {
+    const Matrix4 matrix = Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::rotationZ(Deg(35.0f))*Matrix4::scaling(Vector3{2.0f});
+
+    const std::vector<Vector3> a = measure("transformPointsInPlace(Matrix4, std::vector):", [&matrix](std::vector<Vector3>& data) {
+        MeshTools::transformPointsInPlace(matrix, data);
+    });
+    const std::vector<Vector3> b = measure("transformPointsInPlace(Matrix4, ArrayView, stride):", [&matrix](std::vector<Vector3>& data) {
+        MeshTools::transformPointsInPlace(matrix, view(data), sizeof(Vector3));
+    });
+    const std::vector<Vector3> c = measure("transformPointsInPlace(Matrix4, ArrayView, stride) on all threads:", [&matrix](std::vector<Vector3>& data) {
+        MeshTools::transformPointsInPlace(matrix, view(data), sizeof(Vector3), 0);
+    });
+
+    CORRADE_COMPARE(b[Count - 1], a[Count - 1]);
+    CORRADE_COMPARE(c[Count/2], a[Count/2]);
+}
+
+void TransformBenchmark::dualQuaternion() {
+    const DualQuaternion transformation = DualQuaternion::translation({1.0f, 2.0f, 3.0f})*DualQuaternion::rotation(Deg(35.0f), Vector3::zAxis());
+
+    const std::vector<Vector3> a = measure("transformPointsInPlace(DualQuaternion, std::vector):", [&transformation](std::vector<Vector3>& data) {
+        MeshTools::transformPointsInPlace(transformation, data);
+    });
+    const std::vector<Vector3> b = measure("transformPointsInPlace(DualQuaternion, ArrayView, stride):", [&transformation](std::vector<Vector3>& data) {
+        MeshTools::transformPointsInPlace(transformation, view(data), sizeof(Vector3));
+    });
+
+    CORRADE_COMPARE(b[Count - 1], a[Count - 1]);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TransformBenchmark)
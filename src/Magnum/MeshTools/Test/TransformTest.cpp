@@ -24,6 +24,9 @@
 */
 
 #include <array>
+#include <cstring>
+#include <sstream>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/TestSuite/Tester.h>
 
 #include "Magnum/Math/Matrix3.h"
@@ -40,6 +43,14 @@ struct TransformTest: TestSuite::Tester {
 
     void transformPoints2D();
     void transformPoints3D();
+
+    void interleavedVectors();
+    void interleavedPoints();
+    void interleavedPointsProjective();
+    void interleavedParallel();
+    void interleavedEmpty();
+    void interleavedWrongStride();
+    void interleavedNotNormalized();
 };
 
 TransformTest::TransformTest() {
@@ -47,7 +58,15 @@ TransformTest::TransformTest() {
               &TransformTest::transformVectors3D,
 
               &TransformTest::transformPoints2D,
-              &TransformTest::transformPoints3D});
+              &TransformTest::transformPoints3D,
+
+              &TransformTest::interleavedVectors,
+              &TransformTest::interleavedPoints,
+              &TransformTest::interleavedPointsProjective,
+              &TransformTest::interleavedParallel,
+              &TransformTest::interleavedEmpty,
+              &TransformTest::interleavedWrongStride,
+              &TransformTest::interleavedNotNormalized});
 }
 
 constexpr static std::array<Vector2, 2> points2D{{
@@ -116,6 +135,143 @@ void TransformTest::transformPoints3D() {
     CORRADE_COMPARE(quaternion, points3DRotatedTranslated);
 }
 
+namespace {
+    /* Points interleaved with a four-byte attribute, with the last stride
+       cut right after the point to verify nothing is written past it */
+    constexpr std::size_t Stride = sizeof(Vector3) + 4;
+
+    std::vector<Vector3> points(const std::size_t count) {
+        std::vector<Vector3> out;
+        for(std::size_t i = 0; i != count; ++i)
+            out.emplace_back(Float(i%17) - 8.0f, Float(i%5)*0.5f, Float(i%11)*-0.25f + 1.0f);
+        return out;
+    }
+
+    Containers::Array<char> interleaved(const std::vector<Vector3>& points) {
+        Containers::Array<char> data{Containers::ValueInit, points.size()*Stride};
+        for(std::size_t i = 0; i != points.size(); ++i) {
+            std::memcpy(data + 4 + i*Stride, points[i].data(), sizeof(Vector3));
+            data[i*Stride] = char(i);
+        }
+        return data;
+    }
+
+    Containers::ArrayView<char> view(Containers::Array<char>& data) {
+        return data.suffix(4);
+    }
+
+    std::vector<Vector3> extract(const Containers::Array<char>& data) {
+        std::vector<Vector3> out(data.size()/Stride);
+        for(std::size_t i = 0; i != out.size(); ++i)
+            std::memcpy(out[i].data(), data + 4 + i*Stride, sizeof(Vector3));
+        return out;
+    }
+
+    bool paddingUntouched(const Containers::Array<char>& data) {
+        for(std::size_t i = 0; i != data.size()/Stride; ++i)
+            if(data[i*Stride] != char(i) || data[i*Stride + 1] || data[i*Stride + 2] || data[i*Stride + 3]) return false;
+        return true;
+    }
+}
+
+void TransformTest::interleavedVectors() {
+    /* Odd count to test the scalar remainder */
+    const std::vector<Vector3> original = points(7);
+    const Matrix4 matrix = Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::rotationZ(Deg(35.0f))*Matrix4::scaling({2.0f, 1.0f, 0.5f});
+    const Quaternion quaternion = Quaternion::rotation(Deg(35.0f), Vector3(1.0f, 2.0f, -1.0f).normalized());
+
+    Containers::Array<char> matrixData = interleaved(original);
+    Containers::Array<char> quaternionData = interleaved(original);
+    MeshTools::transformVectorsInPlace(matrix, view(matrixData), Stride);
+    MeshTools::transformVectorsInPlace(quaternion, view(quaternionData), Stride);
+
+    const std::vector<Vector3> matrixTransformed = extract(matrixData);
+    const std::vector<Vector3> quaternionTransformed = extract(quaternionData);
+    for(std::size_t i = 0; i != original.size(); ++i) {
+        CORRADE_COMPARE(matrixTransformed[i], matrix.transformVector(original[i]));
+        CORRADE_COMPARE(quaternionTransformed[i], quaternion.transformVectorNormalized(original[i]));
+    }
+    CORRADE_VERIFY(paddingUntouched(matrixData));
+    CORRADE_VERIFY(paddingUntouched(quaternionData));
+}
+
+void TransformTest::interleavedPoints() {
+    const std::vector<Vector3> original = points(7);
+    const Matrix4 matrix = Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::rotationZ(Deg(35.0f))*Matrix4::scaling({2.0f, 1.0f, 0.5f});
+    const DualQuaternion dualQuaternion = DualQuaternion::translation({1.0f, 2.0f, 3.0f})*DualQuaternion::rotation(Deg(35.0f), Vector3(1.0f, 2.0f, -1.0f).normalized());
+
+    Containers::Array<char> matrixData = interleaved(original);
+    Containers::Array<char> dualQuaternionData = interleaved(original);
+    MeshTools::transformPointsInPlace(matrix, view(matrixData), Stride);
+    MeshTools::transformPointsInPlace(dualQuaternion, view(dualQuaternionData), Stride);
+
+    const std::vector<Vector3> matrixTransformed = extract(matrixData);
+    const std::vector<Vector3> dualQuaternionTransformed = extract(dualQuaternionData);
+    for(std::size_t i = 0; i != original.size(); ++i) {
+        CORRADE_COMPARE(matrixTransformed[i], matrix.transformPoint(original[i]));
+        CORRADE_COMPARE(dualQuaternionTransformed[i], dualQuaternion.transformPointNormalized(original[i]));
+    }
+    CORRADE_VERIFY(paddingUntouched(matrixData));
+    CORRADE_VERIFY(paddingUntouched(dualQuaternionData));
+}
+
+void TransformTest::interleavedPointsProjective() {
+    const std::vector<Vector3> original = points(7);
+    const Matrix4 matrix = Matrix4::perspectiveProjection(Deg(60.0f), 1.5f, 0.5f, 100.0f)*Matrix4::translation(Vector3::zAxis(-12.0f));
+
+    Containers::Array<char> data = interleaved(original);
+    MeshTools::transformPointsInPlace(matrix, view(data), Stride);
+
+    const std::vector<Vector3> transformed = extract(data);
+    for(std::size_t i = 0; i != original.size(); ++i)
+        CORRADE_COMPARE(transformed[i], matrix.transformPoint(original[i]));
+}
+
+void TransformTest::interleavedParallel() {
+    /* Large enough to be split among the threads, the result is the same as
+       with a single thread */
+    const std::vector<Vector3> original = points(200001);
+    const Matrix4 matrix = Matrix4::translation({1.0f, 2.0f, 3.0f})*Matrix4::rotationZ(Deg(35.0f));
+
+    Containers::Array<char> serial = interleaved(original);
+    Containers::Array<char> parallel = interleaved(original);
+    MeshTools::transformPointsInPlace(matrix, view(serial), Stride);
+    MeshTools::transformPointsInPlace(matrix, view(parallel), Stride, 3);
+
+    CORRADE_VERIFY(std::memcmp(serial.data(), parallel.data(), serial.size()) == 0);
+    CORRADE_COMPARE(extract(parallel)[200000], matrix.transformPoint(original[200000]));
+}
+
+void TransformTest::interleavedEmpty() {
+    /* Shouldn't crash */
+    MeshTools::transformPointsInPlace(Matrix4::translation(Vector3::xAxis()), nullptr, Stride);
+    CORRADE_VERIFY(true);
+}
+
+void TransformTest::interleavedWrongStride() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Vector3 data[2];
+    MeshTools::transformVectorsInPlace(Matrix4{}, {reinterpret_cast<char*>(data), sizeof(data)}, 8);
+    MeshTools::transformPointsInPlace(Matrix4{}, {reinterpret_cast<char*>(data), sizeof(data)}, 8);
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::transformVectorsInPlace(): expected stride to be at least 12 but got 8\n"
+        "MeshTools::transformPointsInPlace(): expected stride to be at least 12 but got 8\n");
+}
+
+void TransformTest::interleavedNotNormalized() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Vector3 data[2];
+    MeshTools::transformVectorsInPlace(Quaternion{{}, 2.0f}, {reinterpret_cast<char*>(data), sizeof(data)}, sizeof(Vector3));
+    MeshTools::transformPointsInPlace(DualQuaternion{Quaternion{{}, 2.0f}}, {reinterpret_cast<char*>(data), sizeof(data)}, sizeof(Vector3));
+    CORRADE_COMPARE(out.str(),
+        "MeshTools::transformVectorsInPlace(): quaternion must be normalized\n"
+        "MeshTools::transformPointsInPlace(): dual quaternion must be normalized\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::TransformTest)
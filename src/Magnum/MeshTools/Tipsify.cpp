@@ -25,51 +25,114 @@
 
 #include "Tipsify.h"
 
-#include <stack>
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
 
-namespace Magnum { namespace MeshTools { namespace Implementation {
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* Capacity of the dead-end vertex ring buffer, power of two so the wrap
+   around is just a mask */
+std::size_t deadEndStackSize(const std::size_t cacheSize) {
+    std::size_t size = 32;
+    while(size < cacheSize*4) size <<= 1;
+    return size;
+}
+
+void buildAdjacency(const UnsignedInt* const indices, const std::size_t indexCount, const UnsignedInt vertexCount, UnsignedInt* const liveTriangleCount, UnsignedInt* const neighborOffset, UnsignedInt* const neighbors) {
+    /* How many times is each vertex referenced == count of neighboring
+       triangles for each vertex */
+    std::fill_n(liveTriangleCount, vertexCount, 0);
+    for(std::size_t i = 0; i != indexCount; ++i)
+        ++liveTriangleCount[indices[i]];
+
+    /* Building offset array from counts. Neighbors for i-th vertex will at
+       the end be in interval neighbors[neighborOffset[i]] ;
+       neighbors[neighborOffset[i+1]]. Currently the values are shifted to
+       right, because the next loop will shift them back left. */
+    neighborOffset[0] = 0;
+    UnsignedInt sum = 0;
+    for(std::size_t i = 0; i != vertexCount; ++i) {
+        neighborOffset[i + 1] = sum;
+        sum += liveTriangleCount[i];
+    }
+
+    /* Array of neighbors, using (and changing) neighborOffset array for
+       positioning */
+    for(std::size_t i = 0; i != indexCount; ++i)
+        neighbors[neighborOffset[indices[i]+1]++] = i/3;
+}
+
+}
+
+std::size_t tipsifyScratchSize(const std::size_t indexCount, const UnsignedInt vertexCount, const std::size_t cacheSize) {
+    if(!indexCount) return 0;
+
+    /* Live triangle count, neighbor offsets, neighbors, timestamps, output
+       indices and dead-end stack, then per-triangle emitted flags */
+    return (std::size_t(vertexCount)*3 + 1 + indexCount*2 + deadEndStackSize(cacheSize))*sizeof(UnsignedInt) + indexCount/3;
+}
+
+void tipsify(const Containers::ArrayView<UnsignedInt> indices, const UnsignedInt vertexCount, const std::size_t cacheSize, const Containers::ArrayView<char> scratch) {
+    CORRADE_ASSERT(!(indices.size()%3), "MeshTools::tipsify(): index count is not divisible by 3", );
+    if(indices.empty()) return;
+    CORRADE_ASSERT(scratch.size() >= tipsifyScratchSize(indices.size(), vertexCount, cacheSize),
+        "MeshTools::tipsify(): expected at least" << tipsifyScratchSize(indices.size(), vertexCount, cacheSize) << "bytes of scratch memory but got" << scratch.size(), );
+    CORRADE_ASSERT(reinterpret_cast<std::size_t>(scratch.data()) % sizeof(UnsignedInt) == 0,
+        "MeshTools::tipsify(): scratch memory is not aligned to four bytes", );
+
+    /* Carve all temporary arrays out of the scratch memory */
+    UnsignedInt* const liveTriangleCount = reinterpret_cast<UnsignedInt*>(scratch.data());
+    UnsignedInt* const neighborOffset = liveTriangleCount + vertexCount;
+    UnsignedInt* const neighbors = neighborOffset + vertexCount + 1;
+    UnsignedInt* const timestamp = neighbors + indices.size();
+    UnsignedInt* const outputIndices = timestamp + vertexCount;
+    UnsignedInt* const deadEndStack = outputIndices + indices.size();
+    const std::size_t deadEndStackMask = deadEndStackSize(cacheSize) - 1;
+    UnsignedByte* const emitted = reinterpret_cast<UnsignedByte*>(deadEndStack + deadEndStackMask + 1);
 
-void Tipsify::operator()(std::size_t cacheSize) {
     /* Neighboring triangles for each vertex, per-vertex live triangle count */
-    std::vector<UnsignedInt> liveTriangleCount, neighborPosition, neighbors;
-    buildAdjacency(liveTriangleCount, neighborPosition, neighbors);
+    buildAdjacency(indices.data(), indices.size(), vertexCount, liveTriangleCount, neighborOffset, neighbors);
 
     /* Global time, per-vertex caching timestamps, per-triangle emmited flag */
     UnsignedInt time = cacheSize+1;
-    std::vector<UnsignedInt> timestamp(vertexCount);
-    std::vector<bool> emitted(indices.size()/3);
+    std::fill_n(timestamp, vertexCount, 0);
+    std::fill_n(emitted, indices.size()/3, 0);
 
-    /* Dead-end vertex stack */
-    std::stack<UnsignedInt> deadEndStack;
+    /* Dead-end vertex stack. When full, the oldest entries get
+       overwritten. */
+    std::size_t deadEndStackTop = 0, deadEndStackCount = 0;
 
-    /* Output index buffer */
-    std::vector<UnsignedInt> outputIndices;
-    outputIndices.reserve(indices.size());
+    /* Output cursor */
+    std::size_t outputSize = 0;
 
     /* Starting vertex for fanning, cursor */
     UnsignedInt fanningVertex = 0;
     UnsignedInt i = 0;
     while(fanningVertex != 0xFFFFFFFFu) {
-        /* Array with candidates for next fanning vertex (in 1-ring around
-           fanning vertex) */
-        std::vector<UnsignedInt> candidates;
+        /* Candidates for next fanning vertex (in 1-ring around fanning
+           vertex) are all vertices written to the output in this
+           iteration */
+        const std::size_t candidatesBegin = outputSize;
 
         /* For all neighbors of fanning vertex */
-        for(UnsignedInt ti = neighborPosition[fanningVertex], t = neighbors[ti]; ti != neighborPosition[fanningVertex+1]; t = neighbors[++ti]) {
+        for(UnsignedInt ti = neighborOffset[fanningVertex]; ti != neighborOffset[fanningVertex+1]; ++ti) {
+            const UnsignedInt t = neighbors[ti];
+
             /* Continue if already emitted */
             if(emitted[t]) continue;
-            emitted[t] = true;
+            emitted[t] = 1;
 
             /* Write all vertices of the triangle to output buffer */
             for(UnsignedInt vi = 0; vi != 3; ++vi) {
                 const UnsignedInt v = indices[vi + t*3];
 
-                outputIndices.push_back(v);
+                outputIndices[outputSize++] = v;
 
-                /* Add to dead end stack and candidates array */
-                /** @todo Limit size of dead end stack to cache size */
-                deadEndStack.push(v);
-                candidates.push_back(v);
+                /* Add to dead end stack */
+                deadEndStack[deadEndStackTop++ & deadEndStackMask] = v;
+                if(deadEndStackCount <= deadEndStackMask) ++deadEndStackCount;
 
                 /* Decrease live triangle count */
                 --liveTriangleCount[v];
@@ -85,7 +148,9 @@ void Tipsify::operator()(std::size_t cacheSize) {
 
         /* Go through candidates in 1-ring around fanning vertex */
         Int candidatePriority = -1;
-        for(UnsignedInt v: candidates) {
+        for(std::size_t ci = candidatesBegin; ci != outputSize; ++ci) {
+            const UnsignedInt v = outputIndices[ci];
+
             /* Skip if it doesn't have any live triangles */
             if(!liveTriangleCount[v]) continue;
 
@@ -104,9 +169,9 @@ void Tipsify::operator()(std::size_t cacheSize) {
         /* On dead-end */
         if(fanningVertex == 0xFFFFFFFFu) {
             /* Find vertex with live triangles in dead-end stack */
-            while(!deadEndStack.empty()) {
-                unsigned int d = deadEndStack.top();
-                deadEndStack.pop();
+            while(deadEndStackCount) {
+                --deadEndStackCount;
+                const UnsignedInt d = deadEndStack[--deadEndStackTop & deadEndStackMask];
 
                 if(!liveTriangleCount[d]) continue;
                 fanningVertex = d;
@@ -124,38 +189,29 @@ void Tipsify::operator()(std::size_t cacheSize) {
         }
     }
 
-    /* Swap original index buffer with optimized */
-    using std::swap;
-    swap(indices, outputIndices);
+    /* Copy the optimized index buffer back */
+    std::copy_n(outputIndices, indices.size(), indices.data());
 }
 
-void Tipsify::buildAdjacency(std::vector<UnsignedInt>& liveTriangleCount, std::vector<UnsignedInt>& neighborOffset, std::vector<UnsignedInt>& neighbors) const {
-    /* How many times is each vertex referenced == count of neighboring
-       triangles for each vertex */
-    liveTriangleCount.clear();
+namespace Implementation {
+
+void Tipsify::operator()(std::size_t cacheSize) {
+    /* Single allocation for all temporary data */
+    std::vector<UnsignedInt> scratch((tipsifyScratchSize(indices.size(), vertexCount, cacheSize) + sizeof(UnsignedInt) - 1)/sizeof(UnsignedInt));
+    tipsify({indices.data(), indices.size()}, vertexCount, cacheSize, {reinterpret_cast<char*>(scratch.data()), scratch.size()*sizeof(UnsignedInt)});
+}
+
+void buildAdjacency(const std::vector<UnsignedInt>& indices, const UnsignedInt vertexCount, std::vector<UnsignedInt>& liveTriangleCount, std::vector<UnsignedInt>& neighborOffset, std::vector<UnsignedInt>& neighbors) {
     liveTriangleCount.resize(vertexCount);
-    for(std::size_t i = 0; i != indices.size(); ++i)
-        ++liveTriangleCount[indices[i]];
+    neighborOffset.resize(vertexCount + 1);
+    neighbors.resize(indices.size());
+    MeshTools::buildAdjacency(indices.data(), indices.size(), vertexCount, liveTriangleCount.data(), neighborOffset.data(), neighbors.data());
+}
 
-    /* Building offset array from counts. Neighbors for i-th vertex will at
-       the end be in interval neighbors[neighborOffset[i]] ;
-       neighbors[neighborOffset[i+1]]. Currently the values are shifted to
-       right, because the next loop will shift them back left. */
-    neighborOffset.clear();
-    neighborOffset.reserve(vertexCount+1);
-    neighborOffset.push_back(0);
-    UnsignedInt sum = 0;
-    for(std::size_t i = 0; i != vertexCount; ++i) {
-        neighborOffset.push_back(sum);
-        sum += liveTriangleCount[i];
-    }
+void Tipsify::buildAdjacency(std::vector<UnsignedInt>& liveTriangleCount, std::vector<UnsignedInt>& neighborOffset, std::vector<UnsignedInt>& neighbors) const {
+    Implementation::buildAdjacency(indices, vertexCount, liveTriangleCount, neighborOffset, neighbors);
+}
 
-    /* Array of neighbors, using (and changing) neighborOffset array for
-       positioning */
-    neighbors.clear();
-    neighbors.resize(sum);
-    for(std::size_t i = 0; i != indices.size(); ++i)
-        neighbors[neighborOffset[indices[i]+1]++] = i/3;
 }
 
-}}}
+}}
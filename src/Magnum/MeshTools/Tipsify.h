@@ -26,18 +26,23 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::tipsify()
+ * @brief Function @ref Magnum::MeshTools::tipsify(), @ref Magnum::MeshTools::tipsifyScratchSize()
  */
 
 #include <vector>
+#include <Corrade/Containers/ArrayView.h>
 
-#include "Magnum/Types.h"
+#include "Magnum/Magnum.h"
 #include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
 
 namespace Implementation {
 
+/* Computes count and indices of adjacent triangles for each vertex, used by
+   tipsify() and buildMeshlets() */
+MAGNUM_MESHTOOLS_EXPORT void buildAdjacency(const std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::vector<UnsignedInt>& liveTriangleCount, std::vector<UnsignedInt>& neighborOffset, std::vector<UnsignedInt>& neighbors);
+
 class MAGNUM_MESHTOOLS_EXPORT Tipsify {
     public:
         Tipsify(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount): indices(indices), vertexCount(vertexCount) {}
@@ -71,12 +76,60 @@ array for beter usage of post-transform vertex cache. Algorithm used:
 *Pedro V. Sander, Diego Nehab, and Joshua Barczak - Fast Triangle Reordering
 for Vertex Locality and Reduced Overdraw, SIGGRAPH 2007,
 http://gfx.cs.princeton.edu/pubs/Sander_2007_%3ETR/index.php*.
+@see @ref optimizeOverdraw(), @ref optimizeVertexFetch(),
+    @ref analyzeVertexCache()
 @todo Ability to compute vertex count automatically
 */
 inline void tipsify(std::vector<UnsignedInt>& indices, UnsignedInt vertexCount, std::size_t cacheSize) {
     Implementation::Tipsify(indices, vertexCount)(cacheSize);
 }
 
+/**
+@brief Scratch memory size for tipsifying a mesh
+@param indexCount   Index count
+@param vertexCount  Vertex count
+@param cacheSize    Post-transform vertex cache size
+
+Size in bytes of scratch memory needed by
+@ref tipsify(Containers::ArrayView<UnsignedInt>, UnsignedInt, std::size_t, Containers::ArrayView<char>).
+*/
+std::size_t MAGNUM_MESHTOOLS_EXPORT tipsifyScratchSize(std::size_t indexCount, UnsignedInt vertexCount, std::size_t cacheSize);
+
+/**
+@brief Tipsify the mesh using caller-supplied scratch memory
+@param[in,out] indices  Indices array to operate on
+@param[in] vertexCount  Vertex count
+@param[in] cacheSize    Post-transform vertex cache size
+@param[in] scratch      Scratch memory
+
+Same as @ref tipsify(std::vector<UnsignedInt>&, UnsignedInt, std::size_t),
+but doesn't allocate any memory. All temporary data, including the output
+index array, are placed into @p scratch, which is expected to be at least
+@ref tipsifyScratchSize() bytes large and aligned to four bytes. The memory
+can be reused for any number of calls, thus meshes can be processed in
+parallel by giving each thread its own scratch memory sized for the largest
+mesh:
+@code
+std::vector<std::vector<UnsignedInt>>& meshIndices = ...;
+std::vector<UnsignedInt>& meshVertexCounts = ...;
+
+// In each thread of the pool
+std::vector<UnsignedInt> scratch(MeshTools::tipsifyScratchSize(maxIndexCount, maxVertexCount, 24)/4 + 1);
+for(std::size_t i: meshesForThisThread)
+    MeshTools::tipsify({meshIndices[i].data(), meshIndices[i].size()}, meshVertexCounts[i], 24,
+        {reinterpret_cast<char*>(scratch.data()), scratch.size()*4});
+@endcode
+
+The dead-end vertex stack is a ring buffer with size depending only on
+@p cacheSize. Vertices evicted from it are still found by the linear search
+for next vertex with live triangles, so the output is the same as with the
+other overload.
+
+@attention The function requires the mesh to have triangle faces, thus index
+    count must be divisible by 3.
+*/
+void MAGNUM_MESHTOOLS_EXPORT tipsify(Containers::ArrayView<UnsignedInt> indices, UnsignedInt vertexCount, std::size_t cacheSize, Containers::ArrayView<char> scratch);
+
 }}
 
 #endif
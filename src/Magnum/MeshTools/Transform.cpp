@@ -0,0 +1,216 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Transform.h"
+
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Implementation/parallel.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MAGNUM_MESHTOOLS_TRANSFORM_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Magnum { namespace MeshTools {
+
+namespace {
+
+/* The vectors can be at any alignment in interleaved data, so they are
+   accessed through memcpy() */
+inline Vector3 load(const char* const data) {
+    Vector3 out;
+    std::memcpy(out.data(), data, sizeof(Vector3));
+    return out;
+}
+
+inline void store(char* const data, const Vector3& vector) {
+    std::memcpy(data, vector.data(), sizeof(Vector3));
+}
+
+/* Column-major matrix applied to (x, y, z, w), where w is 1 for points and 0
+   for vectors. Projective matrices additionally divide by the resulting w. */
+struct MatrixKernel {
+    explicit MatrixKernel(const Matrix4& matrix, const bool points): m(matrix), projective{points && matrix.row(3) != Vector4{0.0f, 0.0f, 0.0f, 1.0f}} {
+        if(!points) m[3] = {0.0f, 0.0f, 0.0f, 1.0f};
+    }
+
+    void operator()(Float& x, Float& y, Float& z) const {
+        const Float tx = m[0][0]*x + m[1][0]*y + m[2][0]*z + m[3][0];
+        const Float ty = m[0][1]*x + m[1][1]*y + m[2][1]*z + m[3][1];
+        const Float tz = m[0][2]*x + m[1][2]*y + m[2][2]*z + m[3][2];
+        if(projective) {
+            const Float tw = m[0][3]*x + m[1][3]*y + m[2][3]*z + m[3][3];
+            x = tx/tw;
+            y = ty/tw;
+            z = tz/tw;
+        } else {
+            x = tx;
+            y = ty;
+            z = tz;
+        }
+    }
+
+    #ifdef MAGNUM_MESHTOOLS_TRANSFORM_SSE2
+    void operator()(__m128& x, __m128& y, __m128& z) const {
+        const auto row = [&](const std::size_t i) {
+            return _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[0][i]), x), _mm_mul_ps(_mm_set1_ps(m[1][i]), y)),
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[2][i]), z), _mm_set1_ps(m[3][i])));
+        };
+        const __m128 tx = row(0), ty = row(1), tz = row(2);
+        if(projective) {
+            const __m128 tw = row(3);
+            x = _mm_div_ps(tx, tw);
+            y = _mm_div_ps(ty, tw);
+            z = _mm_div_ps(tz, tw);
+        } else {
+            x = tx;
+            y = ty;
+            z = tz;
+        }
+    }
+    #endif
+
+    Matrix4 m;
+    bool projective;
+};
+
+/* Rotation by a normalized quaternion followed by a translation, same as
+   Quaternion::transformVectorNormalized() */
+struct QuaternionKernel {
+    explicit QuaternionKernel(const Quaternion& quaternion, const Vector3& translation): q(quaternion.vector()), w{quaternion.scalar()}, translation(translation) {}
+
+    void operator()(Float& x, Float& y, Float& z) const {
+        const Float tx = 2.0f*(q.y()*z - q.z()*y);
+        const Float ty = 2.0f*(q.z()*x - q.x()*z);
+        const Float tz = 2.0f*(q.x()*y - q.y()*x);
+        const Float rx = x + w*tx + (q.y()*tz - q.z()*ty) + translation.x();
+        const Float ry = y + w*ty + (q.z()*tx - q.x()*tz) + translation.y();
+        const Float rz = z + w*tz + (q.x()*ty - q.y()*tx) + translation.z();
+        x = rx;
+        y = ry;
+        z = rz;
+    }
+
+    #ifdef MAGNUM_MESHTOOLS_TRANSFORM_SSE2
+    void operator()(__m128& x, __m128& y, __m128& z) const {
+        const __m128 qx = _mm_set1_ps(q.x()), qy = _mm_set1_ps(q.y()), qz = _mm_set1_ps(q.z());
+        const __m128 vw = _mm_set1_ps(w), two = _mm_set1_ps(2.0f);
+        const __m128 tx = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qy, z), _mm_mul_ps(qz, y)));
+        const __m128 ty = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qz, x), _mm_mul_ps(qx, z)));
+        const __m128 tz = _mm_mul_ps(two, _mm_sub_ps(_mm_mul_ps(qx, y), _mm_mul_ps(qy, x)));
+        const auto component = [&](const __m128 v, const __m128 t, const __m128 cross, const Float translation) {
+            return _mm_add_ps(_mm_add_ps(_mm_add_ps(v, _mm_mul_ps(vw, t)), cross), _mm_set1_ps(translation));
+        };
+        const __m128 rx = component(x, tx, _mm_sub_ps(_mm_mul_ps(qy, tz), _mm_mul_ps(qz, ty)), translation.x());
+        const __m128 ry = component(y, ty, _mm_sub_ps(_mm_mul_ps(qz, tx), _mm_mul_ps(qx, tz)), translation.y());
+        const __m128 rz = component(z, tz, _mm_sub_ps(_mm_mul_ps(qx, ty), _mm_mul_ps(qy, tx)), translation.z());
+        x = rx;
+        y = ry;
+        z = rz;
+    }
+    #endif
+
+    Vector3 q;
+    Float w;
+    Vector3 translation;
+};
+
+/* Transforms four vectors at once in SoA layout, the rest one by one */
+template<class Kernel> void transformRange(const Kernel& kernel, char* const data, const std::size_t stride, std::size_t begin, const std::size_t end) {
+    #ifdef MAGNUM_MESHTOOLS_TRANSFORM_SSE2
+    for(; begin + 4 <= end; begin += 4) {
+        char* const a = data + begin*stride;
+        const Vector3 v0 = load(a), v1 = load(a + stride), v2 = load(a + 2*stride), v3 = load(a + 3*stride);
+        __m128 x = _mm_setr_ps(v0.x(), v1.x(), v2.x(), v3.x());
+        __m128 y = _mm_setr_ps(v0.y(), v1.y(), v2.y(), v3.y());
+        __m128 z = _mm_setr_ps(v0.z(), v1.z(), v2.z(), v3.z());
+        kernel(x, y, z);
+
+        alignas(16) Float out[3][4];
+        _mm_store_ps(out[0], x);
+        _mm_store_ps(out[1], y);
+        _mm_store_ps(out[2], z);
+        for(std::size_t i = 0; i != 4; ++i)
+            store(a + i*stride, {out[0][i], out[1][i], out[2][i]});
+    }
+    #endif
+
+    for(; begin != end; ++begin) {
+        char* const a = data + begin*stride;
+        Vector3 v = load(a);
+        kernel(v.x(), v.y(), v.z());
+        store(a, v);
+    }
+}
+
+template<class Kernel> void transform(const Kernel& kernel, char* const data, const std::size_t count, const std::size_t stride, const UnsignedInt threadCount) {
+    Implementation::forEachRange(count, Implementation::parallelThreadCount(count, threadCount), [&](const std::size_t begin, const std::size_t end) {
+        transformRange(kernel, data, stride, begin, end);
+    });
+}
+
+/* The last vector doesn't need to have the whole stride */
+inline std::size_t vectorCount(const Containers::ArrayView<char> data, const std::size_t stride) {
+    return data.size() < sizeof(Vector3) ? 0 : (data.size() - sizeof(Vector3))/stride + 1;
+}
+
+}
+
+void transformVectorsInPlace(const Quaternion& normalizedQuaternion, const Containers::ArrayView<char> data, const std::size_t stride, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(stride >= sizeof(Vector3),
+        "MeshTools::transformVectorsInPlace(): expected stride to be at least" << sizeof(Vector3) << "but got" << stride, );
+    CORRADE_ASSERT(normalizedQuaternion.isNormalized(),
+        "MeshTools::transformVectorsInPlace(): quaternion must be normalized", );
+
+    transform(QuaternionKernel{normalizedQuaternion, {}}, data, vectorCount(data, stride), stride, threadCount);
+}
+
+void transformVectorsInPlace(const Matrix4& matrix, const Containers::ArrayView<char> data, const std::size_t stride, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(stride >= sizeof(Vector3),
+        "MeshTools::transformVectorsInPlace(): expected stride to be at least" << sizeof(Vector3) << "but got" << stride, );
+
+    transform(MatrixKernel{matrix, false}, data, vectorCount(data, stride), stride, threadCount);
+}
+
+void transformPointsInPlace(const DualQuaternion& normalizedDualQuaternion, const Containers::ArrayView<char> data, const std::size_t stride, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(stride >= sizeof(Vector3),
+        "MeshTools::transformPointsInPlace(): expected stride to be at least" << sizeof(Vector3) << "but got" << stride, );
+    CORRADE_ASSERT(normalizedDualQuaternion.isNormalized(),
+        "MeshTools::transformPointsInPlace(): dual quaternion must be normalized", );
+
+    transform(QuaternionKernel{normalizedDualQuaternion.rotation(), normalizedDualQuaternion.translation()}, data, vectorCount(data, stride), stride, threadCount);
+}
+
+void transformPointsInPlace(const Matrix4& matrix, const Containers::ArrayView<char> data, const std::size_t stride, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(stride >= sizeof(Vector3),
+        "MeshTools::transformPointsInPlace(): expected stride to be at least" << sizeof(Vector3) << "but got" << stride, );
+
+    transform(MatrixKernel{matrix, true}, data, vectorCount(data, stride), stride, threadCount);
+}
+
+}}
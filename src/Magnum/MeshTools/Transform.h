@@ -29,8 +29,12 @@
  * @brief Function @ref Magnum::MeshTools::transformVectorsInPlace(), @ref Magnum::MeshTools::transformVectors(), @ref Magnum::MeshTools::transformPointsInPlace(), @ref Magnum::MeshTools::transformPoints()
  */
 
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
 #include "Magnum/Math/DualQuaternion.h"
 #include "Magnum/Math/DualComplex.h"
+#include "Magnum/MeshTools/visibility.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -77,6 +81,38 @@ template<class T, class U> void transformVectorsInPlace(const Math::Matrix4<T>&
     for(auto& vector: vectors) vector = matrix.transformVector(vector);
 }
 
+/**
+@brief Transform vectors in interleaved vertex data in-place
+@param normalizedQuaternion Normalized quaternion
+@param data         Vertex data, with a @ref Vector3 at the beginning of each
+    stride
+@param stride       Byte distance between two vectors, at least
+    `sizeof(Vector3)`
+@param threadCount  Thread count
+
+Equivalent to @ref transformVectorsInPlace(const Math::Quaternion<T>&, U&),
+but operates directly on interleaved data such as the ones produced by
+@ref interleave(). The vectors can be at any alignment, use
+@ref Corrade::Containers::ArrayView::suffix() "ArrayView::suffix()" to skip to
+given attribute offset. The last vector doesn't need to be followed by a whole
+stride. Four vectors are transformed at once using SSE2 if the target
+supports it, the results match the scalar path within floating-point
+precision. If @p threadCount is other than `1`, large arrays are split into
+contiguous chunks processed in parallel, value of `0` means thread count
+reported by `std::thread::hardware_concurrency()`. On platforms without
+thread support the value is ignored.
+@code
+Containers::Array<char> data = MeshTools::interleave(positions, 4, normals);
+const std::size_t stride = 2*sizeof(Vector3) + 4;
+
+MeshTools::transformVectorsInPlace(rotation, data.suffix(sizeof(Vector3) + 4), stride);
+@endcode
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformVectorsInPlace(const Quaternion& normalizedQuaternion, Containers::ArrayView<char> data, std::size_t stride, UnsignedInt threadCount = 1);
+
+/** @overload */
+void MAGNUM_MESHTOOLS_EXPORT transformVectorsInPlace(const Matrix4& matrix, Containers::ArrayView<char> data, std::size_t stride, UnsignedInt threadCount = 1);
+
 /**
 @brief Transform vectors using given transformation
 
@@ -132,6 +168,26 @@ template<class T, class U> void transformPointsInPlace(const Math::Matrix4<T>& m
     for(auto& point: points) point = matrix.transformPoint(point);
 }
 
+/**
+@brief Transform points in interleaved vertex data in-place
+@param normalizedDualQuaternion Normalized dual quaternion
+@param data         Vertex data, with a @ref Vector3 at the beginning of each
+    stride
+@param stride       Byte distance between two points, at least
+    `sizeof(Vector3)`
+@param threadCount  Thread count
+
+Equivalent to @ref transformPointsInPlace(const Math::DualQuaternion<T>&, U&),
+see @ref transformVectorsInPlace(const Quaternion&, Containers::ArrayView<char>, std::size_t, UnsignedInt)
+for more information about the data layout, vectorization and threading. The
+matrix overload does the perspective division only if the last matrix row is
+not @f$ (0, 0, 0, 1) @f$.
+*/
+void MAGNUM_MESHTOOLS_EXPORT transformPointsInPlace(const DualQuaternion& normalizedDualQuaternion, Containers::ArrayView<char> data, std::size_t stride, UnsignedInt threadCount = 1);
+
+/** @overload */
+void MAGNUM_MESHTOOLS_EXPORT transformPointsInPlace(const Matrix4& matrix, Containers::ArrayView<char> data, std::size_t stride, UnsignedInt threadCount = 1);
+
 /**
 @brief Transform points using given transformation
 
@@ -27,8 +27,6 @@
 
 #include "Magnum/Mesh.h"
 #include "Magnum/Math/Vector3.h"
-#include "Magnum/MeshTools/Duplicate.h"
-#include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Subdivide.h"
 #include "Magnum/Trade/MeshData3D.h"
 
@@ -73,12 +71,9 @@ Trade::MeshData3D Icosphere::solid(const UnsignedInt subdivisions) {
         {0.0f, 0.525731f, 0.850651f}
     };
 
-    for(std::size_t i = 0; i != subdivisions; ++i)
-        MeshTools::subdivide(indices, positions, [](const Vector3& a, const Vector3& b) {
-            return (a+b).normalized();
-        });
-
-    indices = MeshTools::duplicate(indices, MeshTools::removeDuplicates(positions));
+    MeshTools::subdivideWelded(indices, positions, [](const Vector3& a, const Vector3& b) {
+        return (a+b).normalized();
+    }, subdivisions);
 
     std::vector<Vector3> normals(positions);
     return Trade::MeshData3D(MeshPrimitive::Triangles, std::move(indices), {std::move(positions)}, {std::move(normals)}, {});
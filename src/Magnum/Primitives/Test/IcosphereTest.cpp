@@ -35,10 +35,12 @@ struct IcosphereTest: TestSuite::Tester {
     explicit IcosphereTest();
 
     void count();
+    void subdivisions();
 };
 
 IcosphereTest::IcosphereTest() {
-    addTests({&IcosphereTest::count});
+    addTests({&IcosphereTest::count,
+              &IcosphereTest::subdivisions});
 }
 
 void IcosphereTest::count() {
@@ -52,6 +54,23 @@ void IcosphereTest::count() {
     CORRADE_COMPARE(data.normals(0).size(), 162);
 }
 
+void IcosphereTest::subdivisions() {
+    /* Each subdivision shares the edge midpoints, so the vertex count is
+       10*4^n + 2 without any duplicates */
+    std::size_t triangleCount = 20, vertexCount = 12;
+    for(UnsignedInt i = 0; i != 5; ++i) {
+        Trade::MeshData3D data = Primitives::Icosphere::solid(i);
+        CORRADE_COMPARE(data.indices().size(), triangleCount*3);
+        CORRADE_COMPARE(data.positions(0).size(), vertexCount);
+
+        for(const Vector3& position: data.positions(0))
+            CORRADE_COMPARE(position.length(), 1.0f);
+
+        vertexCount += triangleCount*3/2;
+        triangleCount *= 4;
+    }
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Primitives::Test::IcosphereTest)
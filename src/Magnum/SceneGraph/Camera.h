@@ -29,6 +29,9 @@
  * @brief Class @ref Magnum::SceneGraph::Camera, enum @ref Magnum::SceneGraph::AspectRatioPolicy, alias @ref Magnum::SceneGraph::BasicCamera2D, @ref Magnum::SceneGraph::BasicCamera3D, typedef @ref Magnum::SceneGraph::Camera2D, @ref Magnum::SceneGraph::Camera3D
  */
 
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/SceneGraph/AbstractFeature.h"
@@ -235,10 +238,28 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         /**
          * @brief Draw
          *
-         * Draws given group of drawables.
+         * Draws given group of drawables. Drawables that have a bounding
+         * sphere which is completely outside of the frustum defined by
+         * @ref projectionMatrix() are skipped, see
+         * @ref Drawable::setBoundingSphere() for more information.
+         * @see @ref drawnCount(), @ref culledCount()
          */
         virtual void draw(DrawableGroup<dimensions, T>& group);
 
+        /**
+         * @brief Count of drawables drawn in last @ref draw() call
+         *
+         * @see @ref culledCount()
+         */
+        std::size_t drawnCount() const { return _drawnCount; }
+
+        /**
+         * @brief Count of drawables culled in last @ref draw() call
+         *
+         * @see @ref drawnCount()
+         */
+        std::size_t culledCount() const { return _culledCount; }
+
     private:
         /** Recalculates camera matrix */
         void cleanInverted(const MatrixTypeFor<dimensions, T>& invertedAbsoluteTransformationMatrix) override {
@@ -254,6 +275,14 @@ template<UnsignedInt dimensions, class T> class Camera: public AbstractFeature<d
         MatrixTypeFor<dimensions, T> _cameraMatrix;
 
         Vector2i _viewport;
+
+        std::size_t _drawnCount, _culledCount;
+
+        /* Scratch space for draw(), kept to avoid allocations every frame */
+        std::vector<MatrixTypeFor<dimensions, T>> _transformations;
+        std::vector<VectorTypeFor<dimensions, T>> _centers;
+        std::vector<T> _radii;
+        Containers::Array<bool> _visible;
 };
 
 /**
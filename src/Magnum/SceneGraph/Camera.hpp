@@ -30,6 +30,7 @@
  */
 
 #include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Geometry/Intersection.h"
 #include "Magnum/SceneGraph/Camera.h"
 #include "Magnum/SceneGraph/Drawable.h"
 
@@ -53,9 +54,43 @@ template<UnsignedInt dimensions, class T> MatrixTypeFor<dimensions, T> aspectRat
         Vector2(T(1), relativeAspectRatio.x()/relativeAspectRatio.y()), T(1)));
 }
 
+template<class T> std::size_t cullSpheres(const Math::Matrix3<T>& projectionMatrix, const Containers::ArrayView<const Math::Vector2<T>> centers, const Containers::ArrayView<const T> radii, const Containers::ArrayView<bool> visible) {
+    /* Extract frustum lines from rows of the matrix, similarly to what
+       Math::Frustum::fromMatrix() does for planes in 3D */
+    const Math::Vector3<T> w = projectionMatrix.row(2);
+    Math::Vector3<T> lines[]{w + projectionMatrix.row(0),
+                             w - projectionMatrix.row(0),
+                             w + projectionMatrix.row(1),
+                             w - projectionMatrix.row(1)};
+    for(Math::Vector3<T>& line: lines) line /= line.xy().length();
+
+    for(std::size_t i = 0; i != centers.size(); ++i) visible[i] = true;
+    for(const Math::Vector3<T>& line: lines) {
+        for(std::size_t i = 0; i != centers.size(); ++i)
+            visible[i] = visible[i] & (line.x()*centers[i].x() + line.y()*centers[i].y() + line.z() >= -radii[i]);
+    }
+
+    std::size_t visibleCount = 0;
+    for(std::size_t i = 0; i != centers.size(); ++i) visibleCount += visible[i];
+    return visibleCount;
 }
 
-template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved) {
+template<class T> std::size_t cullSpheres(const Math::Matrix4<T>& projectionMatrix, const Containers::ArrayView<const Math::Vector3<T>> centers, const Containers::ArrayView<const T> radii, const Containers::ArrayView<bool> visible) {
+    return Math::Geometry::Intersection::sphereFrustum(centers, radii, Math::Frustum<T>::fromMatrix(projectionMatrix), visible);
+}
+
+/* Largest scaling factor of given transformation, used for transforming
+   radius of bounding spheres */
+template<std::size_t dimensions, class T> T maxScaling(const Math::Matrix<dimensions, T>& rotationScaling) {
+    T maxScalingSquared{};
+    for(std::size_t i = 0; i != dimensions; ++i)
+        maxScalingSquared = Math::max(maxScalingSquared, rotationScaling[i].dot());
+    return std::sqrt(maxScalingSquared);
+}
+
+}
+
+template<UnsignedInt dimensions, class T> Camera<dimensions, T>::Camera(AbstractObject<dimensions, T>& object): AbstractFeature<dimensions, T>(object), _aspectRatioPolicy(AspectRatioPolicy::NotPreserved), _drawnCount(0), _culledCount(0) {
     AbstractFeature<dimensions, T>::setCachedTransformations(CachedTransformation::InvertedAbsolute);
 }
 
@@ -89,17 +124,41 @@ template<UnsignedInt dimensions, class T> void Camera<dimensions, T>::draw(Drawa
     /* Compute camera matrix */
     AbstractFeature<dimensions, T>::object().setClean();
 
-    /* Compute transformations of all objects in the group relative to the camera */
-    std::vector<std::reference_wrapper<AbstractObject<dimensions, T>>> objects;
-    objects.reserve(group.size());
-    for(std::size_t i = 0; i != group.size(); ++i)
-        objects.push_back(group[i].object());
-    std::vector<MatrixTypeFor<dimensions, T>> transformations =
-        scene->transformationMatrices(objects, _cameraMatrix);
-
-    /* Perform the drawing */
-    for(std::size_t i = 0; i != transformations.size(); ++i)
-        group[i].draw(transformations[i], *this);
+    /* Transform bounding spheres of drawables which have them into world
+       space. Absolute transformations of these are needed for the test
+       anyway, so they are kept for the drawables that survive it. */
+    _transformations.resize(group.size());
+    _centers.clear();
+    _radii.clear();
+    for(std::size_t i = 0; i != group.size(); ++i) {
+        const Drawable<dimensions, T>& drawable = group[i];
+        if(!drawable.hasBoundingSphere()) continue;
+
+        _transformations[i] = drawable.object().absoluteTransformationMatrix();
+        _centers.push_back(_transformations[i].transformPoint(drawable.boundingSphereCenter()));
+        _radii.push_back(drawable.boundingSphereRadius()*Implementation::maxScaling(_transformations[i].rotationScaling()));
+    }
+
+    /* Test them against the world-space frustum all at once */
+    if(_visible.size() < _centers.size())
+        _visible = Containers::Array<bool>{_centers.size()};
+    if(!_centers.empty())
+        Implementation::cullSpheres<T>(_projectionMatrix*_cameraMatrix, {_centers.data(), _centers.size()}, {_radii.data(), _radii.size()}, {_visible.data(), _centers.size()});
+
+    /* Compute transformations relative to the camera only for drawables
+       inside the frustum and draw them */
+    _drawnCount = _culledCount = 0;
+    for(std::size_t i = 0, bounded = 0; i != group.size(); ++i) {
+        if(!group[i].hasBoundingSphere())
+            _transformations[i] = _cameraMatrix*group[i].object().absoluteTransformationMatrix();
+        else if(!_visible[bounded++]) {
+            ++_culledCount;
+            continue;
+        } else _transformations[i] = _cameraMatrix*_transformations[i];
+
+        group[i].draw(_transformations[i], *this);
+        ++_drawnCount;
+    }
 }
 
 }}
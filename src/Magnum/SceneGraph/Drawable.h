@@ -29,6 +29,8 @@
  * @brief Class @ref Magnum::SceneGraph::Drawable, @ref Magnum::SceneGraph::DrawableGroup, alias @ref Magnum::SceneGraph::BasicDrawable2D, @ref Magnum::SceneGraph::BasicDrawable3D, @ref Magnum::SceneGraph::BasicDrawableGroup2D, @ref Magnum::SceneGraph::BasicDrawableGroup3D, typedef @ref Magnum::SceneGraph::Drawable2D, @ref Magnum::SceneGraph::Drawable3D, @ref Magnum::SceneGraph::DrawableGroup2D, @ref Magnum::SceneGraph::DrawableGroup3D
  */
 
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/SceneGraph/AbstractGroupedFeature.h"
 
 namespace Magnum { namespace SceneGraph {
@@ -155,6 +157,21 @@ void MyApplication::drawEvent() {
 }
 @endcode
 
+## Frustum culling
+
+If the drawable has a bounding sphere set using @ref setBoundingSphere() or
+@ref setBoundingBox(), @ref Camera::draw() doesn't call @ref draw() on it when
+the sphere is completely outside of the camera frustum. The bounds are in
+local coordinates of the object, so they need to be set only once for static
+geometry. Drawables without bounds are always drawn.
+@code
+(new RedCube(&scene, &drawables))
+    ->setBoundingBox({{-1.0f, -1.0f, -1.0f}, {1.0f, 1.0f, 1.0f}});
+@endcode
+
+Count of drawn and culled drawables in last draw can be queried with
+@ref Camera::drawnCount() and @ref Camera::culledCount().
+
 ## Explicit template specializations
 
 The following specializations are explicitly compiled into @ref SceneGraph
@@ -194,6 +211,62 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
             return AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>::group();
         }
 
+        /**
+         * @brief Whether the drawable has a bounding sphere
+         *
+         * @see @ref setBoundingSphere(), @ref setBoundingBox(),
+         *      @ref resetBoundingSphere()
+         */
+        bool hasBoundingSphere() const { return _boundingSphereRadius >= T(0); }
+
+        /**
+         * @brief Bounding sphere center
+         *
+         * In local coordinates of the object.
+         * @see @ref hasBoundingSphere()
+         */
+        VectorTypeFor<dimensions, T> boundingSphereCenter() const {
+            return _boundingSphereCenter;
+        }
+
+        /**
+         * @brief Bounding sphere radius
+         *
+         * Negative if the drawable has no bounding sphere.
+         * @see @ref hasBoundingSphere()
+         */
+        T boundingSphereRadius() const { return _boundingSphereRadius; }
+
+        /**
+         * @brief Set bounding sphere
+         * @param center    Sphere center in local coordinates of the object
+         * @param radius    Sphere radius, expected to be non-negative
+         * @return Reference to self (for method chaining)
+         *
+         * The sphere is used by @ref Camera::draw() for frustum culling.
+         * @see @ref setBoundingBox(), @ref resetBoundingSphere()
+         */
+        Drawable<dimensions, T>& setBoundingSphere(const VectorTypeFor<dimensions, T>& center, T radius);
+
+        /**
+         * @brief Set bounding box
+         * @return Reference to self (for method chaining)
+         *
+         * Sets bounding sphere circumscribed to given box in local
+         * coordinates of the object.
+         * @see @ref setBoundingSphere()
+         */
+        Drawable<dimensions, T>& setBoundingBox(const RangeTypeFor<dimensions, T>& box);
+
+        /**
+         * @brief Reset bounding sphere
+         * @return Reference to self (for method chaining)
+         *
+         * The drawable is then always drawn.
+         * @see @ref setBoundingSphere(), @ref setBoundingBox()
+         */
+        Drawable<dimensions, T>& resetBoundingSphere();
+
         /**
          * @brief Draw the object using given camera
          * @param transformationMatrix  Object transformation relative to camera
@@ -203,6 +276,10 @@ template<UnsignedInt dimensions, class T> class Drawable: public AbstractGrouped
          * @ref SceneGraph::Camera::projectionMatrix() "Camera::projectionMatrix()".
          */
         virtual void draw(const MatrixTypeFor<dimensions, T>& transformationMatrix, Camera<dimensions, T>& camera) = 0;
+
+    private:
+        VectorTypeFor<dimensions, T> _boundingSphereCenter;
+        T _boundingSphereRadius;
 };
 
 /**
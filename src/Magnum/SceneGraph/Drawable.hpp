@@ -29,11 +29,29 @@
  * @brief @ref compilation-speedup-hpp "Template implementation" for @ref Drawable.h
  */
 
+#include "Magnum/Math/Range.h"
 #include "Magnum/SceneGraph/Drawable.h"
 
 namespace Magnum { namespace SceneGraph {
 
-template<UnsignedInt dimensions, class T> Drawable<dimensions, T>::Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables) {}
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>::Drawable(AbstractObject<dimensions, T>& object, DrawableGroup<dimensions, T>* drawables): AbstractGroupedFeature<dimensions, Drawable<dimensions, T>, T>(object, drawables), _boundingSphereRadius(T(-1)) {}
+
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>& Drawable<dimensions, T>::setBoundingSphere(const VectorTypeFor<dimensions, T>& center, const T radius) {
+    CORRADE_ASSERT(radius >= T(0),
+        "SceneGraph::Drawable::setBoundingSphere(): expected non-negative radius, got" << radius, *this);
+    _boundingSphereCenter = center;
+    _boundingSphereRadius = radius;
+    return *this;
+}
+
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>& Drawable<dimensions, T>::setBoundingBox(const RangeTypeFor<dimensions, T>& box) {
+    return setBoundingSphere(box.center(), box.size().length()/T(2));
+}
+
+template<UnsignedInt dimensions, class T> Drawable<dimensions, T>& Drawable<dimensions, T>::resetBoundingSphere() {
+    _boundingSphereRadius = T(-1);
+    return *this;
+}
 
 }}
 
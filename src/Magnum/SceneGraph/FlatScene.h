@@ -0,0 +1,417 @@
+#ifndef Magnum_SceneGraph_FlatScene_h
+#define Magnum_SceneGraph_FlatScene_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::SceneGraph::FlatScene, @ref Magnum::SceneGraph::FlatObject
+ */
+
+#include <vector>
+
+#include "Magnum/SceneGraph/AbstractFeature.h"
+#include "Magnum/SceneGraph/AbstractObject.h"
+#include "Magnum/SceneGraph/visibility.h"
+
+namespace Magnum { namespace SceneGraph {
+
+/**
+@brief Scene with flat transformation storage
+
+Alternative to @ref Scene and @ref Object for large, mostly static
+hierarchies. Instead of storing transformation and hierarchy information in
+each object, parent indices, relative and absolute transformations of all
+@ref FlatObject instances are stored in contiguous arrays owned by the scene.
+The arrays are kept sorted in depth-first order (i.e., each parent is before
+all its children and every subtree occupies a contiguous range), which means
+that cleaning absolute transformations of the whole scene with
+@ref setObjectsClean() is a single linear pass over the arrays.
+
+The scene and its objects implement the @ref AbstractObject interface, so all
+features such as @ref Drawable or @ref Camera work with them unchanged, just
+use @ref FlatScene and @ref FlatObject instead of @ref Scene and @ref Object:
+@code
+typedef SceneGraph::FlatScene<SceneGraph::MatrixTransformation3D> Scene3D;
+typedef SceneGraph::FlatObject<SceneGraph::MatrixTransformation3D> Object3D;
+
+Scene3D scene;
+Object3D* cameraObject = new Object3D{scene};
+SceneGraph::Camera3D camera{*cameraObject};
+Object3D* object = new Object3D{scene, cameraObject};
+object->setTransformation(Matrix4::translation(Vector3::zAxis(-5.0f)));
+@endcode
+
+The `Transformation` template parameter is used only for selecting the
+underlying transformation type, see @ref Object for list of available
+transformation implementations. Transformation convenience functions such as
+`translate()` or `rotate()` are not available, only generic
+@ref FlatObject::setTransformation(), @ref FlatObject::transform() and
+@ref FlatObject::transformLocal().
+
+## Performance characteristics
+
+Adding an object at the end of depth-first order (i.e. as a child of the last
+added object or any of its ancestors) is amortized constant time. Adding an
+object anywhere else is constant time too, but invalidates the depth-first
+order, which is then restored in a linear pass over all objects on first
+operation that needs it (e.g. @ref FlatObject::setDirty() or
+@ref setObjectsClean()).
+
+Deleting an object needs the depth-first order to find its children, so it
+first restores the order if it was invalidated and then takes time linear in
+size of the deleted subtree. Deleted objects are compacted away in another
+linear pass once they make up more than half of the scene. Reparenting an
+object invalidates the order and then marks the object subtree dirty, which
+needs the order restored again, so reparenting an object that isn't dirty
+already costs a linear pass over all objects. It's thus better to create the
+hierarchy in one go and keep it static afterwards.
+
+@anchor SceneGraph-FlatScene-explicit-specializations
+## Explicit template specializations
+
+The same specializations as listed in @ref SceneGraph-Object-explicit-specializations "Object"
+documentation are explicitly compiled into @ref SceneGraph library. For other
+specializations you have to use @ref FlatScene.hpp implementation file to
+avoid linker errors. See @ref compilation-speedup-hpp for more information.
+
+@see @ref scenegraph
+*/
+template<class Transformation> class FlatScene: public AbstractObject<Transformation::Dimensions, typename Transformation::Type> {
+    friend FlatObject<Transformation>;
+
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<Transformation::Dimensions, typename Transformation::Type> MatrixType;
+
+        explicit FlatScene();
+
+        /** @brief Copying is not allowed */
+        FlatScene(const FlatScene<Transformation>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatScene(FlatScene<Transformation>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Destroys all objects in the scene.
+         */
+        ~FlatScene();
+
+        /** @brief Copying is not allowed */
+        FlatScene<Transformation>& operator=(const FlatScene<Transformation>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatScene<Transformation>& operator=(FlatScene<Transformation>&&) = delete;
+
+        /**
+         * @brief Object count
+         *
+         * Including slots of already deleted objects, which are removed when
+         * the depth-first order is restored next time.
+         */
+        std::size_t objectCount() const { return _objects.size(); }
+
+        /**
+         * @brief Object at given index
+         *
+         * Returns `nullptr` if the object at given index was deleted. Note
+         * that object indices change when the depth-first order is restored.
+         * @see @ref FlatObject::index()
+         */
+        FlatObject<Transformation>* object(std::size_t index) { return _objects[index]; }
+        const FlatObject<Transformation>* object(std::size_t index) const { return _objects[index]; } /**< @overload */
+
+        /**
+         * @brief Transformations of given group of objects relative to the scene
+         *
+         * Cleans all objects in the scene using @ref setObjectsClean() and
+         * then returns their cached absolute transformations, premultiplied
+         * with @p initialTransformation.
+         */
+        std::vector<typename Transformation::DataType> transformations(const std::vector<std::reference_wrapper<FlatObject<Transformation>>>& objects, const typename Transformation::DataType& initialTransformation =
+            #ifndef CORRADE_MSVC2015_COMPATIBILITY
+            typename Transformation::DataType()
+            #else
+            Transformation::DataType()
+            #endif
+            );
+
+        /**
+         * @brief Clean absolute transformations of all objects in the scene
+         *
+         * Restores the depth-first order, if needed, and then cleans all
+         * dirty objects in a single linear pass. Compared to
+         * @ref Object::setClean(std::vector<std::reference_wrapper<Object<Transformation>>>)
+         * no traversal of the hierarchy is involved.
+         */
+        void setObjectsClean();
+
+    private:
+        static constexpr UnsignedInt NoParent = 0xFFFFFFFFu;
+
+        AbstractObject<Transformation::Dimensions, typename Transformation::Type>* doScene() override final { return this; }
+        const AbstractObject<Transformation::Dimensions, typename Transformation::Type>* doScene() const override final { return this; }
+
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doTransformationMatrix() const override final { return {}; }
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doAbsoluteTransformationMatrix() const override final { return {}; }
+        std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const override final;
+
+        bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return _dirty; }
+        /* Scene transformation can't change, so there's nothing to do */
+        void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final {}
+        void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final { setSceneClean(); }
+        void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) override final;
+
+        UnsignedInt MAGNUM_SCENEGRAPH_LOCAL addObject(FlatObject<Transformation>& object, UnsignedInt parent);
+        void MAGNUM_SCENEGRAPH_LOCAL removeObject(FlatObject<Transformation>& object);
+        void MAGNUM_SCENEGRAPH_LOCAL setObjectParent(FlatObject<Transformation>& object, UnsignedInt parent);
+        void MAGNUM_SCENEGRAPH_LOCAL setObjectDirty(FlatObject<Transformation>& object);
+        void MAGNUM_SCENEGRAPH_LOCAL setObjectClean(UnsignedInt index);
+        typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL objectAbsoluteTransformation(UnsignedInt index) const;
+
+        void MAGNUM_SCENEGRAPH_LOCAL setSceneClean();
+        void MAGNUM_SCENEGRAPH_LOCAL reorder();
+        static void MAGNUM_SCENEGRAPH_LOCAL setCleanInternal(AbstractObject<Transformation::Dimensions, typename Transformation::Type>& object, const typename Transformation::DataType& absoluteTransformation);
+
+        /* Parallel arrays indexed by object index. Subtree size includes the
+           object itself and is valid only when the arrays are sorted. A
+           `nullptr` in the object array denotes a deleted object. */
+        std::vector<FlatObject<Transformation>*> _objects;
+        std::vector<UnsignedInt> _parents;
+        std::vector<UnsignedInt> _subtreeSizes;
+        std::vector<typename Transformation::DataType> _transformations;
+        std::vector<typename Transformation::DataType> _absoluteTransformations;
+        std::vector<UnsignedByte> _dirtyObjects;
+
+        std::size_t _deletedCount;
+        bool _sorted, _dirty;
+};
+
+/**
+@brief Object in a flat scene
+
+Object which stores its hierarchy and transformation in a @ref FlatScene.
+Unlike @ref Object, the object is always part of a scene. Deleting the object
+deletes all its children, deleting the scene deletes all objects in it. See
+@ref FlatScene for more information.
+*/
+template<class Transformation> class FlatObject: public AbstractObject<Transformation::Dimensions, typename Transformation::Type> {
+    friend FlatScene<Transformation>;
+
+    public:
+        /** @brief Matrix type */
+        typedef MatrixTypeFor<Transformation::Dimensions, typename Transformation::Type> MatrixType;
+
+        /**
+         * @brief Constructor
+         * @param scene     Scene to which the object belongs
+         * @param parent    Parent object or `nullptr`, if the object should
+         *      be a direct child of the scene
+         *
+         * The parent, if specified, must be part of the same scene.
+         */
+        explicit FlatObject(FlatScene<Transformation>& scene, FlatObject<Transformation>* parent = nullptr);
+
+        /** @brief Copying is not allowed */
+        FlatObject(const FlatObject<Transformation>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatObject(FlatObject<Transformation>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Removes itself from the scene and destroys all own children.
+         */
+        ~FlatObject();
+
+        /** @brief Copying is not allowed */
+        FlatObject<Transformation>& operator=(const FlatObject<Transformation>&) = delete;
+
+        /** @brief Moving is not allowed */
+        FlatObject<Transformation>& operator=(FlatObject<Transformation>&&) = delete;
+
+        /**
+         * @{ @name Scene hierarchy
+         */
+
+        /** @brief Scene */
+        FlatScene<Transformation>* scene() { return _scene; }
+        const FlatScene<Transformation>* scene() const { return _scene; } /**< @overload */
+
+        /**
+         * @brief Index of the object in the scene
+         *
+         * Changes when the depth-first order in the scene is restored.
+         * @see @ref FlatScene::object()
+         */
+        UnsignedInt index() const { return _index; }
+
+        /**
+         * @brief Parent object
+         *
+         * Returns `nullptr` if the object is direct child of the scene.
+         */
+        FlatObject<Transformation>* parent() {
+            const UnsignedInt parent = _scene->_parents[_index];
+            return parent == FlatScene<Transformation>::NoParent ? nullptr : _scene->_objects[parent];
+        }
+
+        /** @overload */
+        const FlatObject<Transformation>* parent() const {
+            const UnsignedInt parent = _scene->_parents[_index];
+            return parent == FlatScene<Transformation>::NoParent ? nullptr : _scene->_objects[parent];
+        }
+
+        /**
+         * @brief Set parent object
+         * @return Reference to self (for method chaining)
+         *
+         * Passing `nullptr` makes the object direct child of the scene. The
+         * parent must be part of the same scene. If the parent is this object
+         * or any of its children, the function does nothing.
+         */
+        FlatObject<Transformation>& setParent(FlatObject<Transformation>* parent);
+
+        /*@}*/
+
+        /** @{ @name Object transformation */
+
+        /** @brief Object transformation */
+        typename Transformation::DataType transformation() const {
+            return _scene->_transformations[_index];
+        }
+
+        /**
+         * @brief Set transformation
+         * @return Reference to self (for method chaining)
+         */
+        FlatObject<Transformation>& setTransformation(const typename Transformation::DataType& transformation) {
+            _scene->_transformations[_index] = transformation;
+            setDirty();
+            return *this;
+        }
+
+        /**
+         * @brief Reset object transformation
+         * @return Reference to self (for method chaining)
+         */
+        FlatObject<Transformation>& resetTransformation() {
+            return setTransformation({});
+        }
+
+        /**
+         * @brief Transform object
+         * @return Reference to self (for method chaining)
+         *
+         * @see @ref transformLocal()
+         */
+        FlatObject<Transformation>& transform(const typename Transformation::DataType& transformation) {
+            return setTransformation(Implementation::Transformation<Transformation>::compose(transformation, this->transformation()));
+        }
+
+        /**
+         * @brief Transform object as a local transformation
+         *
+         * Similar to the above, except that the transformation is applied
+         * before all others.
+         */
+        FlatObject<Transformation>& transformLocal(const typename Transformation::DataType& transformation) {
+            return setTransformation(Implementation::Transformation<Transformation>::compose(this->transformation(), transformation));
+        }
+
+        /**
+         * @brief Transformation matrix
+         *
+         * @see @ref transformation()
+         */
+        MatrixType transformationMatrix() const {
+            return Implementation::Transformation<Transformation>::toMatrix(transformation());
+        }
+
+        /**
+         * @brief Transformation matrix relative to the scene
+         *
+         * @see @ref absoluteTransformation()
+         */
+        MatrixType absoluteTransformationMatrix() const {
+            return Implementation::Transformation<Transformation>::toMatrix(absoluteTransformation());
+        }
+
+        /**
+         * @brief Transformation relative to the scene
+         *
+         * If the object is clean, returns the cached transformation,
+         * otherwise computes it from transformations of all parents.
+         * @see @ref absoluteTransformationMatrix()
+         */
+        typename Transformation::DataType absoluteTransformation() const {
+            return _scene->objectAbsoluteTransformation(_index);
+        }
+
+        /*@}*/
+
+        /**
+         * @{ @name Transformation caching
+         *
+         * See @ref scenegraph-features-caching for more information.
+         */
+
+        /** @copydoc AbstractObject::isDirty() */
+        bool isDirty() const { return !!_scene->_dirtyObjects[_index]; }
+
+        /** @copydoc AbstractObject::setDirty() */
+        void setDirty() { _scene->setObjectDirty(*this); }
+
+        /** @copydoc AbstractObject::setClean() */
+        void setClean() { _scene->setObjectClean(_index); }
+
+        /*@}*/
+
+    private:
+        AbstractObject<Transformation::Dimensions, typename Transformation::Type>* doScene() override final { return _scene; }
+        const AbstractObject<Transformation::Dimensions, typename Transformation::Type>* doScene() const override final { return _scene; }
+
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doTransformationMatrix() const override final {
+            return transformationMatrix();
+        }
+        MatrixType MAGNUM_SCENEGRAPH_LOCAL doAbsoluteTransformationMatrix() const override final {
+            return absoluteTransformationMatrix();
+        }
+        std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const override final;
+
+        bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return isDirty(); }
+        void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final { setDirty(); }
+        void MAGNUM_SCENEGRAPH_LOCAL doSetClean() override final { setClean(); }
+        void doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) override final;
+
+        FlatScene<Transformation>* _scene;
+        UnsignedInt _index;
+};
+
+}}
+
+#endif
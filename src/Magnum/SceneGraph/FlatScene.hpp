@@ -0,0 +1,405 @@
+#ifndef Magnum_SceneGraph_FlatScene_hpp
+#define Magnum_SceneGraph_FlatScene_hpp
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief @ref compilation-speedup-hpp "Template implementation" for @ref FlatScene.h
+ */
+
+#include "Magnum/SceneGraph/AbstractTransformation.h"
+#include "Magnum/SceneGraph/FlatScene.h"
+
+namespace Magnum { namespace SceneGraph {
+
+template<class Transformation> constexpr UnsignedInt FlatScene<Transformation>::NoParent;
+
+template<class Transformation> FlatScene<Transformation>::FlatScene(): _deletedCount{0}, _sorted{true}, _dirty{true} {}
+
+template<class Transformation> FlatScene<Transformation>::~FlatScene() {
+    /* Delete all objects, they don't need to do any bookkeeping */
+    for(FlatObject<Transformation>* object: _objects) {
+        if(!object) continue;
+        object->_scene = nullptr;
+        delete object;
+    }
+}
+
+template<class Transformation> std::vector<typename Transformation::DataType> FlatScene<Transformation>::transformations(const std::vector<std::reference_wrapper<FlatObject<Transformation>>>& objects, const typename Transformation::DataType& initialTransformation) {
+    setObjectsClean();
+
+    std::vector<typename Transformation::DataType> transformations;
+    transformations.reserve(objects.size());
+    for(const FlatObject<Transformation>& object: objects) {
+        CORRADE_ASSERT(object._scene == this, "SceneGraph::FlatScene::transformations(): the objects are not part of the same scene", {});
+        transformations.push_back(Implementation::Transformation<Transformation>::compose(initialTransformation, _absoluteTransformations[object._index]));
+    }
+
+    return transformations;
+}
+
+template<class Transformation> auto FlatScene<Transformation>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const -> std::vector<MatrixType> {
+    /* This is a const query, so it doesn't clean anything. Transformations
+       of dirty objects are computed from the nearest clean parent. */
+    const typename Transformation::DataType initialTransformation = Implementation::Transformation<Transformation>::fromMatrix(initialTransformationMatrix);
+    std::vector<MatrixType> transformationMatrices;
+    transformationMatrices.reserve(objects.size());
+    for(AbstractObject<Transformation::Dimensions, typename Transformation::Type>& object: objects) {
+        /* The scene itself */
+        if(&object == this) {
+            transformationMatrices.push_back(initialTransformationMatrix);
+            continue;
+        }
+
+        /** @todo Ensure this doesn't crash, somehow */
+        const FlatObject<Transformation>& flatObject = static_cast<const FlatObject<Transformation>&>(object);
+        CORRADE_ASSERT(flatObject._scene == this, "SceneGraph::FlatScene::transformationMatrices(): the objects are not part of the same scene", {});
+        transformationMatrices.push_back(Implementation::Transformation<Transformation>::toMatrix(
+            Implementation::Transformation<Transformation>::compose(initialTransformation, objectAbsoluteTransformation(flatObject._index))));
+    }
+
+    return transformationMatrices;
+}
+
+template<class Transformation> void FlatScene<Transformation>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) {
+    for(AbstractObject<Transformation::Dimensions, typename Transformation::Type>& object: objects) {
+        if(&object == this) {
+            setSceneClean();
+            continue;
+        }
+
+        /** @todo Ensure this doesn't crash, somehow */
+        FlatObject<Transformation>& flatObject = static_cast<FlatObject<Transformation>&>(object);
+        CORRADE_ASSERT(flatObject._scene == this, "SceneGraph::FlatScene::setClean(): the objects are not part of the same scene", );
+        setObjectClean(flatObject._index);
+    }
+}
+
+template<class Transformation> void FlatScene<Transformation>::setObjectsClean() {
+    setSceneClean();
+
+    /* Restore depth-first order, so parents are always cleaned before their
+       children */
+    if(!_sorted) reorder();
+
+    for(std::size_t i = 0; i != _objects.size(); ++i) {
+        if(!_objects[i] || !_dirtyObjects[i]) continue;
+
+        /* Parent is either clean or was cleaned in some previous iteration */
+        const UnsignedInt parent = _parents[i];
+        _absoluteTransformations[i] = Implementation::Transformation<Transformation>::compose(
+            parent == NoParent ? typename Transformation::DataType{} : _absoluteTransformations[parent],
+            _transformations[i]);
+        setCleanInternal(*_objects[i], _absoluteTransformations[i]);
+        _dirtyObjects[i] = false;
+    }
+}
+
+template<class Transformation> UnsignedInt FlatScene<Transformation>::addObject(FlatObject<Transformation>& object, const UnsignedInt parent) {
+    CORRADE_ASSERT(_objects.size() < NoParent, "SceneGraph::FlatScene: too large scene", {});
+    const UnsignedInt index = UnsignedInt(_objects.size());
+
+    /* Appending keeps the depth-first order only if the parent subtree is at
+       the end. If it is, update subtree sizes of all parents. */
+    if(_sorted && parent != NoParent && parent + _subtreeSizes[parent] != index)
+        _sorted = false;
+    if(_sorted) for(UnsignedInt p = parent; p != NoParent; p = _parents[p])
+        ++_subtreeSizes[p];
+
+    _objects.push_back(&object);
+    _parents.push_back(parent);
+    _subtreeSizes.push_back(1);
+    _transformations.emplace_back();
+    _absoluteTransformations.emplace_back();
+    _dirtyObjects.push_back(true);
+    return index;
+}
+
+template<class Transformation> void FlatScene<Transformation>::removeObject(FlatObject<Transformation>& object) {
+    /* Subtree ranges are needed to find all children */
+    if(!_sorted) reorder();
+
+    /* Delete all children, going from the back so each of them has all its
+       children already deleted */
+    const UnsignedInt index = object._index;
+    for(UnsignedInt i = index + _subtreeSizes[index]; i-- != index + 1; ) {
+        FlatObject<Transformation>* child = _objects[i];
+        if(!child) continue;
+
+        _objects[i] = nullptr;
+        ++_deletedCount;
+        child->_scene = nullptr;
+        delete child;
+    }
+
+    _objects[index] = nullptr;
+    ++_deletedCount;
+
+    /* Subtree sizes include the deleted objects, so the order is still valid.
+       Compact the arrays on next occasion if too many objects are deleted. */
+    if(_deletedCount > _objects.size()/2) _sorted = false;
+}
+
+template<class Transformation> void FlatScene<Transformation>::setObjectParent(FlatObject<Transformation>& object, const UnsignedInt parent) {
+    /* Object cannot be parented to itself or its child */
+    /** @todo Assert for this */
+    for(UnsignedInt p = parent; p != NoParent; p = _parents[p])
+        if(p == object._index) return;
+
+    _parents[object._index] = parent;
+    _sorted = false;
+
+    /* If the object is already dirty, its whole subtree is also dirty, so
+       there's nothing else to do */
+    setObjectDirty(object);
+}
+
+template<class Transformation> void FlatScene<Transformation>::setObjectDirty(FlatObject<Transformation>& object) {
+    /* The transformation of this object (and all children) is already dirty,
+       nothing to do */
+    if(_dirtyObjects[object._index]) return;
+
+    /* Subtree ranges are needed to find all children */
+    if(!_sorted) reorder();
+
+    /* Make all objects in the subtree dirty, skipping subtrees which are
+       dirty already */
+    const UnsignedInt index = object._index;
+    const UnsignedInt end = index + _subtreeSizes[index];
+    for(UnsignedInt i = index; i < end; ) {
+        if(!_objects[i]) {
+            ++i;
+            continue;
+        }
+
+        if(_dirtyObjects[i]) {
+            i += _subtreeSizes[i];
+            continue;
+        }
+
+        for(AbstractFeature<Transformation::Dimensions, typename Transformation::Type>& feature: _objects[i]->features())
+            feature.markDirty();
+
+        _dirtyObjects[i] = true;
+        ++i;
+    }
+}
+
+template<class Transformation> void FlatScene<Transformation>::setObjectClean(const UnsignedInt index) {
+    /* The object (and all its parents) are already clean, nothing to do */
+    if(!_dirtyObjects[index]) return;
+
+    /* Collect all dirty parents */
+    std::vector<UnsignedInt> objects;
+    UnsignedInt p = index;
+    do {
+        objects.push_back(p);
+        p = _parents[p];
+    } while(p != NoParent && _dirtyObjects[p]);
+
+    /* Compute base transformation. On root object it's identity, otherwise
+       it's absolute transformation of the clean parent. */
+    typename Transformation::DataType absoluteTransformation;
+    if(p == NoParent) setSceneClean();
+    else absoluteTransformation = _absoluteTransformations[p];
+
+    /* Clean features on every collected object, going down from root object */
+    for(auto it = objects.rbegin(); it != objects.rend(); ++it) {
+        absoluteTransformation = Implementation::Transformation<Transformation>::compose(absoluteTransformation, _transformations[*it]);
+        _absoluteTransformations[*it] = absoluteTransformation;
+        setCleanInternal(*_objects[*it], absoluteTransformation);
+        _dirtyObjects[*it] = false;
+    }
+}
+
+template<class Transformation> typename Transformation::DataType FlatScene<Transformation>::objectAbsoluteTransformation(const UnsignedInt index) const {
+    if(!_dirtyObjects[index]) return _absoluteTransformations[index];
+
+    /* Go up until a clean parent or the root is found, accumulating relative
+       transformations of all dirty objects on the way. Composition is
+       associative, so there's no need to remember the whole path. */
+    typename Transformation::DataType transformation = _transformations[index];
+    for(UnsignedInt parent = _parents[index]; parent != NoParent; parent = _parents[parent]) {
+        if(!_dirtyObjects[parent])
+            return Implementation::Transformation<Transformation>::compose(_absoluteTransformations[parent], transformation);
+        transformation = Implementation::Transformation<Transformation>::compose(_transformations[parent], transformation);
+    }
+
+    return transformation;
+}
+
+template<class Transformation> void FlatScene<Transformation>::setSceneClean() {
+    if(!_dirty) return;
+
+    setCleanInternal(*this, {});
+    _dirty = false;
+}
+
+/*
+Restoring depth-first order of the arrays
+
+Children of all objects are first gathered into a compressed array, keeping
+their relative order. The hierarchy is then traversed depth-first, which gives
+new order of the objects. Deleted objects are dropped in the process.
+*/
+template<class Transformation> void FlatScene<Transformation>::reorder() {
+    const std::size_t count = _objects.size();
+
+    /* Offsets of children of each object, the scene is at index `count` */
+    std::vector<UnsignedInt> childOffsets(count + 2);
+    for(std::size_t i = 0; i != count; ++i) {
+        if(!_objects[i]) continue;
+        ++childOffsets[(_parents[i] == NoParent ? count : _parents[i]) + 1];
+    }
+    for(std::size_t i = 1; i != childOffsets.size(); ++i)
+        childOffsets[i] += childOffsets[i - 1];
+
+    /* Gather the children */
+    std::vector<UnsignedInt> children(childOffsets.back());
+    {
+        std::vector<UnsignedInt> childPositions{childOffsets.begin(), childOffsets.end() - 1};
+        for(std::size_t i = 0; i != count; ++i) {
+            if(!_objects[i]) continue;
+            children[childPositions[_parents[i] == NoParent ? count : _parents[i]]++] = UnsignedInt(i);
+        }
+    }
+
+    /* Traverse depth-first. Children are pushed in reverse, so the first
+       child is processed first. */
+    std::vector<UnsignedInt> order;
+    order.reserve(children.size());
+    std::vector<UnsignedInt> stack;
+    for(std::size_t i = childOffsets[count + 1]; i != childOffsets[count]; --i)
+        stack.push_back(children[i - 1]);
+    while(!stack.empty()) {
+        const UnsignedInt object = stack.back();
+        stack.pop_back();
+        order.push_back(object);
+        for(std::size_t i = childOffsets[object + 1]; i != childOffsets[object]; --i)
+            stack.push_back(children[i - 1]);
+    }
+
+    /* Map from old to new indices, reusing the array with child offsets */
+    std::vector<UnsignedInt>& newIndices = childOffsets;
+    for(std::size_t i = 0; i != order.size(); ++i)
+        newIndices[order[i]] = UnsignedInt(i);
+
+    /* Permute all arrays */
+    std::vector<FlatObject<Transformation>*> objects(order.size());
+    std::vector<UnsignedInt> parents(order.size());
+    std::vector<typename Transformation::DataType> transformations(order.size());
+    std::vector<typename Transformation::DataType> absoluteTransformations(order.size());
+    std::vector<UnsignedByte> dirtyObjects(order.size());
+    for(std::size_t i = 0; i != order.size(); ++i) {
+        const UnsignedInt old = order[i];
+        objects[i] = _objects[old];
+        objects[i]->_index = UnsignedInt(i);
+        parents[i] = _parents[old] == NoParent ? NoParent : newIndices[_parents[old]];
+        transformations[i] = _transformations[old];
+        absoluteTransformations[i] = _absoluteTransformations[old];
+        dirtyObjects[i] = _dirtyObjects[old];
+    }
+
+    /* Compute subtree sizes, going from the back so children are always
+       processed before their parents */
+    std::vector<UnsignedInt> subtreeSizes(order.size(), 1);
+    for(std::size_t i = order.size(); i != 0; --i)
+        if(parents[i - 1] != NoParent) subtreeSizes[parents[i - 1]] += subtreeSizes[i - 1];
+
+    _objects = std::move(objects);
+    _parents = std::move(parents);
+    _subtreeSizes = std::move(subtreeSizes);
+    _transformations = std::move(transformations);
+    _absoluteTransformations = std::move(absoluteTransformations);
+    _dirtyObjects = std::move(dirtyObjects);
+    _deletedCount = 0;
+    _sorted = true;
+}
+
+template<class Transformation> void FlatScene<Transformation>::setCleanInternal(AbstractObject<Transformation::Dimensions, typename Transformation::Type>& object, const typename Transformation::DataType& absoluteTransformation) {
+    /* "Lazy storage" for transformation matrix and inverted transformation matrix */
+    CachedTransformations cached;
+    MatrixType matrix, invertedMatrix;
+
+    /* Clean all features */
+    for(AbstractFeature<Transformation::Dimensions, typename Transformation::Type>& feature: object.features()) {
+        /* Cached absolute transformation, compute it if it wasn't
+            computed already */
+        if(feature.cachedTransformations() & CachedTransformation::Absolute) {
+            if(!(cached & CachedTransformation::Absolute)) {
+                cached |= CachedTransformation::Absolute;
+                matrix = Implementation::Transformation<Transformation>::toMatrix(absoluteTransformation);
+            }
+
+            feature.clean(matrix);
+        }
+
+        /* Cached inverse absolute transformation, compute it if it wasn't
+            computed already */
+        if(feature.cachedTransformations() & CachedTransformation::InvertedAbsolute) {
+            if(!(cached & CachedTransformation::InvertedAbsolute)) {
+                cached |= CachedTransformation::InvertedAbsolute;
+                invertedMatrix = Implementation::Transformation<Transformation>::toMatrix(
+                    Implementation::Transformation<Transformation>::inverted(absoluteTransformation));
+            }
+
+            feature.cleanInverted(invertedMatrix);
+        }
+    }
+}
+
+template<class Transformation> FlatObject<Transformation>::FlatObject(FlatScene<Transformation>& scene, FlatObject<Transformation>* const parent): _scene{&scene} {
+    CORRADE_ASSERT(!parent || parent->_scene == &scene,
+        "SceneGraph::FlatObject: parent is not part of the same scene", );
+    _index = scene.addObject(*this, parent ? parent->_index : FlatScene<Transformation>::NoParent);
+}
+
+template<class Transformation> FlatObject<Transformation>::~FlatObject() {
+    /* The scene is null if the object is deleted by the scene or by its
+       parent, which then takes care of the bookkeeping */
+    if(_scene) _scene->removeObject(*this);
+}
+
+template<class Transformation> FlatObject<Transformation>& FlatObject<Transformation>::setParent(FlatObject<Transformation>* const parent) {
+    CORRADE_ASSERT(!parent || parent->_scene == _scene,
+        "SceneGraph::FlatObject::setParent(): parent is not part of the same scene", *this);
+
+    const UnsignedInt parentIndex = parent ? parent->_index : FlatScene<Transformation>::NoParent;
+    if(_scene->_parents[_index] != parentIndex) _scene->setObjectParent(*this, parentIndex);
+    return *this;
+}
+
+template<class Transformation> auto FlatObject<Transformation>::doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>&, const MatrixType&) const -> std::vector<MatrixType> {
+    CORRADE_ASSERT(false, "SceneGraph::FlatObject::transformationMatrices(): currently implemented only for FlatScene", {});
+    return {};
+}
+
+template<class Transformation> void FlatObject<Transformation>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) {
+    _scene->doSetClean(objects);
+}
+
+}}
+
+#endif
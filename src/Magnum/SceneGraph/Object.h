@@ -299,7 +299,10 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
          * @brief Transformations of given group of objects relative to this object
          *
          * All transformations can be premultiplied with @p initialTransformation,
-         * if specified.
+         * if specified. If called on a @ref Scene with
+         * @ref Scene::setThreadCount() "thread count" larger than `1`, the
+         * computation is split across multiple threads, with results
+         * identical to the serial computation.
          * @see @ref transformationMatrices()
          */
         /* `objects` passed by copy intentionally (to allow move from
@@ -323,7 +326,10 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
         /**
          * @brief Clean absolute transformations of given set of objects
          *
-         * Only dirty objects in the list are cleaned.
+         * Only dirty objects in the list are cleaned. The absolute
+         * transformations are computed using @ref transformations(), thus
+         * in parallel if enabled with @ref Scene::setThreadCount(). Features
+         * are always cleaned in the calling thread.
          * @see @ref setClean()
          */
         /* `objects` passed by copy intentionally (to avoid copy internally) */
@@ -372,7 +378,9 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
 
         std::vector<MatrixType> doTransformationMatrices(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects, const MatrixType& initialTransformationMatrix) const override final;
 
-        typename Transformation::DataType MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const;
+        static UnsignedInt MAGNUM_SCENEGRAPH_LOCAL computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint);
+        static void MAGNUM_SCENEGRAPH_LOCAL concatenateJointTransformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::vector<UnsignedInt>& parentJoints, const typename Transformation::DataType& initialTransformation);
+        static void MAGNUM_SCENEGRAPH_LOCAL concatenateJointTransformationsParallel(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::vector<UnsignedInt>& parentJoints, const typename Transformation::DataType& initialTransformation, UnsignedInt threadCount);
 
         bool MAGNUM_SCENEGRAPH_LOCAL doIsDirty() const override final { return isDirty(); }
         void MAGNUM_SCENEGRAPH_LOCAL doSetDirty() override final { setDirty(); }
@@ -383,7 +391,7 @@ template<class Transformation> class Object: public AbstractObject<Transformatio
 
         typedef Implementation::ObjectFlag Flag;
         typedef Implementation::ObjectFlags Flags;
-        UnsignedShort counter;
+        UnsignedInt counter;
         Flags flags;
 };
 
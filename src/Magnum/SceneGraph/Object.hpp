@@ -32,6 +32,7 @@
 #include <algorithm>
 #include <stack>
 
+#include "Magnum/Implementation/parallel.h"
 #include "Magnum/SceneGraph/AbstractTransformation.h"
 #include "Magnum/SceneGraph/Object.h"
 #include "Magnum/SceneGraph/Scene.h"
@@ -43,7 +44,7 @@ template<UnsignedInt dimensions, class T> AbstractObject<dimensions, T>::~Abstra
 
 template<UnsignedInt dimensions, class T> AbstractTransformation<dimensions, T>::AbstractTransformation() {}
 
-template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFu), flags(Flag::Dirty) {
+template<class Transformation> Object<Transformation>::Object(Object<Transformation>* parent): counter(0xFFFFFFFFu), flags(Flag::Dirty) {
     setParent(parent);
 }
 
@@ -190,27 +191,32 @@ divided into two groups:
    child in the subtree
  - "non-joints", i.e. paths between joints
 
-Then for all joints their transformation (relative to parent joint) is
-computed and recursively concatenated together. Resulting transformations for
-joints which were originally in `object` list is then returned.
+Then for all joints their transformation relative to parent joint is computed
+and the relative transformations are concatenated together, going from the
+root down. Resulting transformations for joints which were originally in
+`object` list is then returned.
+
+Every object is visited a constant number of times and no recursion is
+involved, so the computation scales linearly with the object count and
+doesn't depend on hierarchy depth.
 */
 template<class Transformation> std::vector<typename Transformation::DataType> Object<Transformation>::transformations(std::vector<std::reference_wrapper<Object<Transformation>>> objects, const typename Transformation::DataType& initialTransformation) const {
-    CORRADE_ASSERT(objects.size() < 0xFFFFu, "SceneGraph::Object::transformations(): too large scene", {});
+    CORRADE_ASSERT(objects.size() < 0xFFFFFFFFu, "SceneGraph::Object::transformations(): too large scene", {});
 
     /* Remember object count for later */
-    std::size_t objectCount = objects.size();
+    const std::size_t objectCount = objects.size();
 
-    /* Mark all original objects as joints and create initial list of joints
-       from them */
-    for(std::size_t i = 0; i != objects.size(); ++i) {
+    /* Mark all original objects as joints, the list of original objects is
+       then extended with additional joints */
+    for(std::size_t i = 0; i != objectCount; ++i) {
         /* Multiple occurences of one object in the array, don't overwrite it
            with different counter */
-        if(objects[i].get().counter != 0xFFFFu) continue;
+        if(objects[i].get().counter != 0xFFFFFFFFu) continue;
 
-        objects[i].get().counter = UnsignedShort(i);
+        objects[i].get().counter = UnsignedInt(i);
         objects[i].get().flags |= Flag::Joint;
     }
-    std::vector<std::reference_wrapper<Object<Transformation>>> jointObjects(objects);
+    std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects = objects;
 
     #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
     /* Scene object */
@@ -220,53 +226,67 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
     /* Nearest common ancestor not yet implemented - assert this is done on scene */
     CORRADE_ASSERT(scene == this, "SceneGraph::Object::transformationMatrices(): currently implemented only for Scene", {});
 
-    /* Mark all objects up the hierarchy as visited */
-    auto it = objects.begin();
-    while(!objects.empty()) {
-        /* Already visited, remove and continue to next (duplicate occurence) */
-        if(it->get().flags & Flag::Visited) {
-            it = objects.erase(it);
-            continue;
-        }
+    /* Mark all objects up the hierarchy as visited. Going up from each object
+       stops at first visited object or joint, so every object is visited at
+       most once. */
+    for(std::size_t i = 0; i != objectCount; ++i) {
+        Object<Transformation>* o = &objects[i].get();
 
-        /* Mark the object as visited */
-        it->get().flags |= Flag::Visited;
+        /* Already visited, continue to next (duplicate occurence) */
+        if(o->flags & Flag::Visited) continue;
 
-        Object<Transformation>* parent = it->get().parent();
+        for(;;) {
+            /* Mark the object as visited */
+            o->flags |= Flag::Visited;
 
-        /* If this is root object, remove from list */
-        if(!parent) {
-            CORRADE_ASSERT(&it->get() == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
-            it = objects.erase(it);
-
-        /* Parent is an joint or already visited - remove current from list */
-        } else if(parent->flags & (Flag::Visited|Flag::Joint)) {
-            it = objects.erase(it);
-
-            /* If not already marked as joint, mark it as such and add it to
-               list of joint objects */
-            if(!(parent->flags & Flag::Joint)) {
-                CORRADE_ASSERT(jointObjects.size() < 0xFFFFu,
-                               "SceneGraph::Object::transformations(): too large scene", {});
-                CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFu);
-                parent->counter = UnsignedShort(jointObjects.size());
-                parent->flags |= Flag::Joint;
-                jointObjects.push_back(*parent);
+            Object<Transformation>* parent = o->parent();
+
+            /* If this is root object, done */
+            if(!parent) {
+                CORRADE_ASSERT(o == scene, "SceneGraph::Object::transformations(): the objects are not part of the same tree", {});
+                break;
             }
 
-        /* Else go up the hierarchy */
-        } else *it = *parent;
+            /* Parent is a joint or already visited, done */
+            if(parent->flags & (Flag::Visited|Flag::Joint)) {
+                /* If not already marked as joint, mark it as such and add it
+                   to list of joint objects */
+                if(!(parent->flags & Flag::Joint)) {
+                    CORRADE_ASSERT(jointObjects.size() < 0xFFFFFFFFu,
+                        "SceneGraph::Object::transformations(): too large scene", {});
+                    CORRADE_INTERNAL_ASSERT(parent->counter == 0xFFFFFFFFu);
+                    parent->counter = UnsignedInt(jointObjects.size());
+                    parent->flags |= Flag::Joint;
+                    jointObjects.push_back(*parent);
+                }
+
+                break;
+            }
 
-        /* Cycle if reached end */
-        if(it == objects.end()) it = objects.begin();
+            /* Else go up the hierarchy */
+            o = parent;
+        }
     }
 
-    /* Array of absolute transformations in joints */
+    /* Array of transformations in joints and indices of their parent joints */
     std::vector<typename Transformation::DataType> jointTransformations(jointObjects.size());
-
-    /* Compute transformations for all joints */
-    for(std::size_t i = 0; i != jointTransformations.size(); ++i)
-        computeJointTransformation(jointObjects, jointTransformations, i, initialTransformation);
+    std::vector<UnsignedInt> parentJoints(jointObjects.size());
+
+    /* Compute transformations of all joints relative to their parent joints.
+       Paths between joints don't overlap, so they can be processed in
+       parallel. */
+    const UnsignedInt threadCount = isScene() ? static_cast<const Scene<Transformation>*>(this)->threadCount() : 1;
+    const std::size_t jointThreadCount = Magnum::Implementation::parallelThreadCount(jointObjects.size(), threadCount);
+    Magnum::Implementation::forEachRange(jointObjects.size(), jointThreadCount, [&jointObjects, &jointTransformations, &parentJoints](const std::size_t begin, const std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            parentJoints[i] = computeJointTransformation(jointObjects, jointTransformations, i);
+    });
+
+    /* Concatenate relative transformations into absolute ones */
+    if(jointThreadCount == 1)
+        concatenateJointTransformations(jointObjects, jointTransformations, parentJoints, initialTransformation);
+    else
+        concatenateJointTransformationsParallel(jointObjects, jointTransformations, parentJoints, initialTransformation, threadCount);
 
     /* Copy transformation for second or next occurences from first occurence
        of duplicate object */
@@ -279,9 +299,9 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
     for(auto i: jointObjects) {
         /* All not-already cleaned objects (...duplicate occurences) should
            have joint mark */
-        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFu || i.get().flags & Flag::Joint);
+        CORRADE_INTERNAL_ASSERT(i.get().counter == 0xFFFFFFFFu || i.get().flags & Flag::Joint);
         i.get().flags &= ~Flag::Joint;
-        i.get().counter = 0xFFFFu;
+        i.get().counter = 0xFFFFFFFFu;
     }
 
     /* Shrink the array to contain only transformations of requested objects and return */
@@ -289,12 +309,12 @@ template<class Transformation> std::vector<typename Transformation::DataType> Ob
     return jointTransformations;
 }
 
-template<class Transformation> typename Transformation::DataType Object<Transformation>::computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint, const typename Transformation::DataType& initialTransformation) const {
+template<class Transformation> UnsignedInt Object<Transformation>::computeJointTransformation(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::size_t joint) {
     std::reference_wrapper<Object<Transformation>> o = jointObjects[joint];
 
-    /* Transformation already computed ("unvisited" by this function before
-       either due to recursion or duplicate object occurences), done */
-    if(!(o.get().flags & Flag::Visited)) return jointTransformations[joint];
+    /* Duplicate object occurence, the transformation is computed for the
+       first one */
+    if(o.get().counter != joint) return 0xFFFFFFFFu;
 
     /* Initialize transformation */
     jointTransformations[joint] = o.get().transformation();
@@ -307,16 +327,16 @@ template<class Transformation> typename Transformation::DataType Object<Transfor
 
         Object<Transformation>* parent = o.get().parent();
 
-        /* Root object, compose transformation with initial, done */
+        /* Root object, transformation is relative to initial, done */
         if(!parent) {
             CORRADE_INTERNAL_ASSERT(o.get().isScene());
-            return (jointTransformations[joint] =
-                Implementation::Transformation<Transformation>::compose(initialTransformation, jointTransformations[joint]));
+            return 0xFFFFFFFFu;
 
-        /* Joint object, compose transformation with the joint, done */
-        } else if(parent->flags & Flag::Joint) {
-            return (jointTransformations[joint] =
-                Implementation::Transformation<Transformation>::compose(computeJointTransformation(jointObjects, jointTransformations, parent->counter, initialTransformation), jointTransformations[joint]));
+        /* Joint object, transformation is relative to the joint, done. Only
+           joints have the counter set, checking it instead of the flag,
+           because flags of the joint may be modified concurrently. */
+        } else if(parent->counter != 0xFFFFFFFFu) {
+            return parent->counter;
 
         /* Else compose transformation with parent, go up the hierarchy */
         } else {
@@ -326,6 +346,90 @@ template<class Transformation> typename Transformation::DataType Object<Transfor
     }
 }
 
+template<class Transformation> void Object<Transformation>::concatenateJointTransformations(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::vector<UnsignedInt>& parentJoints, const typename Transformation::DataType& initialTransformation) {
+    /* A parent joint might have larger index than the child, so the chain of
+       joints which aren't computed yet is collected first and then processed
+       from the top. */
+    std::vector<bool> jointComputed(jointObjects.size());
+    std::vector<UnsignedInt> jointStack;
+    for(std::size_t i = 0; i != jointObjects.size(); ++i) {
+        /* Duplicate occurence, handled later */
+        if(jointObjects[i].get().counter != i) continue;
+
+        for(UnsignedInt joint = UnsignedInt(i); joint != 0xFFFFFFFFu && !jointComputed[joint]; joint = parentJoints[joint])
+            jointStack.push_back(joint);
+
+        while(!jointStack.empty()) {
+            const UnsignedInt joint = jointStack.back();
+            jointStack.pop_back();
+
+            const UnsignedInt parentJoint = parentJoints[joint];
+            jointTransformations[joint] = Implementation::Transformation<Transformation>::compose(
+                parentJoint == 0xFFFFFFFFu ? initialTransformation : jointTransformations[parentJoint],
+                jointTransformations[joint]);
+            jointComputed[joint] = true;
+        }
+    }
+}
+
+template<class Transformation> void Object<Transformation>::concatenateJointTransformationsParallel(const std::vector<std::reference_wrapper<Object<Transformation>>>& jointObjects, std::vector<typename Transformation::DataType>& jointTransformations, const std::vector<UnsignedInt>& parentJoints, const typename Transformation::DataType& initialTransformation, const UnsignedInt threadCount) {
+    /* Compute depth of each joint in the joint hierarchy, using the same
+       stack-based approach as in the serial version. Duplicate occurences
+       have no parent joint and are skipped. */
+    constexpr UnsignedInt NoDepth = 0xFFFFFFFFu;
+    std::vector<UnsignedInt> jointDepths(jointObjects.size(), NoDepth);
+    std::vector<UnsignedInt> jointStack;
+    UnsignedInt maxDepth = 0;
+    for(std::size_t i = 0; i != jointObjects.size(); ++i) {
+        if(jointObjects[i].get().counter != i) continue;
+
+        UnsignedInt joint = UnsignedInt(i);
+        for(; joint != 0xFFFFFFFFu && jointDepths[joint] == NoDepth; joint = parentJoints[joint])
+            jointStack.push_back(joint);
+
+        UnsignedInt depth = joint == 0xFFFFFFFFu ? 0 : jointDepths[joint] + 1;
+        while(!jointStack.empty()) {
+            jointDepths[jointStack.back()] = depth++;
+            jointStack.pop_back();
+        }
+
+        maxDepth = std::max(maxDepth, depth);
+    }
+
+    /* Sort the joints by depth, all joints in one level depend only on joints
+       in previous levels */
+    std::vector<UnsignedInt> levelOffsets(maxDepth + 1);
+    for(const UnsignedInt depth: jointDepths)
+        if(depth != NoDepth) ++levelOffsets[depth];
+    for(UnsignedInt level = 0, offset = 0; level != levelOffsets.size(); ++level) {
+        const UnsignedInt count = levelOffsets[level];
+        levelOffsets[level] = offset;
+        offset += count;
+    }
+    std::vector<UnsignedInt> sortedJoints(levelOffsets.back());
+    {
+        std::vector<UnsignedInt> levelEnds(levelOffsets.begin(), levelOffsets.end() - 1);
+        for(std::size_t i = 0; i != jointDepths.size(); ++i)
+            if(jointDepths[i] != NoDepth) sortedJoints[levelEnds[jointDepths[i]]++] = UnsignedInt(i);
+    }
+
+    /* Concatenate the transformations level by level. The operands are the
+       same as in the serial version, so the result is bit-identical. */
+    for(std::size_t level = 0; level + 1 < levelOffsets.size(); ++level) {
+        const UnsignedInt* levelJoints = sortedJoints.data() + levelOffsets[level];
+        const std::size_t levelSize = levelOffsets[level + 1] - levelOffsets[level];
+        Magnum::Implementation::forEachRange(levelSize, Magnum::Implementation::parallelThreadCount(levelSize, threadCount), [levelJoints, &jointTransformations, &parentJoints, &initialTransformation](const std::size_t begin, const std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i) {
+                const UnsignedInt joint = levelJoints[i];
+                const UnsignedInt parentJoint = parentJoints[joint];
+                jointTransformations[joint] = Implementation::Transformation<Transformation>::compose(
+                    parentJoint == 0xFFFFFFFFu ? initialTransformation : jointTransformations[parentJoint],
+                    jointTransformations[joint]);
+            }
+        });
+    }
+}
+
 template<class Transformation> void Object<Transformation>::doSetClean(const std::vector<std::reference_wrapper<AbstractObject<Transformation::Dimensions, typename Transformation::Type>>>& objects) {
     std::vector<std::reference_wrapper<Object<Transformation>>> castObjects;
     castObjects.reserve(objects.size());
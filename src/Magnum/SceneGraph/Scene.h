@@ -41,10 +41,37 @@ See @ref scenegraph for introduction.
 */
 template<class Transformation> class Scene: public Object<Transformation> {
     public:
-        explicit Scene() = default;
+        explicit Scene(): _threadCount(1) {}
+
+        /**
+         * @brief Thread count for computing absolute transformations
+         *
+         * @see @ref setThreadCount()
+         */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set thread count for computing absolute transformations
+         * @return Reference to self (for method chaining)
+         *
+         * If set to value other than `1`, @ref Object::transformations() and
+         * @ref Object::setClean() called on objects in this scene compute
+         * relative transformations of independent subtrees concurrently and
+         * then concatenate them level by level, with results bit-identical
+         * to the serial computation. Value of `0` means thread count reported
+         * by `std::thread::hardware_concurrency()`. Small object sets are
+         * always processed serially. On platforms without thread support the
+         * value is ignored. Default is `1`.
+         */
+        Scene<Transformation>& setThreadCount(UnsignedInt count) {
+            _threadCount = count;
+            return *this;
+        }
 
     private:
         bool isScene() const override final { return true; }
+
+        UnsignedInt _threadCount;
 };
 
 }}
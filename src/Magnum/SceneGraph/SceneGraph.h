@@ -123,6 +123,9 @@ template<class> class BasicDualQuaternionTransformation;
 typedef BasicDualComplexTransformation<Float> DualComplexTransformation;
 typedef BasicDualQuaternionTransformation<Float> DualQuaternionTransformation;
 
+template<class Transformation> class FlatObject;
+template<class Transformation> class FlatScene;
+
 template<UnsignedInt, class, class> class FeatureGroup;
 template<class Feature, class T> using BasicFeatureGroup2D = FeatureGroup<2, Feature, T>;
 template<class Feature, class T> using BasicFeatureGroup3D = FeatureGroup<3, Feature, T>;
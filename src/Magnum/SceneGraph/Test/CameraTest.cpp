@@ -46,10 +46,13 @@ struct CameraTest: TestSuite::Tester {
     void projectionSizePerspective();
     void projectionSizeViewport();
     void draw();
+    void drawCulled2D();
+    void drawCulled3D();
 };
 
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation2D> Object2D;
 typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation2D> Scene2D;
 typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
 
 CameraTest::CameraTest() {
@@ -61,7 +64,9 @@ CameraTest::CameraTest() {
               &CameraTest::projectionSizeOrthographic,
               &CameraTest::projectionSizePerspective,
               &CameraTest::projectionSizeViewport,
-              &CameraTest::draw});
+              &CameraTest::draw,
+              &CameraTest::drawCulled2D,
+              &CameraTest::drawCulled3D});
 }
 
 void CameraTest::fixAspectRatio() {
@@ -210,6 +215,121 @@ void CameraTest::draw() {
     CORRADE_COMPARE(thirdTransformation, Matrix4());
 }
 
+void CameraTest::drawCulled2D() {
+    class Drawable: public SceneGraph::Drawable2D {
+        public:
+            Drawable(AbstractObject2D& object, DrawableGroup2D* group, bool& drawn): SceneGraph::Drawable2D(object, group), drawn(drawn) {}
+
+        protected:
+            void draw(const Matrix3&, Camera2D&) override { drawn = true; }
+
+        private:
+            bool& drawn;
+    };
+
+    DrawableGroup2D group;
+    Scene2D scene;
+
+    /* Inside */
+    Object2D first(&scene);
+    bool firstDrawn = false;
+    first.translate({1.5f, 0.0f});
+    (new Drawable(first, &group, firstDrawn))->setBoundingSphere({}, 0.1f);
+
+    /* Outside, but the bounding circle (after scaling) reaches inside */
+    Object2D second(&scene);
+    bool secondDrawn = false;
+    second.scale(Vector2(2.0f))
+        .translate({0.0f, 3.0f});
+    (new Drawable(second, &group, secondDrawn))->setBoundingBox({{-0.5f, -0.5f}, {0.5f, 0.5f}});
+
+    /* Outside */
+    Object2D third(&scene);
+    bool thirdDrawn = false;
+    third.translate({-3.0f, 0.0f});
+    (new Drawable(third, &group, thirdDrawn))->setBoundingSphere({}, 0.5f);
+
+    /* Outside, but without bounds */
+    Object2D fourth(&scene);
+    bool fourthDrawn = false;
+    fourth.translate({-3.0f, 0.0f});
+    new Drawable(fourth, &group, fourthDrawn);
+
+    Camera2D camera(scene);
+    camera.setProjectionMatrix(Matrix3::projection({4.0f, 4.0f}));
+    camera.draw(group);
+
+    CORRADE_VERIFY(firstDrawn);
+    CORRADE_VERIFY(secondDrawn);
+    CORRADE_VERIFY(!thirdDrawn);
+    CORRADE_VERIFY(fourthDrawn);
+    CORRADE_COMPARE(camera.drawnCount(), 3);
+    CORRADE_COMPARE(camera.culledCount(), 1);
+}
+
+void CameraTest::drawCulled3D() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, Int& drawCount): SceneGraph::Drawable3D(object, group), drawCount(drawCount) {}
+
+        protected:
+            void draw(const Matrix4&, Camera3D&) override { ++drawCount; }
+
+        private:
+            Int& drawCount;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    /* Camera looking down -Z from origin, objects placed relative to it */
+    Object3D cameraObject(&scene);
+    cameraObject.rotateY(Deg(90.0f))
+        .translate({5.0f, 0.0f, 0.0f});
+    Camera3D camera(cameraObject);
+    camera.setProjectionMatrix(Matrix4::perspectiveProjection(Deg(90.0f), 1.0f, 1.0f, 100.0f));
+
+    /* In front of the camera */
+    Object3D first(&cameraObject);
+    Int firstDrawCount = 0;
+    first.translate({0.0f, 0.0f, -10.0f});
+    Drawable* firstDrawable = new Drawable(first, &group, firstDrawCount);
+    firstDrawable->setBoundingSphere({}, 1.0f);
+
+    /* Behind the camera */
+    Object3D second(&cameraObject);
+    Int secondDrawCount = 0;
+    second.translate({0.0f, 0.0f, 10.0f});
+    (new Drawable(second, &group, secondDrawCount))->setBoundingSphere({}, 1.0f);
+
+    /* Beyond the far plane, but the sphere is offset towards the camera */
+    Object3D third(&cameraObject);
+    Int thirdDrawCount = 0;
+    third.translate({0.0f, 0.0f, -110.0f});
+    (new Drawable(third, &group, thirdDrawCount))->setBoundingSphere({0.0f, 0.0f, 20.0f}, 1.0f);
+
+    camera.draw(group);
+    CORRADE_COMPARE(firstDrawCount, 1);
+    CORRADE_COMPARE(secondDrawCount, 0);
+    CORRADE_COMPARE(thirdDrawCount, 1);
+    CORRADE_COMPARE(camera.drawnCount(), 2);
+    CORRADE_COMPARE(camera.culledCount(), 1);
+
+    /* Move the first object out of view, remove the bounds from the second */
+    first.translate({20.0f, 0.0f, 0.0f});
+    CORRADE_VERIFY(firstDrawable->hasBoundingSphere());
+    CORRADE_COMPARE(firstDrawable->boundingSphereRadius(), 1.0f);
+    static_cast<Drawable&>(group[1]).resetBoundingSphere();
+    CORRADE_VERIFY(!group[1].hasBoundingSphere());
+
+    camera.draw(group);
+    CORRADE_COMPARE(firstDrawCount, 1);
+    CORRADE_COMPARE(secondDrawCount, 1);
+    CORRADE_COMPARE(thirdDrawCount, 2);
+    CORRADE_COMPARE(camera.drawnCount(), 2);
+    CORRADE_COMPARE(camera.culledCount(), 1);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::CameraTest)
@@ -0,0 +1,149 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/FlatScene.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/Test/BenchmarkTimer.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct FlatSceneBenchmark: TestSuite::Tester {
+    explicit FlatSceneBenchmark();
+
+    void setCleanObject();
+    void setCleanFlatObject();
+    void transformationsObject();
+    void transformationsFlatObject();
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+typedef SceneGraph::FlatObject<SceneGraph::MatrixTransformation3D> FlatObject3D;
+typedef SceneGraph::FlatScene<SceneGraph::MatrixTransformation3D> FlatScene3D;
+
+namespace {
+    enum: std::size_t {
+        ObjectCount = 200000,
+        Iterations = 10
+    };
+
+    /* Groups of 16 objects, each group having another group as a parent */
+    template<class Scene, class Object> std::vector<std::reference_wrapper<Object>> populate(Scene& scene, Object*(*create)(Scene&, Object*)) {
+        std::vector<std::reference_wrapper<Object>> objects;
+        objects.reserve(ObjectCount);
+        Object* parent = nullptr;
+        for(std::size_t i = 0; i != ObjectCount; ++i) {
+            Object* o = create(scene, parent);
+            o->setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+            objects.push_back(*o);
+
+            if(i % 16 == 0) parent = &objects[i/2].get();
+        }
+
+        return objects;
+    }
+
+    Object3D* createObject(Scene3D& scene, Object3D* parent) {
+        return new Object3D{parent ? parent : &scene};
+    }
+
+    FlatObject3D* createFlatObject(FlatScene3D& scene, FlatObject3D* parent) {
+        return new FlatObject3D{scene, parent};
+    }
+
+    template<class F> void benchmark(const char* name, F f) {
+        Magnum::Test::BenchmarkTimer timer;
+        for(std::size_t i = 0; i != Iterations; ++i) timer.measure(f);
+
+        Debug() << "   " << name << timer.microseconds() << "us for" << std::size_t(ObjectCount) << "objects";
+    }
+}
+
+FlatSceneBenchmark::FlatSceneBenchmark() {
+    addTests({&FlatSceneBenchmark::setCleanObject,
+              &FlatSceneBenchmark::setCleanFlatObject,
+              &FlatSceneBenchmark::transformationsObject,
+              &FlatSceneBenchmark::transformationsFlatObject});
+}
+
+void FlatSceneBenchmark::setCleanObject() {
+    Scene3D scene;
+    std::vector<std::reference_wrapper<Object3D>> objects = populate(scene, createObject);
+
+    benchmark("Object::setClean():", [&]() {
+        objects.front().get().setDirty();
+        Object3D::setClean(objects);
+    });
+
+    CORRADE_VERIFY(!objects.back().get().isDirty());
+}
+
+void FlatSceneBenchmark::setCleanFlatObject() {
+    FlatScene3D scene;
+    std::vector<std::reference_wrapper<FlatObject3D>> objects = populate(scene, createFlatObject);
+
+    benchmark("FlatScene::setObjectsClean():", [&]() {
+        objects.front().get().setDirty();
+        scene.setObjectsClean();
+    });
+
+    CORRADE_VERIFY(!objects.back().get().isDirty());
+}
+
+void FlatSceneBenchmark::transformationsObject() {
+    Scene3D scene;
+    std::vector<std::reference_wrapper<Object3D>> objects = populate(scene, createObject);
+
+    /* FlatScene::transformations() cleans all objects (and calls their
+       features) before returning the cached values, so do the same here to
+       have both benchmarks do equivalent work */
+    std::vector<Matrix4> transformations;
+    benchmark("Object::setClean() + transformations():", [&]() {
+        objects.front().get().setDirty();
+        Object3D::setClean(objects);
+        transformations = scene.transformations(objects);
+    });
+
+    CORRADE_COMPARE(transformations.size(), std::size_t(ObjectCount));
+}
+
+void FlatSceneBenchmark::transformationsFlatObject() {
+    FlatScene3D scene;
+    std::vector<std::reference_wrapper<FlatObject3D>> objects = populate(scene, createFlatObject);
+
+    std::vector<Matrix4> transformations;
+    benchmark("FlatScene::transformations():", [&]() {
+        objects.front().get().setDirty();
+        transformations = scene.transformations(objects);
+    });
+
+    CORRADE_COMPARE(transformations.size(), std::size_t(ObjectCount));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatSceneBenchmark)
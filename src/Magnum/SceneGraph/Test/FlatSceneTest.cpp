@@ -0,0 +1,413 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/Camera.h"
+#include "Magnum/SceneGraph/Drawable.h"
+#include "Magnum/SceneGraph/FlatScene.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct FlatSceneTest: TestSuite::Tester {
+    explicit FlatSceneTest();
+
+    void construct();
+    void parenting();
+    void parentingCyclic();
+    void deleteObject();
+    void absoluteTransformation();
+    void transformations();
+    void transformationsOrphan();
+    void setClean();
+    void setCleanList();
+    void setDirty();
+    void setObjectsClean();
+    void setObjectsCleanReordered();
+    void draw();
+};
+
+typedef SceneGraph::FlatObject<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::FlatScene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+class CachingFeature: public AbstractFeature3D {
+    public:
+        explicit CachingFeature(AbstractObject3D& object): AbstractFeature3D{object}, dirtyCount{}, cleanCount{} {
+            setCachedTransformations(CachedTransformation::Absolute);
+        }
+
+        Matrix4 cleanedAbsoluteTransformation;
+        Int dirtyCount, cleanCount;
+
+    protected:
+        void markDirty() override { ++dirtyCount; }
+
+        void clean(const Matrix4& absoluteTransformation) override {
+            ++cleanCount;
+            cleanedAbsoluteTransformation = absoluteTransformation;
+        }
+};
+
+FlatSceneTest::FlatSceneTest() {
+    addTests({&FlatSceneTest::construct,
+              &FlatSceneTest::parenting,
+              &FlatSceneTest::parentingCyclic,
+              &FlatSceneTest::deleteObject,
+              &FlatSceneTest::absoluteTransformation,
+              &FlatSceneTest::transformations,
+              &FlatSceneTest::transformationsOrphan,
+              &FlatSceneTest::setClean,
+              &FlatSceneTest::setCleanList,
+              &FlatSceneTest::setDirty,
+              &FlatSceneTest::setObjectsClean,
+              &FlatSceneTest::setObjectsCleanReordered,
+              &FlatSceneTest::draw});
+}
+
+void FlatSceneTest::construct() {
+    Scene3D scene;
+    CORRADE_COMPARE(scene.objectCount(), 0);
+    CORRADE_VERIFY(scene.scene() == &scene);
+
+    Object3D* a = new Object3D{scene};
+    Object3D* b = new Object3D{scene, a};
+    CORRADE_COMPARE(scene.objectCount(), 2);
+    CORRADE_VERIFY(a->scene() == &scene);
+    CORRADE_VERIFY(static_cast<AbstractObject3D*>(b)->scene() == &scene);
+    CORRADE_VERIFY(a->parent() == nullptr);
+    CORRADE_VERIFY(b->parent() == a);
+    CORRADE_COMPARE(a->index(), 0);
+    CORRADE_COMPARE(b->index(), 1);
+    CORRADE_VERIFY(scene.object(1) == b);
+    CORRADE_VERIFY(a->isDirty());
+    CORRADE_VERIFY(b->isDirty());
+}
+
+void FlatSceneTest::parenting() {
+    Scene3D scene;
+    Object3D* a = new Object3D{scene};
+    Object3D* b = new Object3D{scene};
+    Object3D* c = new Object3D{scene, a};
+
+    /* Adding child to a parent that's not at the end breaks the order, it
+       gets restored on next operation that needs it */
+    c->setClean();
+    c->setParent(b);
+    CORRADE_VERIFY(c->parent() == b);
+    CORRADE_VERIFY(c->isDirty());
+    CORRADE_COMPARE(a->index(), 0);
+    CORRADE_COMPARE(b->index(), 1);
+    CORRADE_COMPARE(c->index(), 2);
+
+    c->setParent(nullptr);
+    CORRADE_VERIFY(c->parent() == nullptr);
+
+    a->setParent(c);
+    scene.setObjectsClean();
+    CORRADE_COMPARE(b->index(), 0);
+    CORRADE_COMPARE(c->index(), 1);
+    CORRADE_COMPARE(a->index(), 2);
+    CORRADE_VERIFY(scene.object(2) == a);
+}
+
+void FlatSceneTest::parentingCyclic() {
+    Scene3D scene;
+    Object3D* a = new Object3D{scene};
+    Object3D* b = new Object3D{scene, a};
+
+    /* An object cannot be parent of itself */
+    a->setParent(a);
+    CORRADE_VERIFY(a->parent() == nullptr);
+
+    /* In fact, cyclic dependencies are not allowed at all */
+    a->setParent(b);
+    CORRADE_VERIFY(a->parent() == nullptr);
+    CORRADE_VERIFY(b->parent() == a);
+}
+
+void FlatSceneTest::deleteObject() {
+    Scene3D scene;
+    Object3D* a = new Object3D{scene};
+    Object3D* b = new Object3D{scene, a};
+    new Object3D{scene, b};
+    Object3D* d = new Object3D{scene};
+    new Object3D{scene, a};
+
+    /* Deleting the object deletes its children as well, leaving empty slots
+       in the scene */
+    delete a;
+    CORRADE_COMPARE(scene.objectCount(), 5);
+    std::size_t alive = 0;
+    for(std::size_t i = 0; i != scene.objectCount(); ++i)
+        if(scene.object(i)) ++alive;
+    CORRADE_COMPARE(alive, 1);
+    CORRADE_VERIFY(scene.object(d->index()) == d);
+
+    /* The slots are removed when the order is restored */
+    scene.setObjectsClean();
+    CORRADE_COMPARE(scene.objectCount(), 1);
+    CORRADE_COMPARE(d->index(), 0);
+}
+
+void FlatSceneTest::absoluteTransformation() {
+    Scene3D scene;
+    Object3D a{scene};
+    a.setTransformation(Matrix4::translation(Vector3::xAxis(2.0f)));
+    Object3D* b = new Object3D{scene, &a};
+    b->transform(Matrix4::scaling(Vector3(3.0f)))
+      .transformLocal(Matrix4::translation(Vector3::yAxis(1.0f)));
+
+    const Matrix4 expected = Matrix4::translation(Vector3::xAxis(2.0f))*Matrix4::scaling(Vector3(3.0f))*Matrix4::translation(Vector3::yAxis(1.0f));
+    CORRADE_COMPARE(b->transformationMatrix(), Matrix4::scaling(Vector3(3.0f))*Matrix4::translation(Vector3::yAxis(1.0f)));
+
+    /* Computed from parents */
+    CORRADE_VERIFY(b->isDirty());
+    CORRADE_COMPARE(b->absoluteTransformationMatrix(), expected);
+
+    /* Cached */
+    b->setClean();
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_COMPARE(b->absoluteTransformation(), expected);
+    CORRADE_COMPARE(static_cast<AbstractObject3D*>(b)->absoluteTransformationMatrix(), expected);
+
+    /* Computed from the nearest clean parent */
+    Object3D* c = new Object3D{scene, b};
+    Object3D* d = new Object3D{scene, c};
+    c->setTransformation(Matrix4::rotationZ(Deg(90.0f)));
+    d->setTransformation(Matrix4::translation(Vector3::zAxis(-1.0f)));
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_VERIFY(d->isDirty());
+    CORRADE_COMPARE(d->absoluteTransformationMatrix(), expected*Matrix4::rotationZ(Deg(90.0f))*Matrix4::translation(Vector3::zAxis(-1.0f)));
+}
+
+void FlatSceneTest::transformations() {
+    Scene3D scene;
+    Object3D* a = new Object3D{scene};
+    a->setTransformation(Matrix4::rotationZ(Deg(30.0f)));
+    Object3D* b = new Object3D{scene, a};
+    b->setTransformation(Matrix4::scaling(Vector3(0.5f)));
+    Object3D* c = new Object3D{scene, a};
+    c->setTransformation(Matrix4::translation(Vector3::xAxis(5.0f)));
+
+    const Matrix4 initial = Matrix4::rotationX(Deg(90.0f)).inverted();
+    CORRADE_COMPARE(scene.transformations({*c, *b, *c}, initial), (std::vector<Matrix4>{
+        initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::translation(Vector3::xAxis(5.0f)),
+        initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f)),
+        initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::translation(Vector3::xAxis(5.0f))
+    }));
+
+    /* Through the generic interface, including the scene itself */
+    CORRADE_COMPARE(static_cast<AbstractObject3D&>(scene).transformationMatrices({*b, scene}, initial), (std::vector<Matrix4>{
+        initial*Matrix4::rotationZ(Deg(30.0f))*Matrix4::scaling(Vector3(0.5f)),
+        initial
+    }));
+
+    /* The generic interface is const and doesn't clean dirty objects */
+    a->setTransformation(Matrix4::rotationZ(Deg(60.0f)));
+    CORRADE_VERIFY(b->isDirty());
+    CORRADE_COMPARE(static_cast<const AbstractObject3D&>(scene).transformationMatrices({*b}, initial), (std::vector<Matrix4>{
+        initial*Matrix4::rotationZ(Deg(60.0f))*Matrix4::scaling(Vector3(0.5f))
+    }));
+    CORRADE_VERIFY(a->isDirty());
+    CORRADE_VERIFY(b->isDirty());
+}
+
+void FlatSceneTest::transformationsOrphan() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Scene3D scene;
+    Scene3D another;
+    Object3D* a = new Object3D{another};
+    CORRADE_COMPARE(scene.transformations({*a}), std::vector<Matrix4>{});
+    CORRADE_COMPARE(static_cast<AbstractObject3D*>(a)->transformationMatrices({*a}), std::vector<Matrix4>{});
+    CORRADE_COMPARE(out.str(),
+        "SceneGraph::FlatScene::transformations(): the objects are not part of the same scene\n"
+        "SceneGraph::FlatObject::transformationMatrices(): currently implemented only for FlatScene\n");
+}
+
+void FlatSceneTest::setClean() {
+    Scene3D scene;
+    CachingFeature sceneFeature{scene};
+    Object3D* a = new Object3D{scene};
+    a->setTransformation(Matrix4::translation(Vector3::xAxis(2.0f)));
+    Object3D* b = new Object3D{scene, a};
+    b->setTransformation(Matrix4::scaling(Vector3(3.0f)));
+    Object3D* c = new Object3D{scene, a};
+    CachingFeature& feature = b->addFeature<CachingFeature>();
+
+    CORRADE_VERIFY(scene.isDirty());
+    b->setClean();
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_VERIFY(c->isDirty());
+    CORRADE_COMPARE(sceneFeature.cleanCount, 1);
+    CORRADE_COMPARE(feature.cleanCount, 1);
+    CORRADE_COMPARE(feature.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::xAxis(2.0f))*Matrix4::scaling(Vector3(3.0f)));
+
+    /* Already clean, nothing is done */
+    b->setClean();
+    CORRADE_COMPARE(feature.cleanCount, 1);
+}
+
+void FlatSceneTest::setCleanList() {
+    Scene3D scene;
+    Object3D* a = new Object3D{scene};
+    a->setTransformation(Matrix4::translation(Vector3::zAxis(3.0f)));
+    Object3D* b = new Object3D{scene, a};
+    b->setTransformation(Matrix4::scaling(Vector3(-2.0f)));
+    Object3D* c = new Object3D{scene};
+    CachingFeature& feature = b->addFeature<CachingFeature>();
+
+    AbstractObject3D::setClean({*b, *c, scene});
+    CORRADE_VERIFY(!scene.isDirty());
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_VERIFY(!c->isDirty());
+    CORRADE_COMPARE(feature.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::zAxis(3.0f))*Matrix4::scaling(Vector3(-2.0f)));
+}
+
+void FlatSceneTest::setDirty() {
+    Scene3D scene;
+    Object3D* a = new Object3D{scene};
+    Object3D* b = new Object3D{scene, a};
+    Object3D* c = new Object3D{scene, b};
+    Object3D* d = new Object3D{scene};
+    CachingFeature& feature = c->addFeature<CachingFeature>();
+
+    scene.setObjectsClean();
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(!c->isDirty());
+    CORRADE_COMPARE(feature.cleanCount, 1);
+
+    /* Whole subtree is marked as dirty */
+    b->setDirty();
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(b->isDirty());
+    CORRADE_VERIFY(c->isDirty());
+    CORRADE_VERIFY(!d->isDirty());
+    CORRADE_COMPARE(feature.dirtyCount, 1);
+
+    /* Already dirty, features are not notified again */
+    a->setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_VERIFY(a->isDirty());
+    CORRADE_COMPARE(feature.dirtyCount, 1);
+
+    scene.setObjectsClean();
+    CORRADE_COMPARE(feature.cleanCount, 2);
+    CORRADE_COMPARE(feature.cleanedAbsoluteTransformation, Matrix4::translation(Vector3::xAxis(1.0f)));
+}
+
+void FlatSceneTest::setObjectsClean() {
+    Scene3D scene;
+    Object3D* a = new Object3D{scene};
+    a->setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    Object3D* b = new Object3D{scene, a};
+    b->setTransformation(Matrix4::translation(Vector3::yAxis(2.0f)));
+    Object3D* c = new Object3D{scene, b};
+    c->setTransformation(Matrix4::translation(Vector3::zAxis(3.0f)));
+    CachingFeature& feature = c->addFeature<CachingFeature>();
+
+    scene.setObjectsClean();
+    CORRADE_VERIFY(!a->isDirty());
+    CORRADE_VERIFY(!b->isDirty());
+    CORRADE_VERIFY(!c->isDirty());
+    CORRADE_COMPARE(feature.cleanedAbsoluteTransformation, Matrix4::translation({1.0f, 2.0f, 3.0f}));
+}
+
+void FlatSceneTest::setObjectsCleanReordered() {
+    /* Objects added breadth-first, parents are after children */
+    Scene3D scene;
+    Object3D* a = new Object3D{scene};
+    Object3D* b = new Object3D{scene};
+    Object3D* c = new Object3D{scene, a};
+    Object3D* d = new Object3D{scene, b};
+    Object3D* e = new Object3D{scene, c};
+    a->setTransformation(Matrix4::translation(Vector3::xAxis(1.0f)));
+    b->setTransformation(Matrix4::translation(Vector3::yAxis(1.0f)));
+    c->setTransformation(Matrix4::scaling(Vector3(2.0f)));
+    d->setTransformation(Matrix4::scaling(Vector3(3.0f)));
+    e->setTransformation(Matrix4::translation(Vector3::zAxis(1.0f)));
+    e->setParent(b);
+    b->setParent(c);
+
+    scene.setObjectsClean();
+    CORRADE_COMPARE(a->index(), 0);
+    CORRADE_COMPARE(c->index(), 1);
+    CORRADE_COMPARE(b->index(), 2);
+    CORRADE_COMPARE(d->index(), 3);
+    CORRADE_COMPARE(e->index(), 4);
+
+    const Matrix4 bExpected = Matrix4::translation(Vector3::xAxis(1.0f))*Matrix4::scaling(Vector3(2.0f))*Matrix4::translation(Vector3::yAxis(1.0f));
+    CORRADE_COMPARE(b->absoluteTransformation(), bExpected);
+    CORRADE_COMPARE(d->absoluteTransformation(), bExpected*Matrix4::scaling(Vector3(3.0f)));
+    CORRADE_COMPARE(e->absoluteTransformation(), bExpected*Matrix4::translation(Vector3::zAxis(1.0f)));
+}
+
+void FlatSceneTest::draw() {
+    class Drawable: public SceneGraph::Drawable3D {
+        public:
+            Drawable(AbstractObject3D& object, DrawableGroup3D* group, Matrix4& result): SceneGraph::Drawable3D(object, group), result(result) {}
+
+        protected:
+            void draw(const Matrix4& transformationMatrix, Camera3D&) override {
+                result = transformationMatrix;
+            }
+
+        private:
+            Matrix4& result;
+    };
+
+    DrawableGroup3D group;
+    Scene3D scene;
+
+    Object3D* first = new Object3D{scene};
+    Matrix4 firstTransformation;
+    first->setTransformation(Matrix4::scaling(Vector3(5.0f)));
+    new Drawable(*first, &group, firstTransformation);
+
+    Object3D* second = new Object3D{scene};
+    Matrix4 secondTransformation;
+    second->setTransformation(Matrix4::translation(Vector3::yAxis(3.0f)));
+    new Drawable(*second, &group, secondTransformation);
+
+    Object3D* third = new Object3D{scene, second};
+    Matrix4 thirdTransformation;
+    third->setTransformation(Matrix4::translation(Vector3::zAxis(-1.5f)));
+    new Drawable(*third, &group, thirdTransformation);
+
+    Camera3D camera(*third);
+    camera.draw(group);
+
+    CORRADE_COMPARE(firstTransformation, Matrix4::translation({0.0f, -3.0f, 1.5f})*Matrix4::scaling(Vector3(5.0f)));
+    CORRADE_COMPARE(secondTransformation, Matrix4::translation(Vector3::zAxis(1.5f)));
+    CORRADE_COMPARE(thirdTransformation, Matrix4());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::FlatSceneTest)
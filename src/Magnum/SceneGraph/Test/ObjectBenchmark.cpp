@@ -0,0 +1,101 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/Test/BenchmarkTimer.h"
+
+namespace Magnum { namespace SceneGraph { namespace Test {
+
+struct ObjectBenchmark: TestSuite::Tester {
+    explicit ObjectBenchmark();
+
+    void transformations10k();
+    void transformations100k();
+    void transformations1M();
+    void transformations1MThreads1();
+    void transformations1MThreads2();
+    void transformations1MThreads4();
+    void transformations1MThreads8();
+
+    private:
+        void transformations(std::size_t count, UnsignedInt threadCount = 1);
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+ObjectBenchmark::ObjectBenchmark() {
+    addTests({&ObjectBenchmark::transformations10k,
+              &ObjectBenchmark::transformations100k,
+              &ObjectBenchmark::transformations1M,
+              &ObjectBenchmark::transformations1MThreads1,
+              &ObjectBenchmark::transformations1MThreads2,
+              &ObjectBenchmark::transformations1MThreads4,
+              &ObjectBenchmark::transformations1MThreads8});
+}
+
+void ObjectBenchmark::transformations10k() { transformations(10000); }
+void ObjectBenchmark::transformations100k() { transformations(100000); }
+void ObjectBenchmark::transformations1M() { transformations(1000000); }
+void ObjectBenchmark::transformations1MThreads1() { transformations(1000000, 1); }
+void ObjectBenchmark::transformations1MThreads2() { transformations(1000000, 2); }
+void ObjectBenchmark::transformations1MThreads4() { transformations(1000000, 4); }
+void ObjectBenchmark::transformations1MThreads8() { transformations(1000000, 8); }
+
+void ObjectBenchmark::transformations(const std::size_t count, const UnsignedInt threadCount) {
+    /* Scene with groups of 16 objects, each group having another group as a
+       parent, so there are joints on all levels of the hierarchy */
+    Scene3D scene;
+    scene.setThreadCount(threadCount);
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    objects.reserve(count);
+    Object3D* parent = &scene;
+    for(std::size_t i = 0; i != count; ++i) {
+        Object3D* o = new Object3D{parent};
+        o->translate(Vector3::xAxis(1.0f));
+        objects.push_back(*o);
+
+        if(i % 16 == 0) parent = &objects[i/2].get();
+    }
+
+    /* Take the best of a few runs */
+    std::vector<Matrix4> transformations;
+    Magnum::Test::BenchmarkTimer timer;
+    for(std::size_t i = 0; i != 5; ++i) timer.measure([&]() {
+        transformations = scene.transformations(objects);
+    });
+
+    CORRADE_COMPARE(transformations.size(), count);
+    CORRADE_COMPARE(transformations.front(), Matrix4::translation(Vector3::xAxis(1.0f)));
+
+    Debug() << "   " << count << "objects," << threadCount << "threads:" << timer.microseconds() << "us,"
+        << timer.nanoseconds()/count << "ns per object";
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneGraph::Test::ObjectBenchmark)
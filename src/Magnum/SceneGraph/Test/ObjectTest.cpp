@@ -23,6 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <algorithm>
+#include <cstring>
 #include <sstream>
 #include <Corrade/TestSuite/Tester.h>
 
@@ -45,6 +47,8 @@ struct ObjectTest: TestSuite::Tester {
     void transformationsRelative();
     void transformationsOrphan();
     void transformationsDuplicate();
+    void transformationsLarge();
+    void transformationsParallel();
     void setClean();
     void setCleanListHierarchy();
     void setCleanListBulk();
@@ -82,6 +86,8 @@ ObjectTest::ObjectTest() {
               &ObjectTest::transformationsRelative,
               &ObjectTest::transformationsOrphan,
               &ObjectTest::transformationsDuplicate,
+              &ObjectTest::transformationsLarge,
+              &ObjectTest::transformationsParallel,
               &ObjectTest::setClean,
               &ObjectTest::setCleanListHierarchy,
               &ObjectTest::setCleanListBulk,
@@ -304,6 +310,73 @@ void ObjectTest::transformationsDuplicate() {
     }));
 }
 
+void ObjectTest::transformationsLarge() {
+    /* More objects than what fits into 16 bits, in a deep hierarchy */
+    Scene3D s;
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    Object3D* parent = &s;
+    for(std::size_t i = 0; i != 70000; ++i) {
+        Object3D* o = new Object3D{parent};
+        o->translate(Vector3::xAxis(1.0f));
+        objects.push_back(*o);
+
+        /* Every fourth object branches the hierarchy further */
+        if(i % 4 == 0) parent = o;
+    }
+
+    /* Request them in reverse order and some of them twice */
+    std::reverse(objects.begin(), objects.end());
+    objects.push_back(objects[69999]);
+    objects.push_back(objects[0]);
+
+    std::vector<Matrix4> transformations = s.transformations(objects);
+    CORRADE_COMPARE(transformations.size(), 70002);
+    CORRADE_COMPARE(transformations[69999], Matrix4::translation(Vector3::xAxis(1.0f)));
+    CORRADE_COMPARE(transformations[69998], Matrix4::translation(Vector3::xAxis(2.0f)));
+    CORRADE_COMPARE(transformations[0], Matrix4::translation(Vector3::xAxis(17501.0f)));
+    CORRADE_COMPARE(transformations[70000], transformations[69999]);
+    CORRADE_COMPARE(transformations[70001], transformations[0]);
+}
+
+void ObjectTest::transformationsParallel() {
+    /* Wide and deep hierarchy with non-trivial transformations, so any
+       difference in the order of operations would show up in the result */
+    Scene3D s;
+    std::vector<std::reference_wrapper<Object3D>> objects;
+    for(std::size_t i = 0; i != 400000; ++i) {
+        Object3D* o = new Object3D{i < 8 ? static_cast<Object3D*>(&s) : &objects[(i*7919) % i].get()};
+        o->rotateY(Deg(Float(i % 360)))
+          .translate({0.1f*(i % 13), 1.0f, -0.3f*(i % 7)})
+          .scale(Vector3{1.0f + 0.001f*(i % 17)});
+        objects.push_back(*o);
+    }
+
+    /* Request only a subset of them and some of them twice. There has to be
+       enough of them to be split between more than one thread. */
+    std::vector<std::reference_wrapper<Object3D>> requested;
+    for(std::size_t i = 0; i < objects.size(); i += 2) requested.push_back(objects[i]);
+    requested.push_back(objects[4]);
+    requested.push_back(objects[399998]);
+
+    const Matrix4 initial = Matrix4::rotationX(Deg(35.0f));
+    const std::vector<Matrix4> serial = s.transformations(requested, initial);
+
+    s.setThreadCount(4);
+    CORRADE_COMPARE(s.threadCount(), 4);
+    const std::vector<Matrix4> parallel = s.transformations(requested, initial);
+
+    /* The results should be bit-identical */
+    CORRADE_COMPARE(parallel.size(), serial.size());
+    CORRADE_VERIFY(std::memcmp(parallel.data(), serial.data(), serial.size()*sizeof(Matrix4)) == 0);
+    CORRADE_COMPARE(parallel[0], initial*objects[0].get().absoluteTransformationMatrix());
+    CORRADE_COMPARE(parallel[parallel.size() - 2], parallel[2]);
+
+    /* All marks are cleaned, so the computation can be done again */
+    s.setThreadCount(0);
+    const std::vector<Matrix4> parallelAgain = s.transformations(requested, initial);
+    CORRADE_VERIFY(std::memcmp(parallelAgain.data(), serial.data(), serial.size()*sizeof(Matrix4)) == 0);
+}
+
 void ObjectTest::setClean() {
     Scene3D scene;
 
@@ -33,8 +33,13 @@
 
 namespace Magnum { namespace Shapes {
 
-template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float>(object, group) {
+template<UnsignedInt dimensions> AbstractShape<dimensions>::AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group): SceneGraph::AbstractGroupedFeature<dimensions, AbstractShape<dimensions>, Float>(object, group), _boundsDirty(true) {
     SceneGraph::AbstractFeature<dimensions, Float>::setCachedTransformations(SceneGraph::CachedTransformation::Absolute);
+    if(group) group->setDirty();
+}
+
+template<UnsignedInt dimensions> AbstractShape<dimensions>::~AbstractShape() {
+    if(group()) group()->setDirty();
 }
 
 template<UnsignedInt dimensions> ShapeGroup<dimensions>* AbstractShape<dimensions>::group() {
@@ -58,6 +63,7 @@ template<UnsignedInt dimensions> Collision<dimensions> AbstractShape<dimensions>
 }
 
 template<UnsignedInt dimensions> void AbstractShape<dimensions>::markDirty() {
+    _boundsDirty = true;
     if(group()) group()->setDirty();
 }
 
@@ -57,6 +57,7 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
     /* Otherwise it complains that this is not a function */
     template<UnsignedInt dimensions_> friend const Implementation::AbstractShape<dimensions_>& Implementation::getAbstractShape(const Shapes::AbstractShape<dimensions_>&);
     #endif
+    friend ShapeGroup<dimensions>;
 
     public:
         enum: UnsignedInt {
@@ -87,6 +88,13 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
          */
         explicit AbstractShape(SceneGraph::AbstractObject<dimensions, Float>& object, ShapeGroup<dimensions>* group = nullptr);
 
+        /**
+         * @brief Destructor
+         *
+         * Marks the group as dirty.
+         */
+        ~AbstractShape();
+
         /**
          * @brief Shape group containing this shape
          *
@@ -118,6 +126,9 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AbstractShape: publi
 
     private:
         virtual const Implementation::AbstractShape<dimensions> MAGNUM_SHAPES_LOCAL & abstractTransformedShape() const = 0;
+
+        /* Whether the bounding box cached in the group needs to be updated */
+        bool _boundsDirty;
 };
 
 /** @brief Base class for two-dimensional object shapes */
@@ -41,6 +41,11 @@ template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(cons
            (other.position() < _max).all();
 }
 
+template<UnsignedInt dimensions> bool AxisAlignedBox<dimensions>::operator%(const AxisAlignedBox<dimensions>& other) const {
+    return (other._min < _max).all() &&
+           (other._max > _min).all();
+}
+
 #ifndef DOXYGEN_GENERATING_OUTPUT
 template class MAGNUM_SHAPES_EXPORT AxisAlignedBox<2>;
 template class MAGNUM_SHAPES_EXPORT AxisAlignedBox<3>;
@@ -85,6 +85,9 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AxisAlignedBox {
         /** @brief Collision occurence with point */
         bool operator%(const Point<dimensions>& other) const;
 
+        /** @brief Collision occurence with another axis-aligned box */
+        bool operator%(const AxisAlignedBox<dimensions>& other) const;
+
     private:
         VectorTypeFor<dimensions, Float> _min, _max;
 };
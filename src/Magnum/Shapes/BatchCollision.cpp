@@ -0,0 +1,323 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BatchCollision.h"
+
+#include <algorithm>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define MAGNUM_SHAPES_BATCH_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace Magnum { namespace Shapes {
+
+template<UnsignedInt dimensions> PointBatch<dimensions>::PointBatch(const std::initializer_list<Containers::ArrayView<const Float>> positions) {
+    CORRADE_ASSERT(positions.size() == dimensions,
+        "Shapes::PointBatch::PointBatch(): expected" << dimensions << "position arrays but got" << positions.size(), );
+    std::copy(positions.begin(), positions.end(), _positions);
+    for(UnsignedInt i = 1; i != dimensions; ++i)
+        CORRADE_ASSERT(_positions[i].size() == _positions[0].size(),
+            "Shapes::PointBatch::PointBatch(): position arrays have different size", );
+}
+
+template<UnsignedInt dimensions> SphereBatch<dimensions>::SphereBatch(const std::initializer_list<Containers::ArrayView<const Float>> positions, const Containers::ArrayView<const Float> radii): _radii{radii} {
+    CORRADE_ASSERT(positions.size() == dimensions,
+        "Shapes::SphereBatch::SphereBatch(): expected" << dimensions << "position arrays but got" << positions.size(), );
+    std::copy(positions.begin(), positions.end(), _positions);
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        CORRADE_ASSERT(_positions[i].size() == radii.size(),
+            "Shapes::SphereBatch::SphereBatch(): position and radius arrays have different size", );
+}
+
+template<UnsignedInt dimensions> AxisAlignedBoxBatch<dimensions>::AxisAlignedBoxBatch(const std::initializer_list<Containers::ArrayView<const Float>> min, const std::initializer_list<Containers::ArrayView<const Float>> max) {
+    CORRADE_ASSERT(min.size() == dimensions && max.size() == dimensions,
+        "Shapes::AxisAlignedBoxBatch::AxisAlignedBoxBatch(): expected" << dimensions << "minimal and maximal coordinate arrays but got" << min.size() << "and" << max.size(), );
+    std::copy(min.begin(), min.end(), _min);
+    std::copy(max.begin(), max.end(), _max);
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        CORRADE_ASSERT(_min[i].size() == _min[0].size() && _max[i].size() == _min[0].size(),
+            "Shapes::AxisAlignedBoxBatch::AxisAlignedBoxBatch(): coordinate arrays have different size", );
+}
+
+namespace {
+
+/* Operations on a single value */
+struct ScalarLanes {
+    enum: std::size_t { Size = 1 };
+
+    typedef Float Type;
+    typedef bool Mask;
+
+    static Type load(const Float* data) { return *data; }
+    static Type splat(Float value) { return value; }
+    static Type add(Type a, Type b) { return a + b; }
+    static Type sub(Type a, Type b) { return a - b; }
+    static Type mul(Type a, Type b) { return a*b; }
+    static Mask lessThan(Type a, Type b) { return a < b; }
+    static Mask lessOrEqual(Type a, Type b) { return a <= b; }
+    static Mask both(Mask a, Mask b) { return a && b; }
+    static UnsignedInt bits(Mask mask) { return mask; }
+};
+
+#ifdef MAGNUM_SHAPES_BATCH_SSE
+/* Operations on four values at once */
+struct SseLanes {
+    enum: std::size_t { Size = 4 };
+
+    typedef __m128 Type;
+    typedef __m128 Mask;
+
+    static Type load(const Float* data) { return _mm_loadu_ps(data); }
+    static Type splat(Float value) { return _mm_set1_ps(value); }
+    static Type add(Type a, Type b) { return _mm_add_ps(a, b); }
+    static Type sub(Type a, Type b) { return _mm_sub_ps(a, b); }
+    static Type mul(Type a, Type b) { return _mm_mul_ps(a, b); }
+    static Mask lessThan(Type a, Type b) { return _mm_cmplt_ps(a, b); }
+    static Mask lessOrEqual(Type a, Type b) { return _mm_cmple_ps(a, b); }
+    static Mask both(Mask a, Mask b) { return _mm_and_ps(a, b); }
+    static UnsignedInt bits(Mask mask) { return _mm_movemask_ps(mask); }
+};
+
+typedef SseLanes VectorLanes;
+#else
+typedef ScalarLanes VectorLanes;
+#endif
+
+/* Squared distance of given point and i-th point in the batch */
+template<class Lanes, UnsignedInt dimensions> inline typename Lanes::Type distanceSquared(const VectorTypeFor<dimensions, Float>& position, const Containers::ArrayView<const Float>(&positions)[dimensions], const std::size_t i) {
+    typename Lanes::Type out = Lanes::splat(0.0f);
+    for(UnsignedInt j = 0; j != dimensions; ++j) {
+        const typename Lanes::Type d = Lanes::sub(Lanes::splat(position[j]), Lanes::load(positions[j].data() + i));
+        out = Lanes::add(out, Lanes::mul(d, d));
+    }
+    return out;
+}
+
+template<UnsignedInt dimensions> struct SpherePoints {
+    template<class Lanes> typename Lanes::Mask test(std::size_t i) const {
+        return Lanes::lessThan(distanceSquared<Lanes, dimensions>(position, positions, i), Lanes::splat(radiusSquared));
+    }
+
+    VectorTypeFor<dimensions, Float> position;
+    Float radiusSquared;
+    Containers::ArrayView<const Float> positions[dimensions];
+};
+
+template<UnsignedInt dimensions> struct SphereSpheres {
+    template<class Lanes> typename Lanes::Mask test(std::size_t i) const {
+        const typename Lanes::Type r = Lanes::add(Lanes::splat(radius), Lanes::load(radii.data() + i));
+        return Lanes::lessThan(distanceSquared<Lanes, dimensions>(position, positions, i), Lanes::mul(r, r));
+    }
+
+    VectorTypeFor<dimensions, Float> position;
+    Float radius;
+    Containers::ArrayView<const Float> positions[dimensions];
+    Containers::ArrayView<const Float> radii;
+};
+
+template<UnsignedInt dimensions> struct PointSpheres {
+    template<class Lanes> typename Lanes::Mask test(std::size_t i) const {
+        const typename Lanes::Type r = Lanes::load(radii.data() + i);
+        return Lanes::lessThan(distanceSquared<Lanes, dimensions>(position, positions, i), Lanes::mul(r, r));
+    }
+
+    VectorTypeFor<dimensions, Float> position;
+    Containers::ArrayView<const Float> positions[dimensions];
+    Containers::ArrayView<const Float> radii;
+};
+
+template<UnsignedInt dimensions> struct BoxPoints {
+    template<class Lanes> typename Lanes::Mask test(std::size_t i) const {
+        typename Lanes::Mask out = test<Lanes>(i, 0);
+        for(UnsignedInt j = 1; j != dimensions; ++j)
+            out = Lanes::both(out, test<Lanes>(i, j));
+        return out;
+    }
+
+    template<class Lanes> typename Lanes::Mask test(std::size_t i, UnsignedInt j) const {
+        const typename Lanes::Type p = Lanes::load(positions[j].data() + i);
+        return Lanes::both(Lanes::lessOrEqual(Lanes::splat(min[j]), p),
+                           Lanes::lessThan(p, Lanes::splat(max[j])));
+    }
+
+    VectorTypeFor<dimensions, Float> min, max;
+    Containers::ArrayView<const Float> positions[dimensions];
+};
+
+template<UnsignedInt dimensions> struct PointBoxes {
+    template<class Lanes> typename Lanes::Mask test(std::size_t i) const {
+        typename Lanes::Mask out = test<Lanes>(i, 0);
+        for(UnsignedInt j = 1; j != dimensions; ++j)
+            out = Lanes::both(out, test<Lanes>(i, j));
+        return out;
+    }
+
+    template<class Lanes> typename Lanes::Mask test(std::size_t i, UnsignedInt j) const {
+        const typename Lanes::Type p = Lanes::splat(position[j]);
+        return Lanes::both(Lanes::lessOrEqual(Lanes::load(min[j].data() + i), p),
+                           Lanes::lessThan(p, Lanes::load(max[j].data() + i)));
+    }
+
+    VectorTypeFor<dimensions, Float> position;
+    Containers::ArrayView<const Float> min[dimensions], max[dimensions];
+};
+
+template<UnsignedInt dimensions> struct BoxBoxes {
+    template<class Lanes> typename Lanes::Mask test(std::size_t i) const {
+        typename Lanes::Mask out = test<Lanes>(i, 0);
+        for(UnsignedInt j = 1; j != dimensions; ++j)
+            out = Lanes::both(out, test<Lanes>(i, j));
+        return out;
+    }
+
+    template<class Lanes> typename Lanes::Mask test(std::size_t i, UnsignedInt j) const {
+        return Lanes::both(Lanes::lessThan(Lanes::load(boxesMin[j].data() + i), Lanes::splat(max[j])),
+                           Lanes::lessThan(Lanes::splat(min[j]), Lanes::load(boxesMax[j].data() + i)));
+    }
+
+    VectorTypeFor<dimensions, Float> min, max;
+    Containers::ArrayView<const Float> boxesMin[dimensions], boxesMax[dimensions];
+};
+
+/* Runs the test on groups of eight shapes, producing one byte of the mask at
+   a time. The remaining shapes are tested one by one. */
+template<class Test> std::size_t collidesBatch(const char* const function, const Test& test, const std::size_t count, const Containers::ArrayView<UnsignedByte> hits) {
+    CORRADE_ASSERT(hits.size() >= (count + 7)/8,
+        function << "expected at least" << (count + 7)/8 << "bytes for the hit mask but got" << hits.size(), 0);
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(function);
+    #endif
+
+    std::size_t hitCount = 0;
+    std::size_t i = 0;
+    for(; i + 8 <= count; i += 8) {
+        UnsignedInt byte = 0;
+        for(std::size_t j = 0; j != 8; j += VectorLanes::Size)
+            byte |= VectorLanes::bits(test.template test<VectorLanes>(i + j)) << j;
+        hits[i/8] = byte;
+        for(; byte; byte &= byte - 1) ++hitCount;
+    }
+
+    if(i != count) {
+        UnsignedInt byte = 0;
+        for(std::size_t j = 0; i + j != count; ++j)
+            byte |= ScalarLanes::bits(test.template test<ScalarLanes>(i + j)) << j;
+        hits[i/8] = byte;
+        for(; byte; byte &= byte - 1) ++hitCount;
+    }
+
+    return hitCount;
+}
+
+}
+
+template<UnsignedInt dimensions> std::size_t collides(const Sphere<dimensions>& sphere, const PointBatch<dimensions>& points, const Containers::ArrayView<UnsignedByte> hits) {
+    SpherePoints<dimensions> test;
+    test.position = sphere.position();
+    test.radiusSquared = Math::pow<2>(sphere.radius());
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        test.positions[i] = points.positions(i);
+    return collidesBatch("Shapes::collides():", test, points.size(), hits);
+}
+
+template<UnsignedInt dimensions> std::size_t collides(const Sphere<dimensions>& sphere, const SphereBatch<dimensions>& spheres, const Containers::ArrayView<UnsignedByte> hits) {
+    SphereSpheres<dimensions> test;
+    test.position = sphere.position();
+    test.radius = sphere.radius();
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        test.positions[i] = spheres.positions(i);
+    test.radii = spheres.radii();
+    return collidesBatch("Shapes::collides():", test, spheres.size(), hits);
+}
+
+template<UnsignedInt dimensions> std::size_t collides(const Point<dimensions>& point, const SphereBatch<dimensions>& spheres, const Containers::ArrayView<UnsignedByte> hits) {
+    PointSpheres<dimensions> test;
+    test.position = point.position();
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        test.positions[i] = spheres.positions(i);
+    test.radii = spheres.radii();
+    return collidesBatch("Shapes::collides():", test, spheres.size(), hits);
+}
+
+template<UnsignedInt dimensions> std::size_t collides(const AxisAlignedBox<dimensions>& box, const PointBatch<dimensions>& points, const Containers::ArrayView<UnsignedByte> hits) {
+    BoxPoints<dimensions> test;
+    test.min = box.min();
+    test.max = box.max();
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        test.positions[i] = points.positions(i);
+    return collidesBatch("Shapes::collides():", test, points.size(), hits);
+}
+
+template<UnsignedInt dimensions> std::size_t collides(const Point<dimensions>& point, const AxisAlignedBoxBatch<dimensions>& boxes, const Containers::ArrayView<UnsignedByte> hits) {
+    PointBoxes<dimensions> test;
+    test.position = point.position();
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        test.min[i] = boxes.min(i);
+        test.max[i] = boxes.max(i);
+    }
+    return collidesBatch("Shapes::collides():", test, boxes.size(), hits);
+}
+
+template<UnsignedInt dimensions> std::size_t collides(const AxisAlignedBox<dimensions>& box, const AxisAlignedBoxBatch<dimensions>& boxes, const Containers::ArrayView<UnsignedByte> hits) {
+    BoxBoxes<dimensions> test;
+    test.min = box.min();
+    test.max = box.max();
+    for(UnsignedInt i = 0; i != dimensions; ++i) {
+        test.boxesMin[i] = boxes.min(i);
+        test.boxesMax[i] = boxes.max(i);
+    }
+    return collidesBatch("Shapes::collides():", test, boxes.size(), hits);
+}
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template class MAGNUM_SHAPES_EXPORT PointBatch<2>;
+template class MAGNUM_SHAPES_EXPORT PointBatch<3>;
+template class MAGNUM_SHAPES_EXPORT SphereBatch<2>;
+template class MAGNUM_SHAPES_EXPORT SphereBatch<3>;
+template class MAGNUM_SHAPES_EXPORT AxisAlignedBoxBatch<2>;
+template class MAGNUM_SHAPES_EXPORT AxisAlignedBoxBatch<3>;
+
+template MAGNUM_SHAPES_EXPORT std::size_t collides(const Sphere<2>&, const PointBatch<2>&, Containers::ArrayView<UnsignedByte>);
+template MAGNUM_SHAPES_EXPORT std::size_t collides(const Sphere<3>&, const PointBatch<3>&, Containers::ArrayView<UnsignedByte>);
+template MAGNUM_SHAPES_EXPORT std::size_t collides(const Sphere<2>&, const SphereBatch<2>&, Containers::ArrayView<UnsignedByte>);
+template MAGNUM_SHAPES_EXPORT std::size_t collides(const Sphere<3>&, const SphereBatch<3>&, Containers::ArrayView<UnsignedByte>);
+template MAGNUM_SHAPES_EXPORT std::size_t collides(const Point<2>&, const SphereBatch<2>&, Containers::ArrayView<UnsignedByte>);
+template MAGNUM_SHAPES_EXPORT std::size_t collides(const Point<3>&, const SphereBatch<3>&, Containers::ArrayView<UnsignedByte>);
+template MAGNUM_SHAPES_EXPORT std::size_t collides(const AxisAlignedBox<2>&, const PointBatch<2>&, Containers::ArrayView<UnsignedByte>);
+template MAGNUM_SHAPES_EXPORT std::size_t collides(const AxisAlignedBox<3>&, const PointBatch<3>&, Containers::ArrayView<UnsignedByte>);
+template MAGNUM_SHAPES_EXPORT std::size_t collides(const Point<2>&, const AxisAlignedBoxBatch<2>&, Containers::ArrayView<UnsignedByte>);
+template MAGNUM_SHAPES_EXPORT std::size_t collides(const Point<3>&, const AxisAlignedBoxBatch<3>&, Containers::ArrayView<UnsignedByte>);
+template MAGNUM_SHAPES_EXPORT std::size_t collides(const AxisAlignedBox<2>&, const AxisAlignedBoxBatch<2>&, Containers::ArrayView<UnsignedByte>);
+template MAGNUM_SHAPES_EXPORT std::size_t collides(const AxisAlignedBox<3>&, const AxisAlignedBoxBatch<3>&, Containers::ArrayView<UnsignedByte>);
+#endif
+
+}}
@@ -0,0 +1,235 @@
+#ifndef Magnum_Shapes_BatchCollision_h
+#define Magnum_Shapes_BatchCollision_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Shapes::PointBatch, @ref Magnum::Shapes::SphereBatch, @ref Magnum::Shapes::AxisAlignedBoxBatch, typedef @ref Magnum::Shapes::PointBatch2D, @ref Magnum::Shapes::PointBatch3D, @ref Magnum::Shapes::SphereBatch2D, @ref Magnum::Shapes::SphereBatch3D, @ref Magnum::Shapes::AxisAlignedBoxBatch2D, @ref Magnum::Shapes::AxisAlignedBoxBatch3D, function @ref Magnum::Shapes::collides()
+ */
+
+#include <initializer_list>
+#include <Corrade/Containers/ArrayView.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Shapes/Shapes.h"
+#include "Magnum/Shapes/visibility.h"
+
+namespace Magnum { namespace Shapes {
+
+/**
+@brief Batch of points
+
+Non-owning structure-of-arrays view on point positions, with one array for
+each coordinate. Used for testing collisions of a single shape with many
+points at once, see @ref collides(const Sphere<dimensions>&, const PointBatch<dimensions>&, Containers::ArrayView<UnsignedByte>)
+for more information.
+@see @ref PointBatch2D, @ref PointBatch3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT PointBatch {
+    public:
+        enum: UnsignedInt {
+            Dimensions = dimensions /**< Dimension count */
+        };
+
+        /**
+         * @brief Constructor
+         * @param positions     Position coordinates, one array for each
+         *      dimension
+         *
+         * Expects that there is one array for each dimension and all arrays
+         * have the same size.
+         */
+        explicit PointBatch(std::initializer_list<Containers::ArrayView<const Float>> positions);
+
+        /** @brief Point count */
+        std::size_t size() const { return _positions[0].size(); }
+
+        /** @brief Position coordinates in given dimension */
+        Containers::ArrayView<const Float> positions(UnsignedInt dimension) const {
+            return _positions[dimension];
+        }
+
+    private:
+        Containers::ArrayView<const Float> _positions[dimensions];
+};
+
+/** @brief Batch of two-dimensional points */
+typedef PointBatch<2> PointBatch2D;
+
+/** @brief Batch of three-dimensional points */
+typedef PointBatch<3> PointBatch3D;
+
+/**
+@brief Batch of spheres
+
+Non-owning structure-of-arrays view on sphere positions and radii, with one
+array for each coordinate. See @ref PointBatch for more information.
+@see @ref SphereBatch2D, @ref SphereBatch3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT SphereBatch {
+    public:
+        enum: UnsignedInt {
+            Dimensions = dimensions /**< Dimension count */
+        };
+
+        /**
+         * @brief Constructor
+         * @param positions     Position coordinates, one array for each
+         *      dimension
+         * @param radii         Radii
+         *
+         * Expects that there is one position array for each dimension and
+         * all arrays have the same size.
+         */
+        explicit SphereBatch(std::initializer_list<Containers::ArrayView<const Float>> positions, Containers::ArrayView<const Float> radii);
+
+        /** @brief Sphere count */
+        std::size_t size() const { return _radii.size(); }
+
+        /** @brief Position coordinates in given dimension */
+        Containers::ArrayView<const Float> positions(UnsignedInt dimension) const {
+            return _positions[dimension];
+        }
+
+        /** @brief Radii */
+        Containers::ArrayView<const Float> radii() const { return _radii; }
+
+    private:
+        Containers::ArrayView<const Float> _positions[dimensions];
+        Containers::ArrayView<const Float> _radii;
+};
+
+/** @brief Batch of two-dimensional spheres */
+typedef SphereBatch<2> SphereBatch2D;
+
+/** @brief Batch of three-dimensional spheres */
+typedef SphereBatch<3> SphereBatch3D;
+
+/**
+@brief Batch of axis-aligned boxes
+
+Non-owning structure-of-arrays view on minimal and maximal box coordinates,
+with one array for each coordinate. See @ref PointBatch for more information.
+@see @ref AxisAlignedBoxBatch2D, @ref AxisAlignedBoxBatch3D
+*/
+template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT AxisAlignedBoxBatch {
+    public:
+        enum: UnsignedInt {
+            Dimensions = dimensions /**< Dimension count */
+        };
+
+        /**
+         * @brief Constructor
+         * @param min       Minimal coordinates, one array for each dimension
+         * @param max       Maximal coordinates, one array for each dimension
+         *
+         * Expects that there is one array of minimal and maximal coordinates
+         * for each dimension and all arrays have the same size.
+         */
+        explicit AxisAlignedBoxBatch(std::initializer_list<Containers::ArrayView<const Float>> min, std::initializer_list<Containers::ArrayView<const Float>> max);
+
+        /** @brief Box count */
+        std::size_t size() const { return _min[0].size(); }
+
+        /** @brief Minimal coordinates in given dimension */
+        Containers::ArrayView<const Float> min(UnsignedInt dimension) const {
+            return _min[dimension];
+        }
+
+        /** @brief Maximal coordinates in given dimension */
+        Containers::ArrayView<const Float> max(UnsignedInt dimension) const {
+            return _max[dimension];
+        }
+
+    private:
+        Containers::ArrayView<const Float> _min[dimensions],
+            _max[dimensions];
+};
+
+/** @brief Batch of two-dimensional axis-aligned boxes */
+typedef AxisAlignedBoxBatch<2> AxisAlignedBoxBatch2D;
+
+/** @brief Batch of three-dimensional axis-aligned boxes */
+typedef AxisAlignedBoxBatch<3> AxisAlignedBoxBatch3D;
+
+/**
+@brief Collision occurence of a sphere with a batch of points
+@param sphere   Sphere
+@param points   Batch of points
+@param hits     Hit bitmask
+@return Count of colliding points
+
+Bit `i % 8` of byte `i / 8` in @p hits is set if the sphere collides with
+point `i`, the result being the same as with
+@ref Sphere::operator%(const Point<dimensions>&) const. Unused bits in the
+last byte are set to zero. Expects that @p hits is large enough to hold a bit
+for each point. On x86 the tests are done on four shapes at once using SSE
+instructions.
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT std::size_t collides(const Sphere<dimensions>& sphere, const PointBatch<dimensions>& points, Containers::ArrayView<UnsignedByte> hits);
+
+/**
+@brief Collision occurence of a sphere with a batch of spheres
+
+See @ref collides(const Sphere<dimensions>&, const PointBatch<dimensions>&, Containers::ArrayView<UnsignedByte>)
+for more information.
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT std::size_t collides(const Sphere<dimensions>& sphere, const SphereBatch<dimensions>& spheres, Containers::ArrayView<UnsignedByte> hits);
+
+/**
+@brief Collision occurence of a point with a batch of spheres
+
+See @ref collides(const Sphere<dimensions>&, const PointBatch<dimensions>&, Containers::ArrayView<UnsignedByte>)
+for more information.
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT std::size_t collides(const Point<dimensions>& point, const SphereBatch<dimensions>& spheres, Containers::ArrayView<UnsignedByte> hits);
+
+/**
+@brief Collision occurence of an axis-aligned box with a batch of points
+
+See @ref collides(const Sphere<dimensions>&, const PointBatch<dimensions>&, Containers::ArrayView<UnsignedByte>)
+for more information.
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT std::size_t collides(const AxisAlignedBox<dimensions>& box, const PointBatch<dimensions>& points, Containers::ArrayView<UnsignedByte> hits);
+
+/**
+@brief Collision occurence of a point with a batch of axis-aligned boxes
+
+See @ref collides(const Sphere<dimensions>&, const PointBatch<dimensions>&, Containers::ArrayView<UnsignedByte>)
+for more information.
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT std::size_t collides(const Point<dimensions>& point, const AxisAlignedBoxBatch<dimensions>& boxes, Containers::ArrayView<UnsignedByte> hits);
+
+/**
+@brief Collision occurence of an axis-aligned box with a batch of axis-aligned boxes
+
+See @ref collides(const Sphere<dimensions>&, const PointBatch<dimensions>&, Containers::ArrayView<UnsignedByte>)
+for more information.
+*/
+template<UnsignedInt dimensions> MAGNUM_SHAPES_EXPORT std::size_t collides(const AxisAlignedBox<dimensions>& box, const AxisAlignedBoxBatch<dimensions>& boxes, Containers::ArrayView<UnsignedByte> hits);
+
+}}
+
+#endif
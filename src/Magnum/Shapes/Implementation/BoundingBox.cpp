@@ -0,0 +1,98 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "BoundingBox.h"
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Box.h"
+#include "Magnum/Shapes/Capsule.h"
+#include "Magnum/Shapes/LineSegment.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
+#include "Magnum/Shapes/shapeImplementation.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+template<UnsignedInt dimensions> bool boundingBox(const AbstractShape<dimensions>& shape, RangeTypeFor<dimensions, Float>& box) {
+    typedef typename ShapeDimensionTraits<dimensions>::Type Type;
+    typedef VectorTypeFor<dimensions, Float> VectorType;
+
+    switch(shape.type()) {
+        case Type::Point: {
+            const Point<dimensions>& point = static_cast<const Shape<Point<dimensions>>&>(shape).shape;
+            box = {point.position(), point.position()};
+            return true;
+        }
+
+        case Type::LineSegment: {
+            const LineSegment<dimensions>& segment = static_cast<const Shape<LineSegment<dimensions>>&>(shape).shape;
+            box = {Math::min(segment.a(), segment.b()), Math::max(segment.a(), segment.b())};
+            return true;
+        }
+
+        case Type::Sphere: {
+            const Sphere<dimensions>& sphere = static_cast<const Shape<Sphere<dimensions>>&>(shape).shape;
+            box = {sphere.position() - VectorType(sphere.radius()),
+                   sphere.position() + VectorType(sphere.radius())};
+            return true;
+        }
+
+        case Type::Capsule: {
+            const Capsule<dimensions>& capsule = static_cast<const Shape<Capsule<dimensions>>&>(shape).shape;
+            box = {Math::min(capsule.a(), capsule.b()) - VectorType(capsule.radius()),
+                   Math::max(capsule.a(), capsule.b()) + VectorType(capsule.radius())};
+            return true;
+        }
+
+        case Type::AxisAlignedBox: {
+            /* The transformed box might have the coordinates swapped */
+            const AxisAlignedBox<dimensions>& aab = static_cast<const Shape<AxisAlignedBox<dimensions>>&>(shape).shape;
+            box = {Math::min(aab.min(), aab.max()), Math::max(aab.min(), aab.max())};
+            return true;
+        }
+
+        case Type::Box: {
+            /* Unit box, so the half extent in given axis is sum of absolute
+               values of the corresponding row of the rotation/scaling part */
+            const MatrixTypeFor<dimensions, Float> transformation = static_cast<const Shape<Box<dimensions>>&>(shape).shape.transformation();
+            const auto rotationScaling = transformation.rotationScaling();
+            VectorType halfExtent;
+            for(std::size_t i = 0; i != dimensions; ++i)
+                halfExtent += Math::abs(rotationScaling[i]);
+            box = {transformation.translation() - halfExtent,
+                   transformation.translation() + halfExtent};
+            return true;
+        }
+
+        default: return false;
+    }
+}
+
+template bool boundingBox(const AbstractShape<2>&, Range2D&);
+template bool boundingBox(const AbstractShape<3>&, Range3D&);
+
+}}}
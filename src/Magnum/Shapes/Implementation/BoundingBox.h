@@ -0,0 +1,46 @@
+#ifndef Magnum_Shapes_Implementation_BoundingBox_h
+#define Magnum_Shapes_Implementation_BoundingBox_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Shapes { namespace Implementation {
+
+template<UnsignedInt> struct AbstractShape;
+
+/*
+Axis-aligned bounding box of a shape, used by the ShapeGroup broad-phase.
+Returns false if the shape is unbounded (lines, planes, cylinders, inverted
+spheres) or if the bounds are not known (compositions, as the NOT operation
+makes them unbounded), in which case the shape needs to be tested against
+all others.
+*/
+template<UnsignedInt dimensions> bool boundingBox(const AbstractShape<dimensions>& shape, RangeTypeFor<dimensions, Float>& box);
+
+}}}
+
+#endif
@@ -59,6 +59,7 @@ template<> bool collides(const AbstractShape<2>& a, const AbstractShape<2>& b) {
         _c(Capsule, Capsule2D, Sphere, Sphere2D)
 
         _c(AxisAlignedBox, AxisAlignedBox2D, Point, Point2D)
+        _c(AxisAlignedBox, AxisAlignedBox2D, AxisAlignedBox, AxisAlignedBox2D)
         #undef _c
     }
 
@@ -102,6 +103,7 @@ template<> bool collides(const AbstractShape<3>& a, const AbstractShape<3>& b) {
         _c(Capsule, Capsule3D, Sphere, Sphere3D)
 
         _c(AxisAlignedBox, AxisAlignedBox3D, Point, Point3D)
+        _c(AxisAlignedBox, AxisAlignedBox3D, AxisAlignedBox, AxisAlignedBox3D)
 
         _c(Plane, Plane, Line, Line3D)
         _c(Plane, Plane, LineSegment, LineSegment3D)
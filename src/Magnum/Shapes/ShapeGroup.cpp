@@ -25,31 +25,192 @@
 
 #include "ShapeGroup.h"
 
+#include <algorithm>
+
 #include "Magnum/Shapes/AbstractShape.h"
+#include "Magnum/Shapes/Implementation/BoundingBox.h"
 
 namespace Magnum { namespace Shapes {
 
+namespace {
+    template<class T> inline bool overlaps(const T& a, const T& b) {
+        for(std::size_t i = 0; i != T::VectorType::Size; ++i)
+            if(a.min()[i] > b.max()[i] || b.min()[i] > a.max()[i]) return false;
+        return true;
+    }
+}
+
+template<UnsignedInt dimensions> ShapeGroup<dimensions>& ShapeGroup<dimensions>::add(AbstractShape<dimensions>& shape) {
+    if(shape.group()) shape.group()->setDirty();
+    SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float>::add(shape);
+    dirty = true;
+    return *this;
+}
+
+template<UnsignedInt dimensions> ShapeGroup<dimensions>& ShapeGroup<dimensions>::remove(AbstractShape<dimensions>& shape) {
+    SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float>::remove(shape);
+    dirty = true;
+    return *this;
+}
+
 template<UnsignedInt dimensions> void ShapeGroup<dimensions>::setClean() {
+    /* Shapes mark the group dirty when they change or are added or removed.
+       Shapes added or removed through the base FeatureGroup interface don't,
+       so compare the membership with the snapshot from last time. */
+    if(!dirty && _shapes.size() == this->size()) {
+        std::size_t i = 0;
+        while(i != _shapes.size() && _shapes[i] == &(*this)[i]) ++i;
+        if(i == _shapes.size()) return;
+    }
+
     /* Clean all objects */
     if(!this->isEmpty()) {
-        std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>> objects;
-        objects.reserve(this->size());
+        _objects.clear();
+        _objects.reserve(this->size());
         for(std::size_t i = 0; i != this->size(); ++i)
-            objects.push_back((*this)[i].object());
+            _objects.push_back((*this)[i].object());
 
-        SceneGraph::AbstractObject<dimensions, Float>::setClean(objects);
+        SceneGraph::AbstractObject<dimensions, Float>::setClean(_objects);
     }
 
+    updateBounds();
     dirty = false;
 }
 
+template<UnsignedInt dimensions> void ShapeGroup<dimensions>::updateBounds() {
+    /* Shapes can be added to or removed from the group without making it
+       dirty, so compare with the snapshot from last time. If anything
+       changed, the sorted list is rebuilt from scratch. */
+    const std::size_t count = this->size();
+    bool rebuild = count != _shapes.size();
+    _shapes.resize(count);
+    _bounds.resize(count);
+    _bounded.resize(count);
+
+    /* Update bounds of shapes that changed */
+    for(std::size_t i = 0; i != count; ++i) {
+        AbstractShape<dimensions>& shape = (*this)[i];
+        if(_shapes[i] != &shape) {
+            _shapes[i] = &shape;
+            shape._boundsDirty = true;
+            rebuild = true;
+        }
+
+        if(!shape._boundsDirty) continue;
+
+        const bool bounded = Implementation::boundingBox(Implementation::getAbstractShape(shape), _bounds[i]);
+        if(bounded != _bounded[i]) rebuild = true;
+        _bounded[i] = bounded;
+        shape._boundsDirty = false;
+    }
+
+    const auto minX = [this](UnsignedInt i) { return _bounds[i].min()[0]; };
+
+    if(rebuild) {
+        _sorted.clear();
+        _unbounded.clear();
+        for(std::size_t i = 0; i != count; ++i)
+            (_bounded[i] ? _sorted : _unbounded).push_back(i);
+
+        std::sort(_sorted.begin(), _sorted.end(), [&minX](UnsignedInt a, UnsignedInt b) {
+            return minX(a) < minX(b);
+        });
+
+    /* Between two frames the objects usually move only a little, so the list
+       is nearly sorted and insertion sort is close to linear */
+    } else for(std::size_t i = 1; i < _sorted.size(); ++i) {
+        const UnsignedInt id = _sorted[i];
+        const Float x = minX(id);
+        std::size_t j = i;
+        for(; j && minX(_sorted[j - 1]) > x; --j)
+            _sorted[j] = _sorted[j - 1];
+        _sorted[j] = id;
+    }
+
+    /* Copy of the bounds in sorted order for cache-friendly sweeping */
+    _sortedBounds.resize(_sorted.size());
+    _maxExtent = 0.0f;
+    for(std::size_t i = 0; i != _sorted.size(); ++i) {
+        const RangeTypeFor<dimensions, Float>& bounds = _bounds[_sorted[i]];
+        _sortedBounds[i] = bounds;
+        _maxExtent = std::max(_maxExtent, bounds.max()[0] - bounds.min()[0]);
+    }
+}
+
 template<UnsignedInt dimensions> AbstractShape<dimensions>* ShapeGroup<dimensions>::firstCollision(const AbstractShape<dimensions>& shape) {
     setClean();
-    for(std::size_t i = 0; i != this->size(); ++i)
-        if(&(*this)[i] != &shape && (*this)[i].collides(shape))
-            return &(*this)[i];
 
-    return nullptr;
+    /* Unbounded shape, test against everything */
+    RangeTypeFor<dimensions, Float> bounds;
+    if(!Implementation::boundingBox(Implementation::getAbstractShape(shape), bounds)) {
+        for(std::size_t i = 0; i != this->size(); ++i)
+            if(&(*this)[i] != &shape && (*this)[i].collides(shape))
+                return &(*this)[i];
+
+        return nullptr;
+    }
+
+    /* Test all unbounded shapes and bounded shapes whose bounding box
+       overlaps. Keep the lowest ID to return the same shape as a linear
+       search would. */
+    std::size_t found = this->size();
+    for(UnsignedInt i: _unbounded) {
+        if(i >= found) break;
+        if(_shapes[i] != &shape && _shapes[i]->collides(shape)) found = i;
+    }
+
+    /* Shapes with min X in range [bounds.min - maxExtent, bounds.max] can
+       overlap the bounding box */
+    const Float minX = bounds.min()[0] - _maxExtent;
+    for(std::size_t a = std::lower_bound(_sortedBounds.begin(), _sortedBounds.end(), minX, [](const RangeTypeFor<dimensions, Float>& b, Float x) {
+            return b.min()[0] < x;
+        }) - _sortedBounds.begin(); a != _sortedBounds.size() && _sortedBounds[a].min()[0] <= bounds.max()[0]; ++a) {
+        const UnsignedInt i = _sorted[a];
+        if(i >= found || _shapes[i] == &shape || !overlaps(_sortedBounds[a], bounds)) continue;
+        if(_shapes[i]->collides(shape)) found = i;
+    }
+
+    return found == this->size() ? nullptr : _shapes[found];
+}
+
+template<UnsignedInt dimensions> std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> ShapeGroup<dimensions>::allCollisions() {
+    setClean();
+
+    std::vector<std::pair<UnsignedInt, UnsignedInt>> ids;
+
+    /* Sweep and prune over bounded shapes. Sweep along X until the next
+       shape starts after the current one ends. */
+    for(std::size_t a = 0; a != _sorted.size(); ++a) {
+        const RangeTypeFor<dimensions, Float>& bounds = _sortedBounds[a];
+        for(std::size_t b = a + 1; b != _sorted.size(); ++b) {
+            if(_sortedBounds[b].min()[0] > bounds.max()[0]) break;
+            if(!overlaps(bounds, _sortedBounds[b])) continue;
+
+            const UnsignedInt i = _sorted[a];
+            const UnsignedInt j = _sorted[b];
+            if(_shapes[i]->collides(*_shapes[j]))
+                ids.emplace_back(std::min(i, j), std::max(i, j));
+        }
+    }
+
+    /* Unbounded shapes against everything, testing each unbounded pair only
+       once */
+    for(UnsignedInt i: _unbounded) {
+        for(UnsignedInt j = 0; j != _shapes.size(); ++j) {
+            if(j == i || (!_bounded[j] && j < i)) continue;
+            if(_shapes[i]->collides(*_shapes[j]))
+                ids.emplace_back(std::min(i, j), std::max(i, j));
+        }
+    }
+
+    std::sort(ids.begin(), ids.end());
+
+    std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> collisions;
+    collisions.reserve(ids.size());
+    for(const std::pair<UnsignedInt, UnsignedInt>& id: ids)
+        collisions.emplace_back(_shapes[id.first], _shapes[id.second]);
+
+    return collisions;
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -29,8 +29,11 @@
  * @brief Class @ref Magnum::Shapes::ShapeGroup, typedef @ref Magnum::Shapes::ShapeGroup2D, @ref Magnum::Shapes::ShapeGroup3D
  */
 
+#include <utility>
 #include <vector>
 
+#include "Magnum/DimensionTraits.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/SceneGraph/FeatureGroup.h"
 #include "Magnum/Shapes/AbstractShape.h"
 #include "Magnum/Shapes/visibility.h"
@@ -41,6 +44,18 @@ namespace Magnum { namespace Shapes {
 @brief Group of shapes
 
 See @ref Shape for more information. See @ref shapes for brief introduction.
+
+@section ShapeGroup-broad-phase Broad-phase collision detection
+
+The group keeps axis-aligned bounding boxes of all its shapes sorted along the
+X axis. The bounds and the order are updated incrementally in @ref setClean()
+--- only shapes whose transformation or shape changed since last time have
+their bounds recomputed and, thanks to temporal coherence, re-sorting the
+nearly-sorted list is cheap. Both @ref firstCollision() and
+@ref allCollisions() then do the exact (narrow-phase) test only on shapes
+whose bounding boxes overlap. Shapes without finite bounds (lines, planes,
+cylinders, inverted spheres) and shape compositions are always tested against
+everything.
 @see @ref scenegraph, @ref ShapeGroup2D, @ref ShapeGroup3D
 */
 template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public SceneGraph::FeatureGroup<dimensions, AbstractShape<dimensions>, Float> {
@@ -52,7 +67,7 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          *
          * Marks the group as dirty.
          */
-        explicit ShapeGroup(): dirty(true) {}
+        explicit ShapeGroup(): dirty(true), _maxExtent(0.0f) {}
 
         /**
          * @brief Whether the group is dirty
@@ -70,11 +85,34 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          */
         void setDirty() { dirty = true; }
 
+        /**
+         * @brief Add shape to the group
+         * @return Reference to self (for method chaining)
+         *
+         * Marks the group and the group the shape was previously part of as
+         * dirty.
+         * @see @ref SceneGraph::FeatureGroup::add()
+         */
+        ShapeGroup<dimensions>& add(AbstractShape<dimensions>& shape);
+
+        /**
+         * @brief Remove shape from the group
+         * @return Reference to self (for method chaining)
+         *
+         * Marks the group as dirty.
+         * @see @ref SceneGraph::FeatureGroup::remove()
+         */
+        ShapeGroup<dimensions>& remove(AbstractShape<dimensions>& shape);
+
         /**
          * @brief Set the group and all bodies as clean
          *
          * This function is called before computing any collisions to ensure
-         * all objects are cleaned.
+         * all objects are cleaned. Also updates bounding boxes of changed
+         * shapes for the broad-phase collision detection. If the group is not
+         * dirty and no shapes were added or removed through the base
+         * @ref SceneGraph::FeatureGroup interface since the last call, the
+         * function does nothing.
          */
         void setClean();
 
@@ -87,8 +125,35 @@ template<UnsignedInt dimensions> class MAGNUM_SHAPES_EXPORT ShapeGroup: public S
          */
         AbstractShape<dimensions>* firstCollision(const AbstractShape<dimensions>& shape);
 
+        /**
+         * @brief All collisions between shapes in the group
+         *
+         * Returns all pairs of colliding shapes in the group. Each pair is
+         * reported only once, the shape added to the group earlier is always
+         * first and the pairs are ordered by position of the shapes in the
+         * group. Calls @ref setClean() before the operation.
+         * @see @ref AbstractShape::collides()
+         */
+        std::vector<std::pair<AbstractShape<dimensions>*, AbstractShape<dimensions>*>> allCollisions();
+
     private:
+        void MAGNUM_SHAPES_LOCAL updateBounds();
+
         bool dirty;
+
+        /* Objects of all shapes, kept to avoid allocation in setClean() */
+        std::vector<std::reference_wrapper<SceneGraph::AbstractObject<dimensions, Float>>> _objects;
+
+        /* Broad-phase state. Shapes as they were in the group during last
+           setClean(), their bounding boxes, the same bounding boxes in
+           sorted order, IDs of bounded shapes sorted by minimal X
+           coordinate, IDs of unbounded shapes and maximal X extent of all
+           bounding boxes */
+        std::vector<AbstractShape<dimensions>*> _shapes;
+        std::vector<RangeTypeFor<dimensions, Float>> _bounds, _sortedBounds;
+        std::vector<bool> _bounded;
+        std::vector<UnsignedInt> _sorted, _unbounded;
+        Float _maxExtent;
 };
 
 /**
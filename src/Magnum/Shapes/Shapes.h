@@ -42,6 +42,10 @@ template<UnsignedInt> class AxisAlignedBox;
 typedef AxisAlignedBox<2> AxisAlignedBox2D;
 typedef AxisAlignedBox<3> AxisAlignedBox3D;
 
+template<UnsignedInt> class AxisAlignedBoxBatch;
+typedef AxisAlignedBoxBatch<2> AxisAlignedBoxBatch2D;
+typedef AxisAlignedBoxBatch<3> AxisAlignedBoxBatch3D;
+
 template<UnsignedInt> class Box;
 typedef Box<2> Box2D;
 typedef Box<3> Box3D;
@@ -80,6 +84,10 @@ template<UnsignedInt> class Sphere;
 typedef Sphere<2> Sphere2D;
 typedef Sphere<3> Sphere3D;
 
+template<UnsignedInt> class SphereBatch;
+typedef SphereBatch<2> SphereBatch2D;
+typedef SphereBatch<3> SphereBatch3D;
+
 template<UnsignedInt> class InvertedSphere;
 typedef InvertedSphere<2> InvertedSphere2D;
 typedef InvertedSphere<3> InvertedSphere3D;
@@ -89,6 +97,10 @@ class Plane;
 template<UnsignedInt> class Point;
 typedef Point<2> Point2D;
 typedef Point<3> Point3D;
+
+template<UnsignedInt> class PointBatch;
+typedef PointBatch<2> PointBatch2D;
+typedef PointBatch<3> PointBatch3D;
 #endif
 
 }}
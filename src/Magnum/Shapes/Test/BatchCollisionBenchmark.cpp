@@ -0,0 +1,167 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <random>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/BatchCollision.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
+#include "Magnum/Test/BenchmarkTimer.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+struct BatchCollisionBenchmark: TestSuite::Tester {
+    explicit BatchCollisionBenchmark();
+
+    void sphereSpheres();
+    void sphereSpheresBatch();
+    void boxBoxes();
+    void boxBoxesBatch();
+};
+
+BatchCollisionBenchmark::BatchCollisionBenchmark() {
+    addTests({&BatchCollisionBenchmark::sphereSpheres,
+              &BatchCollisionBenchmark::sphereSpheresBatch,
+              &BatchCollisionBenchmark::boxBoxes,
+              &BatchCollisionBenchmark::boxBoxesBatch});
+}
+
+namespace {
+    constexpr std::size_t Count = 1000000;
+
+    std::vector<Float> randomValues(std::mt19937& generator, Float min, Float max) {
+        std::uniform_real_distribution<Float> distribution{min, max};
+        std::vector<Float> out(Count);
+        for(Float& i: out) i = distribution(generator);
+        return out;
+    }
+
+    /* Runs the function a few times and prints the best time */
+    template<class F> std::size_t measure(const char* name, F f) {
+        std::size_t hitCount = 0;
+        Magnum::Test::BenchmarkTimer timer;
+        for(std::size_t i = 0; i != 5; ++i)
+            timer.measure([&]() { hitCount = f(); });
+
+        Debug() << "   " << name << timer.microseconds() << "us,"
+            << timer.nanoseconds()/Count << "ns per shape," << hitCount << "hits";
+        return hitCount;
+    }
+}
+
+void BatchCollisionBenchmark::sphereSpheres() {
+    std::mt19937 generator;
+    std::vector<Sphere3D> spheres;
+    spheres.reserve(Count);
+    const std::vector<Float> x = randomValues(generator, -100.0f, 100.0f),
+        y = randomValues(generator, -100.0f, 100.0f),
+        z = randomValues(generator, -100.0f, 100.0f),
+        r = randomValues(generator, 0.5f, 2.0f);
+    for(std::size_t i = 0; i != Count; ++i)
+        spheres.emplace_back(Vector3{x[i], y[i], z[i]}, r[i]);
+
+    const Sphere3D sphere{{}, 50.0f};
+    std::vector<bool> hits(Count);
+    const std::size_t hitCount = measure("1M spheres, one by one:", [&]() {
+        std::size_t count = 0;
+        for(std::size_t i = 0; i != Count; ++i)
+            count += (hits[i] = sphere % spheres[i]);
+        return count;
+    });
+
+    CORRADE_VERIFY(hitCount > 0);
+}
+
+void BatchCollisionBenchmark::sphereSpheresBatch() {
+    std::mt19937 generator;
+    const std::vector<Float> x = randomValues(generator, -100.0f, 100.0f),
+        y = randomValues(generator, -100.0f, 100.0f),
+        z = randomValues(generator, -100.0f, 100.0f),
+        r = randomValues(generator, 0.5f, 2.0f);
+    const SphereBatch3D spheres{{{x.data(), Count}, {y.data(), Count}, {z.data(), Count}}, {r.data(), Count}};
+
+    const Sphere3D sphere{{}, 50.0f};
+    std::vector<UnsignedByte> hits((Count + 7)/8);
+    const std::size_t hitCount = measure("1M spheres, batch:", [&]() {
+        return collides(sphere, spheres, {hits.data(), hits.size()});
+    });
+
+    CORRADE_VERIFY(hitCount > 0);
+}
+
+void BatchCollisionBenchmark::boxBoxes() {
+    std::mt19937 generator;
+    std::vector<AxisAlignedBox3D> boxes;
+    boxes.reserve(Count);
+    const std::vector<Float> x = randomValues(generator, -100.0f, 100.0f),
+        y = randomValues(generator, -100.0f, 100.0f),
+        z = randomValues(generator, -100.0f, 100.0f),
+        s = randomValues(generator, 0.5f, 2.0f);
+    for(std::size_t i = 0; i != Count; ++i)
+        boxes.emplace_back(Vector3{x[i], y[i], z[i]}, Vector3{x[i] + s[i], y[i] + s[i], z[i] + s[i]});
+
+    const AxisAlignedBox3D box{Vector3{-50.0f}, Vector3{50.0f}};
+    std::vector<bool> hits(Count);
+    const std::size_t hitCount = measure("1M boxes, one by one:", [&]() {
+        std::size_t count = 0;
+        for(std::size_t i = 0; i != Count; ++i)
+            count += (hits[i] = box % boxes[i]);
+        return count;
+    });
+
+    CORRADE_VERIFY(hitCount > 0);
+}
+
+void BatchCollisionBenchmark::boxBoxesBatch() {
+    std::mt19937 generator;
+    const std::vector<Float> x = randomValues(generator, -100.0f, 100.0f),
+        y = randomValues(generator, -100.0f, 100.0f),
+        z = randomValues(generator, -100.0f, 100.0f),
+        s = randomValues(generator, 0.5f, 2.0f);
+    std::vector<Float> maxX(Count), maxY(Count), maxZ(Count);
+    for(std::size_t i = 0; i != Count; ++i) {
+        maxX[i] = x[i] + s[i];
+        maxY[i] = y[i] + s[i];
+        maxZ[i] = z[i] + s[i];
+    }
+    const AxisAlignedBoxBatch3D boxes{
+        {{x.data(), Count}, {y.data(), Count}, {z.data(), Count}},
+        {{maxX.data(), Count}, {maxY.data(), Count}, {maxZ.data(), Count}}};
+
+    const AxisAlignedBox3D box{Vector3{-50.0f}, Vector3{50.0f}};
+    std::vector<UnsignedByte> hits((Count + 7)/8);
+    const std::size_t hitCount = measure("1M boxes, batch:", [&]() {
+        return collides(box, boxes, {hits.data(), hits.size()});
+    });
+
+    CORRADE_VERIFY(hitCount > 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::BatchCollisionBenchmark)
@@ -0,0 +1,229 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/BatchCollision.h"
+#include "Magnum/Shapes/Point.h"
+#include "Magnum/Shapes/Sphere.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+struct BatchCollisionTest: TestSuite::Tester {
+    explicit BatchCollisionTest();
+
+    void spherePoints();
+    void sphereSpheres();
+    void pointSpheres();
+    void boxPoints();
+    void pointBoxes();
+    void boxBoxes();
+    void boxBoxes2D();
+    void empty();
+};
+
+BatchCollisionTest::BatchCollisionTest() {
+    addTests({&BatchCollisionTest::spherePoints,
+              &BatchCollisionTest::sphereSpheres,
+              &BatchCollisionTest::pointSpheres,
+              &BatchCollisionTest::boxPoints,
+              &BatchCollisionTest::pointBoxes,
+              &BatchCollisionTest::boxBoxes,
+              &BatchCollisionTest::boxBoxes2D,
+              &BatchCollisionTest::empty});
+}
+
+namespace {
+    /* Count not divisible by eight to test also the remainder. Coordinates
+       are from a small set of values so the boundary cases are hit too. */
+    constexpr std::size_t Count = 67;
+
+    Float value(std::size_t i, std::size_t seed) {
+        constexpr Float values[]{-2.0f, -1.5f, -1.0f, -0.5f, 0.0f, 0.5f, 1.0f, 1.5f, 2.0f};
+        return values[(i*(seed*2 + 7) + seed*3) % 9];
+    }
+
+    std::vector<Float> values(std::size_t seed) {
+        std::vector<Float> out(Count);
+        for(std::size_t i = 0; i != Count; ++i) out[i] = value(i, seed);
+        return out;
+    }
+
+    Containers::ArrayView<const Float> view(const std::vector<Float>& data) {
+        return {data.data(), data.size()};
+    }
+
+    bool hit(const std::vector<UnsignedByte>& hits, std::size_t i) {
+        return hits[i/8] & (1 << (i%8));
+    }
+}
+
+void BatchCollisionTest::spherePoints() {
+    const std::vector<Float> x = values(0), y = values(1), z = values(2);
+    const Shapes::Sphere3D sphere{{0.5f, 0.0f, -0.5f}, 1.5f};
+
+    std::vector<UnsignedByte> hits((Count + 7)/8);
+    const std::size_t count = collides(sphere, Shapes::PointBatch3D{{view(x), view(y), view(z)}}, {hits.data(), hits.size()});
+
+    std::size_t expected = 0;
+    for(std::size_t i = 0; i != Count; ++i) {
+        const bool collides = sphere % Shapes::Point3D{{x[i], y[i], z[i]}};
+        CORRADE_COMPARE(hit(hits, i), collides);
+        expected += collides;
+    }
+    CORRADE_COMPARE(count, expected);
+    CORRADE_VERIFY(count > 0 && count < Count);
+
+    /* Unused bits are zero */
+    CORRADE_COMPARE(hits.back() >> (Count % 8), 0);
+}
+
+void BatchCollisionTest::sphereSpheres() {
+    const std::vector<Float> x = values(0), y = values(1), z = values(2), r = values(3);
+    std::vector<Float> radii;
+    for(Float v: r) radii.push_back(Math::abs(v));
+    const Shapes::Sphere3D sphere{{0.5f, 0.0f, -0.5f}, 0.5f};
+
+    std::vector<UnsignedByte> hits((Count + 7)/8);
+    const std::size_t count = collides(sphere, Shapes::SphereBatch3D{{view(x), view(y), view(z)}, view(radii)}, {hits.data(), hits.size()});
+
+    std::size_t expected = 0;
+    for(std::size_t i = 0; i != Count; ++i) {
+        const bool collides = sphere % Shapes::Sphere3D{{x[i], y[i], z[i]}, radii[i]};
+        CORRADE_COMPARE(hit(hits, i), collides);
+        expected += collides;
+    }
+    CORRADE_COMPARE(count, expected);
+    CORRADE_VERIFY(count > 0 && count < Count);
+}
+
+void BatchCollisionTest::pointSpheres() {
+    const std::vector<Float> x = values(0), y = values(1), z = values(2), r = values(3);
+    std::vector<Float> radii;
+    for(Float v: r) radii.push_back(Math::abs(v));
+    const Shapes::Point3D point{{0.5f, 0.0f, -0.5f}};
+
+    std::vector<UnsignedByte> hits((Count + 7)/8);
+    const std::size_t count = collides(point, Shapes::SphereBatch3D{{view(x), view(y), view(z)}, view(radii)}, {hits.data(), hits.size()});
+
+    std::size_t expected = 0;
+    for(std::size_t i = 0; i != Count; ++i) {
+        const bool collides = point % Shapes::Sphere3D{{x[i], y[i], z[i]}, radii[i]};
+        CORRADE_COMPARE(hit(hits, i), collides);
+        expected += collides;
+    }
+    CORRADE_COMPARE(count, expected);
+    CORRADE_VERIFY(count > 0 && count < Count);
+}
+
+void BatchCollisionTest::boxPoints() {
+    const std::vector<Float> x = values(0), y = values(1), z = values(2);
+    const Shapes::AxisAlignedBox3D box{{-1.0f, -1.5f, -0.5f}, {1.0f, 2.0f, 1.5f}};
+
+    std::vector<UnsignedByte> hits((Count + 7)/8);
+    const std::size_t count = collides(box, Shapes::PointBatch3D{{view(x), view(y), view(z)}}, {hits.data(), hits.size()});
+
+    std::size_t expected = 0;
+    for(std::size_t i = 0; i != Count; ++i) {
+        const bool collides = box % Shapes::Point3D{{x[i], y[i], z[i]}};
+        CORRADE_COMPARE(hit(hits, i), collides);
+        expected += collides;
+    }
+    CORRADE_COMPARE(count, expected);
+    CORRADE_VERIFY(count > 0 && count < Count);
+}
+
+void BatchCollisionTest::pointBoxes() {
+    const std::vector<Float> x = values(0), y = values(1), z = values(2),
+        sx = values(3), sy = values(4), sz = values(5);
+    std::vector<Float> maxX, maxY, maxZ;
+    for(std::size_t i = 0; i != Count; ++i) {
+        maxX.push_back(x[i] + Math::abs(sx[i]));
+        maxY.push_back(y[i] + Math::abs(sy[i]));
+        maxZ.push_back(z[i] + Math::abs(sz[i]));
+    }
+    const Shapes::Point3D point{{0.5f, 0.0f, -0.5f}};
+
+    std::vector<UnsignedByte> hits((Count + 7)/8);
+    const std::size_t count = collides(point, Shapes::AxisAlignedBoxBatch3D{{view(x), view(y), view(z)}, {view(maxX), view(maxY), view(maxZ)}}, {hits.data(), hits.size()});
+
+    std::size_t expected = 0;
+    for(std::size_t i = 0; i != Count; ++i) {
+        const bool collides = point % Shapes::AxisAlignedBox3D{{x[i], y[i], z[i]}, {maxX[i], maxY[i], maxZ[i]}};
+        CORRADE_COMPARE(hit(hits, i), collides);
+        expected += collides;
+    }
+    CORRADE_COMPARE(count, expected);
+    CORRADE_VERIFY(count > 0 && count < Count);
+}
+
+void BatchCollisionTest::boxBoxes() {
+    const std::vector<Float> x = values(0), y = values(1), z = values(2),
+        sx = values(3), sy = values(4), sz = values(5);
+    std::vector<Float> maxX, maxY, maxZ;
+    for(std::size_t i = 0; i != Count; ++i) {
+        maxX.push_back(x[i] + Math::abs(sx[i]));
+        maxY.push_back(y[i] + Math::abs(sy[i]));
+        maxZ.push_back(z[i] + Math::abs(sz[i]));
+    }
+    const Shapes::AxisAlignedBox3D box{{-0.5f, -1.0f, -0.5f}, {1.0f, 0.5f, 1.5f}};
+
+    std::vector<UnsignedByte> hits((Count + 7)/8);
+    const std::size_t count = collides(box, Shapes::AxisAlignedBoxBatch3D{{view(x), view(y), view(z)}, {view(maxX), view(maxY), view(maxZ)}}, {hits.data(), hits.size()});
+
+    std::size_t expected = 0;
+    for(std::size_t i = 0; i != Count; ++i) {
+        const bool collides = box % Shapes::AxisAlignedBox3D{{x[i], y[i], z[i]}, {maxX[i], maxY[i], maxZ[i]}};
+        CORRADE_COMPARE(hit(hits, i), collides);
+        expected += collides;
+    }
+    CORRADE_COMPARE(count, expected);
+    CORRADE_VERIFY(count > 0 && count < Count);
+}
+
+void BatchCollisionTest::boxBoxes2D() {
+    const Float minX[]{-1.0f, 1.0f, 0.5f, -3.0f, 0.0f, 0.25f, -0.5f, 2.0f, 0.0f};
+    const Float minY[]{-1.0f, 0.0f, 0.5f, -3.0f, 1.0f, 0.25f, -0.5f, 0.0f, 0.0f};
+    const Float maxX[]{ 0.5f, 2.0f, 1.5f, -2.0f, 0.5f, 0.75f,  0.0f, 3.0f, 1.0f};
+    const Float maxY[]{ 0.5f, 1.0f, 1.5f, -2.0f, 2.0f, 0.75f,  0.0f, 1.0f, 1.0f};
+    const Shapes::AxisAlignedBox2D box{{0.0f, 0.0f}, {1.0f, 1.0f}};
+
+    UnsignedByte hits[2];
+    CORRADE_COMPARE(collides(box, Shapes::AxisAlignedBoxBatch2D{{minX, minY}, {maxX, maxY}}, hits), 4);
+    CORRADE_COMPARE(hits[0], 0x25);
+    CORRADE_COMPARE(hits[1], 0x01);
+}
+
+void BatchCollisionTest::empty() {
+    const Shapes::Sphere2D sphere{{}, 1.0f};
+    CORRADE_COMPARE(collides(sphere, Shapes::PointBatch2D{{nullptr, nullptr}}, nullptr), 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::BatchCollisionTest)
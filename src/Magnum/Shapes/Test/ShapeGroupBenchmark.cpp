@@ -0,0 +1,142 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <random>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Shapes/AxisAlignedBox.h"
+#include "Magnum/Shapes/Shape.h"
+#include "Magnum/Shapes/ShapeGroup.h"
+#include "Magnum/Shapes/Sphere.h"
+#include "Magnum/SceneGraph/MatrixTransformation3D.h"
+#include "Magnum/SceneGraph/Scene.h"
+#include "Magnum/Test/BenchmarkTimer.h"
+
+namespace Magnum { namespace Shapes { namespace Test {
+
+struct ShapeGroupBenchmark: TestSuite::Tester {
+    explicit ShapeGroupBenchmark();
+
+    void spheres1k();
+    void spheres10k();
+    void spheres100k();
+    void spheresNaive1k();
+    void spheresNaive10k();
+
+    void boxes1k();
+    void boxes10k();
+    void boxes100k();
+    void boxesNaive1k();
+    void boxesNaive10k();
+
+    private:
+        template<class T> void allCollisions(std::size_t count, bool naive);
+};
+
+typedef SceneGraph::Object<SceneGraph::MatrixTransformation3D> Object3D;
+typedef SceneGraph::Scene<SceneGraph::MatrixTransformation3D> Scene3D;
+
+ShapeGroupBenchmark::ShapeGroupBenchmark() {
+    addTests({&ShapeGroupBenchmark::spheres1k,
+              &ShapeGroupBenchmark::spheres10k,
+              &ShapeGroupBenchmark::spheres100k,
+              &ShapeGroupBenchmark::spheresNaive1k,
+              &ShapeGroupBenchmark::spheresNaive10k,
+
+              &ShapeGroupBenchmark::boxes1k,
+              &ShapeGroupBenchmark::boxes10k,
+              &ShapeGroupBenchmark::boxes100k,
+              &ShapeGroupBenchmark::boxesNaive1k,
+              &ShapeGroupBenchmark::boxesNaive10k});
+}
+
+void ShapeGroupBenchmark::spheres1k() { allCollisions<Sphere3D>(1000, false); }
+void ShapeGroupBenchmark::spheres10k() { allCollisions<Sphere3D>(10000, false); }
+void ShapeGroupBenchmark::spheres100k() { allCollisions<Sphere3D>(100000, false); }
+void ShapeGroupBenchmark::spheresNaive1k() { allCollisions<Sphere3D>(1000, true); }
+void ShapeGroupBenchmark::spheresNaive10k() { allCollisions<Sphere3D>(10000, true); }
+
+void ShapeGroupBenchmark::boxes1k() { allCollisions<AxisAlignedBox3D>(1000, false); }
+void ShapeGroupBenchmark::boxes10k() { allCollisions<AxisAlignedBox3D>(10000, false); }
+void ShapeGroupBenchmark::boxes100k() { allCollisions<AxisAlignedBox3D>(100000, false); }
+void ShapeGroupBenchmark::boxesNaive1k() { allCollisions<AxisAlignedBox3D>(1000, true); }
+void ShapeGroupBenchmark::boxesNaive10k() { allCollisions<AxisAlignedBox3D>(10000, true); }
+
+namespace {
+    template<class T> struct UnitShape;
+    template<> struct UnitShape<Sphere3D> {
+        static Sphere3D get() { return {{}, 0.5f}; }
+    };
+    template<> struct UnitShape<AxisAlignedBox3D> {
+        static AxisAlignedBox3D get() { return {Vector3(-0.5f), Vector3(0.5f)}; }
+    };
+}
+
+template<class T> void ShapeGroupBenchmark::allCollisions(const std::size_t count, const bool naive) {
+    /* Unit shapes randomly placed in a cube with size chosen so there's a
+       constant amount of collisions per shape */
+    std::mt19937 generator;
+    std::uniform_real_distribution<Float> distribution{0.0f, std::cbrt(Float(count))*2.0f};
+    std::uniform_real_distribution<Float> step{-0.05f, 0.05f};
+    Scene3D scene;
+    ShapeGroup3D shapes;
+    std::vector<Object3D*> objects;
+    objects.reserve(count);
+    for(std::size_t i = 0; i != count; ++i) {
+        Object3D* o = new Object3D{&scene};
+        o->translate({distribution(generator), distribution(generator), distribution(generator)});
+        new Shape<T>{*o, UnitShape<T>::get(), &shapes};
+        objects.push_back(o);
+    }
+
+    /* Take the best of a few runs, moving all objects a bit every time to
+       simulate a frame update */
+    std::size_t collisionCount = 0;
+    Magnum::Test::BenchmarkTimer timer;
+    for(std::size_t i = 0; i != 5; ++i) {
+        for(Object3D* o: objects)
+            o->translate({step(generator), step(generator), step(generator)});
+
+        timer.start();
+        if(naive) {
+            shapes.setClean();
+            collisionCount = 0;
+            for(std::size_t a = 0; a != shapes.size(); ++a)
+                for(std::size_t b = a + 1; b != shapes.size(); ++b)
+                    if(shapes[a].collides(shapes[b])) ++collisionCount;
+        } else collisionCount = shapes.allCollisions().size();
+        timer.stop();
+    }
+
+    /* Verify that the broad phase doesn't miss anything */
+    if(naive) CORRADE_COMPARE(shapes.allCollisions().size(), collisionCount);
+
+    Debug() << "   " << count << (naive ? "shapes, all pairs:" : "shapes, broad-phase:") << timer.microseconds() << "us," << collisionCount << "collisions";
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Shapes::Test::ShapeGroupBenchmark)
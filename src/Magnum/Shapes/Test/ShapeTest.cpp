@@ -25,7 +25,10 @@
 
 #include <Corrade/TestSuite/Tester.h>
 
+#include "Magnum/Shapes/AxisAlignedBox.h"
 #include "Magnum/Shapes/Composition.h"
+#include "Magnum/Shapes/Cylinder.h"
+#include "Magnum/Shapes/Line.h"
 #include "Magnum/Shapes/Point.h"
 #include "Magnum/Shapes/Shape.h"
 #include "Magnum/Shapes/ShapeGroup.h"
@@ -43,6 +46,11 @@ struct ShapeTest: TestSuite::Tester {
     void collides();
     void collision();
     void firstCollision();
+    void firstCollisionUnbounded();
+    void allCollisions();
+    void allCollisionsUnbounded();
+    void allCollisionsIncremental();
+    void allCollisionsFeatureGroup();
     void shapeGroup();
 };
 
@@ -56,6 +64,11 @@ ShapeTest::ShapeTest() {
               &ShapeTest::collides,
               &ShapeTest::collision,
               &ShapeTest::firstCollision,
+              &ShapeTest::firstCollisionUnbounded,
+              &ShapeTest::allCollisions,
+              &ShapeTest::allCollisionsUnbounded,
+              &ShapeTest::allCollisionsIncremental,
+              &ShapeTest::allCollisionsFeatureGroup,
               &ShapeTest::shapeGroup});
 }
 
@@ -206,6 +219,190 @@ void ShapeTest::firstCollision() {
     CORRADE_VERIFY(!shapes.isDirty());
 }
 
+void ShapeTest::firstCollisionUnbounded() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{1.0f, -2.0f, 3.0f}, 1.5f}, &shapes);
+
+    Object3D b(&scene);
+    Shape<Shapes::Sphere3D> bShape(b, {{25.0f, -2.0f, 3.0f}, 1.5f}, &shapes);
+
+    Object3D c(&scene);
+    Shape<Shapes::Line3D> cShape(c, {{0.0f, -2.0f, 3.0f}, {1.0f, -2.0f, 3.0f}}, &shapes);
+
+    /* The line is infinite, so it goes through both spheres. The earlier
+       shape is returned. */
+    CORRADE_VERIFY(shapes.firstCollision(cShape) == &aShape);
+    CORRADE_VERIFY(shapes.firstCollision(bShape) == &cShape);
+
+    /* Move the line away */
+    c.translate(Vector3::yAxis(10.0f));
+    CORRADE_VERIFY(!shapes.firstCollision(cShape));
+    CORRADE_VERIFY(!shapes.firstCollision(bShape));
+}
+
+void ShapeTest::allCollisions() {
+    Scene2D scene;
+    ShapeGroup2D shapes;
+
+    Object2D a(&scene);
+    Shape<Shapes::Sphere2D> aShape(a, {{}, 1.0f}, &shapes);
+
+    Object2D b(&scene);
+    Shape<Shapes::AxisAlignedBox2D> bShape(b, {{0.75f, -0.5f}, {3.0f, 0.5f}}, &shapes);
+
+    Object2D c(&scene);
+    Shape<Shapes::Point2D> cShape(c, {{0.5f, 0.0f}}, &shapes);
+
+    Object2D d(&scene);
+    Shape<Shapes::Sphere2D> dShape(d, {{2.5f, 0.0f}, 1.75f}, &shapes);
+
+    /* Bounding boxes of a and b overlap, but there's no AAB-sphere collision
+       test, so they are not reported */
+    auto collisions = shapes.allCollisions();
+    CORRADE_COMPARE(collisions.size(), 2);
+    CORRADE_VERIFY(collisions[0].first == &aShape);
+    CORRADE_VERIFY(collisions[0].second == &cShape);
+    CORRADE_VERIFY(collisions[1].first == &aShape);
+    CORRADE_VERIFY(collisions[1].second == &dShape);
+    CORRADE_VERIFY(!shapes.isDirty());
+
+    /* Pairs are the same as when testing all shapes with each other */
+    std::size_t count = 0;
+    for(std::size_t i = 0; i != shapes.size(); ++i)
+        for(std::size_t j = i + 1; j != shapes.size(); ++j)
+            if(shapes[i].collides(shapes[j])) ++count;
+    CORRADE_COMPARE(collisions.size(), count);
+}
+
+void ShapeTest::allCollisionsUnbounded() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::Line3D> aShape(a, {{}, Vector3::xAxis()}, &shapes);
+
+    Object3D b(&scene);
+    Shape<Shapes::Sphere3D> bShape(b, {{100.0f, 0.0f, 0.0f}, 0.5f}, &shapes);
+
+    Object3D c(&scene);
+    Shape<Shapes::Cylinder3D> cShape(c, {{50.0f, 0.0f, 0.0f}, {50.0f, 1.0f, 0.0f}, 1.0f}, &shapes);
+
+    Object3D d(&scene);
+    Shape<Shapes::Point3D> dShape(d, {{50.0f, 20.0f, 0.0f}}, &shapes);
+
+    /* Compositions have unknown bounds, so this is tested against
+       everything, but there's no collision implementation for them */
+    Object3D e(&scene);
+    Shape<Shapes::Composition3D> eShape(e, Shapes::Sphere3D({}, 0.5f) || Shapes::Point3D({50.0f, 20.0f, 0.0f}), &shapes);
+
+    /* Line collides with the sphere, cylinder with the point. There's no
+       line/cylinder collision implementation. */
+    auto collisions = shapes.allCollisions();
+    CORRADE_COMPARE(collisions.size(), 2);
+    CORRADE_VERIFY(collisions[0].first == &aShape);
+    CORRADE_VERIFY(collisions[0].second == &bShape);
+    CORRADE_VERIFY(collisions[1].first == &cShape);
+    CORRADE_VERIFY(collisions[1].second == &dShape);
+}
+
+void ShapeTest::allCollisionsIncremental() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{}, 1.0f}, &shapes);
+
+    Object3D b(&scene);
+    Shape<Shapes::Sphere3D> bShape(b, {{5.0f, 0.0f, 0.0f}, 1.0f}, &shapes);
+
+    Object3D c(&scene);
+    Shape<Shapes::Sphere3D> cShape(c, {{10.0f, 0.0f, 0.0f}, 1.0f}, &shapes);
+
+    CORRADE_VERIFY(shapes.allCollisions().empty());
+
+    /* Move c over a, changing the order along X */
+    c.translate(Vector3::xAxis(-9.5f));
+    CORRADE_VERIFY(shapes.isDirty());
+    auto collisions = shapes.allCollisions();
+    CORRADE_COMPARE(collisions.size(), 1);
+    CORRADE_VERIFY(collisions[0].first == &aShape);
+    CORRADE_VERIFY(collisions[0].second == &cShape);
+
+    /* Change shape without moving the object */
+    bShape.setShape({{1.5f, 0.0f, 0.0f}, 1.0f});
+    collisions = shapes.allCollisions();
+    CORRADE_COMPARE(collisions.size(), 3);
+    CORRADE_VERIFY(collisions[0].first == &aShape);
+    CORRADE_VERIFY(collisions[0].second == &bShape);
+    CORRADE_VERIFY(collisions[1].first == &aShape);
+    CORRADE_VERIFY(collisions[1].second == &cShape);
+    CORRADE_VERIFY(collisions[2].first == &bShape);
+    CORRADE_VERIFY(collisions[2].second == &cShape);
+
+    /* Remove shape from the group */
+    CORRADE_VERIFY(!shapes.isDirty());
+    shapes.remove(aShape);
+    CORRADE_VERIFY(shapes.isDirty());
+    collisions = shapes.allCollisions();
+    CORRADE_COMPARE(collisions.size(), 1);
+    CORRADE_VERIFY(collisions[0].first == &bShape);
+    CORRADE_VERIFY(collisions[0].second == &cShape);
+
+    /* Add a new shape, not colliding with anything */
+    {
+        Object3D d(&scene);
+        Shape<Shapes::Sphere3D> dShape(d, {{-5.0f, 0.0f, 0.0f}, 1.0f}, &shapes);
+        CORRADE_VERIFY(shapes.isDirty());
+        collisions = shapes.allCollisions();
+        CORRADE_COMPARE(collisions.size(), 1);
+        CORRADE_VERIFY(collisions[0].first == &bShape);
+        CORRADE_VERIFY(collisions[0].second == &cShape);
+    }
+
+    /* Removed again on destruction */
+    CORRADE_COMPARE(shapes.size(), 2);
+    CORRADE_VERIFY(shapes.isDirty());
+    collisions = shapes.allCollisions();
+    CORRADE_COMPARE(collisions.size(), 1);
+}
+
+void ShapeTest::allCollisionsFeatureGroup() {
+    Scene3D scene;
+    ShapeGroup3D shapes;
+
+    Object3D a(&scene);
+    Shape<Shapes::Sphere3D> aShape(a, {{}, 1.0f}, &shapes);
+
+    Object3D b(&scene);
+    Shape<Shapes::Sphere3D> bShape(b, {{5.0f, 0.0f, 0.0f}, 1.0f}, &shapes);
+
+    Object3D c(&scene);
+    Shape<Shapes::Sphere3D> cShape(c, {{10.0f, 0.0f, 0.0f}, 1.0f}, &shapes);
+
+    Object3D d(&scene);
+    Shape<Shapes::Sphere3D> dShape(d, {{5.5f, 0.0f, 0.0f}, 1.0f});
+
+    CORRADE_VERIFY(shapes.allCollisions().empty());
+    CORRADE_VERIFY(!shapes.isDirty());
+
+    /* Remove one shape and add another through the base class, keeping the
+       size the same. The group isn't notified about either. */
+    SceneGraph::FeatureGroup<3, AbstractShape3D, Float>& group = shapes;
+    group.remove(aShape);
+    group.add(dShape);
+    CORRADE_COMPARE(shapes.size(), 3);
+
+    const auto collisions = shapes.allCollisions();
+    CORRADE_COMPARE(collisions.size(), 1);
+    CORRADE_VERIFY(collisions[0].first == &bShape);
+    CORRADE_VERIFY(collisions[0].second == &dShape);
+    CORRADE_VERIFY(shapes.firstCollision(dShape) == &bShape);
+    CORRADE_VERIFY(shapes.firstCollision(aShape) == nullptr);
+}
+
 void ShapeTest::shapeGroup() {
     Scene2D scene;
     ShapeGroup2D shapes;
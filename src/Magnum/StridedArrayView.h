@@ -0,0 +1,191 @@
+#ifndef Magnum_StridedArrayView_h
+#define Magnum_StridedArrayView_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::StridedArrayView
+ */
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Magnum.h"
+
+namespace Magnum {
+
+/**
+@brief Strided array view
+@tparam T   Element type
+
+Non-owning view on elements separated by a constant byte distance, such as
+one attribute in interleaved vertex data. Similarly to
+@ref Corrade::Containers::ArrayView "Containers::ArrayView" it's implicitly
+constructible from an array view of the same type (with stride equal to the
+type size) and a mutable view is implicitly convertible to a const one. The
+elements are accessed directly through a pointer, so the data and the stride
+are expected to satisfy alignment requirements of @p T.
+@code
+Containers::Array<char> data = MeshTools::interleave(positions, normals);
+StridedArrayView<Vector3> normalView{data + sizeof(Vector3), normals.size(), 2*sizeof(Vector3)};
+for(Vector3& normal: normalView) normal = -normal;
+@endcode
+@see @ref Trade::MeshData::attribute()
+*/
+template<class T> class StridedArrayView {
+    public:
+        typedef T Type; /**< @brief Element type */
+
+        /**
+         * @brief Type-erased data pointer
+         *
+         * Either `char` or `const char`, depending on constness of @p T.
+         */
+        typedef typename std::conditional<std::is_const<T>::value, const char, char>::type ErasedType;
+
+        /**
+         * @brief Iterator
+         *
+         * Satisfies the forward iterator concept, so the view can be used
+         * with STL algorithms and container constructors.
+         */
+        class Iterator {
+            public:
+                typedef std::forward_iterator_tag iterator_category; /**< @brief Iterator category */
+                typedef typename std::remove_const<T>::type value_type; /**< @brief Value type */
+                typedef std::ptrdiff_t difference_type; /**< @brief Difference type */
+                typedef T* pointer;     /**< @brief Pointer type */
+                typedef T& reference;   /**< @brief Reference type */
+
+                /** @brief Default constructor */
+                constexpr /*implicit*/ Iterator() noexcept: _data{}, _stride{} {}
+
+                #ifndef DOXYGEN_GENERATING_OUTPUT
+                constexpr explicit Iterator(ErasedType* data, std::size_t stride) noexcept: _data{data}, _stride{stride} {}
+                #endif
+
+                /** @brief Dereference */
+                T& operator*() const { return *reinterpret_cast<T*>(_data); }
+
+                /** @brief Member access */
+                T* operator->() const { return reinterpret_cast<T*>(_data); }
+
+                /** @brief Advance to next element */
+                Iterator& operator++() {
+                    _data += _stride;
+                    return *this;
+                }
+
+                /** @brief Advance to next element, returning the previous position */
+                Iterator operator++(int) {
+                    Iterator previous = *this;
+                    _data += _stride;
+                    return previous;
+                }
+
+                /** @brief Equality comparison */
+                bool operator==(const Iterator& other) const { return _data == other._data; }
+
+                /** @brief Non-equality comparison */
+                bool operator!=(const Iterator& other) const { return _data != other._data; }
+
+            private:
+                ErasedType* _data;
+                std::size_t _stride;
+        };
+
+        /** @brief Default constructor, creates an empty view */
+        constexpr /*implicit*/ StridedArrayView() noexcept: _data{}, _size{}, _stride{} {}
+
+        /** @brief Construct empty view */
+        constexpr /*implicit*/ StridedArrayView(std::nullptr_t) noexcept: StridedArrayView{} {}
+
+        /**
+         * @brief Constructor
+         * @param data      Pointer to the first element
+         * @param size      Element count
+         * @param stride    Byte distance between two successive elements
+         */
+        constexpr explicit StridedArrayView(ErasedType* data, std::size_t size, std::size_t stride) noexcept: _data{data}, _size{size}, _stride{stride} {}
+
+        /** @brief Construct from contiguous array view */
+        template<class U, class = typename std::enable_if<std::is_convertible<U*, T*>::value && sizeof(U) == sizeof(T)>::type> constexpr /*implicit*/ StridedArrayView(Containers::ArrayView<U> view) noexcept: _data{reinterpret_cast<ErasedType*>(view.data())}, _size{view.size()}, _stride{sizeof(U)} {}
+
+        /** @brief Construct const view from mutable view */
+        template<class U, class = typename std::enable_if<std::is_same<const U, T>::value>::type> constexpr /*implicit*/ StridedArrayView(const StridedArrayView<U>& other) noexcept: _data{other.data()}, _size{other.size()}, _stride{other.stride()} {}
+
+        /** @brief Pointer to the first element */
+        constexpr ErasedType* data() const { return _data; }
+
+        /** @brief Element count */
+        constexpr std::size_t size() const { return _size; }
+
+        /** @brief Byte distance between two successive elements */
+        constexpr std::size_t stride() const { return _stride; }
+
+        /** @brief Whether the view is empty */
+        constexpr bool empty() const { return !_size; }
+
+        /** @brief Element access */
+        T& operator[](std::size_t i) const {
+            return *reinterpret_cast<T*>(_data + i*_stride);
+        }
+
+        /** @brief Iterator to the first element */
+        Iterator begin() const { return Iterator{_data, _stride}; }
+
+        /** @brief Iterator after the last element */
+        Iterator end() const { return Iterator{_data + _size*_stride, _stride}; }
+
+        /**
+         * @brief View slice
+         *
+         * Expects that both @p begin and @p end are in range and
+         * @p begin is not larger than @p end.
+         */
+        StridedArrayView<T> slice(std::size_t begin, std::size_t end) const {
+            CORRADE_ASSERT(begin <= end && end <= _size,
+                "StridedArrayView::slice(): slice from" << begin << "to" << end << "out of range for" << _size << "elements", {});
+            return StridedArrayView<T>{_data + begin*_stride, end - begin, _stride};
+        }
+
+        /** @brief View on the first @p end elements */
+        StridedArrayView<T> prefix(std::size_t end) const { return slice(0, end); }
+
+        /** @brief View on elements starting at @p begin */
+        StridedArrayView<T> suffix(std::size_t begin) const { return slice(begin, _size); }
+
+    private:
+        ErasedType* _data;
+        std::size_t _size;
+        std::size_t _stride;
+};
+
+}
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef Magnum_Test_BenchmarkTimer_h
+#define Magnum_Test_BenchmarkTimer_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <chrono>
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Test {
+
+/* Wall clock timer for benchmarks. Measured intervals are delimited with
+   start() and stop() and the timer keeps the best of them, so the benchmark
+   can prepare fresh data for each run outside of the measured interval. */
+class BenchmarkTimer {
+    public:
+        typedef std::chrono::high_resolution_clock Clock;
+
+        void start() { _begin = Clock::now(); }
+
+        void stop() { _best = std::min(_best, Clock::now() - _begin); }
+
+        /* Measures one run of given function */
+        template<class F> void measure(F f) {
+            start();
+            f();
+            stop();
+        }
+
+        Double milliseconds() const {
+            return std::chrono::duration<Double, std::milli>(_best).count();
+        }
+
+        Double microseconds() const {
+            return std::chrono::duration<Double, std::micro>(_best).count();
+        }
+
+        Double nanoseconds() const {
+            return std::chrono::duration<Double, std::nano>(_best).count();
+        }
+
+    private:
+        Clock::time_point _begin;
+        Clock::duration _best{Clock::duration::max()};
+};
+
+}}
+
+#endif
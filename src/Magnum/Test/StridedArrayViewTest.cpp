@@ -0,0 +1,171 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <vector>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/StridedArrayView.h"
+
+namespace Magnum { namespace Test {
+
+class StridedArrayViewTest: public TestSuite::Tester {
+    public:
+        explicit StridedArrayViewTest();
+
+        void constructDefault();
+        void construct();
+        void constructArrayView();
+        void constructConst();
+
+        void access();
+        void iterate();
+        void slice();
+        void sliceOutOfRange();
+};
+
+StridedArrayViewTest::StridedArrayViewTest() {
+    addTests({&StridedArrayViewTest::constructDefault,
+              &StridedArrayViewTest::construct,
+              &StridedArrayViewTest::constructArrayView,
+              &StridedArrayViewTest::constructConst,
+
+              &StridedArrayViewTest::access,
+              &StridedArrayViewTest::iterate,
+              &StridedArrayViewTest::slice,
+              &StridedArrayViewTest::sliceOutOfRange});
+}
+
+namespace {
+    struct Vertex {
+        Int position;
+        Float weight;
+    };
+
+    Vertex vertices[]{{1, 0.5f}, {2, 1.5f}, {3, 2.5f}, {4, 3.5f}};
+}
+
+void StridedArrayViewTest::constructDefault() {
+    StridedArrayView<Int> a;
+    StridedArrayView<Int> b = nullptr;
+
+    CORRADE_VERIFY(a.empty());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.stride(), 0);
+    CORRADE_VERIFY(a.data() == nullptr);
+    CORRADE_VERIFY(b.empty());
+    CORRADE_VERIFY(a.begin() == a.end());
+}
+
+void StridedArrayViewTest::construct() {
+    StridedArrayView<Float> a{reinterpret_cast<char*>(&vertices[0].weight), 4, sizeof(Vertex)};
+
+    CORRADE_VERIFY(!a.empty());
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a.stride(), sizeof(Vertex));
+    CORRADE_VERIFY(a.data() == reinterpret_cast<char*>(&vertices[0].weight));
+}
+
+void StridedArrayViewTest::constructArrayView() {
+    Int data[]{5, 6, 7};
+    StridedArrayView<Int> a = Containers::ArrayView<Int>{data};
+
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.stride(), sizeof(Int));
+    CORRADE_COMPARE(a[2], 7);
+
+    /* Views on a different type can't be converted */
+    CORRADE_VERIFY(!(std::is_convertible<Containers::ArrayView<Float>, StridedArrayView<Int>>::value));
+    CORRADE_VERIFY(!(std::is_convertible<Containers::ArrayView<const Int>, StridedArrayView<Int>>::value));
+}
+
+void StridedArrayViewTest::constructConst() {
+    StridedArrayView<Int> a{reinterpret_cast<char*>(&vertices[0].position), 4, sizeof(Vertex)};
+    StridedArrayView<const Int> b = a;
+
+    CORRADE_VERIFY(b.data() == a.data());
+    CORRADE_COMPARE(b.size(), 4);
+    CORRADE_COMPARE(b.stride(), sizeof(Vertex));
+
+    /* Const view can't be converted to a mutable one */
+    CORRADE_VERIFY(!(std::is_convertible<StridedArrayView<const Int>, StridedArrayView<Int>>::value));
+}
+
+void StridedArrayViewTest::access() {
+    Vertex data[]{{1, 0.5f}, {2, 1.5f}, {3, 2.5f}};
+    StridedArrayView<Float> a{reinterpret_cast<char*>(&data[0].weight), 3, sizeof(Vertex)};
+
+    CORRADE_COMPARE(a[1], 1.5f);
+    a[2] = 7.0f;
+    CORRADE_COMPARE(data[2].weight, 7.0f);
+    CORRADE_COMPARE(data[2].position, 3);
+}
+
+void StridedArrayViewTest::iterate() {
+    StridedArrayView<const Int> a{reinterpret_cast<const char*>(&vertices[0].position), 4, sizeof(Vertex)};
+
+    Int sum = 0;
+    for(Int i: a) sum += i;
+    CORRADE_COMPARE(sum, 10);
+
+    CORRADE_COMPARE_AS(std::vector<Int>(a.begin(), a.end()),
+        (std::vector<Int>{1, 2, 3, 4}),
+        TestSuite::Compare::Container);
+}
+
+void StridedArrayViewTest::slice() {
+    StridedArrayView<const Float> a{reinterpret_cast<const char*>(&vertices[0].weight), 4, sizeof(Vertex)};
+
+    StridedArrayView<const Float> b = a.slice(1, 3);
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b.stride(), sizeof(Vertex));
+    CORRADE_COMPARE(b[0], 1.5f);
+    CORRADE_COMPARE(b[1], 2.5f);
+
+    StridedArrayView<const Float> c = a.prefix(1);
+    CORRADE_COMPARE(c.size(), 1);
+    CORRADE_COMPARE(c[0], 0.5f);
+
+    StridedArrayView<const Float> d = a.suffix(3);
+    CORRADE_COMPARE(d.size(), 1);
+    CORRADE_COMPARE(d[0], 3.5f);
+}
+
+void StridedArrayViewTest::sliceOutOfRange() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    StridedArrayView<const Float> a{reinterpret_cast<const char*>(&vertices[0].weight), 4, sizeof(Vertex)};
+    a.slice(2, 5);
+    a.slice(3, 2);
+    CORRADE_COMPARE(out.str(),
+        "StridedArrayView::slice(): slice from 2 to 5 out of range for 4 elements\n"
+        "StridedArrayView::slice(): slice from 3 to 2 out of range for 4 elements\n");
+}
+
+}}
+
+CORRADE_TEST_MAIN(Magnum::Test::StridedArrayViewTest)
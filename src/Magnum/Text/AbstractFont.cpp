@@ -136,7 +136,16 @@ void AbstractFont::fillGlyphCache(GlyphCache& cache, const std::string& characte
     CORRADE_ASSERT(!(features() & Feature::PreparedGlyphCache),
         "Text::AbstractFont::fillGlyphCache(): feature not supported", );
 
-    doFillGlyphCache(cache, Utility::Unicode::utf32(characters));
+    /* Render only characters that aren't in the cache yet. Characters
+       without a glyph are always passed through so the font can fill the
+       "Not Found" glyph. */
+    std::u32string missing;
+    for(const char32_t character: Utility::Unicode::utf32(characters)) {
+        const UnsignedInt glyph = glyphId(character);
+        if(!glyph || !cache.contains(glyph)) missing += character;
+    }
+
+    if(!missing.empty()) doFillGlyphCache(cache, missing);
 }
 
 void AbstractFont::doFillGlyphCache(GlyphCache&, const std::u32string&) {
@@ -160,10 +169,27 @@ std::unique_ptr<GlyphCache> AbstractFont::doCreateGlyphCache() {
 std::unique_ptr<AbstractLayouter> AbstractFont::layout(const GlyphCache& cache, const Float size, const std::string& text) {
     CORRADE_ASSERT(isOpened(), "Text::AbstractFont::layout(): no font opened", nullptr);
 
-    return doLayout(cache, size, text);
+    std::unique_ptr<AbstractLayouter> layouter = doLayout(cache, size, text);
+    if(layouter) layouter->_font = this;
+    return layouter;
+}
+
+void AbstractFont::layout(const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, std::unique_ptr<AbstractLayouter>& layouter) {
+    CORRADE_ASSERT(isOpened(), "Text::AbstractFont::layout(): no font opened", );
+
+    /* Reuse the layouter if the font knows how, otherwise create a new one */
+    if(layouter && layouter->_font == this && doRelayout(*layouter, cache, size, text))
+        return;
+
+    layouter = doLayout(cache, size, std::string{text.data(), text.size()});
+    if(layouter) layouter->_font = this;
+}
+
+bool AbstractFont::doRelayout(AbstractLayouter&, const GlyphCache&, Float, Containers::ArrayView<const char>) {
+    return false;
 }
 
-AbstractLayouter::AbstractLayouter(UnsignedInt glyphCount): _glyphCount(glyphCount) {}
+AbstractLayouter::AbstractLayouter(UnsignedInt glyphCount): _font(nullptr), _glyphCount(glyphCount) {}
 
 AbstractLayouter::~AbstractLayouter() {}
 
@@ -32,6 +32,7 @@
 #include <memory>
 #include <string>
 #include <tuple>
+#include <Corrade/Containers/ArrayView.h>
 #include <Corrade/PluginManager/AbstractPlugin.h>
 
 #include "Magnum/Magnum.h"
@@ -72,10 +73,10 @@ checked by the implementation:
 -   All `do*()` implementations working on opened file are called only if
     there is any file opened.
 
-Plugin interface string is `"cz.mosra.magnum.Text.AbstractFont/0.2.4"`.
+Plugin interface string is `"cz.mosra.magnum.Text.AbstractFont/0.2.5"`.
 */
 class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
-    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Text.AbstractFont/0.2.4")
+    CORRADE_PLUGIN_INTERFACE("cz.mosra.magnum.Text.AbstractFont/0.2.5")
 
     public:
         /**
@@ -214,7 +215,9 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          * @param cache         Glyph cache instance
          * @param characters    UTF-8 characters to render
          *
-         * Fills the cache with given characters. Fonts having
+         * Fills the cache with given characters. Characters whose glyphs are
+         * already in the cache are skipped, so the function can be called
+         * repeatedly to fill the cache incrementally. Fonts having
          * @ref Feature::PreparedGlyphCache do not support partial glyph cache
          * filling, use @ref createGlyphCache() instead.
          */
@@ -242,6 +245,22 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
          */
         std::unique_ptr<AbstractLayouter> layout(const GlyphCache& cache, Float size, const std::string& text);
 
+        /**
+         * @brief Layout the text reusing existing layouter
+         * @param cache     Glyph cache
+         * @param size      Font size
+         * @param text      Text to layout
+         * @param layouter  Layouter to reuse, can be `nullptr`
+         *
+         * If @p layouter was previously created by this font, it is
+         * reinitialized with new text, otherwise it is replaced with a new
+         * one. Fonts implementing @ref doRelayout() keep the memory allocated
+         * for previous text, so repeated layouting of texts with similar
+         * length doesn't allocate.
+         * @see @ref layout(const GlyphCache&, Float, const std::string&)
+         */
+        void layout(const GlyphCache& cache, Float size, Containers::ArrayView<const char> text, std::unique_ptr<AbstractLayouter>& layouter);
+
     protected:
         /**
          * @brief Font metrics
@@ -335,6 +354,16 @@ class MAGNUM_TEXT_EXPORT AbstractFont: public PluginManager::AbstractPlugin {
         /** @brief Implementation for @ref layout() */
         virtual std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache& cache, Float size, const std::string& text) = 0;
 
+        /**
+         * @brief Implementation for @ref layout(const GlyphCache&, Float, Containers::ArrayView<const char>, std::unique_ptr<AbstractLayouter>&)
+         *
+         * Called only with layouter previously created by this font. Return
+         * `true` if the layouter was reinitialized with new text, `false` if
+         * it can't be reused, in which case a new one is created using
+         * @ref doLayout(). Default implementation returns `false`.
+         */
+        virtual bool doRelayout(AbstractLayouter& layouter, const GlyphCache& cache, Float size, Containers::ArrayView<const char> text);
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     private:
     #endif
@@ -362,7 +391,7 @@ class MAGNUM_TEXT_EXPORT AbstractLayouter {
         /** @brief Moving is not allowed */
         AbstractLayouter(AbstractLayouter&&) = delete;
 
-        ~AbstractLayouter();
+        virtual ~AbstractLayouter();
 
         /** @brief Copying is not allowed */
         AbstractLayouter& operator=(const AbstractLayouter&) = delete;
@@ -392,6 +421,14 @@ class MAGNUM_TEXT_EXPORT AbstractLayouter {
          */
         explicit AbstractLayouter(UnsignedInt glyphCount);
 
+        /**
+         * @brief Set count of glyphs in laid out text
+         *
+         * Meant to be used when reinitializing the layouter in
+         * @ref AbstractFont::doRelayout().
+         */
+        void setGlyphCount(UnsignedInt glyphCount) { _glyphCount = glyphCount; }
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     protected:
     #else
@@ -409,6 +446,9 @@ class MAGNUM_TEXT_EXPORT AbstractLayouter {
     #ifdef DOXYGEN_GENERATING_OUTPUT
     private:
     #endif
+        friend AbstractFont;
+
+        AbstractFont* _font;
         UnsignedInt _glyphCount;
 };
 
@@ -25,23 +25,29 @@
 
 #include "GlyphCache.h"
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <Corrade/Containers/Array.h>
+
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Image.h"
+#include "Magnum/PixelFormat.h"
 #include "Magnum/TextureFormat.h"
-#include "Magnum/TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
 GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& size, const Vector2i& padding): GlyphCache{internalFormat, size, size, padding} {}
 
-GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const TextureFormat internalFormat, const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _allocator{originalSize, padding}, _useCounter{0}, _statistics{}, _evictionEnabled{false}, _hasExternalGlyphs{false} {
     initialize(internalFormat, size);
 }
 
 GlyphCache::GlyphCache(const Vector2i& size, const Vector2i& padding): GlyphCache{size, size, padding} {}
 
-GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding) {
+GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const Vector2i& padding): _size(originalSize), _padding(padding), _allocator{originalSize, padding}, _useCounter{0}, _statistics{}, _evictionEnabled{false}, _hasExternalGlyphs{false} {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::texture_rg);
     #endif
@@ -62,6 +68,11 @@ GlyphCache::GlyphCache(const Vector2i& originalSize, const Vector2i& size, const
     initialize(internalFormat, size);
 }
 
+GlyphCache::GlyphCache(NoCreateT, const Vector2i& originalSize, const Vector2i& padding): _size(originalSize), _padding(padding), _texture{NoCreate}, _allocator{originalSize, padding}, _useCounter{0}, _statistics{}, _evictionEnabled{false}, _hasExternalGlyphs{false} {
+    /* Default "Not Found" glyph */
+    glyphs.insert({0, {}});
+}
+
 GlyphCache::~GlyphCache() = default;
 
 void GlyphCache::initialize(const TextureFormat internalFormat, const Vector2i& size) {
@@ -75,26 +86,189 @@ void GlyphCache::initialize(const TextureFormat internalFormat, const Vector2i&
     glyphs.insert({0, {}});
 }
 
+namespace {
+    UnsignedLong positionKey(const Vector2i& position) {
+        return UnsignedLong(UnsignedInt(position.x())) << 32 | UnsignedInt(position.y());
+    }
+}
+
+void GlyphCache::resetStatistics() {
+    _statistics = Statistics{};
+}
+
+std::pair<Vector2i, Range2Di> GlyphCache::operator[](const UnsignedInt glyph) const {
+    auto it = glyphs.find(glyph);
+    if(it == glyphs.end()) {
+        ++_statistics.misses;
+        return glyphs.at(0);
+    }
+
+    ++_statistics.hits;
+    if(_evictionEnabled) {
+        auto lastUse = _lastUse.find(glyph);
+        if(lastUse != _lastUse.end()) lastUse->second = ++_useCounter;
+    }
+    return it->second;
+}
+
+bool GlyphCache::contains(const UnsignedInt glyph) const {
+    if(!glyphs.count(glyph)) return false;
+
+    if(_evictionEnabled) {
+        auto lastUse = _lastUse.find(glyph);
+        if(lastUse != _lastUse.end()) lastUse->second = ++_useCounter;
+    }
+    return true;
+}
+
 std::vector<Range2Di> GlyphCache::reserve(const std::vector<Vector2i>& sizes) {
-    CORRADE_ASSERT((glyphs.size() == 1 && glyphs.at(0) == std::pair<Vector2i, Range2Di>()),
-        "Text::GlyphCache::reserve(): reserving space in non-empty cache is not yet implemented", {});
+    CORRADE_ASSERT(!_hasExternalGlyphs,
+        "Text::GlyphCache::reserve(): can't reserve space in a cache with glyphs inserted outside of reserved space", {});
+
+    /* Space reserved previously but not used by any glyph is reused */
+    for(const auto& reserved: _reserved)
+        _allocator.deallocate(reserved.second);
+    _reserved.clear();
+
+    /* Allocate the tallest glyphs first so they open the shelves */
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sizes](std::size_t a, std::size_t b) {
+        if(sizes[a].y() != sizes[b].y()) return sizes[a].y() > sizes[b].y();
+        return sizes[a].x() > sizes[b].x();
+    });
+
+    /* Allocate in a copy so no glyphs get evicted if everything doesn't fit
+       in the end. Eviction candidates are sorted from the most recently
+       used, gathered lazily only once eviction is really needed. */
+    TextureTools::AtlasShelfAllocator allocator = _allocator;
+    std::vector<Range2Di> ranges(sizes.size());
+    std::vector<std::pair<UnsignedLong, UnsignedInt>> candidates;
+    bool candidatesGathered = false;
+    std::vector<UnsignedInt> evicted;
+    for(const std::size_t i: order) {
+        std::optional<Range2Di> range;
+        while(!(range = allocator.allocate(sizes[i])) && _evictionEnabled) {
+            if(!candidatesGathered) {
+                for(const auto& lastUse: _lastUse)
+                    if(lastUse.first != 0) candidates.emplace_back(lastUse.second, lastUse.first);
+                std::sort(candidates.begin(), candidates.end(), std::greater<std::pair<UnsignedLong, UnsignedInt>>{});
+                candidatesGathered = true;
+            }
+            if(candidates.empty()) break;
+
+            const UnsignedInt glyph = candidates.back().second;
+            candidates.pop_back();
+            allocator.deallocate(glyphs.at(glyph).second.padded(-_padding));
+            evicted.push_back(glyph);
+        }
+
+        if(!range) {
+            Error() << "Text::GlyphCache::reserve(): cache of size" << _size
+                << "is too small to fit" << sizes.size() << "glyphs with padding"
+                << _padding;
+            return {};
+        }
+
+        ranges[i] = *range;
+    }
+
+    /* Everything fits, commit the changes */
+    _allocator = std::move(allocator);
+    for(const UnsignedInt glyph: evicted) {
+        glyphs.erase(glyph);
+        _lastUse.erase(glyph);
+    }
+    _statistics.evictions += evicted.size();
+
+    for(const Range2Di& range: ranges) {
+        /* Empty glyphs don't occupy any space */
+        const Range2Di padded = range.padded(_padding);
+        if(!padded.size().product()) continue;
+        _reserved.emplace(positionKey(range.min()), range);
+        _dirty.push_back(padded);
+    }
+
     glyphs.reserve(glyphs.size() + sizes.size());
-    return TextureTools::atlas(_size, sizes, _padding);
+    return ranges;
 }
 
 void GlyphCache::insert(const UnsignedInt glyph, const Vector2i& position, const Range2Di& rectangle) {
     const std::pair<Vector2i, Range2Di> glyphData = {position-_padding, rectangle.padded(_padding)};
 
-    /* Overwriting "Not Found" glyph */
-    if(glyph == 0) glyphs[0] = glyphData;
+    /* Overwriting "Not Found" glyph, freeing its previous reserved space */
+    if(glyph == 0) {
+        if(_lastUse.erase(0)) _allocator.deallocate(glyphs[0].second.padded(-_padding));
+        glyphs[0] = glyphData;
+    }
 
     /* Inserting new glyph */
     else CORRADE_INTERNAL_ASSERT_OUTPUT(glyphs.insert({glyph, glyphData}).second);
+
+    /* Glyph in reserved space can be evicted later, other non-empty glyphs
+       occupy space the allocator doesn't know about */
+    auto reserved = _reserved.find(positionKey(rectangle.min()));
+    if(reserved != _reserved.end() && reserved->second == rectangle) {
+        _reserved.erase(reserved);
+        _lastUse[glyph] = ++_useCounter;
+    } else if(glyphData.second.size().product()) _hasExternalGlyphs = true;
+}
+
+Image2D GlyphCache::image() { return doImage(); }
+
+Image2D GlyphCache::doImage() {
+    #ifndef MAGNUM_TARGET_GLES
+    return _texture.image(0, Image2D{PixelFormat::Red, PixelType::UnsignedByte});
+    #else
+    CORRADE_ASSERT(false, "Text::GlyphCache::image(): not available on OpenGL ES", Image2D{PixelFormat::Red, PixelType::UnsignedByte});
+    #endif
 }
 
 void GlyphCache::setImage(const Vector2i& offset, const ImageView2D& image) {
     /** @todo some internalformat/format checking also here (if querying internal format is not slow) */
     _texture.setSubImage(0, offset, image);
+    _statistics.uploadedBytes += image.pixelSize()*image.size().product();
+}
+
+void GlyphCache::flushImage(const ImageView2D& image) {
+    CORRADE_ASSERT(image.size() == _size,
+        "Text::GlyphCache::flushImage(): expected image of size" << _size << "but got" << image.size(), );
+
+    /* Merge regions that are next to each other in the same atlas row,
+       allocated regions in the same shelf start at the same Y coordinate */
+    std::sort(_dirty.begin(), _dirty.end(), [](const Range2Di& a, const Range2Di& b) {
+        if(a.min().y() != b.min().y()) return a.min().y() < b.min().y();
+        return a.min().x() < b.min().x();
+    });
+    std::vector<Range2Di> regions;
+    for(const Range2Di& dirty: _dirty) {
+        if(!regions.empty() && regions.back().min().y() == dirty.min().y() && regions.back().max().x() == dirty.min().x())
+            regions.back() = Math::join(regions.back(), dirty);
+        else regions.push_back(dirty);
+    }
+    _dirty.clear();
+
+    /* Subclasses may or may not count the upload in setImage(), count it
+       here instead */
+    const std::size_t uploadedBytes = _statistics.uploadedBytes;
+
+    const std::size_t pixelSize = image.pixelSize();
+    const std::size_t rowStride = std::get<1>(image.dataProperties()).x();
+    const char* const data = image.data<char>() + std::get<0>(image.dataProperties());
+    std::size_t regionBytes = 0;
+    for(const Range2Di& region: regions) {
+        /* Copy the region out so it can be uploaded with default pixel
+           storage everywhere, including ES2 */
+        const std::size_t regionRowSize = region.sizeX()*pixelSize;
+        Containers::Array<char> regionData{regionRowSize*region.sizeY()};
+        for(Int y = 0; y != region.sizeY(); ++y)
+            std::memcpy(regionData + y*regionRowSize, data + (region.min().y() + y)*rowStride + region.min().x()*pixelSize, regionRowSize);
+
+        setImage(region.min(), ImageView2D{PixelStorage{}.setAlignment(1), image.format(), image.type(), region.size(), regionData});
+        regionBytes += regionData.size();
+    }
+
+    _statistics.uploadedBytes = uploadedBytes + regionBytes;
 }
 
 }}
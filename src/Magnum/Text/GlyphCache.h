@@ -35,6 +35,7 @@
 #include "Magnum/Math/Range.h"
 #include "Magnum/Texture.h"
 #include "Magnum/Text/visibility.h"
+#include "Magnum/TextureTools/Atlas.h"
 
 namespace Magnum { namespace Text {
 
@@ -56,6 +57,34 @@ font->createGlyphCache(cache, "abcdefghijklmnopqrstuvwxyz"
 @endcode
 
 See @ref Renderer for information about text rendering.
+
+## Incremental filling and eviction
+
+The cache doesn't need to know all glyphs up front. Calling
+@ref AbstractFont::fillGlyphCache() again with new text adds only the glyphs
+that aren't in the cache yet, space for them is allocated on demand using
+@ref TextureTools::AtlasShelfAllocator. Fonts can upload just the parts of
+the cache image that changed using @ref flushImage().
+
+If @ref setEvictionEnabled() "eviction is enabled", glyphs that weren't used
+for the longest time are removed from the cache when there isn't enough space
+for new ones, so a fixed-size cache can serve text with large character sets,
+such as CJK. Glyph usage is tracked by @ref operator[](), which is what text
+layouters use. Note that because of that the lookup modifies internal state of
+the cache even though it's a `const` function, see its documentation for
+details. Texture regions of evicted glyphs get reused, so previously
+rendered text containing them needs to be rendered again --- a change in
+@ref Statistics::evictions tells when that might be needed.
+@code
+Text::GlyphCache cache{Vector2i{1024}};
+cache.setEvictionEnabled(true);
+
+// for every new message
+font->fillGlyphCache(cache, message);
+@endcode
+
+@ref statistics() contain lookup hit and miss counts, eviction count and
+amount of uploaded data, which can be used to choose a cache size.
 @todo Some way for Font to negotiate or check internal texture format
 @todo Default glyph 0 with rect 0 0 0 0 will result in negative dimensions when
     nonzero padding is removed
@@ -99,6 +128,18 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          */
         explicit GlyphCache(const Vector2i& size, const Vector2i& padding = Vector2i());
 
+        /**
+         * @brief Construct without creating the cache texture
+         * @param originalSize      Unscaled glyph cache texture size
+         * @param padding           Padding around every glyph
+         *
+         * Doesn't need an OpenGL context. Meant for subclasses keeping the
+         * cache image somewhere else, for example in memory when converting
+         * fonts on a machine without GPU. Such subclass needs to reimplement
+         * @ref setImage() and @ref doImage(), @ref texture() is not usable.
+         */
+        explicit GlyphCache(NoCreateT, const Vector2i& originalSize, const Vector2i& padding = Vector2i());
+
         virtual ~GlyphCache();
 
         /**
@@ -117,6 +158,83 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         /** @brief Cache texture */
         Texture2D& texture() { return _texture; }
 
+        /**
+         * @brief Cache image
+         *
+         * Downloads the cache texture with @ref PixelFormat::Red and
+         * @ref PixelType::UnsignedByte. Not available on OpenGL ES unless
+         * reimplemented in a subclass.
+         */
+        Image2D image();
+
+        /**
+         * @brief Cache usage statistics
+         *
+         * @see @ref statistics(), @ref resetStatistics()
+         */
+        struct Statistics {
+            /** @brief Count of lookups of glyphs present in the cache */
+            std::size_t hits;
+
+            /**
+             * @brief Count of lookups of glyphs not present in the cache
+             *
+             * These lookups fell back to glyph `0`.
+             */
+            std::size_t misses;
+
+            /** @brief Count of glyphs evicted from the cache */
+            std::size_t evictions;
+
+            /**
+             * @brief Count of bytes uploaded to the cache texture
+             *
+             * Counts data passed to @ref setImage() and @ref flushImage().
+             * If a subclass reimplements @ref setImage(), only uploads done
+             * through @ref flushImage() are counted.
+             */
+            std::size_t uploadedBytes;
+        };
+
+        /**
+         * @brief Usage statistics
+         *
+         * @see @ref resetStatistics()
+         */
+        const Statistics& statistics() const { return _statistics; }
+
+        /** @brief Reset usage statistics to zero */
+        void resetStatistics();
+
+        /** @brief Whether glyph eviction is enabled */
+        bool isEvictionEnabled() const { return _evictionEnabled; }
+
+        /**
+         * @brief Enable glyph eviction
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, @ref reserve() evicts least recently used glyphs if
+         * there isn't enough space for new ones. Only glyphs inserted into
+         * space returned from @ref reserve() can be evicted, glyph `0` is
+         * never evicted. Disabled by default.
+         */
+        GlyphCache& setEvictionEnabled(bool enabled) {
+            _evictionEnabled = enabled;
+            return *this;
+        }
+
+        /**
+         * @brief Whether given glyph is in the cache
+         *
+         * Unlike @ref operator[]() doesn't affect @ref statistics(), but
+         * similarly marks the glyph as recently used if
+         * @ref setEvictionEnabled() "eviction is enabled".
+         * @attention Despite being `const`, the function modifies the usage
+         *      tracking state, so it isn't safe to call from multiple threads
+         *      at once.
+         */
+        bool contains(UnsignedInt glyph) const;
+
         /**
          * @brief Parameters of given glyph
          * @param glyph         Glyph ID
@@ -129,12 +247,20 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          * If no glyph is found, glyph `0` is returned, which is by default on
          * zero position and has zero region in texture atlas. You can reset it
          * to some meaningful value in @ref insert().
+         *
+         * @attention Despite being `const`, every call modifies internal
+         *      state of the cache --- it counts a hit or a miss in
+         *      @ref statistics() and, if @ref setEvictionEnabled() "eviction is enabled",
+         *      marks the glyph as recently used, which affects what gets
+         *      evicted by @ref reserve() later. That's needed because text
+         *      layouters get the cache only through a `const` reference.
+         *      Because of that the function isn't safe to call from multiple
+         *      threads at once, even on a `const` instance. Iterate the cache
+         *      using @ref begin() and @ref end() to access glyph data without
+         *      any side effects.
          * @see @ref padding()
          */
-        std::pair<Vector2i, Range2Di> operator[](UnsignedInt glyph) const {
-            auto it = glyphs.find(glyph);
-            return it == glyphs.end() ? glyphs.at(0) : it->second;
-        }
+        std::pair<Vector2i, Range2Di> operator[](UnsignedInt glyph) const;
 
         /** @brief Iterator access to cache data */
         std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>>::const_iterator begin() const {
@@ -152,12 +278,18 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          * Returns non-overlapping regions in cache texture to store glyphs.
          * The reserved space is reused on next call to @ref reserve() if no
          * glyph was stored there, use @ref insert() to store actual glyph on
-         * given position and @ref setImage() to upload glyph image.
+         * given position and @ref setImage() or @ref flushImage() to upload
+         * glyph image. Can be called repeatedly to add more glyphs, but not
+         * after glyphs were inserted into regions not returned from this
+         * function.
          *
-         * Glyph @p sizes are expected to be without padding.
+         * If there isn't enough space and @ref setEvictionEnabled() "eviction is enabled",
+         * least recently used glyphs are evicted to make space. If there's
+         * still not enough space even with all glyphs evicted, nothing is
+         * evicted, no space is reserved, a message is printed to error output
+         * and an empty vector is returned.
          *
-         * @attention Cache size must be large enough to contain all rendered
-         *      glyphs.
+         * Glyph @p sizes are expected to be without padding.
          * @see @ref padding()
          */
         std::vector<Range2Di> reserve(const std::vector<Vector2i>& sizes);
@@ -170,7 +302,9 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          *
          * You can obtain unused non-overlapping regions with @ref reserve().
          * You can't overwrite already inserted glyph, however you can reset
-         * glyph `0` to some meaningful value.
+         * glyph `0` to some meaningful value. Non-empty regions that weren't
+         * returned from @ref reserve() make further calls to @ref reserve()
+         * impossible.
          *
          * Glyph parameters are expected to be without padding.
          *
@@ -184,9 +318,29 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
          *
          * Uploads image for one or more glyphs to given offset in cache
          * texture.
+         * @see @ref flushImage()
          */
         virtual void setImage(const Vector2i& offset, const ImageView2D& image);
 
+        /**
+         * @brief Upload changed parts of cache image
+         *
+         * Expects that @p image has the same size as @ref textureSize().
+         * Uploads only regions returned from @ref reserve() since the last
+         * call to this function, including padding. Adjacent regions in the
+         * same row of the atlas are merged together and uploaded using
+         * @ref setImage().
+         */
+        void flushImage(const ImageView2D& image);
+
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    protected:
+    #else
+    private:
+    #endif
+        /** @brief Implementation for @ref image() */
+        virtual Image2D doImage();
+
     private:
         void MAGNUM_LOCAL initialize(TextureFormat internalFormat, const Vector2i& size);
 
@@ -194,6 +348,19 @@ class MAGNUM_TEXT_EXPORT GlyphCache {
         Texture2D _texture;
 
         std::unordered_map<UnsignedInt, std::pair<Vector2i, Range2Di>> glyphs;
+
+        TextureTools::AtlasShelfAllocator _allocator;
+        /* Reserved regions not used by any glyph yet, indexed by their
+           position */
+        std::unordered_map<UnsignedLong, Range2Di> _reserved;
+        /* Reserved regions (with padding) not uploaded yet */
+        std::vector<Range2Di> _dirty;
+        /* Last use of glyphs in reserved regions and usage statistics,
+           modified by the const operator[]() and contains() */
+        mutable std::unordered_map<UnsignedInt, UnsignedLong> _lastUse;
+        mutable UnsignedLong _useCounter;
+        mutable Statistics _statistics;
+        bool _evictionEnabled, _hasExternalGlyphs;
 };
 
 }}
@@ -0,0 +1,157 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "LayoutCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <Corrade/Utility/MurmurHash2.h>
+#include <Corrade/Utility/Unicode.h>
+
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/GlyphCache.h"
+
+namespace Magnum { namespace Text {
+
+namespace {
+    std::size_t hashText(const Containers::ArrayView<const char> text) {
+        std::size_t hash;
+        std::memcpy(&hash, Utility::MurmurHash2()(text.data(), text.size()).byteArray(), sizeof(std::size_t));
+        return hash;
+    }
+
+    /* Approximate memory used by a layout */
+    template<class T> std::size_t entryBytes(const T& entry) {
+        return sizeof(T) + entry.text.size() + entry.vertices.size()*sizeof(AbstractRenderer::Vertex) + entry.glyphs.size()*sizeof(typename decltype(entry.glyphs)::value_type);
+    }
+}
+
+LayoutCache::LayoutCache(const std::size_t byteBudget): _byteBudget{byteBudget}, _usedBytes{0}, _statistics{} {}
+
+LayoutCache::~LayoutCache() = default;
+
+LayoutCache& LayoutCache::setByteBudget(const std::size_t byteBudget) {
+    _byteBudget = byteBudget;
+    evictOverBudget();
+    return *this;
+}
+
+std::tuple<Containers::ArrayView<const AbstractRenderer::Vertex>, Range2D> LayoutCache::layout(AbstractFont& font, const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, const Alignment alignment) {
+    const std::size_t hash = hashText(text);
+
+    /* Find the layout among all with the same text hash */
+    for(auto found = _lookup.equal_range(hash); found.first != found.second; ++found.first) {
+        const std::list<Entry>::iterator it = found.first->second;
+        if(it->font != &font || it->cache != &cache || it->size != size || it->alignment != alignment || it->text.size() != text.size() || std::memcmp(it->text.data(), text.data(), text.size()) != 0)
+            continue;
+
+        /* Look up all glyphs, which marks them as recently used in the glyph
+           cache. If any of them was evicted or moved since, the texture
+           coordinates are wrong and the text needs to be laid out again. */
+        bool changed = false;
+        for(const std::pair<UnsignedInt, Range2Di>& glyph: it->glyphs) {
+            if(cache[glyph.first].second == glyph.second) continue;
+            changed = true;
+            break;
+        }
+        if(changed) {
+            evict(it);
+            break;
+        }
+
+        /* Mark as most recently used */
+        _entries.splice(_entries.begin(), _entries, it);
+        ++_statistics.hits;
+        return std::make_tuple(Containers::ArrayView<const AbstractRenderer::Vertex>{it->vertices.data(), it->vertices.size()}, it->rectangle);
+    }
+
+    ++_statistics.misses;
+
+    /* Render the text, assuming there's at most one glyph for each byte
+       similarly to AbstractRenderer::render() */
+    _vertices.resize(text.size()*4);
+    UnsignedInt glyphCount;
+    Range2D rectangle;
+    std::tie(glyphCount, rectangle) = AbstractRenderer::render(font, cache, size, text, {_vertices.data(), _vertices.size()}, _layouter, alignment);
+
+    /* Put it into the cache */
+    _entries.push_front(Entry{&font, &cache, size, alignment, hash, std::string{text.data(), text.size()}, std::vector<AbstractRenderer::Vertex>(_vertices.begin(), _vertices.begin() + glyphCount*4), {}, rectangle});
+    _lookup.emplace(hash, _entries.begin());
+
+    /* Remember the glyphs used by the layout together with their current
+       location in the glyph cache, each glyph just once */
+    Entry& entry = _entries.front();
+    for(std::size_t i = 0; i != entry.text.size(); ) {
+        char32_t character;
+        std::tie(character, i) = Utility::Unicode::nextChar(entry.text, i);
+        if(character != U'\n') entry.glyphs.emplace_back(font.glyphId(character), Range2Di{});
+    }
+    std::sort(entry.glyphs.begin(), entry.glyphs.end(), [](const std::pair<UnsignedInt, Range2Di>& a, const std::pair<UnsignedInt, Range2Di>& b) {
+        return a.first < b.first;
+    });
+    entry.glyphs.erase(std::unique(entry.glyphs.begin(), entry.glyphs.end(), [](const std::pair<UnsignedInt, Range2Di>& a, const std::pair<UnsignedInt, Range2Di>& b) {
+        return a.first == b.first;
+    }), entry.glyphs.end());
+    entry.glyphs.shrink_to_fit();
+    for(std::pair<UnsignedInt, Range2Di>& glyph: entry.glyphs)
+        glyph.second = cache[glyph.first].second;
+
+    _usedBytes += entryBytes(_entries.front());
+    evictOverBudget();
+
+    return std::make_tuple(Containers::ArrayView<const AbstractRenderer::Vertex>{entry.vertices.data(), entry.vertices.size()}, entry.rectangle);
+}
+
+void LayoutCache::evict(const std::list<Entry>::iterator it) {
+    for(auto found = _lookup.equal_range(it->hash); found.first != found.second; ++found.first) {
+        if(found.first->second != it) continue;
+        _lookup.erase(found.first);
+        break;
+    }
+
+    _usedBytes -= entryBytes(*it);
+    _entries.erase(it);
+}
+
+void LayoutCache::evictOverBudget() {
+    /* Always keep the most recently used layout */
+    while(_usedBytes > _byteBudget && _entries.size() > 1) {
+        evict(std::prev(_entries.end()));
+        ++_statistics.evictions;
+    }
+}
+
+void LayoutCache::clear() {
+    _entries.clear();
+    _lookup.clear();
+    _usedBytes = 0;
+}
+
+void LayoutCache::resetStatistics() {
+    _statistics = Statistics{};
+}
+
+}}
@@ -0,0 +1,207 @@
+#ifndef Magnum_Text_LayoutCache_h
+#define Magnum_Text_LayoutCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Text::LayoutCache
+ */
+
+#include <list>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "Magnum/Text/Renderer.h"
+
+namespace Magnum { namespace Text {
+
+/**
+@brief Text layout cache
+
+Remembers vertex data of laid out texts, so texts that are rendered
+repeatedly don't need to go through glyph lookup and quad generation again.
+Layouts are identified by font, glyph cache, font size, alignment and the
+text itself.
+@code
+Text::LayoutCache layoutCache{1024*1024};
+
+// for every label, each frame
+Containers::ArrayView<const Text::AbstractRenderer::Vertex> vertices;
+Range2D rectangle;
+std::tie(vertices, rectangle) = layoutCache.layout(*font, glyphCache, 0.15f,
+    {label.data(), label.size()}, Text::Alignment::LineCenter);
+@endcode
+
+The cache can be also used by @ref Renderer, see
+@ref AbstractRenderer::setLayoutCache().
+
+## Memory budget
+
+Memory used by the cached layouts (i.e. copy of the text, vertex data and
+fixed bookkeeping overhead for each of them) is limited by the budget passed
+in constructor. When it is exceeded, layouts that weren't used for the
+longest time are evicted. The most recently used layout is always kept, even
+if it alone exceeds the budget.
+
+## Glyph cache changes
+
+The cached vertex data contain texture coordinates of glyphs in the glyph
+cache. Each cached layout remembers IDs of its glyphs, as returned by
+@ref AbstractFont::glyphId(), and looks them up in the glyph cache every time
+it's used. That marks them as recently used if
+@ref GlyphCache::setEvictionEnabled() "glyph eviction is enabled" and the
+lookups are counted in @ref GlyphCache::statistics(). If any of the glyphs
+got evicted or its location in the glyph cache changed, only the layouts that
+use it are redone. Changes that don't affect glyph location, such as
+uploading a different image for the same glyph, are not detected and
+@ref clear() should be called after them.
+*/
+class MAGNUM_TEXT_EXPORT LayoutCache {
+    public:
+        /**
+         * @brief Usage statistics
+         *
+         * @see @ref statistics(), @ref resetStatistics()
+         */
+        struct Statistics {
+            /** @brief Count of lookups of layouts present in the cache */
+            std::size_t hits;
+
+            /**
+             * @brief Count of lookups of layouts not present in the cache
+             *
+             * Includes lookups of layouts that had to be redone because of
+             * glyph cache changes.
+             */
+            std::size_t misses;
+
+            /** @brief Count of layouts evicted from the cache */
+            std::size_t evictions;
+        };
+
+        /**
+         * @brief Constructor
+         * @param byteBudget    Maximal amount of memory used by cached
+         *      layouts, in bytes
+         */
+        explicit LayoutCache(std::size_t byteBudget);
+
+        /** @brief Copying is not allowed */
+        LayoutCache(const LayoutCache&) = delete;
+
+        ~LayoutCache();
+
+        /** @brief Copying is not allowed */
+        LayoutCache& operator=(const LayoutCache&) = delete;
+
+        /** @brief Memory budget in bytes */
+        std::size_t byteBudget() const { return _byteBudget; }
+
+        /**
+         * @brief Set memory budget
+         * @return Reference to self (for method chaining)
+         *
+         * Evicts least recently used layouts if the new budget is smaller
+         * than @ref usedBytes().
+         */
+        LayoutCache& setByteBudget(std::size_t byteBudget);
+
+        /** @brief Memory used by cached layouts in bytes */
+        std::size_t usedBytes() const { return _usedBytes; }
+
+        /** @brief Count of cached layouts */
+        std::size_t count() const { return _entries.size(); }
+
+        /**
+         * @brief Layout the text
+         * @param font          Font
+         * @param cache         Glyph cache
+         * @param size          Font size
+         * @param text          Text to layout
+         * @param alignment     Text alignment
+         *
+         * If the layout is in the cache, returns its vertex data and
+         * rectangle spanning the text. Otherwise renders the text using
+         * @ref AbstractRenderer::render(AbstractFont&, const GlyphCache&, Float, Containers::ArrayView<const char>, Containers::ArrayView<AbstractRenderer::Vertex>, std::unique_ptr<AbstractLayouter>&, Alignment),
+         * puts it into the cache and evicts old layouts if the budget is
+         * exceeded. The returned vertex data are valid until the next call
+         * to this function, @ref setByteBudget() or @ref clear(). Four
+         * vertices are returned for each glyph, in the same order as in
+         * @ref AbstractRenderer::vertexBuffer().
+         *
+         * Looking up a cached layout doesn't do any allocations, but all its
+         * glyphs are looked up in @p cache to verify they didn't change, see
+         * the class documentation for details.
+         */
+        std::tuple<Containers::ArrayView<const AbstractRenderer::Vertex>, Range2D> layout(AbstractFont& font, const GlyphCache& cache, Float size, Containers::ArrayView<const char> text, Alignment alignment = Alignment::LineLeft);
+
+        /** @brief Remove all layouts from the cache */
+        void clear();
+
+        /**
+         * @brief Usage statistics
+         *
+         * @see @ref resetStatistics()
+         */
+        const Statistics& statistics() const { return _statistics; }
+
+        /** @brief Reset usage statistics to zero */
+        void resetStatistics();
+
+    private:
+        struct Entry {
+            AbstractFont* font;
+            const GlyphCache* cache;
+            Float size;
+            Alignment alignment;
+            std::size_t hash;
+            std::string text;
+            std::vector<AbstractRenderer::Vertex> vertices;
+            /* Glyphs used by the layout and their rectangles in the glyph
+               cache at the time of layouting */
+            std::vector<std::pair<UnsignedInt, Range2Di>> glyphs;
+            Range2D rectangle;
+        };
+
+        void MAGNUM_LOCAL evict(std::list<Entry>::iterator it);
+        void MAGNUM_LOCAL evictOverBudget();
+
+        std::size_t _byteBudget, _usedBytes;
+        /* Most recently used first */
+        std::list<Entry> _entries;
+        /* Text hash to entries with that text */
+        std::unordered_multimap<std::size_t, std::list<Entry>::iterator> _lookup;
+        /* Reused for layouting all texts */
+        std::unique_ptr<AbstractLayouter> _layouter;
+        std::vector<AbstractRenderer::Vertex> _vertices;
+        Statistics _statistics;
+};
+
+}}
+
+#endif
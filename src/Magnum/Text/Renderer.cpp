@@ -25,12 +25,15 @@
 
 #include "Renderer.h"
 
+#include <algorithm>
+
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Mesh.h"
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Shaders/AbstractVector.h"
 #include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/LayoutCache.h"
 
 namespace Magnum { namespace Text {
 
@@ -56,58 +59,41 @@ template<class T> void createIndices(void* output, const UnsignedInt glyphCount)
     }
 }
 
-struct Vertex {
-    Vector2 position, textureCoordinates;
-};
+typedef AbstractRenderer::Vertex Vertex;
 
-std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment) {
-    /* Output data, reserve memory as when the text would be ASCII-only. In
-       reality the actual vertex count will be smaller, but allocating more at
-       once is better than reallocating many times later. */
-    std::vector<Vertex> vertices;
-    vertices.reserve(text.size()*4);
+/* Renders at most vertices.size()/4 glyphs into the output, returns count of
+   glyphs the whole text has, which can be larger */
+std::pair<UnsignedInt, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, const Containers::ArrayView<Vertex> vertices, std::unique_ptr<AbstractLayouter>& layouter, const Alignment alignment) {
+    const std::size_t capacity = vertices.size()/4;
 
-    /* Total rendered bounds, intial line position, line increment, last+1
-       vertex on previous line */
+    /* Total rendered bounds, intial line position, line increment, glyph
+       count, first glyph on current line */
     Range2D rectangle;
     Vector2 linePosition;
     const Vector2 lineAdvance = Vector2::yAxis(font.lineHeight()*size/font.size());
-    std::size_t lastLineLastVertex = 0;
-
-    /* Temp buffer so we don't allocate for each new line */
-    /**
-     * @todo C++1z: use std::string_view to avoid the one allocation and all
-     *      the copying altogether
-     */
-    std::string line;
-    line.reserve(text.size());
+    std::size_t glyphCount = 0;
+    std::size_t lineFirstGlyph = 0;
 
     /* Render each line separately and align it horizontally */
-    std::size_t pos, prevPos = 0;
+    const char* prevPos = text.begin();
+    const char* pos;
     do {
         /* Empty line, nothing to do (the rest is done below in while expression) */
-        if((pos = text.find('\n', prevPos)) == prevPos) continue;
-
-        /* Copy the line into the temp buffer */
-        line.assign(text, prevPos, pos-prevPos);
+        if((pos = std::find(prevPos, text.end(), '\n')) == prevPos) continue;
 
-        /* Layout the line */
-        const auto layouter = font.layout(cache, size, line);
-
-        /* Verify that we don't reallocate anything. The only problem might
-           arise when the layouter decides to compose one character from more
-           than one glyph (i.e. accents). Will remove the assert when this
-           issue arises. */
-        CORRADE_INTERNAL_ASSERT(vertices.size() + layouter->glyphCount()*4 <= vertices.capacity());
+        /* Layout the line, reusing the layouter from previous lines or calls
+           if possible */
+        font.layout(cache, size, {prevPos, std::size_t(pos - prevPos)}, layouter);
 
         /* Bounds of rendered line */
         Range2D lineRectangle;
 
-        /* Render all glyphs */
+        /* Render all glyphs, count those that don't fit */
         Vector2 cursorPosition(linePosition);
-        for(UnsignedInt i = 0; i != layouter->glyphCount(); ++i) {
+        for(UnsignedInt i = 0; i != layouter->glyphCount(); ++i, ++glyphCount) {
             Range2D quadPosition, textureCoordinates;
             std::tie(quadPosition, textureCoordinates) = layouter->renderGlyph(i, cursorPosition, lineRectangle);
+            if(glyphCount >= capacity) continue;
 
             /* 0---2
                |   |
@@ -115,12 +101,11 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
                |   |
                1---3 */
 
-            vertices.insert(vertices.end(), {
-                {quadPosition.topLeft(), textureCoordinates.topLeft()},
-                {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()},
-                {quadPosition.topRight(), textureCoordinates.topRight()},
-                {quadPosition.bottomRight(), textureCoordinates.bottomRight()}
-            });
+            Vertex* const out = vertices.data() + glyphCount*4;
+            out[0] = {quadPosition.topLeft(), textureCoordinates.topLeft()};
+            out[1] = {quadPosition.bottomLeft(), textureCoordinates.bottomLeft()};
+            out[2] = {quadPosition.topRight(), textureCoordinates.topRight()};
+            out[3] = {quadPosition.bottomRight(), textureCoordinates.bottomRight()};
         }
 
         /** @todo What about top-down text? */
@@ -138,8 +123,8 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
 
         /* Align positions and bounds on current line */
         lineRectangle = lineRectangle.translated(Vector2::xAxis(alignmentOffsetX));
-        for(auto it = vertices.begin()+lastLineLastVertex; it != vertices.end(); ++it)
-            it->position.x() += alignmentOffsetX;
+        for(std::size_t i = lineFirstGlyph*4, end = Math::min(glyphCount, capacity)*4; i < end; ++i)
+            vertices[i].position.x() += alignmentOffsetX;
 
         /* Add final line bounds to total bounds, similarly to AbstractFont::renderGlyph() */
         if(!rectangle.size().isZero()) {
@@ -150,8 +135,8 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
     /* Move to next line */
     } while(prevPos = pos+1,
             linePosition -= lineAdvance,
-            lastLineLastVertex = vertices.size(),
-            pos != std::string::npos);
+            lineFirstGlyph = glyphCount,
+            pos != text.end());
 
     /* Vertically align the rendered text */
     Float alignmentOffsetY = 0.0f;
@@ -166,9 +151,28 @@ std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& fo
 
     /* Align positions and bounds */
     rectangle = rectangle.translated(Vector2::yAxis(alignmentOffsetY));
-    for(auto& v: vertices) v.position.y() += alignmentOffsetY;
+    for(std::size_t i = 0, end = Math::min(glyphCount, capacity)*4; i != end; ++i)
+        vertices[i].position.y() += alignmentOffsetY;
 
-    return std::make_tuple(std::move(vertices), rectangle);
+    return {glyphCount, rectangle};
+}
+
+std::tuple<std::vector<Vertex>, Range2D> renderVerticesInternal(AbstractFont& font, const GlyphCache& cache, const Float size, const std::string& text, const Alignment alignment) {
+    /* Output data, allocate memory as when the text would be ASCII-only. In
+       reality the actual vertex count will be smaller, but allocating more at
+       once is better than reallocating many times later. */
+    std::vector<Vertex> vertices(text.size()*4);
+
+    std::unique_ptr<AbstractLayouter> layouter;
+    const std::pair<UnsignedInt, Range2D> glyphCountRectangle = renderVerticesInternal(font, cache, size, {text.data(), text.size()}, {vertices.data(), vertices.size()}, layouter, alignment);
+
+    /* The only problem might arise when the layouter decides to compose one
+       character from more than one glyph (i.e. accents). Will remove the
+       assert when this issue arises. */
+    CORRADE_INTERNAL_ASSERT(glyphCountRectangle.first*4 <= vertices.size());
+    vertices.resize(glyphCountRectangle.first*4);
+
+    return std::make_tuple(std::move(vertices), glyphCountRectangle.second);
 }
 
 std::pair<Containers::Array<char>, Mesh::IndexType> renderIndicesInternal(const UnsignedInt glyphCount) {
@@ -231,7 +235,7 @@ std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>,
     /* Deinterleave the vertices */
     std::vector<Vector2> positions, textureCoordinates;
     positions.reserve(vertices.size());
-    positions.reserve(textureCoordinates.size());
+    textureCoordinates.reserve(vertices.size());
     for(const auto& v: vertices) {
         positions.push_back(v.position);
         textureCoordinates.push_back(v.textureCoordinates);
@@ -245,6 +249,13 @@ std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>,
     return std::make_tuple(std::move(positions), std::move(textureCoordinates), std::move(indices), rectangle);
 }
 
+std::pair<UnsignedInt, Range2D> AbstractRenderer::render(AbstractFont& font, const GlyphCache& cache, const Float size, const Containers::ArrayView<const char> text, const Containers::ArrayView<Vertex> vertices, std::unique_ptr<AbstractLayouter>& layouter, const Alignment alignment) {
+    const std::pair<UnsignedInt, Range2D> glyphCountRectangle = renderVerticesInternal(font, cache, size, text, vertices, layouter, alignment);
+    CORRADE_ASSERT(glyphCountRectangle.first*4 <= vertices.size(),
+        "Text::AbstractRenderer::render(): output with" << vertices.size() << "vertices too small to render" << glyphCountRectangle.first << "glyphs", {});
+    return glyphCountRectangle;
+}
+
 template<UnsignedInt dimensions> std::tuple<Mesh, Range2D> Renderer<dimensions>::render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Buffer& vertexBuffer, Buffer& indexBuffer, BufferUsage usage, Alignment alignment) {
     /* Finalize mesh configuration and return the result */
     auto r = renderInternal(font, cache, size, text, vertexBuffer, indexBuffer, usage, alignment);
@@ -302,7 +313,7 @@ void AbstractRenderer::bufferUnmapImplementationDefault(Buffer& buffer)
     #endif
 }
 
-AbstractRenderer::AbstractRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{Buffer::TargetHint::Array}, _indexBuffer{Buffer::TargetHint::ElementArray}, font(font), cache(cache), size(size), _alignment(alignment), _capacity(0) {
+AbstractRenderer::AbstractRenderer(AbstractFont& font, const GlyphCache& cache, const Float size, const Alignment alignment): _vertexBuffer{Buffer::TargetHint::Array}, _indexBuffer{Buffer::TargetHint::ElementArray}, font(font), cache(cache), size(size), _alignment(alignment), _capacity(0), _layoutCache(nullptr) {
     #ifndef MAGNUM_TARGET_GLES
     MAGNUM_ASSERT_EXTENSION_SUPPORTED(Extensions::GL::ARB::map_buffer_range);
     #elif defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
@@ -373,27 +384,44 @@ void AbstractRenderer::reserve(const uint32_t glyphCount, const BufferUsage vert
 }
 
 void AbstractRenderer::render(const std::string& text) {
-    /* Render vertex data */
-    std::vector<Vertex> vertexData;
-    _rectangle = {};
-    std::tie(vertexData, _rectangle) = renderVerticesInternal(font, cache, size, text, _alignment);
+    /* Take the vertex data from the layout cache, if set */
+    if(_layoutCache) {
+        Containers::ArrayView<const Vertex> cached;
+        std::tie(cached, _rectangle) = _layoutCache->layout(font, cache, size, {text.data(), text.size()}, _alignment);
+
+        const UnsignedInt glyphCount = cached.size()/4;
+        CORRADE_ASSERT(glyphCount <= _capacity,
+            "Text::Renderer::render(): capacity" << _capacity << "too small to render" << glyphCount << "glyphs", );
+
+        if(glyphCount) {
+            Vertex* const vertices = static_cast<Vertex*>(bufferMapImplementation(_vertexBuffer, cached.size()*sizeof(Vertex)));
+            CORRADE_INTERNAL_ASSERT(vertices);
+            std::copy(cached.begin(), cached.end(), vertices);
+            bufferUnmapImplementation(_vertexBuffer);
+        }
 
-    const UnsignedInt glyphCount = vertexData.size()/4;
-    const UnsignedInt vertexCount = glyphCount*4;
-    const UnsignedInt indexCount = glyphCount*6;
+        _mesh.setCount(glyphCount*6);
+        return;
+    }
+
+    /* Render directly into the mapped buffer, reusing the layouter from
+       previous calls. Glyphs that don't fit are only counted. */
+    const UnsignedInt capacityVertexCount = _capacity*4;
+    Containers::ArrayView<Vertex> vertices;
+    if(capacityVertexCount) {
+        vertices = {static_cast<Vertex*>(bufferMapImplementation(_vertexBuffer,
+            capacityVertexCount*sizeof(Vertex))), capacityVertexCount};
+        CORRADE_INTERNAL_ASSERT(vertices);
+    }
+    UnsignedInt glyphCount;
+    std::tie(glyphCount, _rectangle) = renderVerticesInternal(font, cache, size, {text.data(), text.size()}, vertices, _layouter, _alignment);
+    if(capacityVertexCount) bufferUnmapImplementation(_vertexBuffer);
 
     CORRADE_ASSERT(glyphCount <= _capacity,
         "Text::Renderer::render(): capacity" << _capacity << "too small to render" << glyphCount << "glyphs", );
 
-    /* Interleave the data into mapped buffer*/
-    Containers::ArrayView<Vertex> vertices(static_cast<Vertex*>(bufferMapImplementation(_vertexBuffer,
-        vertexCount*sizeof(Vertex))), vertexCount);
-    CORRADE_INTERNAL_ASSERT_OUTPUT(vertices);
-    std::copy(vertexData.begin(), vertexData.end(), vertices.begin());
-    bufferUnmapImplementation(_vertexBuffer);
-
     /* Update index count */
-    _mesh.setCount(indexCount);
+    _mesh.setCount(glyphCount*6);
 }
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
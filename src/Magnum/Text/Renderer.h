@@ -29,9 +29,11 @@
  * @brief Class @ref Magnum::Text::AbstractRenderer, @ref Magnum::Text::Renderer, typedef @ref Magnum::Text::Renderer2D, @ref Magnum::Text::Renderer3D
  */
 
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
+#include <Corrade/Containers/ArrayView.h>
 
 #include "Magnum/Math/Range.h"
 #include "Magnum/Buffer.h"
@@ -51,6 +53,17 @@ Not meant to be used directly, see @ref Renderer for more information.
 */
 class MAGNUM_TEXT_EXPORT AbstractRenderer {
     public:
+        /**
+         * @brief Vertex
+         *
+         * Layout of vertex data in @ref vertexBuffer() and in the output of
+         * @ref render(AbstractFont&, const GlyphCache&, Float, Containers::ArrayView<const char>, Containers::ArrayView<Vertex>, std::unique_ptr<AbstractLayouter>&, Alignment).
+         */
+        struct Vertex {
+            Vector2 position;           /**< @brief Position */
+            Vector2 textureCoordinates; /**< @brief Texture coordinates */
+        };
+
         /**
          * @brief Render text
          * @param font          Font
@@ -64,6 +77,31 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
          */
         static std::tuple<std::vector<Vector2>, std::vector<Vector2>, std::vector<UnsignedInt>, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, const std::string& text, Alignment alignment = Alignment::LineLeft);
 
+        /**
+         * @brief Render text into existing memory
+         * @param font          Font
+         * @param cache         Glyph cache
+         * @param size          Font size
+         * @param text          Text to render
+         * @param vertices      Where to put the vertices
+         * @param layouter      Layouter to reuse, can be `nullptr`
+         * @param alignment     Text alignment
+         *
+         * Writes four vertices for each glyph into @p vertices, in the same
+         * order as in @ref vertexBuffer(), and returns count of rendered
+         * glyphs and rectangle spanning the rendered text. The indices can be
+         * shared among all texts, as they are the same as produced by
+         * @ref reserve(). Expects that @p vertices is large enough to contain
+         * all glyphs, i.e. at least four times larger than the number of
+         * glyphs in the text.
+         *
+         * The @p layouter is reused for all lines of the text and then kept,
+         * see @ref AbstractFont::layout(const GlyphCache&, Float, Containers::ArrayView<const char>, std::unique_ptr<AbstractLayouter>&).
+         * If the font supports it, passing the same layouter to repeated
+         * calls doesn't do any allocations.
+         */
+        static std::pair<UnsignedInt, Range2D> render(AbstractFont& font, const GlyphCache& cache, Float size, Containers::ArrayView<const char> text, Containers::ArrayView<Vertex> vertices, std::unique_ptr<AbstractLayouter>& layouter, Alignment alignment = Alignment::LineLeft);
+
         /**
          * @brief Capacity for rendered glyphs
          *
@@ -83,6 +121,24 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         /** @brief Mesh */
         Mesh& mesh() { return _mesh; }
 
+        /** @brief Layout cache or `nullptr` if not set */
+        LayoutCache* layoutCache() const { return _layoutCache; }
+
+        /**
+         * @brief Set layout cache
+         * @return Reference to self (for method chaining)
+         *
+         * If set, @ref render(const std::string&) takes the vertex data from
+         * given cache and only copies them into the vertex buffer, so
+         * rendering texts that were already rendered before doesn't need to
+         * lay them out again. The cache can be shared among more renderers.
+         * Set to `nullptr` to disable caching. Initially no cache is set.
+         */
+        AbstractRenderer& setLayoutCache(LayoutCache* cache) {
+            _layoutCache = cache;
+            return *this;
+        }
+
         /**
          * @brief Reserve capacity for rendered glyphs
          *
@@ -100,9 +156,11 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         /**
          * @brief Render text
          *
-         * Renders the text to vertex buffer, reusing index buffer already
-         * filled with @ref reserve(). Rectangle spanning the rendered text is
-         * available through @ref rectangle().
+         * Renders the text directly into mapped vertex buffer, reusing index
+         * buffer already filled with @ref reserve(). Rectangle spanning the
+         * rendered text is available through @ref rectangle(). The layouter
+         * is kept between calls, so if the font supports it, rendering
+         * doesn't do any allocations.
          *
          * Initially no text is rendered.
          * @attention The capacity must be large enough to contain all glyphs,
@@ -132,6 +190,8 @@ class MAGNUM_TEXT_EXPORT AbstractRenderer {
         Alignment _alignment;
         UnsignedInt _capacity;
         Range2D _rectangle;
+        std::unique_ptr<AbstractLayouter> _layouter;
+        LayoutCache* _layoutCache;
 
         #if defined(MAGNUM_TARGET_GLES2) && !defined(CORRADE_TARGET_EMSCRIPTEN)
         typedef void*(*BufferMapImplementation)(Buffer&, GLsizeiptr);
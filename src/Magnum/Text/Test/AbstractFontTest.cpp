@@ -27,7 +27,7 @@
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Directory.h>
 
-#include "Magnum/Math/Vector2.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Text/AbstractFont.h"
 
 #include "configure.h"
@@ -39,11 +39,19 @@ struct AbstractFontTest: TestSuite::Tester {
 
     void openSingleData();
     void openFile();
+
+    void layoutReuse();
+    void layoutReuseNotSupported();
+    void layoutReuseDifferentFont();
 };
 
 AbstractFontTest::AbstractFontTest() {
     addTests({&AbstractFontTest::openSingleData,
-              &AbstractFontTest::openFile});
+              &AbstractFontTest::openFile,
+
+              &AbstractFontTest::layoutReuse,
+              &AbstractFontTest::layoutReuseNotSupported,
+              &AbstractFontTest::layoutReuseDifferentFont});
 }
 
 namespace {
@@ -72,6 +80,48 @@ class SingleDataFont: public Text::AbstractFont {
         bool opened;
 };
 
+class LayoutFont: public Text::AbstractFont {
+    public:
+        class Layouter: public AbstractLayouter {
+            public:
+                explicit Layouter(UnsignedInt glyphCount): AbstractLayouter(glyphCount) {}
+
+                void relayout(UnsignedInt glyphCount) { setGlyphCount(glyphCount); }
+
+            private:
+                std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt) override { return {}; }
+        };
+
+        explicit LayoutFont(bool relayoutSupported): relayoutSupported(relayoutSupported), layoutCount(0), relayoutCount(0) {}
+
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(char32_t) override { return 0; }
+
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, Float, const std::string& text) override {
+            ++layoutCount;
+            return std::unique_ptr<AbstractLayouter>(new Layouter(text.size()));
+        }
+
+        bool doRelayout(AbstractLayouter& layouter, const GlyphCache&, Float, Containers::ArrayView<const char> text) override {
+            if(!relayoutSupported) return false;
+            ++relayoutCount;
+            static_cast<Layouter&>(layouter).relayout(text.size());
+            return true;
+        }
+
+        bool relayoutSupported;
+        Int layoutCount, relayoutCount;
+};
+
+/* *static_cast<GlyphCache*>(nullptr) makes Clang Analyzer grumpy */
+char glyphCacheData;
+GlyphCache& nullGlyphCache = *reinterpret_cast<GlyphCache*>(&glyphCacheData);
+
 }
 
 void AbstractFontTest::openSingleData() {
@@ -91,6 +141,58 @@ void AbstractFontTest::openFile() {
     CORRADE_VERIFY(font.isOpened());
 }
 
+void AbstractFontTest::layoutReuse() {
+    LayoutFont font{true};
+    std::unique_ptr<AbstractLayouter> layouter;
+
+    /* First call creates the layouter */
+    font.layout(nullGlyphCache, 1.0f, {"hello", 5}, layouter);
+    CORRADE_VERIFY(layouter);
+    CORRADE_COMPARE(layouter->glyphCount(), 5);
+    CORRADE_COMPARE(font.layoutCount, 1);
+    CORRADE_COMPARE(font.relayoutCount, 0);
+
+    /* Second call reuses it */
+    AbstractLayouter* const previous = layouter.get();
+    font.layout(nullGlyphCache, 1.0f, {"hi", 2}, layouter);
+    CORRADE_VERIFY(layouter.get() == previous);
+    CORRADE_COMPARE(layouter->glyphCount(), 2);
+    CORRADE_COMPARE(font.layoutCount, 1);
+    CORRADE_COMPARE(font.relayoutCount, 1);
+}
+
+void AbstractFontTest::layoutReuseNotSupported() {
+    LayoutFont font{false};
+    std::unique_ptr<AbstractLayouter> layouter;
+
+    /* The layouter is created anew each time */
+    font.layout(nullGlyphCache, 1.0f, {"hello", 5}, layouter);
+    font.layout(nullGlyphCache, 1.0f, {"hi", 2}, layouter);
+    CORRADE_VERIFY(layouter);
+    CORRADE_COMPARE(layouter->glyphCount(), 2);
+    CORRADE_COMPARE(font.layoutCount, 2);
+    CORRADE_COMPARE(font.relayoutCount, 0);
+}
+
+void AbstractFontTest::layoutReuseDifferentFont() {
+    LayoutFont a{true}, b{true};
+
+    /* Layouter from another font is not passed to doRelayout() */
+    std::unique_ptr<AbstractLayouter> layouter = a.layout(nullGlyphCache, 1.0f, "hello");
+    b.layout(nullGlyphCache, 1.0f, {"hi", 2}, layouter);
+    CORRADE_VERIFY(layouter);
+    CORRADE_COMPARE(layouter->glyphCount(), 2);
+    CORRADE_COMPARE(a.layoutCount, 1);
+    CORRADE_COMPARE(b.layoutCount, 1);
+    CORRADE_COMPARE(b.relayoutCount, 0);
+
+    /* But the new one is */
+    b.layout(nullGlyphCache, 1.0f, {"hey", 3}, layouter);
+    CORRADE_COMPARE(layouter->glyphCount(), 3);
+    CORRADE_COMPARE(b.layoutCount, 1);
+    CORRADE_COMPARE(b.relayoutCount, 1);
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Text::Test::AbstractFontTest)
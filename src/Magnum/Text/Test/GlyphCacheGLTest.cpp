@@ -23,8 +23,13 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <sstream>
 #include <tuple>
 
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/TextureFormat.h"
 #include "Magnum/Test/AbstractOpenGLTester.h"
 #include "Magnum/Text/GlyphCache.h"
 
@@ -34,14 +39,48 @@ struct GlyphCacheGLTest: Magnum::Test::AbstractOpenGLTester {
     explicit GlyphCacheGLTest();
 
     void initialize();
+    void initializeNoCreate();
     void access();
     void reserve();
+    void reserveIncremental();
+    void reserveUnusedSpace();
+    void reserveTooSmall();
+    void reserveEmptyGlyph();
+
+    void evict();
+    void evictDisabled();
+    void evictNotEnoughSpace();
+    void evictDisabledContains();
+    void evictNotFoundGlyph();
+    void overwriteNotFoundGlyph();
+
+    void statistics();
+    void flushImage();
+    void flushImageNotAdjacent();
+    void image();
 };
 
 GlyphCacheGLTest::GlyphCacheGLTest() {
     addTests({&GlyphCacheGLTest::initialize,
+              &GlyphCacheGLTest::initializeNoCreate,
               &GlyphCacheGLTest::access,
-              &GlyphCacheGLTest::reserve});
+              &GlyphCacheGLTest::reserve,
+              &GlyphCacheGLTest::reserveIncremental,
+              &GlyphCacheGLTest::reserveUnusedSpace,
+              &GlyphCacheGLTest::reserveTooSmall,
+              &GlyphCacheGLTest::reserveEmptyGlyph,
+
+              &GlyphCacheGLTest::evict,
+              &GlyphCacheGLTest::evictDisabled,
+              &GlyphCacheGLTest::evictNotEnoughSpace,
+              &GlyphCacheGLTest::evictDisabledContains,
+              &GlyphCacheGLTest::evictNotFoundGlyph,
+              &GlyphCacheGLTest::overwriteNotFoundGlyph,
+
+              &GlyphCacheGLTest::statistics,
+              &GlyphCacheGLTest::flushImage,
+              &GlyphCacheGLTest::flushImageNotAdjacent,
+              &GlyphCacheGLTest::image});
 }
 
 void GlyphCacheGLTest::initialize() {
@@ -53,6 +92,21 @@ void GlyphCacheGLTest::initialize() {
     #endif
 }
 
+void GlyphCacheGLTest::initializeNoCreate() {
+    Text::GlyphCache cache{NoCreate, {1024, 2048}, Vector2i{2}};
+
+    /* No texture is created, glyph bookkeeping works as usual */
+    CORRADE_COMPARE(cache.texture().id(), 0);
+    CORRADE_COMPARE(cache.textureSize(), Vector2i(1024, 2048));
+    CORRADE_COMPARE(cache.padding(), Vector2i{2});
+    CORRADE_COMPARE(cache.glyphCount(), 1);
+
+    std::vector<Range2Di> ranges = cache.reserve({{6, 6}});
+    CORRADE_COMPARE(ranges.size(), 1);
+    cache.insert(1, {}, ranges[0]);
+    CORRADE_COMPARE(cache.glyphCount(), 2);
+}
+
 void GlyphCacheGLTest::access() {
     Text::GlyphCache cache(Vector2i(236));
     Vector2i position;
@@ -91,6 +145,267 @@ void GlyphCacheGLTest::reserve() {
     CORRADE_VERIFY(!cache.reserve({{5, 3}}).empty());
 }
 
+void GlyphCacheGLTest::reserveIncremental() {
+    Text::GlyphCache cache{Vector2i{64}, Vector2i{64}, Vector2i{1}};
+
+    std::vector<Range2Di> first = cache.reserve({{14, 14}, {10, 14}});
+    CORRADE_COMPARE(first.size(), 2);
+    cache.insert(1, {}, first[0]);
+    cache.insert(2, {}, first[1]);
+
+    /* Reserving in a non-empty cache doesn't overlap existing glyphs */
+    std::vector<Range2Di> second = cache.reserve({{14, 14}});
+    CORRADE_COMPARE(second.size(), 1);
+    for(const Range2Di& range: first) {
+        const Range2Di a = range.padded(Vector2i{1});
+        const Range2Di b = second[0].padded(Vector2i{1});
+        CORRADE_VERIFY(!((a.min() < b.max()).all() && (b.min() < a.max()).all()));
+    }
+    cache.insert(3, {}, second[0]);
+
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+    CORRADE_VERIFY(cache.contains(3));
+    CORRADE_VERIFY(!cache.contains(4));
+}
+
+void GlyphCacheGLTest::reserveUnusedSpace() {
+    Text::GlyphCache cache{Vector2i{64}};
+
+    /* Space not used by any glyph is reused on next reserve() */
+    CORRADE_COMPARE(cache.reserve({{64, 64}}).size(), 1);
+    CORRADE_COMPARE(cache.reserve({{64, 64}}).size(), 1);
+}
+
+void GlyphCacheGLTest::reserveTooSmall() {
+    Text::GlyphCache cache{Vector2i{64}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(cache.reserve({{32, 32}, {65, 8}}).empty());
+    CORRADE_COMPARE(out.str(), "Text::GlyphCache::reserve(): cache of size Vector(64, 64) is too small to fit 2 glyphs with padding Vector(0, 0)\n");
+
+    /* Nothing stays reserved after a failure */
+    CORRADE_COMPARE(cache.reserve({{64, 64}}).size(), 1);
+}
+
+void GlyphCacheGLTest::reserveEmptyGlyph() {
+    Text::GlyphCache cache{Vector2i{16}};
+
+    /* Empty glyphs (e.g. space) don't occupy any space */
+    std::vector<Range2Di> ranges = cache.reserve({{0, 0}, {16, 16}});
+    CORRADE_COMPARE(ranges.size(), 2);
+    cache.insert(1, {}, ranges[0]);
+    cache.insert(2, {}, ranges[1]);
+    CORRADE_COMPARE(cache.glyphCount(), 3);
+}
+
+void GlyphCacheGLTest::evict() {
+    Text::GlyphCache cache{Vector2i{32}};
+    CORRADE_VERIFY(!cache.isEvictionEnabled());
+    cache.setEvictionEnabled(true);
+    CORRADE_VERIFY(cache.isEvictionEnabled());
+
+    std::vector<Range2Di> ranges = cache.reserve({{16, 16}, {16, 16}, {16, 16}, {16, 16}});
+    CORRADE_COMPARE(ranges.size(), 4);
+    for(UnsignedInt i = 0; i != 4; ++i) cache.insert(i + 1, {}, ranges[i]);
+
+    /* Glyph 3 is the least recently used after these */
+    cache[1];
+    cache[2];
+    CORRADE_VERIFY(cache.contains(4));
+
+    std::vector<Range2Di> more = cache.reserve({{16, 16}});
+    CORRADE_COMPARE(more, std::vector<Range2Di>{ranges[2]});
+    CORRADE_VERIFY(!cache.contains(3));
+    CORRADE_COMPARE(cache.glyphCount(), 4);
+    CORRADE_COMPARE(cache.statistics().evictions, 1);
+
+    /* Evicted glyph falls back to glyph 0 */
+    CORRADE_COMPARE(cache[3], cache[0]);
+}
+
+void GlyphCacheGLTest::evictDisabled() {
+    Text::GlyphCache cache{Vector2i{16}};
+    std::vector<Range2Di> ranges = cache.reserve({{16, 16}});
+    CORRADE_COMPARE(ranges.size(), 1);
+    cache.insert(1, {}, ranges[0]);
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(cache.reserve({{1, 1}}).empty());
+    CORRADE_VERIFY(cache.contains(1));
+    CORRADE_COMPARE(cache.statistics().evictions, 0);
+}
+
+void GlyphCacheGLTest::evictNotEnoughSpace() {
+    Text::GlyphCache cache{Vector2i{32}};
+    cache.setEvictionEnabled(true);
+
+    std::vector<Range2Di> ranges = cache.reserve({{16, 16}, {16, 16}, {16, 16}, {16, 16}});
+    CORRADE_COMPARE(ranges.size(), 4);
+    for(UnsignedInt i = 0; i != 4; ++i) cache.insert(i + 1, {}, ranges[i]);
+
+    /* Doesn't fit even with everything evicted, so nothing is evicted */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(cache.reserve({{16, 16}, {33, 8}}).empty());
+    CORRADE_COMPARE(cache.glyphCount(), 5);
+    for(UnsignedInt i = 0; i != 4; ++i) CORRADE_VERIFY(cache.contains(i + 1));
+    CORRADE_COMPARE(cache.statistics().evictions, 0);
+
+    /* The glyph space is still occupied */
+    CORRADE_COMPARE(cache.reserve({{16, 16}}), std::vector<Range2Di>{ranges[0]});
+    CORRADE_VERIFY(!cache.contains(1));
+}
+
+void GlyphCacheGLTest::evictDisabledContains() {
+    Text::GlyphCache cache{Vector2i{32}};
+
+    std::vector<Range2Di> ranges = cache.reserve({{16, 16}, {16, 16}, {16, 16}, {16, 16}});
+    CORRADE_COMPARE(ranges.size(), 4);
+    for(UnsignedInt i = 0; i != 4; ++i) cache.insert(i + 1, {}, ranges[i]);
+
+    /* Lookups with eviction disabled don't affect the order */
+    CORRADE_VERIFY(cache.contains(1));
+    cache[1];
+
+    cache.setEvictionEnabled(true);
+    CORRADE_COMPARE(cache.reserve({{16, 16}}), std::vector<Range2Di>{ranges[0]});
+    CORRADE_VERIFY(!cache.contains(1));
+    CORRADE_VERIFY(cache.contains(2));
+}
+
+void GlyphCacheGLTest::evictNotFoundGlyph() {
+    Text::GlyphCache cache{Vector2i{16}};
+    cache.setEvictionEnabled(true);
+    std::vector<Range2Di> ranges = cache.reserve({{16, 16}});
+    CORRADE_COMPARE(ranges.size(), 1);
+    cache.insert(0, {}, ranges[0]);
+
+    /* Glyph 0 is never evicted */
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(cache.reserve({{1, 1}}).empty());
+    CORRADE_COMPARE(cache[0].second, ranges[0]);
+}
+
+void GlyphCacheGLTest::overwriteNotFoundGlyph() {
+    Text::GlyphCache cache{Vector2i{32}};
+    std::vector<Range2Di> first = cache.reserve({{32, 16}});
+    CORRADE_COMPARE(first.size(), 1);
+    cache.insert(0, {}, first[0]);
+
+    std::vector<Range2Di> second = cache.reserve({{32, 16}});
+    CORRADE_COMPARE(second.size(), 1);
+    cache.insert(0, {}, second[0]);
+
+    /* Space of the previous glyph 0 is freed */
+    CORRADE_COMPARE(cache.reserve({{32, 16}}), first);
+}
+
+void GlyphCacheGLTest::statistics() {
+    Text::GlyphCache cache{Vector2i{64}};
+    CORRADE_COMPARE(cache.statistics().hits, 0);
+    CORRADE_COMPARE(cache.statistics().misses, 0);
+    CORRADE_COMPARE(cache.statistics().evictions, 0);
+    CORRADE_COMPARE(cache.statistics().uploadedBytes, 0);
+
+    cache.insert(1, {}, {{0, 0}, {8, 8}});
+    cache[0];
+    cache[1];
+    cache[1];
+    cache[2];
+    CORRADE_COMPARE(cache.statistics().hits, 3);
+    CORRADE_COMPARE(cache.statistics().misses, 1);
+
+    /* contains() isn't counted */
+    CORRADE_VERIFY(cache.contains(1));
+    CORRADE_VERIFY(!cache.contains(2));
+    CORRADE_COMPARE(cache.statistics().hits, 3);
+    CORRADE_COMPARE(cache.statistics().misses, 1);
+
+    cache.resetStatistics();
+    CORRADE_COMPARE(cache.statistics().hits, 0);
+    CORRADE_COMPARE(cache.statistics().misses, 0);
+}
+
+void GlyphCacheGLTest::flushImage() {
+    #ifndef MAGNUM_TARGET_GLES2
+    Text::GlyphCache cache{TextureFormat::RGBA8, Vector2i{64}, Vector2i{64}, Vector2i{1}};
+    #else
+    Text::GlyphCache cache{TextureFormat::RGBA, Vector2i{64}, Vector2i{64}, Vector2i{1}};
+    #endif
+
+    /* One tall glyph in the first row, two in the second */
+    std::vector<Range2Di> ranges = cache.reserve({{6, 6}, {8, 6}, {6, 20}});
+    CORRADE_COMPARE(ranges.size(), 3);
+    for(UnsignedInt i = 0; i != 3; ++i) cache.insert(i + 1, {}, ranges[i]);
+
+    const char data[64*64*4]{};
+    cache.flushImage(ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i{64}, data});
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Only the padded glyph rectangles, merged per row, are uploaded */
+    CORRADE_COMPARE(cache.statistics().uploadedBytes, (8*22 + (8 + 10)*8)*4);
+
+    /* Nothing changed since */
+    cache.flushImage(ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i{64}, data});
+    CORRADE_COMPARE(cache.statistics().uploadedBytes, (8*22 + (8 + 10)*8)*4);
+
+    /* Uploading directly is counted as well */
+    cache.setImage({}, ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i{4}, data});
+    CORRADE_COMPARE(cache.statistics().uploadedBytes, (8*22 + (8 + 10)*8 + 16)*4);
+}
+
+void GlyphCacheGLTest::flushImageNotAdjacent() {
+    #ifndef MAGNUM_TARGET_GLES2
+    Text::GlyphCache cache{TextureFormat::RGBA8, Vector2i{64}, Vector2i{64}, Vector2i{1}};
+    #else
+    Text::GlyphCache cache{TextureFormat::RGBA, Vector2i{64}, Vector2i{64}, Vector2i{1}};
+    #endif
+
+    /* Three glyphs in one row, the middle one left unused */
+    std::vector<Range2Di> ranges = cache.reserve({{6, 6}, {6, 6}, {6, 6}});
+    CORRADE_COMPARE(ranges.size(), 3);
+    cache.insert(1, {}, ranges[0]);
+    cache.insert(2, {}, ranges[2]);
+
+    const char data[64*64*4]{};
+    cache.flushImage(ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i{64}, data});
+    CORRADE_COMPARE(cache.statistics().uploadedBytes, 3*8*8*4);
+
+    /* Space of the middle one gets reused, together with space at the end of
+       the row. These two aren't next to each other, so they're uploaded
+       separately. */
+    std::vector<Range2Di> more = cache.reserve({{6, 6}, {6, 6}});
+    CORRADE_COMPARE(more.size(), 2);
+    CORRADE_COMPARE(more[0].min().y(), ranges[0].min().y());
+    CORRADE_COMPARE(more[1].min().y(), ranges[0].min().y());
+    cache.flushImage(ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, Vector2i{64}, data});
+    CORRADE_COMPARE(cache.statistics().uploadedBytes, (3 + 2)*8*8*4);
+}
+
+void GlyphCacheGLTest::image() {
+    #ifdef MAGNUM_TARGET_GLES
+    CORRADE_SKIP("Texture image queries are not available on OpenGL ES.");
+    #else
+    Text::GlyphCache cache{Vector2i{4}};
+
+    const char data[]{  0,   8,  16,  24,
+                       32,  40,  48,  56,
+                       64,  72,  80,  88,
+                       96, 104, 112, 120};
+    cache.setImage({}, ImageView2D{PixelFormat::Red, PixelType::UnsignedByte, Vector2i{4}, data});
+
+    const Image2D image = cache.image();
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(image.size(), Vector2i{4});
+    CORRADE_COMPARE(image.format(), PixelFormat::Red);
+    CORRADE_COMPARE((std::vector<char>{image.data<char>(), image.data<char>() + 16}),
+                    (std::vector<char>{data, data + 16}));
+    #endif
+}
+
 }}}
 
 MAGNUM_GL_TEST_MAIN(Magnum::Text::Test::GlyphCacheGLTest)
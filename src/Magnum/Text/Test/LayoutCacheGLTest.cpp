@@ -0,0 +1,349 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <tuple>
+
+#include "Magnum/Test/AbstractOpenGLTester.h"
+#include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/GlyphCache.h"
+#include "Magnum/Text/LayoutCache.h"
+
+namespace Magnum { namespace Text { namespace Test {
+
+struct LayoutCacheGLTest: Magnum::Test::AbstractOpenGLTester {
+    explicit LayoutCacheGLTest();
+
+    void layout();
+    void layoutDifferentParameters();
+    void layoutEmpty();
+
+    void evict();
+    void evictTooLarge();
+    void setByteBudget();
+    void glyphCacheEviction();
+
+    void clear();
+    void statistics();
+};
+
+LayoutCacheGLTest::LayoutCacheGLTest() {
+    addTests({&LayoutCacheGLTest::layout,
+              &LayoutCacheGLTest::layoutDifferentParameters,
+              &LayoutCacheGLTest::layoutEmpty,
+
+              &LayoutCacheGLTest::evict,
+              &LayoutCacheGLTest::evictTooLarge,
+              &LayoutCacheGLTest::setByteBudget,
+              &LayoutCacheGLTest::glyphCacheEviction,
+
+              &LayoutCacheGLTest::clear,
+              &LayoutCacheGLTest::statistics});
+}
+
+namespace {
+
+class TestLayouter: public Text::AbstractLayouter {
+    public:
+        explicit TestLayouter(Float size, std::size_t glyphCount): AbstractLayouter(glyphCount), _size(size) {}
+
+    private:
+        std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override {
+            return std::make_tuple(
+                Range2D({}, Vector2(3.0f, 2.0f)*((i+1)*_size)),
+                Range2D::fromSize({i*6.0f, 0.0f}, {6.0f, 10.0f}),
+                (Vector2::xAxis((i+1)*3.0f)+Vector2(1.0f, -1.0f))*_size
+            );
+        }
+
+        Float _size;
+};
+
+class TestFont: public Text::AbstractFont {
+    public:
+        explicit TestFont(): layoutCount(0) {}
+
+        Int layoutCount;
+
+    private:
+        Features doFeatures() const override { return {}; }
+
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(char32_t character) override { return character; }
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, const Float size, const std::string& text) override {
+            ++layoutCount;
+            return std::unique_ptr<AbstractLayouter>(new TestLayouter(size, text.size()));
+        }
+};
+
+}
+
+void LayoutCacheGLTest::layout() {
+    TestFont font;
+    GlyphCache glyphCache{Vector2i{16}};
+    LayoutCache cache{4096};
+    CORRADE_COMPARE(cache.byteBudget(), 4096);
+    CORRADE_COMPARE(cache.count(), 0);
+    CORRADE_COMPARE(cache.usedBytes(), 0);
+
+    Containers::ArrayView<const AbstractRenderer::Vertex> vertices;
+    Range2D rectangle;
+    std::tie(vertices, rectangle) = cache.layout(font, glyphCache, 0.25f, {"abc", 3}, Alignment::MiddleRightIntegral);
+    CORRADE_COMPARE(font.layoutCount, 1);
+    CORRADE_COMPARE(cache.count(), 1);
+    CORRADE_VERIFY(cache.usedBytes() > 3 + 12*sizeof(AbstractRenderer::Vertex));
+
+    /* The same as in RendererGLTest::renderData() */
+    const Vector2 offset{-5.0f, 0.0f};
+    CORRADE_COMPARE(rectangle, Range2D({0.0f, -0.5f}, {5.0f, 1.0f}).translated(offset));
+    CORRADE_COMPARE(vertices.size(), 12);
+    CORRADE_COMPARE(vertices[0].position, (Vector2{0.0f, 0.5f} + offset));
+    CORRADE_COMPARE(vertices[11].position, (Vector2{5.0f, -0.5f} + offset));
+    CORRADE_COMPARE(vertices[11].textureCoordinates, (Vector2{18.0f, 0.0f}));
+
+    /* Second time it's taken from the cache */
+    const std::string text = "abc";
+    Containers::ArrayView<const AbstractRenderer::Vertex> cachedVertices;
+    Range2D cachedRectangle;
+    std::tie(cachedVertices, cachedRectangle) = cache.layout(font, glyphCache, 0.25f, {text.data(), text.size()}, Alignment::MiddleRightIntegral);
+    CORRADE_COMPARE(font.layoutCount, 1);
+    CORRADE_COMPARE(cache.count(), 1);
+    CORRADE_VERIFY(cachedVertices.data() == vertices.data());
+    CORRADE_COMPARE(cachedVertices.size(), 12);
+    CORRADE_COMPARE(cachedRectangle, rectangle);
+}
+
+void LayoutCacheGLTest::layoutDifferentParameters() {
+    TestFont font, anotherFont;
+    GlyphCache glyphCache{Vector2i{16}}, anotherGlyphCache{Vector2i{16}};
+    LayoutCache cache{4096};
+
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    cache.layout(font, glyphCache, 0.25f, {"abd", 3});
+    cache.layout(font, glyphCache, 0.25f, {"ab", 2});
+    cache.layout(font, glyphCache, 0.5f, {"abc", 3});
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3}, Alignment::TopCenter);
+    cache.layout(font, anotherGlyphCache, 0.25f, {"abc", 3});
+    cache.layout(anotherFont, glyphCache, 0.25f, {"abc", 3});
+    CORRADE_COMPARE(font.layoutCount, 6);
+    CORRADE_COMPARE(anotherFont.layoutCount, 1);
+    CORRADE_COMPARE(cache.count(), 7);
+    CORRADE_COMPARE(cache.statistics().misses, 7);
+    CORRADE_COMPARE(cache.statistics().hits, 0);
+
+    /* All of them are cached separately */
+    Range2D rectangle;
+    std::tie(std::ignore, rectangle) = cache.layout(font, glyphCache, 0.5f, {"abc", 3});
+    CORRADE_COMPARE(rectangle, Range2D({0.0f, -1.0f}, {10.0f, 2.0f}));
+    std::tie(std::ignore, rectangle) = cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    CORRADE_COMPARE(rectangle, Range2D({0.0f, -0.5f}, {5.0f, 1.0f}));
+    CORRADE_COMPARE(cache.statistics().hits, 2);
+    CORRADE_COMPARE(font.layoutCount, 6);
+}
+
+void LayoutCacheGLTest::layoutEmpty() {
+    TestFont font;
+    GlyphCache glyphCache{Vector2i{16}};
+    LayoutCache cache{4096};
+
+    Containers::ArrayView<const AbstractRenderer::Vertex> vertices;
+    std::tie(vertices, std::ignore) = cache.layout(font, glyphCache, 0.25f, nullptr);
+    CORRADE_VERIFY(vertices.empty());
+    CORRADE_COMPARE(cache.count(), 1);
+
+    std::tie(vertices, std::ignore) = cache.layout(font, glyphCache, 0.25f, nullptr);
+    CORRADE_VERIFY(vertices.empty());
+    CORRADE_COMPARE(cache.statistics().hits, 1);
+}
+
+void LayoutCacheGLTest::evict() {
+    TestFont font;
+    GlyphCache glyphCache{Vector2i{16}};
+
+    /* Find out how much a three-glyph layout takes */
+    std::size_t entrySize;
+    {
+        LayoutCache cache{4096};
+        cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+        entrySize = cache.usedBytes();
+    }
+
+    /* Space for exactly two layouts */
+    LayoutCache cache{entrySize*2};
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    cache.layout(font, glyphCache, 0.25f, {"def", 3});
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_COMPARE(cache.usedBytes(), entrySize*2);
+    CORRADE_COMPARE(cache.statistics().evictions, 0);
+
+    /* Use the first so the second is the least recently used */
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    cache.layout(font, glyphCache, 0.25f, {"ghi", 3});
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_COMPARE(cache.usedBytes(), entrySize*2);
+    CORRADE_COMPARE(cache.statistics().evictions, 1);
+
+    font.layoutCount = 0;
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    CORRADE_COMPARE(font.layoutCount, 0);
+    cache.layout(font, glyphCache, 0.25f, {"def", 3});
+    CORRADE_COMPARE(font.layoutCount, 1);
+}
+
+void LayoutCacheGLTest::evictTooLarge() {
+    TestFont font;
+    GlyphCache glyphCache{Vector2i{16}};
+    LayoutCache cache{16};
+
+    /* The most recent layout is kept even if it doesn't fit */
+    Containers::ArrayView<const AbstractRenderer::Vertex> vertices;
+    std::tie(vertices, std::ignore) = cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    CORRADE_COMPARE(vertices.size(), 12);
+    CORRADE_COMPARE(cache.count(), 1);
+    CORRADE_VERIFY(cache.usedBytes() > cache.byteBudget());
+
+    std::tie(vertices, std::ignore) = cache.layout(font, glyphCache, 0.25f, {"ab", 2});
+    CORRADE_COMPARE(vertices.size(), 8);
+    CORRADE_COMPARE(cache.count(), 1);
+    CORRADE_COMPARE(cache.statistics().evictions, 1);
+}
+
+void LayoutCacheGLTest::setByteBudget() {
+    TestFont font;
+    GlyphCache glyphCache{Vector2i{16}};
+    LayoutCache cache{4096};
+
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    cache.layout(font, glyphCache, 0.25f, {"def", 3});
+    cache.layout(font, glyphCache, 0.25f, {"ghi", 3});
+    CORRADE_COMPARE(cache.count(), 3);
+    const std::size_t entrySize = cache.usedBytes()/3;
+
+    cache.setByteBudget(entrySize*2);
+    CORRADE_COMPARE(cache.byteBudget(), entrySize*2);
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_COMPARE(cache.usedBytes(), entrySize*2);
+    CORRADE_COMPARE(cache.statistics().evictions, 1);
+
+    /* The oldest one was evicted */
+    font.layoutCount = 0;
+    cache.layout(font, glyphCache, 0.25f, {"ghi", 3});
+    cache.layout(font, glyphCache, 0.25f, {"def", 3});
+    CORRADE_COMPARE(font.layoutCount, 0);
+
+    /* Zero budget keeps only the last one */
+    cache.setByteBudget(0);
+    CORRADE_COMPARE(cache.count(), 1);
+    cache.layout(font, glyphCache, 0.25f, {"def", 3});
+    CORRADE_COMPARE(font.layoutCount, 0);
+}
+
+void LayoutCacheGLTest::glyphCacheEviction() {
+    TestFont font;
+    GlyphCache glyphCache{Vector2i{32}};
+    glyphCache.setEvictionEnabled(true);
+    LayoutCache cache{4096};
+
+    std::vector<Range2Di> ranges = glyphCache.reserve({{16, 32}, {16, 32}});
+    CORRADE_COMPARE(ranges.size(), 2);
+    glyphCache.insert('a', {}, ranges[0]);
+    glyphCache.insert('x', {}, ranges[1]);
+
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    cache.layout(font, glyphCache, 0.25f, {"xyz", 3});
+    CORRADE_COMPARE(font.layoutCount, 2);
+
+    /* Using a cached layout marks its glyphs as recently used, so glyph x is
+       the least recently used now and gets evicted */
+    cache.layout(font, glyphCache, 0.25f, {"xyz", 3});
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    CORRADE_COMPARE(font.layoutCount, 2);
+    CORRADE_COMPARE(glyphCache.reserve({{16, 32}}), std::vector<Range2Di>{ranges[1]});
+    CORRADE_COMPARE(glyphCache.statistics().evictions, 1);
+    CORRADE_VERIFY(glyphCache.contains('a'));
+    CORRADE_VERIFY(!glyphCache.contains('x'));
+
+    /* Only the layout using the evicted glyph is redone */
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    CORRADE_COMPARE(font.layoutCount, 2);
+    cache.layout(font, glyphCache, 0.25f, {"xyz", 3});
+    CORRADE_COMPARE(font.layoutCount, 3);
+    CORRADE_COMPARE(cache.count(), 2);
+    CORRADE_COMPARE(cache.statistics().misses, 3);
+
+    /* And cached again */
+    cache.layout(font, glyphCache, 0.25f, {"xyz", 3});
+    CORRADE_COMPARE(font.layoutCount, 3);
+
+    /* Inserting a glyph that was missing before redoes the layout as well */
+    std::vector<Range2Di> more = glyphCache.reserve({{16, 32}});
+    CORRADE_COMPARE(more.size(), 1);
+    glyphCache.insert('y', {}, more[0]);
+    cache.layout(font, glyphCache, 0.25f, {"xyz", 3});
+    CORRADE_COMPARE(font.layoutCount, 4);
+}
+
+void LayoutCacheGLTest::clear() {
+    TestFont font;
+    GlyphCache glyphCache{Vector2i{16}};
+    LayoutCache cache{4096};
+
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    cache.layout(font, glyphCache, 0.25f, {"def", 3});
+    cache.clear();
+    CORRADE_COMPARE(cache.count(), 0);
+    CORRADE_COMPARE(cache.usedBytes(), 0);
+
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    CORRADE_COMPARE(font.layoutCount, 3);
+}
+
+void LayoutCacheGLTest::statistics() {
+    TestFont font;
+    GlyphCache glyphCache{Vector2i{16}};
+    LayoutCache cache{4096};
+    CORRADE_COMPARE(cache.statistics().hits, 0);
+    CORRADE_COMPARE(cache.statistics().misses, 0);
+    CORRADE_COMPARE(cache.statistics().evictions, 0);
+
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    cache.layout(font, glyphCache, 0.25f, {"abc", 3});
+    cache.layout(font, glyphCache, 0.25f, {"def", 3});
+    CORRADE_COMPARE(cache.statistics().hits, 2);
+    CORRADE_COMPARE(cache.statistics().misses, 2);
+
+    cache.resetStatistics();
+    CORRADE_COMPARE(cache.statistics().hits, 0);
+    CORRADE_COMPARE(cache.statistics().misses, 0);
+    CORRADE_COMPARE(cache.count(), 2);
+}
+
+}}}
+
+MAGNUM_GL_TEST_MAIN(Magnum::Text::Test::LayoutCacheGLTest)
@@ -25,6 +25,8 @@
 
 #include "Magnum/Test/AbstractOpenGLTester.h"
 #include "Magnum/Text/AbstractFont.h"
+#include "Magnum/Text/GlyphCache.h"
+#include "Magnum/Text/LayoutCache.h"
 #include "Magnum/Text/Renderer.h"
 
 namespace Magnum { namespace Text { namespace Test {
@@ -33,18 +35,22 @@ struct RendererGLTest: Magnum::Test::AbstractOpenGLTester {
     explicit RendererGLTest();
 
     void renderData();
+    void renderDataIntoMemory();
     void renderMesh();
     void renderMeshIndexType();
     void mutableText();
+    void mutableTextLayoutCache();
 
     void multiline();
 };
 
 RendererGLTest::RendererGLTest() {
     addTests({&RendererGLTest::renderData,
+              &RendererGLTest::renderDataIntoMemory,
               &RendererGLTest::renderMesh,
               &RendererGLTest::renderMeshIndexType,
               &RendererGLTest::mutableText,
+              &RendererGLTest::mutableTextLayoutCache,
 
               &RendererGLTest::multiline});
 }
@@ -55,6 +61,11 @@ class TestLayouter: public Text::AbstractLayouter {
     public:
         explicit TestLayouter(Float size, std::size_t glyphCount): AbstractLayouter(glyphCount), _size(size) {}
 
+        void relayout(Float size, std::size_t glyphCount) {
+            _size = size;
+            setGlyphCount(glyphCount);
+        }
+
     private:
         std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override {
             return std::make_tuple(
@@ -68,17 +79,29 @@ class TestLayouter: public Text::AbstractLayouter {
 };
 
 class TestFont: public Text::AbstractFont {
-    Features doFeatures() const override { return Feature::OpenData; }
+    public:
+        explicit TestFont(): layoutCount(0) {}
 
-    bool doIsOpened() const override { return true; }
-    void doClose() override {}
+        Int layoutCount;
 
-    UnsignedInt doGlyphId(char32_t) override { return 0; }
-    Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+    private:
+        Features doFeatures() const override { return Feature::OpenData; }
 
-    std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, const Float size, const std::string& text) override {
-        return std::unique_ptr<AbstractLayouter>(new TestLayouter(size, text.size()));
-    }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doGlyphId(char32_t) override { return 0; }
+        Vector2 doGlyphAdvance(UnsignedInt) override { return {}; }
+
+        std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache&, const Float size, const std::string& text) override {
+            ++layoutCount;
+            return std::unique_ptr<AbstractLayouter>(new TestLayouter(size, text.size()));
+        }
+
+        bool doRelayout(AbstractLayouter& layouter, const GlyphCache&, const Float size, const Containers::ArrayView<const char> text) override {
+            static_cast<TestLayouter&>(layouter).relayout(size, text.size());
+            return true;
+        }
 };
 
 /* *static_cast<GlyphCache*>(nullptr) makes Clang Analyzer grumpy */
@@ -170,6 +193,71 @@ void RendererGLTest::renderData() {
     }));
 }
 
+void RendererGLTest::renderDataIntoMemory() {
+    TestFont font;
+    std::vector<AbstractRenderer::Vertex> vertices(16);
+    std::unique_ptr<AbstractLayouter> layouter;
+    UnsignedInt glyphCount;
+    Range2D bounds;
+    std::tie(glyphCount, bounds) = Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, {"abc", 3}, {vertices.data(), vertices.size()}, layouter, Alignment::MiddleRightIntegral);
+    CORRADE_COMPARE(glyphCount, 3);
+    CORRADE_COMPARE(font.layoutCount, 1);
+
+    /* Alignment offset. Y would be -0.25f if it wasn't integral */
+    const Vector2 offset{-5.0f, 0.0f};
+
+    /* Bounds */
+    CORRADE_COMPARE(bounds, Range2D({0.0f, -0.5f}, {5.0f, 1.0f}).translated(offset));
+
+    /* Vertex positions and texture coordinates, the same as in renderData() */
+    std::vector<Vector2> positions, textureCoordinates;
+    for(std::size_t i = 0; i != 12; ++i) {
+        positions.push_back(vertices[i].position);
+        textureCoordinates.push_back(vertices[i].textureCoordinates);
+    }
+    CORRADE_COMPARE(positions, (std::vector<Vector2>{
+        Vector2{0.0f,  0.5f} + offset,
+        Vector2{0.0f,  0.0f} + offset,
+        Vector2{0.75f, 0.5f} + offset,
+        Vector2{0.75f, 0.0f} + offset,
+
+        Vector2{1.0f,  0.75f} + offset,
+        Vector2{1.0f, -0.25f} + offset,
+        Vector2{2.5f,  0.75f} + offset,
+        Vector2{2.5f, -0.25f} + offset,
+
+        Vector2{2.75f,  1.0f} + offset,
+        Vector2{2.75f, -0.5f} + offset,
+        Vector2{5.0f,   1.0f} + offset,
+        Vector2{5.0f,  -0.5f} + offset
+    }));
+    CORRADE_COMPARE(textureCoordinates, (std::vector<Vector2>{
+        {0.0f, 10.0f},
+        {0.0f,  0.0f},
+        {6.0f, 10.0f},
+        {6.0f,  0.0f},
+
+        { 6.0f, 10.0f},
+        { 6.0f,  0.0f},
+        {12.0f, 10.0f},
+        {12.0f,  0.0f},
+
+        {12.0f, 10.0f},
+        {12.0f,  0.0f},
+        {18.0f, 10.0f},
+        {18.0f,  0.0f}
+    }));
+
+    /* Rendering another text reuses the layouter */
+    AbstractLayouter* const previous = layouter.get();
+    std::tie(glyphCount, bounds) = Text::AbstractRenderer::render(font, nullGlyphCache, 0.25f, {"ab", 2}, {vertices.data(), vertices.size()}, layouter);
+    CORRADE_COMPARE(glyphCount, 2);
+    CORRADE_VERIFY(layouter.get() == previous);
+    CORRADE_COMPARE(font.layoutCount, 1);
+    CORRADE_COMPARE(bounds, Range2D({0.0f, -0.25f}, {2.5f, 0.75f}));
+    CORRADE_COMPARE(vertices[7].position, (Vector2{2.5f, -0.25f}));
+}
+
 void RendererGLTest::renderMesh() {
     TestFont font;
     Mesh mesh{NoCreate};
@@ -321,6 +409,73 @@ void RendererGLTest::mutableText() {
         5.0f,  -0.5f, 18.0f,  0.0f
     }));
     #endif
+
+    /* Render shorter text, the layouter is reused */
+    renderer.render("ab");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(renderer.rectangle(), Range2D({0.0f, -0.25f}, {2.5f, 0.75f}));
+    CORRADE_COMPARE(renderer.mesh().count(), 12);
+    CORRADE_COMPARE(font.layoutCount, 1);
+}
+
+void RendererGLTest::mutableTextLayoutCache() {
+    #ifndef MAGNUM_TARGET_GLES
+    if(!Context::current().isExtensionSupported<Extensions::GL::ARB::map_buffer_range>())
+        CORRADE_SKIP(Extensions::GL::ARB::map_buffer_range::string() + std::string(" is not supported"));
+    #elif defined(MAGNUM_TARGET_GLES2) && !defined(MAGNUM_TARGET_EMSCRIPTEN)
+    if(!Context::current().isExtensionSupported<Extensions::GL::EXT::map_buffer_range>() &&
+       !Context::current().isExtensionSupported<Extensions::GL::OES::mapbuffer>()
+       #ifdef CORRADE_TARGET_NACL
+       && !Context::current().isExtensionSupported<Extensions::GL::CHROMIUM::map_sub>()
+       #endif
+    ) {
+        CORRADE_SKIP("No required extension is supported");
+    }
+    #endif
+
+    TestFont font;
+    GlyphCache glyphCache{Vector2i{16}};
+    LayoutCache layoutCache{4096};
+    Text::Renderer2D renderer(font, glyphCache, 0.25f);
+    CORRADE_VERIFY(!renderer.layoutCache());
+    renderer.setLayoutCache(&layoutCache);
+    CORRADE_VERIFY(renderer.layoutCache() == &layoutCache);
+    renderer.reserve(4, BufferUsage::DynamicDraw, BufferUsage::DynamicDraw);
+    MAGNUM_VERIFY_NO_ERROR();
+
+    /* Render the same text twice, the second time it's taken from the cache */
+    renderer.render("abc");
+    renderer.render("ab");
+    renderer.render("abc");
+    MAGNUM_VERIFY_NO_ERROR();
+    CORRADE_COMPARE(font.layoutCount, 1);
+    CORRADE_COMPARE(layoutCache.statistics().hits, 1);
+    CORRADE_COMPARE(layoutCache.statistics().misses, 2);
+
+    /* The result is the same as without the cache */
+    CORRADE_COMPARE(renderer.rectangle(), Range2D({0.0f, -0.5f}, {5.0f, 1.0f}));
+    CORRADE_COMPARE(renderer.mesh().count(), 18);
+
+    /** @todo How to verify this on ES? */
+    #ifndef MAGNUM_TARGET_GLES
+    Containers::Array<Float> vertices = renderer.vertexBuffer().subData<Float>(0, 48);
+    CORRADE_COMPARE(std::vector<Float>(vertices.begin(), vertices.end()), (std::vector<Float>{
+        0.0f,  0.5f, 0.0f, 10.0f,
+        0.0f,  0.0f, 0.0f,  0.0f,
+        0.75f, 0.5f, 6.0f, 10.0f,
+        0.75f, 0.0f, 6.0f,  0.0f,
+
+        1.0f,  0.75f,  6.0f, 10.0f,
+        1.0f, -0.25f,  6.0f,  0.0f,
+        2.5f,  0.75f, 12.0f, 10.0f,
+        2.5f, -0.25f, 12.0f,  0.0f,
+
+        2.75f,  1.0f, 12.0f, 10.0f,
+        2.75f, -0.5f, 12.0f,  0.0f,
+        5.0f,   1.0f, 18.0f, 10.0f,
+        5.0f,  -0.5f, 18.0f,  0.0f
+    }));
+    #endif
 }
 
 void RendererGLTest::multiline() {
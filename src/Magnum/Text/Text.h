@@ -40,6 +40,7 @@ class AbstractFontConverter;
 class AbstractLayouter;
 class DistanceFieldGlyphCache;
 class GlyphCache;
+class LayoutCache;
 
 enum class Alignment: UnsignedByte;
 
@@ -23,13 +23,18 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
+#include <Corrade/Containers/Array.h>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/Directory.h>
 
+#include "Magnum/Image.h"
+#include "Magnum/PixelFormat.h"
 #include "Magnum/Text/AbstractFont.h"
 #include "Magnum/Text/AbstractFontConverter.h"
 #include "Magnum/Text/DistanceFieldGlyphCache.h"
+#include "Magnum/TextureTools/DistanceField.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 
 #ifdef MAGNUM_TARGET_HEADLESS
@@ -58,7 +63,7 @@ namespace Magnum {
 
 @section magnum-fontconverter-usage Usage
 
-    magnum-fontconverter [-h|--help] --font FONT --converter CONVERTER [--plugin-dir DIR] [--characters CHARACTERS] [--font-size N] [--atlas-size "X Y"] [--output-size "X Y"] [--radius N] [--] input output
+    magnum-fontconverter [-h|--help] --font FONT --converter CONVERTER [--plugin-dir DIR] [--characters CHARACTERS] [--font-size N] [--atlas-size "X Y"] [--output-size "X Y"] [--radius N] [--cpu] [--threads N] [--] input output
 
 Arguments:
 
@@ -76,6 +81,10 @@ Arguments:
 -   `--output-size "X Y"` -- output atlas size. If set to zero size, distance
     field computation will not be used. (default: `"256 256"`)
 -   `--radius N` -- distance field computation radius (default: `24`)
+-   `--cpu` -- keep the glyph cache in memory and compute the distance field
+    on the CPU, without OpenGL context
+-   `--threads N` -- thread count for CPU computation, `0` means all
+    available threads (default: `0`)
 
 The resulting font files can be then used as specified in the documentation of
 `converter` plugin.
@@ -91,10 +100,55 @@ Making raster font from TTF file with default set of characters using
 According to `MagnumFontConverter` plugin documentation, this will generate
 files `myfont.conf` and `myfont.tga` in current directory. You can then load
 and use them with the @ref Text::MagnumFont "MagnumFont" plugin.
+
+On machines without GPU, add `--cpu` to the arguments. The glyph cache is then
+kept in memory and the distance field is computed using
+@ref TextureTools::distanceField(const ImageView2D&, Image2D&, const Range2Di&, Int, UnsignedInt).
 */
 
 namespace Text {
 
+namespace {
+
+/* Glyph cache keeping the image in memory, so fonts can be converted without
+   an OpenGL context. If distance field is requested, it's computed from the
+   whole image when the image is queried. */
+class ImageGlyphCache: public GlyphCache {
+    public:
+        explicit ImageGlyphCache(const Vector2i& originalSize, const Vector2i& size, const Int radius, const UnsignedInt threadCount): GlyphCache{NoCreate, originalSize, Vector2i(radius)}, _image{PixelFormat::Red, PixelType::UnsignedByte, originalSize, Containers::Array<char>{Containers::ValueInit, imageDataSize(originalSize)}}, _size{size}, _radius{radius}, _threadCount{threadCount} {}
+
+        void setImage(const Vector2i& offset, const ImageView2D& image) override {
+            CORRADE_ASSERT(image.format() == PixelFormat::Red && image.type() == PixelType::UnsignedByte,
+                "ImageGlyphCache::setImage(): expected" << PixelFormat::Red << "and" << PixelType::UnsignedByte << "but got" << image.format() << "and" << image.type(), );
+
+            const std::size_t rowStride = std::get<1>(image.dataProperties()).x();
+            const char* const data = image.data<char>() + std::get<0>(image.dataProperties());
+            const std::size_t outputRowStride = std::get<1>(_image.dataProperties()).x();
+            for(Int y = 0; y != image.size().y(); ++y)
+                std::memcpy(_image.data<char>() + (offset.y() + y)*outputRowStride + offset.x(), data + y*rowStride, image.size().x());
+        }
+
+    private:
+        /* Rows with default four-byte alignment */
+        static std::size_t imageDataSize(const Vector2i& size) {
+            return std::size_t((size.x() + 3)/4*4*size.y());
+        }
+
+        Image2D doImage() override {
+            Image2D out{PixelFormat::Red, PixelType::UnsignedByte, _size, Containers::Array<char>{imageDataSize(_size)}};
+            if(_radius) TextureTools::distanceField(_image, out, {{}, _size}, _radius, _threadCount);
+            else std::memcpy(out.data<char>(), _image.data<char>(), out.data().size());
+            return out;
+        }
+
+        Image2D _image;
+        Vector2i _size;
+        Int _radius;
+        UnsignedInt _threadCount;
+};
+
+}
+
 class FontConverter: public Platform::WindowlessApplication {
     public:
         explicit FontConverter(const Arguments& arguments);
@@ -118,11 +172,13 @@ FontConverter::FontConverter(const Arguments& arguments): Platform::WindowlessAp
         .addOption("atlas-size", "2048 2048").setHelp("atlas-size", "glyph atlas size", "\"X Y\"")
         .addOption("output-size", "256 256").setHelp("output-size", "output atlas size. If set to zero size, distance field computation will not be used.", "\"X Y\"")
         .addOption("radius", "24").setHelp("radius", "distance field computation radius", "N")
+        .addBooleanOption("cpu").setHelp("cpu", "keep the glyph cache in memory and compute the distance field on the CPU, without OpenGL context")
+        .addOption("threads", "0").setHelp("threads", "thread count for CPU computation, 0 means all available threads", "N")
         .addSkippedPrefix("magnum", "engine-specific options")
         .setHelp("Converts font to raster one of given atlas size.")
         .parse(arguments.argc, arguments.argv);
 
-    createContext();
+    if(!args.isSet("cpu")) createContext();
 }
 
 int FontConverter::exec() {
@@ -147,9 +203,24 @@ int FontConverter::exec() {
         std::exit(1);
     }
 
-    /* Create distance field glyph cache if radius is specified */
+    /* Create in-memory glyph cache if computing on the CPU */
     std::unique_ptr<Text::GlyphCache> cache;
-    if(!args.value<Vector2i>("output-size").isZero()) {
+    if(args.isSet("cpu")) {
+        const Vector2i outputSize = args.value<Vector2i>("output-size");
+        if(!outputSize.isZero()) {
+            Debug() << "Populating in-memory glyph cache, distance field will be computed on the CPU...";
+
+            cache.reset(new ImageGlyphCache(
+                args.value<Vector2i>("atlas-size"), outputSize,
+                args.value<Int>("radius"), args.value<UnsignedInt>("threads")));
+        } else {
+            Debug() << "Zero-size distance field output specified, populating normal in-memory glyph cache...";
+
+            cache.reset(new ImageGlyphCache(args.value<Vector2i>("atlas-size"), args.value<Vector2i>("atlas-size"), 0, 0));
+        }
+
+    /* Create distance field glyph cache if radius is specified */
+    } else if(!args.value<Vector2i>("output-size").isZero()) {
         Debug() << "Populating distance field glyph cache...";
 
         cache.reset(new Text::DistanceFieldGlyphCache(
@@ -25,37 +25,277 @@
 
 #include "Atlas.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Range.h"
 
 namespace Magnum { namespace TextureTools {
 
-std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding) {
-    if(sizes.empty()) return {};
+namespace {
+    Vector2i flipped(const Vector2i& size) { return {size.y(), size.x()}; }
+}
+
+AtlasPacker::AtlasPacker(const Vector2i& size, const Vector2i& padding): _size{size}, _padding{padding}, _rotationAllowed{false}, _usedArea{0} {
+    clear();
+}
+
+Float AtlasPacker::occupancy() const {
+    const Long area = Long(_size.x())*_size.y();
+    return area ? Float(Double(_usedArea)/area) : 0.0f;
+}
+
+void AtlasPacker::clear() {
+    _usedArea = 0;
+    _skyline.assign(1, Segment{0, 0, _size.x()});
+}
+
+bool AtlasPacker::findPlacement(const Vector2i& size, Placement& placement) const {
+    bool found = false;
+    for(std::size_t i = 0; i != _skyline.size(); ++i) {
+        /* Segments are sorted by x, no other will fit if this doesn't */
+        if(_skyline[i].x + size.x() > _size.x()) break;
+
+        /* The rectangle rests on the highest segment it spans */
+        Int y = 0;
+        Int widthLeft = size.x();
+        for(std::size_t j = i; widthLeft > 0; ++j) {
+            y = Math::max(y, _skyline[j].y);
+            widthLeft -= _skyline[j].width;
+        }
+        if(y + size.y() > _size.y()) continue;
+
+        /* Prefer lowest top edge, then the narrowest segment to leave wider
+           ones for larger rectangles */
+        const Int top = y + size.y();
+        if(!found || top < placement.top || (top == placement.top && _skyline[i].width < placement.width)) {
+            placement = Placement{i, y, top, _skyline[i].width};
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+void AtlasPacker::place(const Placement& placement, const Vector2i& size) {
+    /* New segment on top of the rectangle */
+    const std::size_t i = placement.segment;
+    _skyline.insert(_skyline.begin() + i, Segment{_skyline[i].x, placement.top, size.x()});
+
+    /* Cut the segments below it */
+    const Int end = _skyline[i].x + size.x();
+    while(i + 1 != _skyline.size() && _skyline[i + 1].x < end) {
+        Segment& next = _skyline[i + 1];
+        const Int overlap = end - next.x;
+        if(overlap < next.width) {
+            next.x += overlap;
+            next.width -= overlap;
+            break;
+        }
+
+        _skyline.erase(_skyline.begin() + i + 1);
+    }
+
+    /* Merge neighbors of the same height */
+    for(std::size_t j = 0; j + 1 < _skyline.size(); ) {
+        if(_skyline[j].y == _skyline[j + 1].y) {
+            _skyline[j].width += _skyline[j + 1].width;
+            _skyline.erase(_skyline.begin() + j + 1);
+        } else ++j;
+    }
+}
+
+std::vector<Range2Di> AtlasPacker::add(const std::vector<Vector2i>& sizes) {
+    /* Pack the tallest rectangles first (or the ones with the longest side,
+       if they can be rotated) */
+    std::vector<std::size_t> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this, &sizes](std::size_t a, std::size_t b) {
+        const Vector2i& sa = sizes[a];
+        const Vector2i& sb = sizes[b];
+        if(_rotationAllowed) {
+            const Int maxA = Math::max(sa.x(), sa.y()), maxB = Math::max(sb.x(), sb.y());
+            if(maxA != maxB) return maxA > maxB;
+            return Math::min(sa.x(), sa.y()) > Math::min(sb.x(), sb.y());
+        }
+        if(sa.y() != sb.y()) return sa.y() > sb.y();
+        return sa.x() > sb.x();
+    });
+
+    /* Back up the state so it can be restored if anything doesn't fit */
+    const std::vector<Segment> skyline = _skyline;
+    const Long usedArea = _usedArea;
+
+    std::vector<Range2Di> ranges(sizes.size());
+    for(const std::size_t i: order) {
+        const Vector2i paddedSize = sizes[i] + 2*_padding;
+
+        /* Empty rectangles don't occupy any space */
+        if(!paddedSize.product()) {
+            ranges[i] = Range2Di::fromSize(_padding, sizes[i]);
+            continue;
+        }
+
+        Placement placement;
+        bool found = findPlacement(paddedSize, placement);
+        bool rotated = false;
+        if(_rotationAllowed && paddedSize.x() != paddedSize.y()) {
+            Placement rotatedPlacement;
+            if(findPlacement(flipped(paddedSize), rotatedPlacement) && (!found || rotatedPlacement.top < placement.top)) {
+                placement = rotatedPlacement;
+                found = rotated = true;
+            }
+        }
+
+        if(!found) {
+            _skyline = skyline;
+            _usedArea = usedArea;
+            return {};
+        }
+
+        const Vector2i size = rotated ? flipped(sizes[i]) : sizes[i];
+        ranges[i] = Range2Di::fromSize(Vector2i{_skyline[placement.segment].x, placement.y} + _padding, size);
+        place(placement, rotated ? flipped(paddedSize) : paddedSize);
+        _usedArea += Long(size.x())*size.y();
+    }
+
+    return ranges;
+}
+
+namespace {
+    /* New shelves are rounded up to this height so slightly different
+       rectangles can share them */
+    constexpr Int ShelfHeightGranularity = 4;
+
+    /* How much taller than the rectangle can a shelf be to be reused */
+    Int maxShelfWaste(const Int height) {
+        return Math::max(ShelfHeightGranularity, height/4);
+    }
+}
+
+AtlasShelfAllocator::AtlasShelfAllocator(const Vector2i& size, const Vector2i& padding): _size{size}, _padding{padding}, _top{0}, _usedArea{0} {}
+
+Float AtlasShelfAllocator::occupancy() const {
+    const Long area = Long(_size.x())*_size.y();
+    return area ? Float(Double(_usedArea)/area) : 0.0f;
+}
+
+void AtlasShelfAllocator::clear() {
+    _top = 0;
+    _usedArea = 0;
+    _shelves.clear();
+}
+
+std::optional<Range2Di> AtlasShelfAllocator::allocate(const Vector2i& size) {
+    const Vector2i paddedSize = size + 2*_padding;
+
+    /* Empty rectangles don't occupy any space */
+    if(!paddedSize.product()) return Range2Di::fromSize(_padding, size);
+
+    if(paddedSize.x() > _size.x() || paddedSize.y() > _size.y())
+        return std::nullopt;
+
+    /* Find the lowest fitting shelf that isn't too tall. If there's no space
+       for a new shelf, any shelf that fits is better than nothing. */
+    Shelf* best = nullptr;
+    Span* bestSpan = nullptr;
+    Shelf* fallback = nullptr;
+    Span* fallbackSpan = nullptr;
+    for(Shelf& shelf: _shelves) {
+        if(shelf.height < paddedSize.y()) continue;
+
+        Span* span = nullptr;
+        for(Span& s: shelf.free) if(s.width >= paddedSize.x()) {
+            span = &s;
+            break;
+        }
+        if(!span) continue;
 
-    /* Size of largest texture */
-    Vector2i maxSize;
-    for(const Vector2i& size: sizes)
-        maxSize = Math::max(maxSize, size);
+        if(shelf.height - paddedSize.y() <= maxShelfWaste(paddedSize.y())) {
+            if(!best || shelf.height < best->height) {
+                best = &shelf;
+                bestSpan = span;
+            }
+        } else if(!fallback || shelf.height < fallback->height) {
+            fallback = &shelf;
+            fallbackSpan = span;
+        }
+    }
 
-    std::vector<Range2Di> atlas;
+    /* Open a new shelf on top */
+    if(!best && _top + paddedSize.y() <= _size.y()) {
+        const Int height = Math::min(_size.y() - _top, (paddedSize.y() + ShelfHeightGranularity - 1)/ShelfHeightGranularity*ShelfHeightGranularity);
+        _shelves.push_back(Shelf{_top, height, {Span{0, _size.x()}}});
+        _top += height;
+        best = &_shelves.back();
+        bestSpan = &best->free.front();
+    }
 
-    /* Columns and rows */
-    const Vector2i paddedSize = maxSize+2*padding;
-    const Vector2i gridSize = atlasSize/paddedSize;
-    if(std::size_t(gridSize.product()) < sizes.size()) {
-        Error() << "TextureTools::atlas(): requested atlas size" << atlasSize
-                << "is too small to fit" << sizes.size() << paddedSize
-                << "textures. Generated atlas will be empty.";
-        return atlas;
+    if(!best) {
+        if(!fallback) return std::nullopt;
+        best = fallback;
+        bestSpan = fallbackSpan;
     }
 
-    /** @todo actual magic implementation, not this joke */
+    /* Take the beginning of the span */
+    const Vector2i position{bestSpan->x, best->y};
+    bestSpan->x += paddedSize.x();
+    bestSpan->width -= paddedSize.x();
+    if(!bestSpan->width) best->free.erase(best->free.begin() + (bestSpan - best->free.data()));
+
+    _usedArea += Long(size.x())*size.y();
+    return Range2Di::fromSize(position + _padding, size);
+}
+
+void AtlasShelfAllocator::deallocate(const Range2Di& range) {
+    const Range2Di padded = range.padded(_padding);
+    if(!padded.size().product()) return;
+
+    auto shelf = std::lower_bound(_shelves.begin(), _shelves.end(), padded.min().y(), [](const Shelf& shelf, Int y) {
+        return shelf.y < y;
+    });
+    CORRADE_ASSERT(shelf != _shelves.end() && shelf->y == padded.min().y(),
+        "TextureTools::AtlasShelfAllocator::deallocate(): range" << range << "was not allocated", );
+
+    /* Put the span back, merging it with the neighbors */
+    auto next = std::lower_bound(shelf->free.begin(), shelf->free.end(), padded.min().x(), [](const Span& span, Int x) {
+        return span.x < x;
+    });
+    auto it = shelf->free.insert(next, Span{padded.min().x(), padded.size().x()});
+    if(it + 1 != shelf->free.end() && it->x + it->width == (it + 1)->x) {
+        it->width += (it + 1)->width;
+        shelf->free.erase(it + 1);
+    }
+    if(it != shelf->free.begin() && (it - 1)->x + (it - 1)->width == it->x) {
+        (it - 1)->width += it->width;
+        shelf->free.erase(it);
+    }
+
+    _usedArea -= Long(range.size().x())*range.size().y();
+
+    /* Remove empty shelves from the top so the space can be used by shelves
+       of different height */
+    while(!_shelves.empty() && _shelves.back().free.size() == 1 && _shelves.back().free.front().width == _size.x()) {
+        _top = _shelves.back().y;
+        _shelves.pop_back();
+    }
+}
+
+std::vector<Range2Di> atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding, Float* const occupancy) {
+    if(sizes.empty()) {
+        if(occupancy) *occupancy = 0.0f;
+        return {};
+    }
 
-    atlas.reserve(sizes.size());
-    for(std::size_t i = 0; i != sizes.size(); ++i)
-        atlas.push_back(Range2Di::fromSize(Vector2i(i%gridSize.x(), i/gridSize.x())*paddedSize+padding, sizes[i]));
+    AtlasPacker packer{atlasSize, padding};
+    std::vector<Range2Di> atlas = packer.add(sizes);
+    if(atlas.empty()) Error() << "TextureTools::atlas(): requested atlas size"
+        << atlasSize << "is too small to fit" << sizes.size()
+        << "textures with padding" << padding << Debug::nospace
+        << ". Generated atlas will be empty.";
 
+    if(occupancy) *occupancy = packer.occupancy();
     return atlas;
 }
 
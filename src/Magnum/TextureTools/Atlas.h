@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::TextureTools::atlas()
+ * @brief Class @ref Magnum::TextureTools::AtlasPacker, @ref Magnum::TextureTools::AtlasShelfAllocator, function @ref Magnum::TextureTools::atlas()
  */
 
 #include <vector>
@@ -34,23 +34,216 @@
 #include "Magnum/Magnum.h"
 #include "Magnum/Math/Vector2.h"
 #include "Magnum/TextureTools/visibility.h"
+#include "MagnumExternal/Optional/optional.hpp"
 
 namespace Magnum { namespace TextureTools {
 
+/**
+@brief Incremental texture atlas packer
+
+Packs rectangles into a texture of given size using the skyline bottom-left
+algorithm. The free space is tracked as a list of horizontal segments forming
+the top outline of already placed rectangles and each rectangle is put at the
+position where its top edge ends up lowest. Rectangles can be added in more
+batches, for example when new glyphs need to be added into an existing glyph
+cache. Each batch is sorted by height before packing, which gives
+considerably tighter results than packing in the original order.
+@code
+TextureTools::AtlasPacker packer{Vector2i{1024}, Vector2i{1}};
+std::vector<Range2Di> ranges = packer.add(sizes);
+if(ranges.empty()) {
+    // doesn't fit, create another texture
+}
+
+std::vector<Range2Di> moreRanges = packer.add(moreSizes);
+@endcode
+
+Padding is added twice to each size and the rectangles are laid out so the
+padding doesn't overlap. Returned ranges have the original sizes, i.e.
+without the padding.
+@see @ref atlas()
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasPacker {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Atlas size
+         * @param padding   Padding around each rectangle
+         */
+        explicit AtlasPacker(const Vector2i& size, const Vector2i& padding = Vector2i());
+
+        /** @brief Atlas size */
+        Vector2i size() const { return _size; }
+
+        /** @brief Padding around each rectangle */
+        Vector2i padding() const { return _padding; }
+
+        /** @brief Whether rectangles can be rotated */
+        bool isRotationAllowed() const { return _rotationAllowed; }
+
+        /**
+         * @brief Allow rotating the rectangles
+         * @return Reference to self (for method chaining)
+         *
+         * If enabled, a rectangle can be placed rotated by 90° if that fits
+         * better. Its range returned from @ref add() then has the width and
+         * height swapped compared to the input size. Disabled by default.
+         */
+        AtlasPacker& setRotationAllowed(bool allowed) {
+            _rotationAllowed = allowed;
+            return *this;
+        }
+
+        /**
+         * @brief Atlas occupancy
+         *
+         * Ratio of total area of all added rectangles (without the padding)
+         * to atlas area, in range @f$ [0, 1] @f$.
+         */
+        Float occupancy() const;
+
+        /**
+         * @brief Add rectangles to the atlas
+         * @return Range for each rectangle, in the same order as @p sizes
+         *
+         * If any of the rectangles doesn't fit, nothing is added and an empty
+         * vector is returned.
+         */
+        std::vector<Range2Di> add(const std::vector<Vector2i>& sizes);
+
+        /** @brief Remove all rectangles from the atlas */
+        void clear();
+
+    private:
+        /* Part of the skyline, sorted by x and covering the whole width */
+        struct Segment {
+            Int x, y, width;
+        };
+
+        /* Where a rectangle would be placed and how good the place is */
+        struct Placement {
+            std::size_t segment;
+            Int y, top, width;
+        };
+
+        bool findPlacement(const Vector2i& size, Placement& placement) const;
+        void place(const Placement& placement, const Vector2i& size);
+
+        Vector2i _size, _padding;
+        bool _rotationAllowed;
+        Long _usedArea;
+        std::vector<Segment> _skyline;
+};
+
+/**
+@brief Texture atlas allocator with support for freeing
+
+Unlike @ref AtlasPacker, which can only add rectangles until the atlas is
+full, this allocator can also free previously allocated rectangles and reuse
+their space, which makes it suitable for caches that evict old entries, such
+as @ref Text::GlyphCache.
+
+The atlas is divided into horizontal shelves stacked from the bottom. Each
+rectangle is put into the lowest shelf that is at least as tall and doesn't
+waste too much space above it, otherwise a new shelf is opened on top of the
+existing ones. Free space in each shelf is tracked as a sorted list of
+horizontal spans, freed rectangles are merged back into them and shelves that
+become empty at the top of the atlas are removed, so their height can be
+reused for rectangles of different size. As the allocator doesn't move
+already allocated rectangles, packing is less tight than with
+@ref AtlasPacker, especially for rectangles of very different heights.
+@code
+TextureTools::AtlasShelfAllocator allocator{Vector2i{1024}, Vector2i{1}};
+std::optional<Range2Di> range = allocator.allocate({24, 32});
+if(!range) {
+    // doesn't fit, free some space and try again
+}
+
+allocator.deallocate(*range);
+@endcode
+
+Padding is added twice to each size and the rectangles are laid out so the
+padding doesn't overlap. Returned ranges have the original sizes, i.e.
+without the padding.
+*/
+class MAGNUM_TEXTURETOOLS_EXPORT AtlasShelfAllocator {
+    public:
+        /**
+         * @brief Constructor
+         * @param size      Atlas size
+         * @param padding   Padding around each rectangle
+         */
+        explicit AtlasShelfAllocator(const Vector2i& size, const Vector2i& padding = Vector2i());
+
+        /** @brief Atlas size */
+        Vector2i size() const { return _size; }
+
+        /** @brief Padding around each rectangle */
+        Vector2i padding() const { return _padding; }
+
+        /**
+         * @brief Atlas occupancy
+         *
+         * Ratio of total area of all allocated rectangles (without the
+         * padding) to atlas area, in range @f$ [0, 1] @f$.
+         */
+        Float occupancy() const;
+
+        /**
+         * @brief Allocate a rectangle
+         *
+         * Returns range of given size or @ref std::nullopt if there isn't
+         * enough space. Rectangles that have zero area even with padding
+         * don't occupy any space.
+         */
+        std::optional<Range2Di> allocate(const Vector2i& size);
+
+        /**
+         * @brief Free a rectangle
+         *
+         * Expects that @p range was previously returned from @ref allocate()
+         * and wasn't freed since.
+         */
+        void deallocate(const Range2Di& range);
+
+        /** @brief Free all rectangles */
+        void clear();
+
+    private:
+        /* Free part of a shelf */
+        struct Span {
+            Int x, width;
+        };
+
+        struct Shelf {
+            Int y, height;
+            /* Sorted by x, neighbors are never adjacent */
+            std::vector<Span> free;
+        };
+
+        Vector2i _size, _padding;
+        Int _top;
+        Long _usedArea;
+        /* Sorted by y */
+        std::vector<Shelf> _shelves;
+};
+
 /**
 @brief Pack textures into texture atlas
 @param atlasSize    Size of resulting atlas
 @param sizes        Sizes of all textures in the atlas
 @param padding      Padding around each texture
+@param occupancy    If not `nullptr`, ratio of total texture area to atlas
+    area is saved there
 
-Packs many small textures into one larger. If the textures cannot be packed
-into required size, empty vector is returned.
+Packs many small textures into one larger using @ref AtlasPacker. If the
+textures cannot be packed into required size, empty vector is returned.
 
 Padding is added twice to each size and the atlas is laid out so the padding
 don't overlap. Returned sizes are the same as original sizes, i.e. without the
 padding.
 */
-std::vector<Range2Di> MAGNUM_TEXTURETOOLS_EXPORT atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i());
+std::vector<Range2Di> MAGNUM_TEXTURETOOLS_EXPORT atlas(const Vector2i& atlasSize, const std::vector<Vector2i>& sizes, const Vector2i& padding = Vector2i(), Float* occupancy = nullptr);
 
 }}
 
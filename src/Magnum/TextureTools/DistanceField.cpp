@@ -25,15 +25,22 @@
 
 #include "DistanceField.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <Corrade/Utility/Resource.h>
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Range.h"
 #include "Magnum/AbstractShaderProgram.h"
 #include "Magnum/Buffer.h"
 #include "Magnum/Context.h"
 #include "Magnum/Extensions.h"
 #include "Magnum/Framebuffer.h"
+#include "Magnum/Image.h"
+#include "Magnum/Implementation/parallel.h"
 #include "Magnum/Mesh.h"
+#include "Magnum/PixelFormat.h"
 #include "Magnum/Shader.h"
 #include "Magnum/Texture.h"
 #include "Magnum/Shaders/Implementation/CreateCompatibilityShader.h"
@@ -212,4 +219,132 @@ void distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangl
     mesh.draw(shader);
 }
 
+namespace {
+
+/* Thread count for processing given count of rows or columns, each having
+   given count of pixels */
+std::size_t threadCountFor(const std::size_t count, const std::size_t pixelsPerItem, const UnsignedInt threadCount) {
+    return std::min(Magnum::Implementation::parallelThreadCount(count*pixelsPerItem, threadCount), count);
+}
+
+/* Temporary storage for the one-dimensional transform */
+struct TransformScratch {
+    explicit TransformScratch(std::size_t count): values(count), parabolas(count), boundaries(count + 1) {}
+
+    std::vector<UnsignedInt> values;
+    std::vector<Int> parabolas;
+    std::vector<Double> boundaries;
+};
+
+/* One-dimensional squared Euclidean distance transform from Felzenszwalb and
+   Huttenlocher, Distance Transforms of Sampled Functions, 2012, operating
+   in-place on `count` values. The lower envelope of parabolas
+   rooted at each sample is built first and then sampled. All input values
+   are at most `cap` and the result is capped as well, which gives the same
+   result as capping only the final distance. */
+void distanceTransform(UnsignedInt* const data, const std::size_t count, const UnsignedInt cap, TransformScratch& scratch) {
+    std::copy_n(data, count, scratch.values.begin());
+
+    const auto intersection = [&scratch](const Int q, const Int p) {
+        return ((Double(scratch.values[q]) + Double(q)*q) - (Double(scratch.values[p]) + Double(p)*p))/(2.0*(q - p));
+    };
+
+    std::size_t k = 0;
+    scratch.parabolas[0] = 0;
+    scratch.boundaries[0] = -std::numeric_limits<Double>::infinity();
+    scratch.boundaries[1] = std::numeric_limits<Double>::infinity();
+    for(Int q = 1; q < Int(count); ++q) {
+        Double s = intersection(q, scratch.parabolas[k]);
+        while(s <= scratch.boundaries[k]) {
+            --k;
+            s = intersection(q, scratch.parabolas[k]);
+        }
+
+        ++k;
+        scratch.parabolas[k] = q;
+        scratch.boundaries[k] = s;
+        scratch.boundaries[k + 1] = std::numeric_limits<Double>::infinity();
+    }
+
+    k = 0;
+    for(Int q = 0; q < Int(count); ++q) {
+        while(scratch.boundaries[k + 1] < q) ++k;
+        const Long offset = q - scratch.parabolas[k];
+        data[q] = UnsignedInt(std::min(Long(cap), offset*offset + scratch.values[scratch.parabolas[k]]));
+    }
+}
+
+}
+
+void distanceField(const ImageView2D& input, Image2D& output, const Range2Di& rectangle, const Int radius, const UnsignedInt threadCount) {
+    CORRADE_ASSERT(input.type() == PixelType::UnsignedByte,
+        "TextureTools::distanceField(): expected input with" << PixelType::UnsignedByte << "but got" << input.type(), );
+    CORRADE_ASSERT(output.type() == PixelType::UnsignedByte && output.pixelSize() == 1,
+        "TextureTools::distanceField(): expected single-channel output with" << PixelType::UnsignedByte << "but got" << output.format() << "and" << output.type(), );
+    CORRADE_ASSERT((rectangle.min() >= Vector2i{}).all() && (rectangle.max() <= output.size()).all(),
+        "TextureTools::distanceField(): rectangle" << rectangle << "doesn't fit into output of size" << output.size(), );
+    CORRADE_ASSERT(radius >= 0,
+        "TextureTools::distanceField(): expected non-negative radius but got" << radius, );
+
+    const std::size_t width = input.size().x();
+    const std::size_t height = input.size().y();
+    if(!width || !height || !rectangle.size().product()) return;
+
+    /* Threshold the red channel the same way as the shader does */
+    std::vector<bool> inside(width*height);
+    {
+        const std::size_t pixelSize = input.pixelSize();
+        const std::size_t rowStride = std::get<1>(input.dataProperties()).x();
+        const UnsignedByte* const data = input.data<UnsignedByte>() + std::get<0>(input.dataProperties());
+        for(std::size_t y = 0; y != height; ++y)
+            for(std::size_t x = 0; x != width; ++x)
+                inside[y*width + x] = data[y*rowStride + x*pixelSize] > 127;
+    }
+
+    /* Squared distance to the nearest pixel outside and inside, nothing
+       farther than the radius is of interest */
+    const UnsignedInt cap = UnsignedInt((radius + 1)*(radius + 1));
+    std::vector<UnsignedInt> toOutside(width*height), toInside(width*height);
+    for(std::size_t i = 0; i != width*height; ++i) {
+        toOutside[i] = inside[i] ? cap : 0;
+        toInside[i] = inside[i] ? 0 : cap;
+    }
+
+    /* Transform all rows */
+    Magnum::Implementation::forEachRange(height, threadCountFor(height, width, threadCount), [&](const std::size_t begin, const std::size_t end) {
+        TransformScratch scratch{width};
+        for(std::size_t y = begin; y != end; ++y) {
+            distanceTransform(toOutside.data() + y*width, width, cap, scratch);
+            distanceTransform(toInside.data() + y*width, width, cap, scratch);
+        }
+    });
+
+    /* Transform only columns that are sampled by the output and convert the
+       distance to the same normalized value as the shader */
+    const Vector2 scaling = Vector2{input.size()}/Vector2{rectangle.size()};
+    const std::size_t outputRowStride = std::get<1>(output.dataProperties()).x();
+    UnsignedByte* const outputData = output.data<UnsignedByte>() + std::get<0>(output.dataProperties()) + rectangle.min().y()*outputRowStride + rectangle.min().x();
+    Magnum::Implementation::forEachRange(rectangle.sizeX(), threadCountFor(rectangle.sizeX(), height, threadCount), [&](const std::size_t begin, const std::size_t end) {
+        TransformScratch scratch{height};
+        std::vector<UnsignedInt> columnToOutside(height), columnToInside(height);
+        for(std::size_t x = begin; x != end; ++x) {
+            const std::size_t inputX = std::min(width - 1, std::size_t(x*scaling.x()));
+            for(std::size_t y = 0; y != height; ++y) {
+                columnToOutside[y] = toOutside[y*width + inputX];
+                columnToInside[y] = toInside[y*width + inputX];
+            }
+            distanceTransform(columnToOutside.data(), height, cap, scratch);
+            distanceTransform(columnToInside.data(), height, cap, scratch);
+
+            for(Int y = 0; y != rectangle.sizeY(); ++y) {
+                const std::size_t inputY = std::min(height - 1, std::size_t(y*scaling.y()));
+                const bool isInside = inside[inputY*width + inputX];
+                const Float distance = std::sqrt(Float(isInside ? columnToOutside[inputY] : columnToInside[inputY]));
+                const Float value = (isInside ? distance : -distance)/Float(radius*2 + 2) + 0.5f;
+                outputData[y*outputRowStride + x] = UnsignedByte(Math::clamp(value, 0.0f, 1.0f)*255.0f + 0.5f);
+            }
+        }
+    });
+}
+
 }}
@@ -80,7 +80,9 @@ Based on: *Chris Green - Improved Alpha-Tested Magnification for Vector Textures
 and Special Effects, SIGGRAPH 2007,
 http://www.valvesoftware.com/publications/2007/SIGGRAPH2007_AlphaTestedMagnification.pdf*
 
-@attention This is GPU-only implementation, so it expects active context.
+@attention This is GPU implementation, so it expects active context. See
+    @ref distanceField(const ImageView2D&, Image2D&, const Range2Di&, Int, UnsignedInt)
+    for a CPU implementation.
 
 @note If internal format of @p output texture is not renderable, this function
     prints message to error output and does nothing. In desktop OpenGL and
@@ -99,6 +101,37 @@ void MAGNUM_TEXTURETOOLS_EXPORT distanceField(Texture2D& input, Texture2D& outpu
 void MAGNUM_TEXTURETOOLS_EXPORT distanceField(Texture2D& input, Texture2D& output, const Range2Di& rectangle, Int radius, const Vector2i& imageSize);
 #endif
 
+/**
+@brief Create signed distance field on the CPU
+@param input        Input image
+@param output       Output image
+@param rectangle    Rectangle in output image where to put the result
+@param radius       Max lookup radius in input image
+@param threadCount  Thread count
+
+CPU counterpart to @ref distanceField(Texture2D&, Texture2D&, const Range2Di&, Int, const Vector2i&),
+doesn't need any GL context. Takes the red (first) channel of @p input, which
+is expected to have @ref PixelType::UnsignedByte, and writes the distance
+field into @p rectangle of @p output, which is expected to have a single
+channel with @ref PixelType::UnsignedByte, such as @ref PixelFormat::Red.
+Input pixels are sampled relative to the corner of @p rectangle. For a
+rectangle starting at origin the output values are the same as from the GPU
+implementation.
+
+Instead of searching the neighborhood of each pixel, the distances are
+calculated using an exact Euclidean distance transform, separately along rows
+and columns, so the time is linear in pixel count and doesn't depend on
+@p radius. If @p threadCount is other than `1`, large images are processed in
+parallel, value of `0` means thread count reported by
+`std::thread::hardware_concurrency()`. On platforms without thread support
+the value is ignored. The output is the same regardless of thread count.
+
+Based on: *Pedro F. Felzenszwalb, Daniel P. Huttenlocher - Distance
+Transforms of Sampled Functions, Theory of Computing 8, 2012,
+http://dx.doi.org/10.4086/toc.2012.v008a019*
+*/
+void MAGNUM_TEXTURETOOLS_EXPORT distanceField(const ImageView2D& input, Image2D& output, const Range2Di& rectangle, Int radius, UnsignedInt threadCount = 1);
+
 }}
 
 #endif
@@ -38,27 +38,81 @@ struct AtlasTest: TestSuite::Tester {
     void createPadding();
     void createEmpty();
     void createTooSmall();
+    void createTighterThanGrid();
+
+    void packerFull();
+    void packerIncremental();
+    void packerIncrementalTooLarge();
+    void packerRotation();
+    void packerEmptyRectangle();
+    void packerClear();
+    void packerNoOverlap();
+
+    void shelfAllocate();
+    void shelfFull();
+    void shelfTooLarge();
+    void shelfEmptyRectangle();
+    void shelfDeallocate();
+    void shelfDeallocateTopShelf();
+    void shelfFallbackShelf();
+    void shelfClear();
+    void shelfNoOverlap();
 };
 
 AtlasTest::AtlasTest() {
     addTests({&AtlasTest::create,
               &AtlasTest::createPadding,
               &AtlasTest::createEmpty,
-              &AtlasTest::createTooSmall});
+              &AtlasTest::createTooSmall,
+              &AtlasTest::createTighterThanGrid,
+
+              &AtlasTest::packerFull,
+              &AtlasTest::packerIncremental,
+              &AtlasTest::packerIncrementalTooLarge,
+              &AtlasTest::packerRotation,
+              &AtlasTest::packerEmptyRectangle,
+              &AtlasTest::packerClear,
+              &AtlasTest::packerNoOverlap,
+
+              &AtlasTest::shelfAllocate,
+              &AtlasTest::shelfFull,
+              &AtlasTest::shelfTooLarge,
+              &AtlasTest::shelfEmptyRectangle,
+              &AtlasTest::shelfDeallocate,
+              &AtlasTest::shelfDeallocateTopShelf,
+              &AtlasTest::shelfFallbackShelf,
+              &AtlasTest::shelfClear,
+              &AtlasTest::shelfNoOverlap});
+}
+
+namespace {
+    bool overlaps(const std::vector<Range2Di>& ranges, const Vector2i& padding) {
+        for(std::size_t i = 0; i != ranges.size(); ++i)
+            for(std::size_t j = i + 1; j != ranges.size(); ++j) {
+                const Range2Di a = ranges[i].padded(padding);
+                const Range2Di b = ranges[j].padded(padding);
+                if((a.min() < b.max()).all() && (b.min() < a.max()).all())
+                    return true;
+            }
+        return false;
+    }
 }
 
 void AtlasTest::create() {
+    Float occupancy;
     std::vector<Range2Di> atlas = TextureTools::atlas({64, 64}, {
         {12, 18},
         {32, 15},
         {23, 25}
-    });
+    }, {}, &occupancy);
 
+    /* The tallest one goes first */
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({0, 0}, {12, 18}),
-        Range2Di::fromSize({32, 0}, {32, 15}),
-        Range2Di::fromSize({0, 25}, {23, 25})}));
+        Range2Di::fromSize({23, 0}, {12, 18}),
+        Range2Di::fromSize({23, 18}, {32, 15}),
+        Range2Di::fromSize({0, 0}, {23, 25})}));
+    CORRADE_COMPARE(occupancy, (12.0f*18.0f + 32.0f*15.0f + 23.0f*25.0f)/(64.0f*64.0f));
 }
 
 void AtlasTest::createPadding() {
@@ -70,27 +124,305 @@ void AtlasTest::createPadding() {
 
     CORRADE_COMPARE(atlas.size(), 3);
     CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
-        Range2Di::fromSize({2, 1}, {8, 16}),
-        Range2Di::fromSize({34, 1}, {28, 13}),
-        Range2Di::fromSize({2, 26}, {19, 23})}));
+        Range2Di::fromSize({25, 1}, {8, 16}),
+        Range2Di::fromSize({25, 19}, {28, 13}),
+        Range2Di::fromSize({2, 1}, {19, 23})}));
 }
 
 void AtlasTest::createEmpty() {
-    std::vector<Range2Di> atlas = TextureTools::atlas({}, {});
+    Float occupancy = 1.0f;
+    std::vector<Range2Di> atlas = TextureTools::atlas({}, {}, {}, &occupancy);
     CORRADE_VERIFY(atlas.empty());
+    CORRADE_COMPARE(occupancy, 0.0f);
 }
 
 void AtlasTest::createTooSmall() {
     std::ostringstream o;
     Error redirectError{&o};
 
-    std::vector<Range2Di> atlas = TextureTools::atlas({64, 32}, {
+    std::vector<Range2Di> atlas = TextureTools::atlas({48, 32}, {
         {8, 16},
         {21, 13},
         {19, 29}
     }, {2, 1});
     CORRADE_VERIFY(atlas.empty());
-    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(64, 32) is too small to fit 3 Vector(25, 31) textures. Generated atlas will be empty.\n");
+    CORRADE_COMPARE(o.str(), "TextureTools::atlas(): requested atlas size Vector(48, 32) is too small to fit 3 textures with padding Vector(2, 1). Generated atlas will be empty.\n");
+}
+
+void AtlasTest::createTighterThanGrid() {
+    /* Padded sizes are {12, 18}, {25, 15} and {23, 31}, a grid of the
+       largest one wouldn't fit but they fit next to each other */
+    std::vector<Range2Di> atlas = TextureTools::atlas({64, 32}, {
+        {8, 16},
+        {21, 13},
+        {19, 29}
+    }, {2, 1});
+
+    CORRADE_COMPARE(atlas, (std::vector<Range2Di>{
+        Range2Di::fromSize({25, 1}, {8, 16}),
+        Range2Di::fromSize({37, 1}, {21, 13}),
+        Range2Di::fromSize({2, 1}, {19, 29})}));
+}
+
+void AtlasTest::packerFull() {
+    /* 64 squares fill the atlas completely */
+    AtlasPacker packer{{128, 128}};
+    std::vector<Range2Di> ranges = packer.add(std::vector<Vector2i>(64, Vector2i{16}));
+
+    CORRADE_COMPARE(ranges.size(), 64);
+    CORRADE_VERIFY(!overlaps(ranges, {}));
+    CORRADE_COMPARE(packer.occupancy(), 1.0f);
+
+    /* Nothing more fits */
+    CORRADE_VERIFY(packer.add({{1, 1}}).empty());
+}
+
+void AtlasTest::packerIncremental() {
+    AtlasPacker packer{{64, 64}, {1, 1}};
+    CORRADE_COMPARE(packer.size(), (Vector2i{64, 64}));
+    CORRADE_COMPARE(packer.padding(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(packer.occupancy(), 0.0f);
+
+    std::vector<Range2Di> first = packer.add({{30, 10}, {14, 20}});
+    CORRADE_COMPARE(first, (std::vector<Range2Di>{
+        Range2Di::fromSize({17, 1}, {30, 10}),
+        Range2Di::fromSize({1, 1}, {14, 20})}));
+
+    /* The second batch continues on top of the first, the 16 pixels left
+       on the right are too narrow for the first rectangle with padding */
+    std::vector<Range2Di> second = packer.add({{15, 8}, {62, 5}});
+    CORRADE_COMPARE(second, (std::vector<Range2Di>{
+        Range2Di::fromSize({17, 13}, {15, 8}),
+        Range2Di::fromSize({1, 23}, {62, 5})}));
+
+    std::vector<Range2Di> all = first;
+    all.insert(all.end(), second.begin(), second.end());
+    CORRADE_VERIFY(!overlaps(all, {1, 1}));
+    CORRADE_COMPARE(packer.occupancy(), (30.0f*10.0f + 14.0f*20.0f + 15.0f*8.0f + 62.0f*5.0f)/(64.0f*64.0f));
+}
+
+void AtlasTest::packerIncrementalTooLarge() {
+    AtlasPacker packer{{32, 32}};
+    std::vector<Range2Di> first = packer.add({{32, 16}});
+    CORRADE_COMPARE(first.size(), 1);
+
+    /* The first fits but the second doesn't, so nothing is added */
+    CORRADE_VERIFY(packer.add({{32, 8}, {32, 9}}).empty());
+    CORRADE_COMPARE(packer.occupancy(), 0.5f);
+
+    /* The space is still available */
+    std::vector<Range2Di> second = packer.add({{32, 16}});
+    CORRADE_COMPARE(second, (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 16}, {32, 16})}));
+    CORRADE_COMPARE(packer.occupancy(), 1.0f);
+}
+
+void AtlasTest::packerRotation() {
+    /* Tall rectangle fits in a wide atlas only if rotated */
+    AtlasPacker packer{{64, 16}};
+    CORRADE_VERIFY(!packer.isRotationAllowed());
+    CORRADE_VERIFY(packer.add({{8, 32}}).empty());
+
+    packer.setRotationAllowed(true);
+    CORRADE_VERIFY(packer.isRotationAllowed());
+    std::vector<Range2Di> ranges = packer.add({{8, 32}, {16, 8}});
+    CORRADE_COMPARE(ranges, (std::vector<Range2Di>{
+        Range2Di::fromSize({0, 0}, {32, 8}),
+        Range2Di::fromSize({32, 0}, {16, 8})}));
+}
+
+void AtlasTest::packerEmptyRectangle() {
+    AtlasPacker packer{{16, 16}};
+    std::vector<Range2Di> ranges = packer.add({{0, 0}, {16, 16}, {0, 5}});
+    CORRADE_COMPARE(ranges, (std::vector<Range2Di>{
+        Range2Di::fromSize({}, {0, 0}),
+        Range2Di::fromSize({}, {16, 16}),
+        Range2Di::fromSize({}, {0, 5})}));
+}
+
+void AtlasTest::packerClear() {
+    AtlasPacker packer{{16, 16}};
+    CORRADE_COMPARE(packer.add({{16, 16}}).size(), 1);
+    CORRADE_VERIFY(packer.add({{1, 1}}).empty());
+
+    packer.clear();
+    CORRADE_COMPARE(packer.occupancy(), 0.0f);
+    CORRADE_COMPARE(packer.add({{16, 16}}).size(), 1);
+}
+
+void AtlasTest::packerNoOverlap() {
+    /* Pseudo-random glyph-like sizes */
+    std::vector<Vector2i> sizes;
+    UnsignedInt seed = 17;
+    for(std::size_t i = 0; i != 300; ++i) {
+        seed = seed*1103515245u + 12345u;
+        const Int width = 4 + (seed >> 16)%20;
+        seed = seed*1103515245u + 12345u;
+        const Int height = 6 + (seed >> 16)%24;
+        sizes.emplace_back(width, height);
+    }
+
+    AtlasPacker packer{{512, 256}, {1, 1}};
+    std::vector<Range2Di> ranges = packer.add(sizes);
+    CORRADE_COMPARE(ranges.size(), sizes.size());
+    CORRADE_VERIFY(!overlaps(ranges, {1, 1}));
+    for(std::size_t i = 0; i != ranges.size(); ++i) {
+        CORRADE_COMPARE(ranges[i].size(), sizes[i]);
+        CORRADE_VERIFY((ranges[i].min() >= Vector2i{1}).all());
+        CORRADE_VERIFY((ranges[i].max() <= Vector2i{511, 255}).all());
+    }
+
+    /* A grid of the largest padded size (25x31) would fit only 160 of them */
+    CORRADE_VERIFY(packer.occupancy() > 0.5f);
+}
+
+void AtlasTest::shelfAllocate() {
+    AtlasShelfAllocator allocator{{64, 64}, {1, 1}};
+    CORRADE_COMPARE(allocator.size(), (Vector2i{64, 64}));
+    CORRADE_COMPARE(allocator.padding(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(allocator.occupancy(), 0.0f);
+
+    /* First shelf is 8 pixels high */
+    std::optional<Range2Di> a = allocator.allocate({10, 6});
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(*a, Range2Di::fromSize({1, 1}, {10, 6}));
+
+    /* Doesn't fit into the first shelf, second shelf is rounded up to 12
+       pixels */
+    std::optional<Range2Di> b = allocator.allocate({5, 7});
+    CORRADE_VERIFY(b);
+    CORRADE_COMPARE(*b, Range2Di::fromSize({1, 9}, {5, 7}));
+
+    /* Fits into the first shelf next to the first rectangle */
+    std::optional<Range2Di> c = allocator.allocate({4, 5});
+    CORRADE_VERIFY(c);
+    CORRADE_COMPARE(*c, Range2Di::fromSize({13, 1}, {4, 5}));
+
+    CORRADE_COMPARE(allocator.occupancy(), (10.0f*6.0f + 5.0f*7.0f + 4.0f*5.0f)/(64.0f*64.0f));
+}
+
+void AtlasTest::shelfFull() {
+    AtlasShelfAllocator allocator{{128, 128}};
+    std::vector<Range2Di> ranges;
+    for(std::size_t i = 0; i != 64; ++i) {
+        std::optional<Range2Di> range = allocator.allocate({16, 16});
+        CORRADE_VERIFY(range);
+        ranges.push_back(*range);
+    }
+
+    CORRADE_VERIFY(!overlaps(ranges, {}));
+    CORRADE_COMPARE(allocator.occupancy(), 1.0f);
+
+    /* Nothing more fits */
+    CORRADE_VERIFY(!allocator.allocate({1, 1}));
+}
+
+void AtlasTest::shelfTooLarge() {
+    AtlasShelfAllocator allocator{{64, 32}, {1, 1}};
+    CORRADE_VERIFY(!allocator.allocate({63, 4}));
+    CORRADE_VERIFY(!allocator.allocate({4, 31}));
+    CORRADE_VERIFY(allocator.allocate({62, 30}));
+}
+
+void AtlasTest::shelfEmptyRectangle() {
+    AtlasShelfAllocator allocator{{16, 16}};
+    CORRADE_COMPARE(allocator.allocate({0, 5}).value_or(Range2Di{}), Range2Di::fromSize({}, {0, 5}));
+    CORRADE_COMPARE(allocator.allocate({16, 16}).value_or(Range2Di{}), Range2Di::fromSize({}, {16, 16}));
+    CORRADE_COMPARE(allocator.allocate({0, 0}).value_or(Range2Di{}), Range2Di::fromSize({}, {0, 0}));
+
+    /* Freeing an empty rectangle does nothing */
+    allocator.deallocate(Range2Di::fromSize({}, {0, 5}));
+    CORRADE_COMPARE(allocator.occupancy(), 1.0f);
+}
+
+void AtlasTest::shelfDeallocate() {
+    AtlasShelfAllocator allocator{{64, 64}};
+    std::vector<Range2Di> ranges;
+    for(std::size_t i = 0; i != 16; ++i) ranges.push_back(*allocator.allocate({16, 16}));
+    CORRADE_VERIFY(!allocator.allocate({16, 16}));
+
+    /* Freed space gets reused */
+    allocator.deallocate(ranges[5]);
+    CORRADE_COMPARE(allocator.occupancy(), 15.0f/16.0f);
+    CORRADE_COMPARE(allocator.allocate({16, 16}).value_or(Range2Di{}), ranges[5]);
+
+    /* Neighboring free spans are merged */
+    allocator.deallocate(ranges[9]);
+    allocator.deallocate(ranges[11]);
+    allocator.deallocate(ranges[10]);
+    CORRADE_COMPARE(allocator.allocate({48, 16}).value_or(Range2Di{}), Range2Di::fromSize(ranges[9].min(), {48, 16}));
+}
+
+void AtlasTest::shelfDeallocateTopShelf() {
+    AtlasShelfAllocator allocator{{64, 64}};
+    std::optional<Range2Di> a = allocator.allocate({64, 32});
+    std::optional<Range2Di> b = allocator.allocate({64, 32});
+    CORRADE_VERIFY(a && b);
+    CORRADE_VERIFY(!allocator.allocate({8, 16}));
+
+    /* Emptied top shelf gets removed so smaller shelves can take its place */
+    allocator.deallocate(*b);
+    CORRADE_COMPARE(allocator.allocate({64, 16}).value_or(Range2Di{}), Range2Di::fromSize({0, 32}, {64, 16}));
+    CORRADE_COMPARE(allocator.allocate({64, 16}).value_or(Range2Di{}), Range2Di::fromSize({0, 48}, {64, 16}));
+}
+
+void AtlasTest::shelfFallbackShelf() {
+    AtlasShelfAllocator allocator{{32, 32}};
+    std::optional<Range2Di> a = allocator.allocate({32, 28});
+    CORRADE_VERIFY(a);
+    CORRADE_VERIFY(allocator.allocate({32, 4}));
+    allocator.deallocate(*a);
+
+    /* The first shelf is much taller than needed, but as there's no space
+       for a new one, it's used anyway */
+    CORRADE_COMPARE(allocator.allocate({8, 4}).value_or(Range2Di{}), Range2Di::fromSize({}, {8, 4}));
+}
+
+void AtlasTest::shelfClear() {
+    AtlasShelfAllocator allocator{{16, 16}};
+    CORRADE_VERIFY(allocator.allocate({16, 16}));
+    CORRADE_VERIFY(!allocator.allocate({1, 1}));
+
+    allocator.clear();
+    CORRADE_COMPARE(allocator.occupancy(), 0.0f);
+    CORRADE_COMPARE(allocator.allocate({16, 16}).value_or(Range2Di{}), Range2Di::fromSize({}, {16, 16}));
+}
+
+void AtlasTest::shelfNoOverlap() {
+    /* Pseudo-random glyph-like sizes, allocated and freed in pseudo-random
+       order */
+    AtlasShelfAllocator allocator{{256, 256}, {1, 1}};
+    std::vector<Range2Di> ranges;
+    UnsignedInt seed = 17;
+    Long area = 0;
+    for(std::size_t i = 0; i != 2000; ++i) {
+        seed = seed*1103515245u + 12345u;
+        if(!ranges.empty() && (seed >> 16)%3 == 0) {
+            seed = seed*1103515245u + 12345u;
+            const std::size_t index = (seed >> 16)%ranges.size();
+            area -= ranges[index].size().product();
+            allocator.deallocate(ranges[index]);
+            ranges.erase(ranges.begin() + index);
+            continue;
+        }
+
+        seed = seed*1103515245u + 12345u;
+        const Int width = 4 + (seed >> 16)%20;
+        seed = seed*1103515245u + 12345u;
+        const Int height = 6 + (seed >> 16)%24;
+        std::optional<Range2Di> range = allocator.allocate({width, height});
+        if(!range) continue;
+
+        CORRADE_COMPARE(range->size(), (Vector2i{width, height}));
+        CORRADE_VERIFY((range->min() >= Vector2i{1}).all());
+        CORRADE_VERIFY((range->max() <= Vector2i{255}).all());
+        area += range->size().product();
+        ranges.push_back(*range);
+    }
+
+    CORRADE_VERIFY(ranges.size() > 100);
+    CORRADE_VERIFY(!overlaps(ranges, {1, 1}));
+    CORRADE_COMPARE(allocator.occupancy(), Float(Double(area)/(256*256)));
 }
 
 }}}
@@ -0,0 +1,245 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/TextureTools/DistanceField.h"
+
+namespace Magnum { namespace TextureTools { namespace Test {
+
+struct DistanceFieldTest: TestSuite::Tester {
+    explicit DistanceFieldTest();
+
+    void empty();
+    void singlePixel();
+    void matchesShader();
+    void scaled();
+    void rectangle();
+    void outputAlignment();
+    void rgbaInput();
+    void multithreaded();
+};
+
+DistanceFieldTest::DistanceFieldTest() {
+    addTests({&DistanceFieldTest::empty,
+              &DistanceFieldTest::singlePixel,
+              &DistanceFieldTest::matchesShader,
+              &DistanceFieldTest::scaled,
+              &DistanceFieldTest::rectangle,
+              &DistanceFieldTest::outputAlignment,
+              &DistanceFieldTest::rgbaInput,
+              &DistanceFieldTest::multithreaded});
+}
+
+namespace {
+    /* Pseudo-random blobs, with an empty border */
+    std::vector<UnsignedByte> blobs(const Vector2i& size, UnsignedInt seed) {
+        std::vector<UnsignedByte> data(size.product());
+        for(std::size_t i = 0; i != 12; ++i) {
+            seed = seed*1103515245u + 12345u;
+            const Int cx = 4 + (seed >> 16)%(size.x() - 8);
+            seed = seed*1103515245u + 12345u;
+            const Int cy = 4 + (seed >> 16)%(size.y() - 8);
+            seed = seed*1103515245u + 12345u;
+            const Int r = 1 + (seed >> 16)%(Math::min(size.x(), size.y())/6);
+            for(Int y = Math::max(cy - r, 1); y < Math::min(cy + r + 1, size.y() - 1); ++y)
+                for(Int x = Math::max(cx - r, 1); x < Math::min(cx + r + 1, size.x() - 1); ++x)
+                    if((x - cx)*(x - cx) + (y - cy)*(y - cy) <= r*r)
+                        data[y*size.x() + x] ^= 0xff;
+        }
+        return data;
+    }
+
+    /* Straightforward port of the search in DistanceFieldShader.frag.
+       Samples outside of the image are treated as clamped to the edge. */
+    std::vector<UnsignedByte> shaderReference(const std::vector<UnsignedByte>& input, const Vector2i& inputSize, const Vector2i& outputSize, const Int radius) {
+        const auto hasValue = [&](const Vector2i& position) {
+            const Int x = Math::clamp(position.x(), 0, inputSize.x() - 1);
+            const Int y = Math::clamp(position.y(), 0, inputSize.y() - 1);
+            return input[y*inputSize.x() + x] > 127;
+        };
+        const auto rotate = [](const Vector2i& vec) { return Vector2i{-vec.y(), vec.x()}; };
+
+        const Vector2 scaling = Vector2{inputSize}/Vector2{outputSize};
+        std::vector<UnsignedByte> output(outputSize.product());
+        for(Int y = 0; y != outputSize.y(); ++y) for(Int x = 0; x != outputSize.x(); ++x) {
+            const Vector2i position{Vector2{Float(x), Float(y)}*scaling};
+            const bool isInside = hasValue(position);
+            Float minDistanceSquared = Float((radius + 1)*(radius + 1));
+            Int radiusLimit = radius;
+            for(Int i = 1; i <= radiusLimit; ++i) for(Int j = 0; j < i*2; ++j) {
+                const Vector2i offset{-i + j, i};
+                if(hasValue(position + offset) == !isInside ||
+                   hasValue(position + rotate(offset)) == !isInside ||
+                   hasValue(position + rotate(rotate(offset))) == !isInside ||
+                   hasValue(position + rotate(rotate(rotate(offset)))) == !isInside) {
+                    const Float distanceSquared = Float(offset.dot());
+                    if(minDistanceSquared < distanceSquared) continue;
+                    minDistanceSquared = distanceSquared;
+                    radiusLimit = Math::min(radius, Int(std::floor(std::sqrt(distanceSquared))));
+                }
+            }
+
+            const Float value = (isInside ? 1.0f : -1.0f)*std::sqrt(minDistanceSquared)/Float(radius*2 + 2) + 0.5f;
+            output[y*outputSize.x() + x] = UnsignedByte(Math::clamp(value, 0.0f, 1.0f)*255.0f + 0.5f);
+        }
+
+        return output;
+    }
+
+    std::vector<UnsignedByte> cpuDistanceField(const std::vector<UnsignedByte>& input, const Vector2i& inputSize, const Vector2i& outputSize, const Int radius, const UnsignedInt threadCount = 1) {
+        Image2D output{PixelStorage{}.setAlignment(1), PixelFormat::Red, PixelType::UnsignedByte, outputSize, Containers::Array<char>{std::size_t(outputSize.product())}};
+        distanceField(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::Red, PixelType::UnsignedByte, inputSize, {input.data(), input.size()}}, output, {{}, outputSize}, radius, threadCount);
+        return std::vector<UnsignedByte>(output.data<UnsignedByte>(), output.data<UnsignedByte>() + outputSize.product());
+    }
+}
+
+void DistanceFieldTest::empty() {
+    /* Everything is farther than the radius */
+    const std::vector<UnsignedByte> input(16*8);
+    CORRADE_COMPARE(cpuDistanceField(input, {16, 8}, {16, 8}, 4), std::vector<UnsignedByte>(16*8, 0));
+}
+
+void DistanceFieldTest::singlePixel() {
+    std::vector<UnsignedByte> input(5*5);
+    input[2*5 + 2] = 0xff;
+
+    /* The inside pixel is one pixel from outside, outside pixels are at
+       their distance from it. Radius 2 normalizes the distances from
+       [-3, 3]. */
+    const auto value = [](const Float distance) {
+        return UnsignedByte((distance/6.0f + 0.5f)*255.0f + 0.5f);
+    };
+    const UnsignedByte corner = value(-std::sqrt(8.0f));
+    const UnsignedByte knight = value(-std::sqrt(5.0f));
+    const UnsignedByte twoAway = value(-2.0f);
+    const UnsignedByte diagonal = value(-std::sqrt(2.0f));
+    const UnsignedByte side = value(-1.0f);
+    const UnsignedByte center = value(1.0f);
+    CORRADE_COMPARE(cpuDistanceField(input, {5, 5}, {5, 5}, 2), (std::vector<UnsignedByte>{
+        corner,  knight,   twoAway, knight,   corner,
+        knight,  diagonal, side,    diagonal, knight,
+        twoAway, side,     center,  side,     twoAway,
+        knight,  diagonal, side,    diagonal, knight,
+        corner,  knight,   twoAway, knight,   corner}));
+
+    /* With radius 1 everything except the direct neighbors is clamped */
+    const auto value1 = [](const Float distance) {
+        return UnsignedByte((distance/4.0f + 0.5f)*255.0f + 0.5f);
+    };
+    const UnsignedByte far1 = value1(-2.0f);
+    const UnsignedByte diagonal1 = value1(-std::sqrt(2.0f));
+    const UnsignedByte side1 = value1(-1.0f);
+    const UnsignedByte center1 = value1(1.0f);
+    CORRADE_COMPARE(cpuDistanceField(input, {5, 5}, {5, 5}, 1), (std::vector<UnsignedByte>{
+        far1, far1,      far1,    far1,      far1,
+        far1, diagonal1, side1,   diagonal1, far1,
+        far1, side1,     center1, side1,     far1,
+        far1, diagonal1, side1,   diagonal1, far1,
+        far1, far1,      far1,    far1,      far1}));
+}
+
+void DistanceFieldTest::matchesShader() {
+    const Vector2i size{64, 48};
+    const std::vector<UnsignedByte> input = blobs(size, 7);
+    for(const Int radius: {0, 1, 3, 8, 20}) {
+        CORRADE_COMPARE(cpuDistanceField(input, size, size, radius), shaderReference(input, size, size, radius));
+    }
+}
+
+void DistanceFieldTest::scaled() {
+    const Vector2i size{128, 96};
+    const std::vector<UnsignedByte> input = blobs(size, 13);
+    for(const Vector2i& outputSize: {Vector2i{32, 24}, Vector2i{64, 32}, Vector2i{40, 30}}) {
+        CORRADE_COMPARE(cpuDistanceField(input, size, outputSize, 6), shaderReference(input, size, outputSize, 6));
+    }
+}
+
+void DistanceFieldTest::rectangle() {
+    const Vector2i size{32, 32};
+    const std::vector<UnsignedByte> input = blobs(size, 3);
+
+    /* Pixels outside of the rectangle are untouched */
+    Image2D output{PixelStorage{}.setAlignment(1), PixelFormat::Red, PixelType::UnsignedByte, {24, 20}, Containers::Array<char>{Containers::ValueInit, 24*20}};
+    distanceField(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::Red, PixelType::UnsignedByte, size, {input.data(), input.size()}}, output, Range2Di::fromSize({5, 3}, {16, 16}), 4);
+
+    std::vector<UnsignedByte> expected(24*20);
+    const std::vector<UnsignedByte> field = shaderReference(input, size, {16, 16}, 4);
+    for(Int y = 0; y != 16; ++y)
+        std::copy_n(field.begin() + y*16, 16, expected.begin() + (y + 3)*24 + 5);
+    CORRADE_COMPARE(std::vector<UnsignedByte>(output.data<UnsignedByte>(), output.data<UnsignedByte>() + 24*20), expected);
+}
+
+void DistanceFieldTest::outputAlignment() {
+    const Vector2i size{12, 10};
+    const std::vector<UnsignedByte> input = blobs(size, 5);
+
+    /* Rows of the output are padded to four bytes */
+    Image2D output{PixelFormat::Red, PixelType::UnsignedByte, {6, 5}, Containers::Array<char>{Containers::ValueInit, 8*5}};
+    distanceField(ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::Red, PixelType::UnsignedByte, size, {input.data(), input.size()}}, output, {{}, {6, 5}}, 3);
+
+    std::vector<UnsignedByte> expected(8*5);
+    const std::vector<UnsignedByte> field = shaderReference(input, size, {6, 5}, 3);
+    for(Int y = 0; y != 5; ++y)
+        std::copy_n(field.begin() + y*6, 6, expected.begin() + y*8);
+    CORRADE_COMPARE(std::vector<UnsignedByte>(output.data<UnsignedByte>(), output.data<UnsignedByte>() + 8*5), expected);
+}
+
+void DistanceFieldTest::rgbaInput() {
+    const Vector2i size{16, 16};
+    const std::vector<UnsignedByte> red = blobs(size, 11);
+
+    /* Only the red channel is taken */
+    std::vector<UnsignedByte> rgba(size.product()*4);
+    for(std::size_t i = 0; i != red.size(); ++i) {
+        rgba[i*4] = red[i];
+        rgba[i*4 + 1] = rgba[i*4 + 3] = 0xff;
+    }
+
+    Image2D output{PixelStorage{}.setAlignment(1), PixelFormat::Red, PixelType::UnsignedByte, size, Containers::Array<char>{std::size_t(size.product())}};
+    distanceField(ImageView2D{PixelFormat::RGBA, PixelType::UnsignedByte, size, {rgba.data(), rgba.size()}}, output, {{}, size}, 3);
+    CORRADE_COMPARE(std::vector<UnsignedByte>(output.data<UnsignedByte>(), output.data<UnsignedByte>() + size.product()), cpuDistanceField(red, size, size, 3));
+}
+
+void DistanceFieldTest::multithreaded() {
+    /* Large enough to be split among four threads */
+    const Vector2i size{512, 512};
+    const std::vector<UnsignedByte> input = blobs(size, 19);
+    const std::vector<UnsignedByte> expected = cpuDistanceField(input, size, {128, 128}, 16);
+    CORRADE_COMPARE(cpuDistanceField(input, size, {128, 128}, 16, 4), expected);
+    CORRADE_COMPARE(cpuDistanceField(input, size, {128, 128}, 16, 0), expected);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DistanceFieldTest)
@@ -23,6 +23,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/Array.h>
 #include <Corrade/Utility/Arguments.h>
 #include <Corrade/Utility/Directory.h>
 #include <Corrade/PluginManager/Manager.h>
@@ -63,7 +64,7 @@ namespace Magnum {
 
 @section magnum-distancefieldconverter-usage Usage
 
-    magnum-distancefieldconverter [-h|--help] [--importer IMPORTER] [--converter CONVERTER] [--plugin-dir DIR] --output-size "X Y" --radius N [--] input output
+    magnum-distancefieldconverter [-h|--help] [--importer IMPORTER] [--converter CONVERTER] [--plugin-dir DIR] [--cpu] [--threads N] --output-size "X Y" --radius N [--] input output
 
 Arguments:
 
@@ -74,11 +75,16 @@ Arguments:
 -   `--converter CONVERTER` -- image converter plugin (default: @ref Trade::AnyImageConverter "AnyImageConverter")
 -   `--plugin-dir DIR` -- base plugin dir (defaults to plugin directory in
     Magnum install location)
+-   `--cpu` -- compute the distance field on the CPU, without creating any
+    OpenGL context
+-   `--threads N` -- thread count for CPU computation, `0` means all
+    available threads (default: `0`)
 -   `--output-size "X Y"` -- size of output image
 -   `--radius N` -- distance field computation radius
 
 Images with @ref PixelFormat::Red, @ref PixelFormat::RGB or @ref PixelFormat::RGBA
-are accepted on input.
+are accepted on input. With `--cpu` the input is additionally expected to
+have @ref PixelType::UnsignedByte.
 
 The resulting image can be then used with @ref Shaders::DistanceFieldVector
 shader. See also @ref TextureTools::distanceField() for more information about
@@ -92,6 +98,10 @@ This will open monochrome `logo-src.png` image using any plugin that can open
 PNG files and converts it to 256x256 distance field `logo.png` using any plugin
 that can write PNG files.
 
+    magnum-distancefieldconverter --cpu --output-size "256 256" --radius 24 logo-src.png logo.png
+
+The same, but on machines without GPU.
+
 */
 
 namespace TextureTools {
@@ -114,11 +124,13 @@ DistanceFieldConverter::DistanceFieldConverter(const Arguments& arguments): Plat
         .addOption("plugin-dir", MAGNUM_PLUGINS_DIR).setHelp("plugin-dir", "base plugin dir", "DIR")
         .addNamedArgument("output-size").setHelp("output-size", "size of output image", "\"X Y\"")
         .addNamedArgument("radius").setHelp("radius", "distance field computation radius", "N")
+        .addBooleanOption("cpu").setHelp("cpu", "compute the distance field on the CPU, without OpenGL context")
+        .addOption("threads", "0").setHelp("threads", "thread count for CPU computation, 0 means all available threads", "N")
         .addSkippedPrefix("magnum", "engine-specific options")
         .setHelp("Converts red channel of an image to distance field representation.")
         .parse(arguments.argc, arguments.argv);
 
-    createContext();
+    if(!args.isSet("cpu")) createContext();
 }
 
 int DistanceFieldConverter::exec() {
@@ -141,37 +153,57 @@ int DistanceFieldConverter::exec() {
         return 1;
     }
 
-    /* Decide about internal format */
-    TextureFormat internalFormat;
-    if(image->format() == PixelFormat::Red) internalFormat = TextureFormat::R8;
-    else if(image->format() == PixelFormat::RGB) internalFormat = TextureFormat::RGB8;
-    else if(image->format() == PixelFormat::RGBA) internalFormat = TextureFormat::RGBA8;
-    else {
+    if(image->format() != PixelFormat::Red && image->format() != PixelFormat::RGB && image->format() != PixelFormat::RGBA) {
         Error() << "Unsupported image format" << image->format();
         return 1;
     }
 
-    /* Input texture */
-    Texture2D input;
-    input.setMinificationFilter(Sampler::Filter::Linear)
-        .setMagnificationFilter(Sampler::Filter::Linear)
-        .setWrapping(Sampler::Wrapping::ClampToEdge)
-        .setStorage(1, internalFormat, image->size())
-        .setSubImage(0, {}, *image);
-
-    /* Output texture */
-    Texture2D output;
-    output.setStorage(1, TextureFormat::R8, args.value<Vector2i>("output-size"));
-
-    CORRADE_INTERNAL_ASSERT(Renderer::error() == Renderer::Error::NoError);
+    const Vector2i outputSize = args.value<Vector2i>("output-size");
+    Image2D result(PixelFormat::Red, PixelType::UnsignedByte);
 
-    /* Do it */
-    Debug() << "Converting image of size" << image->size() << "to distance field...";
-    TextureTools::distanceField(input, output, {{}, args.value<Vector2i>("output-size")}, args.value<Int>("radius"), image->size());
+    /* Compute on the CPU */
+    if(args.isSet("cpu")) {
+        if(image->type() != PixelType::UnsignedByte) {
+            Error() << "Unsupported image type" << image->type();
+            return 1;
+        }
+
+        /* Rows with default four-byte alignment */
+        result = Image2D{PixelFormat::Red, PixelType::UnsignedByte, outputSize, Containers::Array<char>{std::size_t((outputSize.x() + 3)/4*4*outputSize.y())}};
+
+        Debug() << "Converting image of size" << image->size() << "to distance field on the CPU...";
+        TextureTools::distanceField(*image, result, {{}, outputSize}, args.value<Int>("radius"), args.value<UnsignedInt>("threads"));
+
+    /* Compute on the GPU */
+    } else {
+        /* Decide about internal format */
+        TextureFormat internalFormat;
+        if(image->format() == PixelFormat::Red) internalFormat = TextureFormat::R8;
+        else if(image->format() == PixelFormat::RGB) internalFormat = TextureFormat::RGB8;
+        else internalFormat = TextureFormat::RGBA8;
+
+        /* Input texture */
+        Texture2D input;
+        input.setMinificationFilter(Sampler::Filter::Linear)
+            .setMagnificationFilter(Sampler::Filter::Linear)
+            .setWrapping(Sampler::Wrapping::ClampToEdge)
+            .setStorage(1, internalFormat, image->size())
+            .setSubImage(0, {}, *image);
+
+        /* Output texture */
+        Texture2D output;
+        output.setStorage(1, TextureFormat::R8, outputSize);
+
+        CORRADE_INTERNAL_ASSERT(Renderer::error() == Renderer::Error::NoError);
+
+        /* Do it */
+        Debug() << "Converting image of size" << image->size() << "to distance field...";
+        TextureTools::distanceField(input, output, {{}, outputSize}, args.value<Int>("radius"), image->size());
+
+        output.image(0, result);
+    }
 
     /* Save image */
-    Image2D result(PixelFormat::Red, PixelType::UnsignedByte);
-    output.image(0, result);
     if(!converter->exportToFile(result, args.value("output"))) {
         Error() << "Cannot save file" << args.value("output");
         return 1;
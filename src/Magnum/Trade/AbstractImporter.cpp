@@ -34,6 +34,7 @@
 #include "Magnum/Trade/CameraData.h"
 #include "Magnum/Trade/ImageData.h"
 #include "Magnum/Trade/LightData.h"
+#include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/MeshData2D.h"
 #include "Magnum/Trade/MeshData3D.h"
 #include "Magnum/Trade/ObjectData2D.h"
@@ -304,6 +305,18 @@ std::optional<MeshData3D> AbstractImporter::mesh3D(const UnsignedInt id) {
 
 std::optional<MeshData3D> AbstractImporter::doMesh3D(UnsignedInt) { return std::nullopt; }
 
+std::optional<MeshData> AbstractImporter::mesh(const UnsignedInt id) {
+    CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::mesh(): no file opened", {});
+    CORRADE_ASSERT(id < doMesh3DCount(), "Trade::AbstractImporter::mesh(): index out of range", {});
+    return doMesh(id);
+}
+
+std::optional<MeshData> AbstractImporter::doMesh(const UnsignedInt id) {
+    const std::optional<MeshData3D> data = doMesh3D(id);
+    if(!data) return std::nullopt;
+    return MeshData{*data};
+}
+
 UnsignedInt AbstractImporter::materialCount() const {
     CORRADE_ASSERT(isOpened(), "Trade::AbstractImporter::materialCount(): no file opened", {});
     return doMaterialCount();
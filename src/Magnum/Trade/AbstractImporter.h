@@ -334,6 +334,17 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
          */
         std::optional<MeshData3D> mesh3D(UnsignedInt id);
 
+        /**
+         * @brief Three-dimensional mesh in a single vertex buffer
+         * @param id        Mesh ID, from range [0, @ref mesh3DCount()).
+         *
+         * Returns given mesh with all attributes in one contiguous vertex
+         * buffer or `std::nullopt` if importing failed. Importers that don't
+         * provide the data in this form directly return the result of
+         * @ref mesh3D() converted using @ref MeshData::MeshData(const MeshData3D&).
+         */
+        std::optional<MeshData> mesh(UnsignedInt id);
+
         /** @brief Material count */
         UnsignedInt materialCount() const;
 
@@ -689,6 +700,13 @@ class MAGNUM_EXPORT AbstractImporter: public PluginManager::AbstractManagingPlug
         /** @brief Implementation for @ref mesh3D() */
         virtual std::optional<MeshData3D> doMesh3D(UnsignedInt id);
 
+        /**
+         * @brief Implementation for @ref mesh()
+         *
+         * Default implementation converts output of @ref doMesh3D().
+         */
+        virtual std::optional<MeshData> doMesh(UnsignedInt id);
+
         /**
          * @brief Implementation for @ref materialCount()
          *
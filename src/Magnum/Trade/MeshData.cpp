@@ -0,0 +1,223 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshData.h"
+
+#include <cstring>
+
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade {
+
+Debug& operator<<(Debug& debug, const MeshAttribute value) {
+    switch(value) {
+        #define _c(value) case MeshAttribute::value: return debug << "Trade::MeshAttribute::" #value;
+        _c(Position)
+        _c(Normal)
+        _c(TextureCoordinates)
+        _c(Color)
+        #undef _c
+        case MeshAttribute::Custom: break;
+    }
+
+    if(UnsignedShort(value) >= UnsignedShort(MeshAttribute::Custom))
+        return debug << "Trade::MeshAttribute::Custom(" << Debug::nospace << UnsignedShort(value) - UnsignedShort(MeshAttribute::Custom) << Debug::nospace << ")";
+
+    return debug << "Trade::MeshAttribute(" << Debug::nospace << UnsignedShort(value) << Debug::nospace << ")";
+}
+
+Debug& operator<<(Debug& debug, const MeshAttributeFormat value) {
+    switch(value) {
+        #define _c(value) case MeshAttributeFormat::value: return debug << "Trade::MeshAttributeFormat::" #value;
+        _c(Float)
+        _c(Vector2)
+        _c(Vector3)
+        _c(Vector4)
+        #undef _c
+    }
+
+    return debug << "Trade::MeshAttributeFormat(" << Debug::nospace << UnsignedInt(value) << Debug::nospace << ")";
+}
+
+std::size_t meshAttributeFormatSize(const MeshAttributeFormat format) {
+    switch(format) {
+        case MeshAttributeFormat::Float: return sizeof(Float);
+        case MeshAttributeFormat::Vector2: return sizeof(Vector2);
+        case MeshAttributeFormat::Vector3: return sizeof(Vector3);
+        case MeshAttributeFormat::Vector4: return sizeof(Vector4);
+    }
+
+    CORRADE_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+MeshData::MeshData(const MeshPrimitive primitive, Containers::Array<char>&& indexData, const Mesh::IndexType indexType, Containers::Array<char>&& vertexData, std::vector<MeshAttributeData> attributes, const UnsignedInt vertexCount, const void* const importerState): _primitive{primitive}, _indexType{indexType}, _indexed{true}, _vertexCount{vertexCount}, _indexData{std::move(indexData)}, _vertexData{std::move(vertexData)}, _attributes{std::move(attributes)}, _importerState{importerState} {
+    CORRADE_ASSERT(_indexData.size()%Mesh::indexSize(indexType) == 0,
+        "Trade::MeshData: index data size" << _indexData.size() << "is not divisible by size of" << indexType, );
+
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    if(_vertexCount) for(const MeshAttributeData& attribute: _attributes) {
+        const std::size_t end = attribute.offset() + (_vertexCount - 1)*attribute.stride() + meshAttributeFormatSize(attribute.format());
+        CORRADE_ASSERT(end <= _vertexData.size(),
+            "Trade::MeshData:" << attribute.name() << "attribute needs" << end << "bytes but vertex data has only" << _vertexData.size(), );
+    }
+    #endif
+}
+
+MeshData::MeshData(const MeshPrimitive primitive, Containers::Array<char>&& vertexData, std::vector<MeshAttributeData> attributes, const UnsignedInt vertexCount, const void* const importerState): MeshData{primitive, nullptr, Mesh::IndexType::UnsignedInt, std::move(vertexData), std::move(attributes), vertexCount, importerState} {
+    _indexed = false;
+}
+
+namespace {
+
+/* Interleaved layout of all MeshData3D attributes */
+std::vector<MeshAttributeData> attributesFor(const MeshData3D& data) {
+    std::vector<MeshAttributeData> attributes;
+    std::size_t stride = 0;
+    const auto add = [&attributes, &stride](const MeshAttribute name, const MeshAttributeFormat format, const UnsignedInt count) {
+        for(UnsignedInt i = 0; i != count; ++i) {
+            attributes.emplace_back(name, format, stride, 0);
+            stride += meshAttributeFormatSize(format);
+        }
+    };
+    add(MeshAttribute::Position, MeshAttributeFormat::Vector3, data.positionArrayCount());
+    add(MeshAttribute::Normal, MeshAttributeFormat::Vector3, data.normalArrayCount());
+    add(MeshAttribute::TextureCoordinates, MeshAttributeFormat::Vector2, data.textureCoords2DArrayCount());
+
+    for(MeshAttributeData& attribute: attributes)
+        attribute = MeshAttributeData{attribute.name(), attribute.format(), attribute.offset(), stride};
+    return attributes;
+}
+
+template<class T> void copyInto(char* const data, const MeshAttributeData& attribute, const std::vector<T>& values) {
+    for(std::size_t i = 0; i != values.size(); ++i)
+        std::memcpy(data + attribute.offset() + i*attribute.stride(), &values[i], sizeof(T));
+}
+
+Containers::Array<char> vertexDataFor(const MeshData3D& data, const std::vector<MeshAttributeData>& attributes) {
+    const std::size_t vertexCount = data.positions(0).size();
+    Containers::Array<char> vertexData{vertexCount*(attributes.empty() ? 0 : attributes[0].stride())};
+
+    UnsignedInt attribute = 0;
+    for(UnsignedInt i = 0; i != data.positionArrayCount(); ++i)
+        copyInto(vertexData, attributes[attribute++], data.positions(i));
+    for(UnsignedInt i = 0; i != data.normalArrayCount(); ++i)
+        copyInto(vertexData, attributes[attribute++], data.normals(i));
+    for(UnsignedInt i = 0; i != data.textureCoords2DArrayCount(); ++i)
+        copyInto(vertexData, attributes[attribute++], data.textureCoords2D(i));
+
+    return vertexData;
+}
+
+Containers::Array<char> indexDataFor(const MeshData3D& data) {
+    if(!data.isIndexed()) return nullptr;
+
+    Containers::Array<char> indexData{data.indices().size()*sizeof(UnsignedInt)};
+    std::memcpy(indexData, data.indices().data(), indexData.size());
+    return indexData;
+}
+
+}
+
+MeshData::MeshData(const MeshData3D& other): _primitive{other.primitive()}, _indexType{Mesh::IndexType::UnsignedInt}, _indexed{other.isIndexed()}, _vertexCount{UnsignedInt(other.positions(0).size())}, _indexData{indexDataFor(other)}, _attributes{attributesFor(other)}, _importerState{other.importerState()} {
+    _vertexData = vertexDataFor(other, _attributes);
+}
+
+MeshData::MeshData(MeshData&&) noexcept = default;
+
+MeshData::~MeshData() = default;
+
+MeshData& MeshData::operator=(MeshData&&) noexcept = default;
+
+Mesh::IndexType MeshData::indexType() const {
+    CORRADE_ASSERT(isIndexed(), "Trade::MeshData::indexType(): the mesh is not indexed", {});
+    return _indexType;
+}
+
+UnsignedInt MeshData::indexCount() const {
+    return isIndexed() ? _indexData.size()/Mesh::indexSize(_indexType) : 0;
+}
+
+std::vector<UnsignedInt> MeshData::indicesAsArray() const {
+    CORRADE_ASSERT(isIndexed(), "Trade::MeshData::indicesAsArray(): the mesh is not indexed", {});
+
+    std::vector<UnsignedInt> out;
+    out.reserve(indexCount());
+    switch(_indexType) {
+        case Mesh::IndexType::UnsignedByte:
+            for(const UnsignedByte index: indices<UnsignedByte>()) out.push_back(index);
+            break;
+        case Mesh::IndexType::UnsignedShort:
+            for(const UnsignedShort index: indices<UnsignedShort>()) out.push_back(index);
+            break;
+        case Mesh::IndexType::UnsignedInt:
+            for(const UnsignedInt index: indices<UnsignedInt>()) out.push_back(index);
+            break;
+    }
+
+    return out;
+}
+
+const MeshAttributeData& MeshData::attributeData(const UnsignedInt id) const {
+    #if !defined(CORRADE_NO_ASSERT) || defined(CORRADE_GRACEFUL_ASSERT)
+    /* There may be no attributes at all, so return something that lives
+       long enough */
+    static const MeshAttributeData empty{MeshAttribute::Custom, MeshAttributeFormat::Float, 0, 0};
+    #endif
+    CORRADE_ASSERT(id < _attributes.size(),
+        "Trade::MeshData::attributeData(): index" << id << "out of range for" << _attributes.size() << "attributes", empty);
+    return _attributes[id];
+}
+
+UnsignedInt MeshData::attributeCount(const MeshAttribute name) const {
+    UnsignedInt count = 0;
+    for(const MeshAttributeData& attribute: _attributes)
+        if(attribute.name() == name) ++count;
+    return count;
+}
+
+UnsignedInt MeshData::attributeId(const MeshAttribute name, const UnsignedInt id) const {
+    UnsignedInt count = 0;
+    for(UnsignedInt i = 0; i != _attributes.size(); ++i)
+        if(_attributes[i].name() == name && count++ == id) return i;
+
+    CORRADE_ASSERT(false,
+        "Trade::MeshData::attributeId(): index" << id << "out of range for" << count << name << "attributes", {});
+    return {}; /* LCOV_EXCL_LINE */
+}
+
+Containers::Array<char> MeshData::releaseIndexData() {
+    _indexType = Mesh::IndexType::UnsignedInt;
+    _indexed = false;
+    return std::move(_indexData);
+}
+
+Containers::Array<char> MeshData::releaseVertexData() {
+    _vertexCount = 0;
+    _attributes.clear();
+    return std::move(_vertexData);
+}
+
+}}
@@ -0,0 +1,409 @@
+#ifndef Magnum_Trade_MeshData_h
+#define Magnum_Trade_MeshData_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MeshData, @ref Magnum::Trade::MeshAttributeData, enum @ref Magnum::Trade::MeshAttribute, @ref Magnum::Trade::MeshAttributeFormat
+ */
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/StridedArrayView.h"
+#include "Magnum/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh attribute name
+
+@see @ref MeshData, @ref MeshAttributeData
+*/
+enum class MeshAttribute: UnsignedShort {
+    /** Position, @ref MeshAttributeFormat::Vector2 or @ref MeshAttributeFormat::Vector3 */
+    Position,
+
+    /** Normal, @ref MeshAttributeFormat::Vector3 */
+    Normal,
+
+    /** Texture coordinates, @ref MeshAttributeFormat::Vector2 */
+    TextureCoordinates,
+
+    /** Color, @ref MeshAttributeFormat::Vector3 or @ref MeshAttributeFormat::Vector4 */
+    Color,
+
+    /**
+     * Start of importer-specific attributes. Values above this are not
+     * interpreted in any way.
+     */
+    Custom = 32768
+};
+
+/** @debugoperatorenum{Magnum::Trade::MeshAttribute} */
+MAGNUM_EXPORT Debug& operator<<(Debug& debug, MeshAttribute value);
+
+/**
+@brief Mesh attribute format
+
+@see @ref meshAttributeFormatSize(), @ref MeshAttributeData
+*/
+enum class MeshAttributeFormat: UnsignedByte {
+    Float,      /**< @ref Magnum::Float "Float" */
+    Vector2,    /**< @ref Magnum::Vector2 "Vector2" */
+    Vector3,    /**< @ref Magnum::Vector3 "Vector3" or @ref Magnum::Color3 "Color3" */
+    Vector4     /**< @ref Magnum::Vector4 "Vector4" or @ref Magnum::Color4 "Color4" */
+};
+
+/** @debugoperatorenum{Magnum::Trade::MeshAttributeFormat} */
+MAGNUM_EXPORT Debug& operator<<(Debug& debug, MeshAttributeFormat value);
+
+/** @brief Size of given mesh attribute format in bytes */
+MAGNUM_EXPORT std::size_t meshAttributeFormatSize(MeshAttributeFormat format);
+
+namespace Implementation {
+    template<class> struct MeshAttributeFormatFor;
+    template<> struct MeshAttributeFormatFor<Float> {
+        constexpr static MeshAttributeFormat format() { return MeshAttributeFormat::Float; }
+    };
+    template<> struct MeshAttributeFormatFor<Math::Vector2<Float>> {
+        constexpr static MeshAttributeFormat format() { return MeshAttributeFormat::Vector2; }
+    };
+    template<> struct MeshAttributeFormatFor<Math::Vector3<Float>> {
+        constexpr static MeshAttributeFormat format() { return MeshAttributeFormat::Vector3; }
+    };
+    template<> struct MeshAttributeFormatFor<Math::Vector4<Float>> {
+        constexpr static MeshAttributeFormat format() { return MeshAttributeFormat::Vector4; }
+    };
+    template<> struct MeshAttributeFormatFor<Math::Color3<Float>>: MeshAttributeFormatFor<Math::Vector3<Float>> {};
+    template<> struct MeshAttributeFormatFor<Math::Color4<Float>>: MeshAttributeFormatFor<Math::Vector4<Float>> {};
+
+    template<class> struct MeshIndexTypeFor;
+    template<> struct MeshIndexTypeFor<UnsignedByte> {
+        constexpr static Mesh::IndexType type() { return Mesh::IndexType::UnsignedByte; }
+    };
+    template<> struct MeshIndexTypeFor<UnsignedShort> {
+        constexpr static Mesh::IndexType type() { return Mesh::IndexType::UnsignedShort; }
+    };
+    template<> struct MeshIndexTypeFor<UnsignedInt> {
+        constexpr static Mesh::IndexType type() { return Mesh::IndexType::UnsignedInt; }
+    };
+}
+
+/**
+@brief Mesh attribute data
+
+Describes one attribute in vertex data of @ref MeshData.
+*/
+class MeshAttributeData {
+    public:
+        /**
+         * @brief Constructor
+         * @param name      Attribute name
+         * @param format    Attribute format
+         * @param offset    Byte offset of the first element in vertex data
+         * @param stride    Byte distance between two successive elements
+         */
+        constexpr explicit MeshAttributeData(MeshAttribute name, MeshAttributeFormat format, std::size_t offset, std::size_t stride) noexcept: _name{name}, _format{format}, _offset{offset}, _stride{stride} {}
+
+        /** @brief Attribute name */
+        constexpr MeshAttribute name() const { return _name; }
+
+        /** @brief Attribute format */
+        constexpr MeshAttributeFormat format() const { return _format; }
+
+        /** @brief Byte offset of the first element in vertex data */
+        constexpr std::size_t offset() const { return _offset; }
+
+        /** @brief Byte distance between two successive elements */
+        constexpr std::size_t stride() const { return _stride; }
+
+    private:
+        MeshAttribute _name;
+        MeshAttributeFormat _format;
+        std::size_t _offset;
+        std::size_t _stride;
+};
+
+/**
+@brief Mesh data
+
+Unlike @ref MeshData3D, which stores each attribute in a separate array, this
+class holds all vertex attributes in a single contiguous buffer described by
+a table of @ref MeshAttributeData, and indices in a single buffer of given
+@ref Mesh::IndexType. The data can be thus uploaded to the GPU as-is, without
+any repacking, and importers can hand over their interleaved data with just
+one allocation. Typed access to the attributes is provided through
+@ref StridedArrayView.
+@code
+Trade::MeshData data = *importer.mesh(0);
+
+// Attributes with given name, in any layout
+for(const Vector3& position: data.attribute<Vector3>(Trade::MeshAttribute::Position))
+    min = Math::min(min, position);
+
+// Uploading to the GPU as-is
+Mesh mesh;
+std::unique_ptr<Buffer> vertices, indices;
+std::tie(mesh, vertices, indices) = MeshTools::compile(data, BufferUsage::StaticDraw);
+@endcode
+
+There can be more than one attribute with given name, e.g. multiple sets of
+texture coordinates. Attributes with the same name are numbered in the order
+they were specified in the constructor, see @ref attributeId().
+
+@see @ref AbstractImporter::mesh(), @ref MeshTools::compile(const Trade::MeshData&, BufferUsage)
+*/
+class MAGNUM_EXPORT MeshData {
+    public:
+        /**
+         * @brief Construct indexed mesh data
+         * @param primitive     Primitive
+         * @param indexData     Index data
+         * @param indexType     Index type
+         * @param vertexData    Vertex data
+         * @param attributes    Description of attributes in @p vertexData
+         * @param vertexCount   Vertex count
+         * @param importerState Importer-specific state
+         *
+         * Expects that size of @p indexData is divisible by size of
+         * @p indexType and that all attributes fit into @p vertexData.
+         */
+        explicit MeshData(MeshPrimitive primitive, Containers::Array<char>&& indexData, Mesh::IndexType indexType, Containers::Array<char>&& vertexData, std::vector<MeshAttributeData> attributes, UnsignedInt vertexCount, const void* importerState = nullptr);
+
+        /**
+         * @brief Construct non-indexed mesh data
+         *
+         * Same as above, but with no index data.
+         */
+        explicit MeshData(MeshPrimitive primitive, Containers::Array<char>&& vertexData, std::vector<MeshAttributeData> attributes, UnsignedInt vertexCount, const void* importerState = nullptr);
+
+        /**
+         * @brief Construct from @ref MeshData3D
+         *
+         * Interleaves all attribute arrays into a single vertex buffer in
+         * the order of positions, normals and texture coordinates, with all
+         * arrays of the same kind next to each other. The indices, if any,
+         * are stored as @ref Mesh::IndexType::UnsignedInt. The importer state
+         * is copied.
+         */
+        explicit MeshData(const MeshData3D& other);
+
+        /** @brief Copying is not allowed */
+        MeshData(const MeshData&) = delete;
+
+        /** @brief Move constructor */
+        MeshData(MeshData&&) noexcept;
+
+        ~MeshData();
+
+        /** @brief Copying is not allowed */
+        MeshData& operator=(const MeshData&) = delete;
+
+        /** @brief Move assignment */
+        MeshData& operator=(MeshData&&) noexcept;
+
+        /** @brief Primitive */
+        MeshPrimitive primitive() const { return _primitive; }
+
+        /**
+         * @brief Whether the mesh is indexed
+         *
+         * Returns `true` also for meshes constructed with an empty index
+         * array.
+         */
+        bool isIndexed() const { return _indexed; }
+
+        /**
+         * @brief Index type
+         *
+         * Expects that the mesh is indexed.
+         */
+        Mesh::IndexType indexType() const;
+
+        /**
+         * @brief Index count
+         *
+         * Returns `0` if the mesh is not indexed.
+         */
+        UnsignedInt indexCount() const;
+
+        /** @brief Raw index data */
+        Containers::ArrayView<const char> indexData() const { return _indexData; }
+
+        /**
+         * @brief Indices
+         *
+         * Expects that the mesh is indexed and @p T corresponds to
+         * @ref indexType(). Use @ref indicesAsArray() to get indices of any
+         * type.
+         */
+        template<class T> Containers::ArrayView<const T> indices() const;
+
+        /**
+         * @brief Indices converted to @ref Magnum::UnsignedInt "UnsignedInt"
+         *
+         * Expects that the mesh is indexed.
+         */
+        std::vector<UnsignedInt> indicesAsArray() const;
+
+        /** @brief Vertex count */
+        UnsignedInt vertexCount() const { return _vertexCount; }
+
+        /** @brief Raw vertex data */
+        Containers::ArrayView<const char> vertexData() const { return _vertexData; }
+
+        /** @brief Mutable raw vertex data */
+        Containers::ArrayView<char> mutableVertexData() { return _vertexData; }
+
+        /** @brief Total attribute count */
+        UnsignedInt attributeCount() const { return _attributes.size(); }
+
+        /**
+         * @brief Attribute description
+         * @param id    Attribute ID, from range [0, @ref attributeCount()).
+         */
+        const MeshAttributeData& attributeData(UnsignedInt id) const;
+
+        /**
+         * @brief Count of attributes with given name
+         *
+         * @see @ref hasAttribute()
+         */
+        UnsignedInt attributeCount(MeshAttribute name) const;
+
+        /** @brief Whether the mesh has at least one attribute with given name */
+        bool hasAttribute(MeshAttribute name) const { return attributeCount(name); }
+
+        /**
+         * @brief Absolute ID of a named attribute
+         * @param name  Attribute name
+         * @param id    ID among attributes of the same name, from range
+         *      [0, @ref attributeCount(MeshAttribute) const)
+         */
+        UnsignedInt attributeId(MeshAttribute name, UnsignedInt id = 0) const;
+
+        /**
+         * @brief Attribute view
+         * @param id    Attribute ID, from range [0, @ref attributeCount()).
+         *
+         * Expects that @p T corresponds to format of the attribute.
+         */
+        template<class T> StridedArrayView<const T> attribute(UnsignedInt id) const;
+
+        /**
+         * @brief Named attribute view
+         *
+         * Equivalent to calling @ref attribute(UnsignedInt) const with
+         * @ref attributeId().
+         */
+        template<class T> StridedArrayView<const T> attribute(MeshAttribute name, UnsignedInt id = 0) const {
+            return attribute<T>(attributeId(name, id));
+        }
+
+        /**
+         * @brief Mutable attribute view
+         *
+         * Same as @ref attribute(UnsignedInt) const, but allows modification
+         * of the data, e.g. for transforming the mesh in-place.
+         */
+        template<class T> StridedArrayView<T> mutableAttribute(UnsignedInt id);
+
+        /**
+         * @brief Mutable named attribute view
+         *
+         * Equivalent to calling @ref mutableAttribute(UnsignedInt) with
+         * @ref attributeId().
+         */
+        template<class T> StridedArrayView<T> mutableAttribute(MeshAttribute name, UnsignedInt id = 0) {
+            return mutableAttribute<T>(attributeId(name, id));
+        }
+
+        /**
+         * @brief Release index data storage
+         *
+         * Releases the ownership of the index data and resets internal
+         * index-related state to default. The mesh then behaves like
+         * non-indexed.
+         */
+        Containers::Array<char> releaseIndexData();
+
+        /**
+         * @brief Release vertex data storage
+         *
+         * Releases the ownership of the vertex data and resets all
+         * attributes and vertex count to default.
+         */
+        Containers::Array<char> releaseVertexData();
+
+        /**
+         * @brief Importer-specific state
+         *
+         * See @ref AbstractImporter::importerState() for more information.
+         */
+        const void* importerState() const { return _importerState; }
+
+    private:
+        MeshPrimitive _primitive;
+        Mesh::IndexType _indexType;
+        bool _indexed;
+        UnsignedInt _vertexCount;
+        Containers::Array<char> _indexData;
+        Containers::Array<char> _vertexData;
+        std::vector<MeshAttributeData> _attributes;
+        const void* _importerState;
+};
+
+template<class T> Containers::ArrayView<const T> MeshData::indices() const {
+    CORRADE_ASSERT(isIndexed(),
+        "Trade::MeshData::indices(): the mesh is not indexed", {});
+    CORRADE_ASSERT(Implementation::MeshIndexTypeFor<T>::type() == _indexType,
+        "Trade::MeshData::indices(): improper type requested for" << _indexType, {});
+    return {reinterpret_cast<const T*>(_indexData.data()), _indexData.size()/sizeof(T)};
+}
+
+template<class T> StridedArrayView<const T> MeshData::attribute(const UnsignedInt id) const {
+    CORRADE_ASSERT(id < _attributes.size(),
+        "Trade::MeshData::attribute(): index" << id << "out of range for" << _attributes.size() << "attributes", {});
+    const MeshAttributeData& attribute = _attributes[id];
+    CORRADE_ASSERT(Implementation::MeshAttributeFormatFor<typename std::remove_const<T>::type>::format() == attribute.format(),
+        "Trade::MeshData::attribute(): improper type requested for" << attribute.name() << "of format" << attribute.format(), {});
+    return StridedArrayView<const T>{_vertexData.data() + attribute.offset(), _vertexCount, attribute.stride()};
+}
+
+template<class T> StridedArrayView<T> MeshData::mutableAttribute(const UnsignedInt id) {
+    CORRADE_ASSERT(id < _attributes.size(),
+        "Trade::MeshData::mutableAttribute(): index" << id << "out of range for" << _attributes.size() << "attributes", {});
+    const MeshAttributeData& attribute = _attributes[id];
+    CORRADE_ASSERT(Implementation::MeshAttributeFormatFor<T>::format() == attribute.format(),
+        "Trade::MeshData::mutableAttribute(): improper type requested for" << attribute.name() << "of format" << attribute.format(), {});
+    return StridedArrayView<T>{_vertexData.data() + attribute.offset(), _vertexCount, attribute.stride()};
+}
+
+}}
+
+#endif
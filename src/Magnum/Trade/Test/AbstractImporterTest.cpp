@@ -27,7 +27,10 @@
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/Utility/Directory.h>
 
+#include "Magnum/Math/Vector3.h"
 #include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MeshData3D.h"
 
 #include "configure.h"
 
@@ -38,10 +41,12 @@ class AbstractImporterTest: public TestSuite::Tester {
         explicit AbstractImporterTest();
 
         void openFile();
+        void meshFromMesh3D();
 };
 
 AbstractImporterTest::AbstractImporterTest() {
-    addTests({&AbstractImporterTest::openFile});
+    addTests({&AbstractImporterTest::openFile,
+              &AbstractImporterTest::meshFromMesh3D});
 }
 
 void AbstractImporterTest::openFile() {
@@ -68,6 +73,33 @@ void AbstractImporterTest::openFile() {
     CORRADE_VERIFY(importer.isOpened());
 }
 
+void AbstractImporterTest::meshFromMesh3D() {
+    class Importer: public Trade::AbstractImporter {
+        private:
+            Features doFeatures() const override { return {}; }
+            bool doIsOpened() const override { return true; }
+            void doClose() override {}
+
+            UnsignedInt doMesh3DCount() const override { return 1; }
+            std::optional<MeshData3D> doMesh3D(UnsignedInt) override {
+                return MeshData3D{MeshPrimitive::Lines, {0, 1, 1, 2},
+                    {{{0.0f, 1.0f, 2.0f}, {3.0f, 4.0f, 5.0f}, {6.0f, 7.0f, 8.0f}}},
+                    {{{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}}, {}};
+            }
+    };
+
+    /* mesh() should convert the output of doMesh3D() by default */
+    Importer importer;
+    std::optional<MeshData> mesh = importer.mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(mesh->indexCount(), 4);
+    CORRADE_COMPARE(mesh->vertexCount(), 3);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE(mesh->attribute<Vector3>(MeshAttribute::Position)[2], (Vector3{6.0f, 7.0f, 8.0f}));
+    CORRADE_COMPARE(mesh->attribute<Vector3>(MeshAttribute::Normal)[1], (Vector3{0.0f, 1.0f, 0.0f}));
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::AbstractImporterTest)
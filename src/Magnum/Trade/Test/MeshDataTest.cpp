@@ -0,0 +1,378 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MeshData3D.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MeshDataTest: public TestSuite::Tester {
+    public:
+        explicit MeshDataTest();
+
+        void construct();
+        void constructNotIndexed();
+    void constructEmptyIndices();
+        void constructFromMeshData3D();
+        void constructFromMeshData3DNotIndexed();
+        void constructCopy();
+        void constructMove();
+
+        void indicesAsArray();
+        void indicesWrongType();
+        void indicesNotIndexed();
+
+        void attributeNamed();
+        void attributeOutOfRange();
+    void attributeDataOutOfRange();
+        void attributeWrongType();
+        void mutableAttribute();
+
+        void release();
+
+        void debugAttribute();
+        void debugAttributeFormat();
+};
+
+MeshDataTest::MeshDataTest() {
+    addTests({&MeshDataTest::construct,
+              &MeshDataTest::constructNotIndexed,
+              &MeshDataTest::constructEmptyIndices,
+              &MeshDataTest::constructFromMeshData3D,
+              &MeshDataTest::constructFromMeshData3DNotIndexed,
+              &MeshDataTest::constructCopy,
+              &MeshDataTest::constructMove,
+
+              &MeshDataTest::indicesAsArray,
+              &MeshDataTest::indicesWrongType,
+              &MeshDataTest::indicesNotIndexed,
+
+              &MeshDataTest::attributeNamed,
+              &MeshDataTest::attributeOutOfRange,
+              &MeshDataTest::attributeDataOutOfRange,
+              &MeshDataTest::attributeWrongType,
+              &MeshDataTest::mutableAttribute,
+
+              &MeshDataTest::release,
+
+              &MeshDataTest::debugAttribute,
+              &MeshDataTest::debugAttributeFormat});
+}
+
+namespace {
+    struct Vertex {
+        Vector3 position;
+        Vector2 textureCoordinates;
+        Color4 color;
+    };
+
+    /* Three interleaved vertices with 16-bit indices */
+    MeshData interleavedMesh() {
+        Containers::Array<char> indexData{4*sizeof(UnsignedShort)};
+        UnsignedShort* indices = reinterpret_cast<UnsignedShort*>(indexData.data());
+        indices[0] = 0;
+        indices[1] = 1;
+        indices[2] = 2;
+        indices[3] = 0;
+
+        Containers::Array<char> vertexData{3*sizeof(Vertex)};
+        Vertex* vertices = reinterpret_cast<Vertex*>(vertexData.data());
+        vertices[0] = {{0.0f, 1.0f, 2.0f}, {0.0f, 0.5f}, {1.0f, 0.0f, 0.0f, 1.0f}};
+        vertices[1] = {{3.0f, 4.0f, 5.0f}, {1.0f, 0.5f}, {0.0f, 1.0f, 0.0f, 1.0f}};
+        vertices[2] = {{6.0f, 7.0f, 8.0f}, {0.5f, 1.0f}, {0.0f, 0.0f, 1.0f, 1.0f}};
+
+        return MeshData{MeshPrimitive::Triangles,
+            std::move(indexData), Mesh::IndexType::UnsignedShort,
+            std::move(vertexData), {
+                MeshAttributeData{MeshAttribute::Position, MeshAttributeFormat::Vector3, offsetof(Vertex, position), sizeof(Vertex)},
+                MeshAttributeData{MeshAttribute::TextureCoordinates, MeshAttributeFormat::Vector2, offsetof(Vertex, textureCoordinates), sizeof(Vertex)},
+                MeshAttributeData{MeshAttribute::Color, MeshAttributeFormat::Vector4, offsetof(Vertex, color), sizeof(Vertex)}}, 3};
+    }
+}
+
+void MeshDataTest::construct() {
+    int a;
+    Containers::Array<char> indexData{3};
+    const char* indexDataPointer = indexData.data();
+    Containers::Array<char> vertexData{2*sizeof(Vector3) + 3*sizeof(Vector2)};
+    const char* vertexDataPointer = vertexData.data();
+
+    /* Non-interleaved positions followed by texture coordinates */
+    MeshData data{MeshPrimitive::TriangleFan,
+        std::move(indexData), Mesh::IndexType::UnsignedByte,
+        std::move(vertexData), {
+            MeshAttributeData{MeshAttribute::Position, MeshAttributeFormat::Vector3, 0, sizeof(Vector3)},
+            MeshAttributeData{MeshAttribute::TextureCoordinates, MeshAttributeFormat::Vector2, 2*sizeof(Vector3), 2*sizeof(Vector2)}}, 2, &a};
+
+    CORRADE_COMPARE(data.primitive(), MeshPrimitive::TriangleFan);
+    CORRADE_VERIFY(data.isIndexed());
+    CORRADE_COMPARE(data.indexType(), Mesh::IndexType::UnsignedByte);
+    CORRADE_COMPARE(data.indexCount(), 3);
+    CORRADE_COMPARE(static_cast<const void*>(data.indexData().data()), indexDataPointer);
+    CORRADE_COMPARE(data.vertexCount(), 2);
+    CORRADE_COMPARE(static_cast<const void*>(data.vertexData().data()), vertexDataPointer);
+    CORRADE_COMPARE(data.vertexData().size(), 2*sizeof(Vector3) + 3*sizeof(Vector2));
+    CORRADE_COMPARE(data.importerState(), &a);
+
+    CORRADE_COMPARE(data.attributeCount(), 2);
+    CORRADE_COMPARE(data.attributeData(1).name(), MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(data.attributeData(1).format(), MeshAttributeFormat::Vector2);
+    CORRADE_COMPARE(data.attributeData(1).offset(), 2*sizeof(Vector3));
+    CORRADE_COMPARE(data.attributeData(1).stride(), 2*sizeof(Vector2));
+
+    StridedArrayView<const Vector2> textureCoordinates = data.attribute<Vector2>(1);
+    CORRADE_COMPARE(textureCoordinates.size(), 2);
+    CORRADE_COMPARE(textureCoordinates.stride(), 2*sizeof(Vector2));
+    CORRADE_COMPARE(static_cast<const void*>(textureCoordinates.data()), vertexDataPointer + 2*sizeof(Vector3));
+}
+
+void MeshDataTest::constructNotIndexed() {
+    Containers::Array<char> vertexData{3*sizeof(Float)};
+    MeshData data{MeshPrimitive::Points, std::move(vertexData), {
+        MeshAttributeData{MeshAttribute::Custom, MeshAttributeFormat::Float, 0, sizeof(Float)}}, 3};
+
+    CORRADE_COMPARE(data.primitive(), MeshPrimitive::Points);
+    CORRADE_VERIFY(!data.isIndexed());
+    CORRADE_COMPARE(data.indexCount(), 0);
+    CORRADE_COMPARE(static_cast<const void*>(data.indexData().data()), nullptr);
+    CORRADE_COMPARE(data.vertexCount(), 3);
+    CORRADE_COMPARE(data.attributeCount(), 1);
+    CORRADE_COMPARE(data.attribute<Float>(MeshAttribute::Custom).size(), 3);
+    CORRADE_COMPARE(data.importerState(), nullptr);
+}
+
+void MeshDataTest::constructEmptyIndices() {
+    Containers::Array<char> vertexData{3*sizeof(Float)};
+    MeshData data{MeshPrimitive::Points, nullptr, Mesh::IndexType::UnsignedShort, std::move(vertexData), {
+        MeshAttributeData{MeshAttribute::Custom, MeshAttributeFormat::Float, 0, sizeof(Float)}}, 3};
+
+    /* Empty index array is still an indexed mesh, it just draws nothing */
+    CORRADE_VERIFY(data.isIndexed());
+    CORRADE_COMPARE(data.indexType(), Mesh::IndexType::UnsignedShort);
+    CORRADE_COMPARE(data.indexCount(), 0);
+    CORRADE_COMPARE(data.indices<UnsignedShort>().size(), 0);
+}
+
+void MeshDataTest::constructFromMeshData3D() {
+    int a;
+    const MeshData3D data3D{MeshPrimitive::Triangles,
+        {0, 1, 2, 2, 1, 3},
+        {{{0.0f, 1.0f, 2.0f}, {3.0f, 4.0f, 5.0f}, {6.0f, 7.0f, 8.0f}, {9.0f, 10.0f, 11.0f}},
+         {{-0.0f, -1.0f, -2.0f}, {-3.0f, -4.0f, -5.0f}, {-6.0f, -7.0f, -8.0f}, {-9.0f, -10.0f, -11.0f}}},
+        {{{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}}},
+        {{{0.0f, 0.5f}, {1.0f, 0.5f}, {0.5f, 1.0f}, {0.5f, 0.0f}}}, &a};
+
+    MeshData data{data3D};
+    CORRADE_COMPARE(data.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(data.indexType(), Mesh::IndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(std::vector<UnsignedInt>(data.indices<UnsignedInt>().begin(), data.indices<UnsignedInt>().end()),
+        (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(data.importerState(), &a);
+
+    /* All attributes are interleaved */
+    CORRADE_COMPARE(data.vertexCount(), 4);
+    CORRADE_COMPARE(data.vertexData().size(), 4*(3*sizeof(Vector3) + sizeof(Vector2)));
+    CORRADE_COMPARE(data.attributeCount(), 4);
+    CORRADE_COMPARE(data.attributeCount(MeshAttribute::Position), 2);
+    CORRADE_COMPARE(data.attributeCount(MeshAttribute::Normal), 1);
+    CORRADE_COMPARE(data.attributeCount(MeshAttribute::TextureCoordinates), 1);
+    CORRADE_VERIFY(!data.hasAttribute(MeshAttribute::Color));
+    for(UnsignedInt i = 0; i != data.attributeCount(); ++i)
+        CORRADE_COMPARE(data.attributeData(i).stride(), 3*sizeof(Vector3) + sizeof(Vector2));
+    CORRADE_COMPARE(data.attributeData(2).offset(), 2*sizeof(Vector3));
+
+    StridedArrayView<const Vector3> positions = data.attribute<Vector3>(MeshAttribute::Position, 1);
+    CORRADE_COMPARE_AS(std::vector<Vector3>(positions.begin(), positions.end()),
+        data3D.positions(1), TestSuite::Compare::Container);
+    StridedArrayView<const Vector3> normals = data.attribute<Vector3>(MeshAttribute::Normal);
+    CORRADE_COMPARE_AS(std::vector<Vector3>(normals.begin(), normals.end()),
+        data3D.normals(0), TestSuite::Compare::Container);
+    StridedArrayView<const Vector2> textureCoordinates = data.attribute<Vector2>(MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE_AS(std::vector<Vector2>(textureCoordinates.begin(), textureCoordinates.end()),
+        data3D.textureCoords2D(0), TestSuite::Compare::Container);
+}
+
+void MeshDataTest::constructFromMeshData3DNotIndexed() {
+    MeshData data{MeshData3D{MeshPrimitive::Points, {}, {{{1.5f, 2.5f, 3.5f}, {4.5f, 5.5f, 6.5f}}}, {}, {}}};
+
+    CORRADE_VERIFY(!data.isIndexed());
+    CORRADE_COMPARE(data.vertexCount(), 2);
+    CORRADE_COMPARE(data.attributeCount(), 1);
+    CORRADE_COMPARE(data.attributeData(0).stride(), sizeof(Vector3));
+    CORRADE_COMPARE(data.attribute<Vector3>(MeshAttribute::Position)[1], (Vector3{4.5f, 5.5f, 6.5f}));
+}
+
+void MeshDataTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_constructible<MeshData, const MeshData&>{}));
+    CORRADE_VERIFY(!(std::is_assignable<MeshData, const MeshData&>{}));
+}
+
+void MeshDataTest::constructMove() {
+    MeshData a = interleavedMesh();
+    const char* vertexDataPointer = a.vertexData().data();
+
+    MeshData b{std::move(a)};
+    CORRADE_COMPARE(b.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(b.indexCount(), 4);
+    CORRADE_COMPARE(b.vertexCount(), 3);
+    CORRADE_COMPARE(static_cast<const void*>(b.vertexData().data()), vertexDataPointer);
+    CORRADE_COMPARE(b.attributeCount(), 3);
+
+    MeshData c{MeshPrimitive::Lines, nullptr, {}, 0};
+    c = std::move(b);
+    CORRADE_COMPARE(c.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(static_cast<const void*>(c.vertexData().data()), vertexDataPointer);
+    CORRADE_COMPARE(c.attribute<Vector3>(MeshAttribute::Position)[2], (Vector3{6.0f, 7.0f, 8.0f}));
+}
+
+void MeshDataTest::indicesAsArray() {
+    MeshData data = interleavedMesh();
+    CORRADE_COMPARE(data.indexType(), Mesh::IndexType::UnsignedShort);
+    CORRADE_COMPARE(data.indices<UnsignedShort>().size(), 4);
+    CORRADE_COMPARE(data.indices<UnsignedShort>()[1], 1);
+    CORRADE_COMPARE_AS(data.indicesAsArray(), (std::vector<UnsignedInt>{0, 1, 2, 0}),
+        TestSuite::Compare::Container);
+}
+
+void MeshDataTest::indicesWrongType() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshData data = interleavedMesh();
+    data.indices<UnsignedInt>();
+    CORRADE_COMPARE(out.str(), "Trade::MeshData::indices(): improper type requested for Mesh::IndexType::UnsignedShort\n");
+}
+
+void MeshDataTest::indicesNotIndexed() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshData data{MeshPrimitive::Points, nullptr, {}, 0};
+    data.indices<UnsignedInt>();
+    CORRADE_COMPARE(out.str(), "Trade::MeshData::indices(): the mesh is not indexed\n");
+}
+
+void MeshDataTest::attributeNamed() {
+    const MeshData data = interleavedMesh();
+    CORRADE_COMPARE(data.attributeId(MeshAttribute::Color), 2);
+
+    StridedArrayView<const Vector2> textureCoordinates = data.attribute<Vector2>(MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE(textureCoordinates.size(), 3);
+    CORRADE_COMPARE(textureCoordinates.stride(), sizeof(Vertex));
+    CORRADE_COMPARE(textureCoordinates[2], (Vector2{0.5f, 1.0f}));
+
+    /* Colors can be accessed both as vectors and as colors */
+    CORRADE_COMPARE(data.attribute<Color4>(MeshAttribute::Color)[1], (Color4{0.0f, 1.0f, 0.0f, 1.0f}));
+    CORRADE_COMPARE(data.attribute<Vector4>(MeshAttribute::Color)[2], (Vector4{0.0f, 0.0f, 1.0f, 1.0f}));
+}
+
+void MeshDataTest::attributeOutOfRange() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshData data = interleavedMesh();
+    data.attribute<Vector3>(3);
+    data.mutableAttribute<Vector3>(3);
+    CORRADE_COMPARE(out.str(),
+        "Trade::MeshData::attribute(): index 3 out of range for 3 attributes\n"
+        "Trade::MeshData::mutableAttribute(): index 3 out of range for 3 attributes\n");
+}
+
+void MeshDataTest::attributeDataOutOfRange() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Containers::Array<char> vertexData;
+    MeshData data{MeshPrimitive::Points, std::move(vertexData), {}, 0};
+    data.attributeData(0);
+    CORRADE_COMPARE(out.str(),
+        "Trade::MeshData::attributeData(): index 0 out of range for 0 attributes\n");
+}
+
+void MeshDataTest::attributeWrongType() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshData data = interleavedMesh();
+    data.attribute<Vector3>(MeshAttribute::TextureCoordinates);
+    data.mutableAttribute<Color3>(MeshAttribute::Color);
+    CORRADE_COMPARE(out.str(),
+        "Trade::MeshData::attribute(): improper type requested for Trade::MeshAttribute::TextureCoordinates of format Trade::MeshAttributeFormat::Vector2\n"
+        "Trade::MeshData::mutableAttribute(): improper type requested for Trade::MeshAttribute::Color of format Trade::MeshAttributeFormat::Vector4\n");
+}
+
+void MeshDataTest::mutableAttribute() {
+    MeshData data = interleavedMesh();
+    for(Vector3& position: data.mutableAttribute<Vector3>(MeshAttribute::Position))
+        position *= 2.0f;
+
+    /* Other attributes are untouched */
+    CORRADE_COMPARE(data.attribute<Vector3>(MeshAttribute::Position)[1], (Vector3{6.0f, 8.0f, 10.0f}));
+    CORRADE_COMPARE(data.attribute<Vector2>(MeshAttribute::TextureCoordinates)[1], (Vector2{1.0f, 0.5f}));
+    CORRADE_COMPARE(static_cast<const void*>(data.mutableVertexData().data()), data.vertexData().data());
+}
+
+void MeshDataTest::release() {
+    MeshData data = interleavedMesh();
+    const char* indexDataPointer = data.indexData().data();
+    const char* vertexDataPointer = data.vertexData().data();
+
+    Containers::Array<char> indexData = data.releaseIndexData();
+    CORRADE_COMPARE(static_cast<const void*>(indexData.data()), indexDataPointer);
+    CORRADE_COMPARE(indexData.size(), 4*sizeof(UnsignedShort));
+    CORRADE_VERIFY(!data.isIndexed());
+    CORRADE_COMPARE(data.indexCount(), 0);
+
+    Containers::Array<char> vertexData = data.releaseVertexData();
+    CORRADE_COMPARE(static_cast<const void*>(vertexData.data()), vertexDataPointer);
+    CORRADE_COMPARE(vertexData.size(), 3*sizeof(Vertex));
+    CORRADE_COMPARE(static_cast<const void*>(data.vertexData().data()), nullptr);
+    CORRADE_COMPARE(data.vertexCount(), 0);
+    CORRADE_COMPARE(data.attributeCount(), 0);
+}
+
+void MeshDataTest::debugAttribute() {
+    std::ostringstream out;
+
+    Debug(&out) << MeshAttribute::Normal << MeshAttribute::Custom << MeshAttribute(32771) << MeshAttribute(1234);
+    CORRADE_COMPARE(out.str(), "Trade::MeshAttribute::Normal Trade::MeshAttribute::Custom(0) Trade::MeshAttribute::Custom(3) Trade::MeshAttribute(1234)\n");
+}
+
+void MeshDataTest::debugAttributeFormat() {
+    std::ostringstream out;
+
+    Debug(&out) << MeshAttributeFormat::Vector2 << MeshAttributeFormat(0xde);
+    CORRADE_COMPARE(out.str(), "Trade::MeshAttributeFormat::Vector2 Trade::MeshAttributeFormat(222)\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshDataTest)
@@ -45,6 +45,10 @@ typedef ImageData<2> ImageData2D;
 typedef ImageData<3> ImageData3D;
 
 class LightData;
+enum class MeshAttribute: UnsignedShort;
+class MeshAttributeData;
+enum class MeshAttributeFormat: UnsignedByte;
+class MeshData;
 class MeshData2D;
 class MeshData3D;
 class MeshObjectData2D;
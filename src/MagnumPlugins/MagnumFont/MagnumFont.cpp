@@ -46,15 +46,18 @@ struct MagnumFont::Data {
 namespace {
     class MagnumFontLayouter: public AbstractLayouter {
         public:
-            explicit MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, Float fontSize, Float textSize, std::vector<UnsignedInt>&& glyphs);
+            explicit MagnumFontLayouter(const std::unordered_map<char32_t, UnsignedInt>& glyphId, const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, Float fontSize, Float textSize, Containers::ArrayView<const char> text);
+
+            void relayout(const std::unordered_map<char32_t, UnsignedInt>& glyphId, const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, Float fontSize, Float textSize, Containers::ArrayView<const char> text);
 
         private:
             std::tuple<Range2D, Range2D, Vector2> doRenderGlyph(UnsignedInt i) override;
 
-            const std::vector<Vector2>& glyphAdvance;
-            const GlyphCache& cache;
-            const Float fontSize, textSize;
-            const std::vector<UnsignedInt> glyphs;
+            const std::vector<Vector2>* glyphAdvance;
+            const GlyphCache* cache;
+            Float fontSize, textSize;
+            /* Kept between relayouts so it doesn't need to be reallocated */
+            std::vector<UnsignedInt> glyphs;
     };
 }
 
@@ -198,38 +201,56 @@ std::unique_ptr<GlyphCache> MagnumFont::doCreateGlyphCache() {
 }
 
 std::unique_ptr<AbstractLayouter> MagnumFont::doLayout(const GlyphCache& cache, Float size, const std::string& text) {
+    return std::unique_ptr<MagnumFontLayouter>(new MagnumFontLayouter(_opened->glyphId, _opened->glyphAdvance, cache, this->size(), size, {text.data(), text.size()}));
+}
+
+bool MagnumFont::doRelayout(AbstractLayouter& layouter, const GlyphCache& cache, Float size, const Containers::ArrayView<const char> text) {
+    static_cast<MagnumFontLayouter&>(layouter).relayout(_opened->glyphId, _opened->glyphAdvance, cache, this->size(), size, text);
+    return true;
+}
+
+namespace {
+
+MagnumFontLayouter::MagnumFontLayouter(const std::unordered_map<char32_t, UnsignedInt>& glyphId, const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, const Float fontSize, const Float textSize, const Containers::ArrayView<const char> text): AbstractLayouter(0) {
+    relayout(glyphId, glyphAdvance, cache, fontSize, textSize, text);
+}
+
+void MagnumFontLayouter::relayout(const std::unordered_map<char32_t, UnsignedInt>& glyphId, const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, const Float fontSize, const Float textSize, const Containers::ArrayView<const char> text) {
+    /* The font could have been reopened since the last time, so update
+       everything */
+    this->glyphAdvance = &glyphAdvance;
+    this->cache = &cache;
+    this->fontSize = fontSize;
+    this->textSize = textSize;
+
     /* Get glyph codes from characters */
-    std::vector<UnsignedInt> glyphs;
+    glyphs.clear();
     glyphs.reserve(text.size());
     for(std::size_t i = 0; i != text.size(); ) {
         UnsignedInt codepoint;
         std::tie(codepoint, i) = Utility::Unicode::nextChar(text, i);
-        const auto it = _opened->glyphId.find(codepoint);
-        glyphs.push_back(it == _opened->glyphId.end() ? 0 : it->second);
+        const auto it = glyphId.find(codepoint);
+        glyphs.push_back(it == glyphId.end() ? 0 : it->second);
     }
 
-    return std::unique_ptr<MagnumFontLayouter>(new MagnumFontLayouter(_opened->glyphAdvance, cache, this->size(), size, std::move(glyphs)));
+    setGlyphCount(glyphs.size());
 }
 
-namespace {
-
-MagnumFontLayouter::MagnumFontLayouter(const std::vector<Vector2>& glyphAdvance, const GlyphCache& cache, const Float fontSize, const Float textSize, std::vector<UnsignedInt>&& glyphs): AbstractLayouter(glyphs.size()), glyphAdvance(glyphAdvance), cache(cache), fontSize(fontSize), textSize(textSize), glyphs(std::move(glyphs)) {}
-
 std::tuple<Range2D, Range2D, Vector2> MagnumFontLayouter::doRenderGlyph(const UnsignedInt i) {
     /* Position of the texture in the resulting glyph, texture coordinates */
     Vector2i position;
     Range2Di rectangle;
-    std::tie(position, rectangle) = cache[glyphs[i]];
+    std::tie(position, rectangle) = (*cache)[glyphs[i]];
 
     /* Normalized texture coordinates */
-    const auto textureCoordinates = Range2D(rectangle).scaled(1.0f/Vector2(cache.textureSize()));
+    const auto textureCoordinates = Range2D(rectangle).scaled(1.0f/Vector2(cache->textureSize()));
 
     /* Quad rectangle, computed from texture rectangle, denormalized to
        requested text size */
     const auto quadRectangle = Range2D(Range2Di::fromSize(position, rectangle.size())).scaled(Vector2(textSize/fontSize));
 
     /* Advance for given glyph, denormalized to requested text size */
-    const Vector2 advance = glyphAdvance[glyphs[i]]*(textSize/fontSize);
+    const Vector2 advance = (*glyphAdvance)[glyphs[i]]*(textSize/fontSize);
 
     return std::make_tuple(quadRectangle, textureCoordinates, advance);
 }
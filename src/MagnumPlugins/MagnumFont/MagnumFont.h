@@ -134,6 +134,8 @@ class MagnumFont: public AbstractFont {
 
         std::unique_ptr<AbstractLayouter> doLayout(const GlyphCache& cache, Float size, const std::string& text) override;
 
+        bool doRelayout(AbstractLayouter& layouter, const GlyphCache& cache, Float size, Containers::ArrayView<const char> text) override;
+
         Metrics openInternal(Utility::Configuration&& conf, Trade::ImageData2D&& image);
 
         Data* _opened;
@@ -30,7 +30,6 @@
 #include <Corrade/Utility/Directory.h>
 
 #include "Magnum/Image.h"
-#include "Magnum/PixelFormat.h"
 #include "Magnum/Text/GlyphCache.h"
 #include "Magnum/Text/AbstractFont.h"
 #include "MagnumPlugins/TgaImageConverter/TgaImageConverter.h"
@@ -101,8 +100,7 @@ std::vector<std::pair<std::string, Containers::Array<char>>> MagnumFontConverter
     std::copy(confStr.begin(), confStr.end(), confData.begin());
 
     /* Save cache image */
-    Image2D image(PixelFormat::Red, PixelType::UnsignedByte);
-    cache.texture().image(0, image);
+    const Image2D image = cache.image();
     auto tgaData = Trade::TgaImageConverter().exportToData(image);
 
     std::vector<std::pair<std::string, Containers::Array<char>>> out;
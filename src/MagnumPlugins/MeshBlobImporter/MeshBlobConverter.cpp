@@ -0,0 +1,156 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshBlobConverter.h"
+
+#include <cstring>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/MeshBlobImporter/MeshBlobHeader.h"
+
+namespace Magnum { namespace Trade {
+
+namespace {
+
+std::size_t alignedOffset(const std::size_t offset) {
+    return (offset + MeshBlobAlignment - 1)/MeshBlobAlignment*MeshBlobAlignment;
+}
+
+}
+
+Containers::Array<char> convertToMeshBlob(const std::vector<std::pair<std::string, MeshData3D>>& meshes) {
+    /* Compute layout of the file. Header table goes first, each mesh then has
+       its name followed by aligned index and attribute arrays. */
+    std::vector<MeshBlobMeshHeader> headers(meshes.size());
+    std::size_t size = sizeof(MeshBlobHeader) + meshes.size()*sizeof(MeshBlobMeshHeader);
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        const std::string& name = meshes[i].first;
+        const MeshData3D& mesh = meshes[i].second;
+        MeshBlobMeshHeader& header = headers[i];
+
+        header.primitive = UnsignedInt(mesh.primitive());
+        header.indexCount = mesh.isIndexed() ? mesh.indices().size() : 0;
+        header.positionArrayCount = mesh.positionArrayCount();
+        header.normalArrayCount = mesh.normalArrayCount();
+        header.textureCoords2DArrayCount = mesh.textureCoords2DArrayCount();
+        header.vertexCount = header.positionArrayCount ? mesh.positions(0).size() : 0;
+        header.reserved = 0;
+
+        bool sameSize = true;
+        for(UnsignedInt j = 0; j != mesh.positionArrayCount(); ++j)
+            sameSize = sameSize && mesh.positions(j).size() == header.vertexCount;
+        for(UnsignedInt j = 0; j != mesh.normalArrayCount(); ++j)
+            sameSize = sameSize && mesh.normals(j).size() == header.vertexCount;
+        for(UnsignedInt j = 0; j != mesh.textureCoords2DArrayCount(); ++j)
+            sameSize = sameSize && mesh.textureCoords2D(j).size() == header.vertexCount;
+        if(!sameSize) {
+            Error() << "Trade::convertToMeshBlob(): attribute arrays of mesh" << i << "have different sizes";
+            return nullptr;
+        }
+
+        header.nameOffset = size;
+        header.nameSize = name.size();
+        size += name.size();
+
+        header.indexOffset = size = alignedOffset(size);
+        size += header.indexCount*sizeof(UnsignedInt);
+
+        header.positionOffset = size = alignedOffset(size);
+        size += std::size_t(header.positionArrayCount)*header.vertexCount*sizeof(Vector3);
+
+        header.normalOffset = size = alignedOffset(size);
+        size += std::size_t(header.normalArrayCount)*header.vertexCount*sizeof(Vector3);
+
+        header.textureCoords2DOffset = size = alignedOffset(size);
+        size += std::size_t(header.textureCoords2DArrayCount)*header.vertexCount*sizeof(Vector2);
+    }
+
+    /* Zero-initialized so the padding is deterministic */
+    Containers::Array<char> out{Containers::ValueInit, size};
+
+    MeshBlobHeader& header = *reinterpret_cast<MeshBlobHeader*>(out.data());
+    std::memcpy(header.magic, "MBLB", 4);
+    header.version = 1;
+    header.meshHeaderSize = sizeof(MeshBlobMeshHeader);
+    header.meshCount = meshes.size();
+    header.reserved = 0;
+    if(!headers.empty())
+        std::memcpy(out + sizeof(MeshBlobHeader), headers.data(), headers.size()*sizeof(MeshBlobMeshHeader));
+
+    for(std::size_t i = 0; i != meshes.size(); ++i) {
+        const std::string& name = meshes[i].first;
+        const MeshData3D& mesh = meshes[i].second;
+        const MeshBlobMeshHeader& meshHeader = headers[i];
+
+        std::copy(name.begin(), name.end(), out + meshHeader.nameOffset);
+        if(mesh.isIndexed())
+            std::copy(mesh.indices().begin(), mesh.indices().end(), reinterpret_cast<UnsignedInt*>(out + meshHeader.indexOffset));
+
+        for(UnsignedInt j = 0; j != mesh.positionArrayCount(); ++j)
+            std::copy(mesh.positions(j).begin(), mesh.positions(j).end(), reinterpret_cast<Vector3*>(out + meshHeader.positionOffset) + j*meshHeader.vertexCount);
+        for(UnsignedInt j = 0; j != mesh.normalArrayCount(); ++j)
+            std::copy(mesh.normals(j).begin(), mesh.normals(j).end(), reinterpret_cast<Vector3*>(out + meshHeader.normalOffset) + j*meshHeader.vertexCount);
+        for(UnsignedInt j = 0; j != mesh.textureCoords2DArrayCount(); ++j)
+            std::copy(mesh.textureCoords2D(j).begin(), mesh.textureCoords2D(j).end(), reinterpret_cast<Vector2*>(out + meshHeader.textureCoords2DOffset) + j*meshHeader.vertexCount);
+    }
+
+    return out;
+}
+
+Containers::Array<char> convertToMeshBlob(AbstractImporter& importer) {
+    CORRADE_ASSERT(importer.isOpened(), "Trade::convertToMeshBlob(): no file opened", nullptr);
+
+    std::vector<std::pair<std::string, MeshData3D>> meshes;
+    meshes.reserve(importer.mesh3DCount());
+    for(UnsignedInt i = 0; i != importer.mesh3DCount(); ++i) {
+        std::optional<MeshData3D> mesh = importer.mesh3D(i);
+        if(!mesh) {
+            Error() << "Trade::convertToMeshBlob(): cannot import mesh" << i;
+            return nullptr;
+        }
+
+        meshes.emplace_back(importer.mesh3DName(i), std::move(*mesh));
+    }
+
+    return convertToMeshBlob(meshes);
+}
+
+bool convertToMeshBlobFile(AbstractImporter& importer, const std::string& filename) {
+    const Containers::Array<char> data = convertToMeshBlob(importer);
+    if(!data) return false;
+
+    if(!Utility::Directory::write(filename, data)) {
+        Error() << "Trade::convertToMeshBlobFile(): cannot write to file" << filename;
+        return false;
+    }
+
+    return true;
+}
+
+}}
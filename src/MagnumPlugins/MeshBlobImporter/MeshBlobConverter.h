@@ -0,0 +1,72 @@
+#ifndef Magnum_Trade_MeshBlobConverter_h
+#define Magnum_Trade_MeshBlobConverter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::Trade::convertToMeshBlob(), @ref Magnum::Trade::convertToMeshBlobFile()
+ */
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Trade/Trade.h"
+#include "MagnumPlugins/MeshBlobImporter/MeshBlobImporter.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Convert meshes to mesh blob
+@param meshes   List of mesh names and data
+
+Writes the meshes in format understood by @ref MeshBlobImporter. All attribute
+arrays of given mesh are expected to have the same size. Returns empty array
+if any mesh doesn't satisfy that.
+@see @ref convertToMeshBlobFile()
+*/
+MAGNUM_MESHBLOBIMPORTER_EXPORT Containers::Array<char> convertToMeshBlob(const std::vector<std::pair<std::string, MeshData3D>>& meshes);
+
+/**
+@brief Convert all meshes from an importer to mesh blob
+
+Imports all 3D meshes from @p importer, which is expected to have a file
+opened, and converts them with @ref convertToMeshBlob(const std::vector<std::pair<std::string, MeshData3D>>&).
+Returns empty array if any of the meshes cannot be imported or converted.
+*/
+MAGNUM_MESHBLOBIMPORTER_EXPORT Containers::Array<char> convertToMeshBlob(AbstractImporter& importer);
+
+/**
+@brief Convert all meshes from an importer to mesh blob file
+
+Same as @ref convertToMeshBlob(AbstractImporter&), but saves the result to
+given file. Returns `true` on success, `false` otherwise.
+*/
+MAGNUM_MESHBLOBIMPORTER_EXPORT bool convertToMeshBlobFile(AbstractImporter& importer, const std::string& filename);
+
+}}
+
+#endif
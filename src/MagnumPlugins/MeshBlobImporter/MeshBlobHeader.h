@@ -0,0 +1,84 @@
+#ifndef Magnum_Trade_MeshBlobHeader_h
+#define Magnum_Trade_MeshBlobHeader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Struct @ref Magnum::Trade::MeshBlobHeader, @ref Magnum::Trade::MeshBlobMeshHeader
+ */
+
+#include "Magnum/Types.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh blob file header
+
+The file starts with this header, followed by @ref meshCount instances of
+@ref MeshBlobMeshHeader. All other data are referenced from the mesh headers
+using absolute offsets. All values are little-endian.
+@see @ref MeshBlobImporter, @ref convertToMeshBlob()
+*/
+struct MeshBlobHeader {
+    char magic[4];              /**< @brief File signature, `MBLB` */
+    UnsignedShort version;      /**< @brief Format version, currently `1` */
+    UnsignedShort meshHeaderSize; /**< @brief Size of @ref MeshBlobMeshHeader */
+    UnsignedInt meshCount;      /**< @brief Mesh count */
+    UnsignedInt reserved;       /**< @brief Reserved, `0` */
+};
+
+/**
+@brief Mesh blob mesh header
+
+Index and attribute data are stored as tightly packed arrays starting at
+offsets aligned to @ref MeshBlobAlignment bytes. All arrays of one attribute
+are stored one after another and each contains @ref vertexCount items.
+Non-indexed meshes have zero @ref indexCount.
+*/
+struct MeshBlobMeshHeader {
+    UnsignedLong nameOffset;    /**< @brief Offset of mesh name */
+    UnsignedLong indexOffset;   /**< @brief Offset of @ref UnsignedInt indices */
+    UnsignedLong positionOffset; /**< @brief Offset of @ref Vector3 positions */
+    UnsignedLong normalOffset;  /**< @brief Offset of @ref Vector3 normals */
+    UnsignedLong textureCoords2DOffset; /**< @brief Offset of @ref Vector2 texture coordinates */
+    UnsignedInt nameSize;       /**< @brief Mesh name length, without null terminator */
+    UnsignedInt primitive;      /**< @brief @ref MeshPrimitive value */
+    UnsignedInt indexCount;     /**< @brief Index count */
+    UnsignedInt vertexCount;    /**< @brief Vertex count */
+    UnsignedInt positionArrayCount; /**< @brief Position array count */
+    UnsignedInt normalArrayCount; /**< @brief Normal array count */
+    UnsignedInt textureCoords2DArrayCount; /**< @brief 2D texture coordinate array count */
+    UnsignedInt reserved;       /**< @brief Reserved, `0` */
+};
+
+/** @brief Alignment of index and attribute data in mesh blob */
+enum: std::size_t { MeshBlobAlignment = 16 };
+
+static_assert(sizeof(MeshBlobHeader) == 16, "MeshBlobHeader size is not 16 bytes");
+static_assert(sizeof(MeshBlobMeshHeader) == 72, "MeshBlobMeshHeader size is not 72 bytes");
+
+}}
+
+#endif
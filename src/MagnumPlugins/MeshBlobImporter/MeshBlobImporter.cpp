@@ -0,0 +1,388 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MeshBlobImporter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Endianness.h>
+
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/MeshBlobImporter/MeshBlobHeader.h"
+
+#if defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#elif defined(CORRADE_TARGET_WINDOWS)
+#define WIN32_LEAN_AND_MEAN 1
+#define VC_EXTRALEAN
+#include <windows.h>
+#endif
+
+namespace Magnum { namespace Trade {
+
+struct MeshBlobImporter::File {
+    Containers::Array<char> data;
+    std::unordered_map<std::string, UnsignedInt> meshesForName;
+
+    const MeshBlobHeader& header() const {
+        return *reinterpret_cast<const MeshBlobHeader*>(data.data());
+    }
+
+    const MeshBlobMeshHeader& meshHeader(UnsignedInt id) const {
+        return reinterpret_cast<const MeshBlobMeshHeader*>(data.data() + sizeof(MeshBlobHeader))[id];
+    }
+};
+
+namespace {
+
+/* Checks that `count` items of `itemSize` bytes starting at `offset` fit into
+   `size` bytes, written so it can't overflow */
+bool isInRange(const UnsignedLong offset, const UnsignedLong count, const std::size_t itemSize, const std::size_t alignment, const std::size_t size) {
+    return offset % alignment == 0 && offset <= size && count <= (size - offset)/itemSize;
+}
+
+/* Returns false if a*b doesn't fit into std::size_t */
+bool multiply(const std::size_t a, const std::size_t b, std::size_t& out) {
+    if(b && a > ~std::size_t{}/b) return false;
+    out = a*b;
+    return true;
+}
+
+bool isValidPrimitive(const UnsignedInt primitive) {
+    switch(MeshPrimitive(primitive)) {
+        case MeshPrimitive::Points:
+        case MeshPrimitive::LineStrip:
+        case MeshPrimitive::LineLoop:
+        case MeshPrimitive::Lines:
+        #ifndef MAGNUM_TARGET_GLES
+        case MeshPrimitive::LineStripAdjacency:
+        case MeshPrimitive::LinesAdjacency:
+        #endif
+        case MeshPrimitive::TriangleStrip:
+        case MeshPrimitive::TriangleFan:
+        case MeshPrimitive::Triangles:
+        #ifndef MAGNUM_TARGET_GLES
+        case MeshPrimitive::TriangleStripAdjacency:
+        case MeshPrimitive::TrianglesAdjacency:
+        case MeshPrimitive::Patches:
+        #endif
+            return true;
+    }
+
+    return false;
+}
+
+#if defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)
+void unmapDeleter(char* const data, const std::size_t size) {
+    if(data) munmap(data, size);
+}
+
+bool mapFile(const std::string& filename, Containers::Array<char>& out) {
+    const int fd = open(filename.data(), O_RDONLY);
+    if(fd == -1) return false;
+
+    struct stat st;
+    if(fstat(fd, &st) == -1) {
+        close(fd);
+        return false;
+    }
+
+    /* Zero-size mapping is not allowed, the empty file gets reported as too
+       short later */
+    const std::size_t size = st.st_size;
+    if(!size) {
+        close(fd);
+        out = nullptr;
+        return true;
+    }
+
+    void* const data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    /* The mapping stays valid after closing the file descriptor */
+    close(fd);
+    if(data == MAP_FAILED) return false;
+
+    out = Containers::Array<char>{static_cast<char*>(data), size, unmapDeleter};
+    return true;
+}
+#elif defined(CORRADE_TARGET_WINDOWS)
+void unmapDeleter(char* const data, std::size_t) {
+    if(data) UnmapViewOfFile(data);
+}
+
+bool mapFile(const std::string& filename, Containers::Array<char>& out) {
+    HANDLE file = CreateFileA(filename.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if(!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    /* Zero-size mapping is not allowed, the empty file gets reported as too
+       short later */
+    if(!size.QuadPart) {
+        CloseHandle(file);
+        out = nullptr;
+        return true;
+    }
+
+    /* The view stays valid after closing both handles */
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if(!mapping) return false;
+    void* const data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if(!data) return false;
+
+    out = Containers::Array<char>{static_cast<char*>(data), std::size_t(size.QuadPart), unmapDeleter};
+    return true;
+}
+#endif
+
+}
+
+MeshBlobImporter::MeshBlobImporter() = default;
+
+MeshBlobImporter::MeshBlobImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter{manager, std::move(plugin)} {}
+
+MeshBlobImporter::~MeshBlobImporter() = default;
+
+auto MeshBlobImporter::doFeatures() const -> Features { return Feature::OpenData; }
+
+bool MeshBlobImporter::doIsOpened() const { return !!_file; }
+
+void MeshBlobImporter::doClose() { _file.reset(); }
+
+void MeshBlobImporter::doOpenData(const Containers::ArrayView<const char> data) {
+    /* The data are not guaranteed to outlive the importer, so copy them */
+    Containers::Array<char> copy{data.size()};
+    std::copy(data.begin(), data.end(), copy.begin());
+    openInternal(std::move(copy), "Trade::MeshBlobImporter::openData():");
+}
+
+void MeshBlobImporter::doOpenFile(const std::string& filename) {
+    #if (defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_EMSCRIPTEN) && !defined(CORRADE_TARGET_NACL)) || defined(CORRADE_TARGET_WINDOWS)
+    Containers::Array<char> data;
+    if(!mapFile(filename, data)) {
+        Error() << "Trade::MeshBlobImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    openInternal(std::move(data), "Trade::MeshBlobImporter::openFile():");
+    #else
+    AbstractImporter::doOpenFile(filename);
+    #endif
+}
+
+void MeshBlobImporter::openInternal(Containers::Array<char>&& data, const char* const prefix) {
+    if(Utility::Endianness::isBigEndian()) {
+        Error() << prefix << "big-endian platforms are not supported";
+        return;
+    }
+
+    if(data.size() < sizeof(MeshBlobHeader)) {
+        Error() << prefix << "the file is too short:" << data.size() << "bytes";
+        return;
+    }
+
+    std::unique_ptr<File> file{new File};
+    file->data = std::move(data);
+    const std::size_t size = file->data.size();
+
+    const MeshBlobHeader& header = file->header();
+    if(std::memcmp(header.magic, "MBLB", 4) != 0) {
+        Error() << prefix << "invalid file signature";
+        return;
+    }
+
+    if(header.version != 1) {
+        Error() << prefix << "unsupported file version" << header.version;
+        return;
+    }
+
+    if(header.meshHeaderSize != sizeof(MeshBlobMeshHeader)) {
+        Error() << prefix << "unexpected mesh header size" << header.meshHeaderSize;
+        return;
+    }
+
+    if(!isInRange(sizeof(MeshBlobHeader), header.meshCount, sizeof(MeshBlobMeshHeader), 1, size)) {
+        Error() << prefix << "the file is too short for" << header.meshCount << "meshes";
+        return;
+    }
+
+    /* Validate all ranges upfront so the accessors don't need to */
+    file->meshesForName.reserve(header.meshCount);
+    for(UnsignedInt i = 0; i != header.meshCount; ++i) {
+        const MeshBlobMeshHeader& mesh = file->meshHeader(i);
+
+        if(!mesh.positionArrayCount) {
+            Error() << prefix << "mesh" << i << "has no positions";
+            return;
+        }
+
+        if(!isValidPrimitive(mesh.primitive)) {
+            Error() << prefix << "invalid primitive" << mesh.primitive << "in mesh" << i;
+            return;
+        }
+
+        const char* invalid = nullptr;
+        if(!isInRange(mesh.nameOffset, mesh.nameSize, 1, 1, size))
+            invalid = "name";
+        else if(!isInRange(mesh.indexOffset, mesh.indexCount, sizeof(UnsignedInt), MeshBlobAlignment, size))
+            invalid = "index";
+        else if(!isInRange(mesh.positionOffset, UnsignedLong(mesh.positionArrayCount)*mesh.vertexCount, sizeof(Vector3), MeshBlobAlignment, size))
+            invalid = "position";
+        else if(!isInRange(mesh.normalOffset, UnsignedLong(mesh.normalArrayCount)*mesh.vertexCount, sizeof(Vector3), MeshBlobAlignment, size))
+            invalid = "normal";
+        else if(!isInRange(mesh.textureCoords2DOffset, UnsignedLong(mesh.textureCoords2DArrayCount)*mesh.vertexCount, sizeof(Vector2), MeshBlobAlignment, size))
+            invalid = "texture coordinate";
+        if(invalid) {
+            Error() << prefix << "invalid" << invalid << "data range in mesh" << i;
+            return;
+        }
+
+        if(mesh.nameSize)
+            file->meshesForName.emplace(std::string{file->data + mesh.nameOffset, mesh.nameSize}, i);
+    }
+
+    _file = std::move(file);
+}
+
+UnsignedInt MeshBlobImporter::doMesh3DCount() const { return _file->header().meshCount; }
+
+Int MeshBlobImporter::doMesh3DForName(const std::string& name) {
+    const auto it = _file->meshesForName.find(name);
+    return it == _file->meshesForName.end() ? -1 : it->second;
+}
+
+std::string MeshBlobImporter::doMesh3DName(const UnsignedInt id) {
+    const MeshBlobMeshHeader& mesh = _file->meshHeader(id);
+    return std::string{_file->data + mesh.nameOffset, mesh.nameSize};
+}
+
+auto MeshBlobImporter::meshView(const UnsignedInt id) const -> MeshView {
+    CORRADE_ASSERT(_file, "Trade::MeshBlobImporter::meshView(): no file opened", {});
+    CORRADE_ASSERT(id < _file->header().meshCount, "Trade::MeshBlobImporter::meshView(): index out of range", {});
+
+    const MeshBlobMeshHeader& mesh = _file->meshHeader(id);
+    const char* const data = _file->data;
+
+    MeshView view;
+    view.primitive = MeshPrimitive(mesh.primitive);
+    view.indices = {reinterpret_cast<const UnsignedInt*>(data + mesh.indexOffset), mesh.indexCount};
+
+    const auto positions = reinterpret_cast<const Vector3*>(data + mesh.positionOffset);
+    view.positions.reserve(mesh.positionArrayCount);
+    for(std::size_t i = 0; i != mesh.positionArrayCount; ++i)
+        view.positions.emplace_back(positions + i*mesh.vertexCount, mesh.vertexCount);
+
+    const auto normals = reinterpret_cast<const Vector3*>(data + mesh.normalOffset);
+    view.normals.reserve(mesh.normalArrayCount);
+    for(std::size_t i = 0; i != mesh.normalArrayCount; ++i)
+        view.normals.emplace_back(normals + i*mesh.vertexCount, mesh.vertexCount);
+
+    const auto textureCoords2D = reinterpret_cast<const Vector2*>(data + mesh.textureCoords2DOffset);
+    view.textureCoords2D.reserve(mesh.textureCoords2DArrayCount);
+    for(std::size_t i = 0; i != mesh.textureCoords2DArrayCount; ++i)
+        view.textureCoords2D.emplace_back(textureCoords2D + i*mesh.vertexCount, mesh.vertexCount);
+
+    return view;
+}
+
+std::optional<MeshData3D> MeshBlobImporter::doMesh3D(const UnsignedInt id) {
+    /* MeshData3D owns its data, so this is the only place where the data get
+       copied */
+    const MeshView view = meshView(id);
+
+    std::vector<std::vector<Vector3>> positions;
+    positions.reserve(view.positions.size());
+    for(const auto& a: view.positions)
+        positions.emplace_back(a.begin(), a.end());
+
+    std::vector<std::vector<Vector3>> normals;
+    normals.reserve(view.normals.size());
+    for(const auto& a: view.normals)
+        normals.emplace_back(a.begin(), a.end());
+
+    std::vector<std::vector<Vector2>> textureCoords2D;
+    textureCoords2D.reserve(view.textureCoords2D.size());
+    for(const auto& a: view.textureCoords2D)
+        textureCoords2D.emplace_back(a.begin(), a.end());
+
+    return MeshData3D{view.primitive, {view.indices.begin(), view.indices.end()}, std::move(positions), std::move(normals), std::move(textureCoords2D)};
+}
+
+std::optional<MeshData> MeshBlobImporter::doMesh(const UnsignedInt id) {
+    const MeshBlobMeshHeader& mesh = _file->meshHeader(id);
+
+    /* Attribute arrays of one mesh are stored next to each other, so they
+       are copied in one go, including the alignment padding between them */
+    std::vector<MeshAttributeData> attributes;
+    std::size_t begin = ~std::size_t{}, end = 0;
+    const std::size_t dataSize = _file->data.size();
+    const auto add = [&](const MeshAttribute name, const MeshAttributeFormat format, const UnsignedLong offset, const UnsignedInt count) {
+        const std::size_t size = meshAttributeFormatSize(format);
+        std::size_t arraySize, totalSize;
+        if(!multiply(mesh.vertexCount, size, arraySize) || !multiply(arraySize, count, totalSize) || offset > dataSize || totalSize > dataSize - offset)
+            return false;
+        for(std::size_t i = 0; i != count; ++i)
+            attributes.emplace_back(name, format, std::size_t(offset) + i*arraySize, size);
+        if(!count) return true;
+        begin = std::min(begin, std::size_t(offset));
+        end = std::max(end, std::size_t(offset) + totalSize);
+        return true;
+    };
+    if(!add(MeshAttribute::Position, MeshAttributeFormat::Vector3, mesh.positionOffset, mesh.positionArrayCount) ||
+       !add(MeshAttribute::Normal, MeshAttributeFormat::Vector3, mesh.normalOffset, mesh.normalArrayCount) ||
+       !add(MeshAttribute::TextureCoordinates, MeshAttributeFormat::Vector2, mesh.textureCoords2DOffset, mesh.textureCoords2DArrayCount)) {
+        Error() << "Trade::MeshBlobImporter::mesh(): invalid attribute data range in mesh" << id;
+        return std::nullopt;
+    }
+    if(attributes.empty()) begin = end = 0;
+
+    for(MeshAttributeData& attribute: attributes)
+        attribute = MeshAttributeData{attribute.name(), attribute.format(), attribute.offset() - begin, attribute.stride()};
+
+    Containers::Array<char> vertexData{end - begin};
+    std::memcpy(vertexData, _file->data + begin, end - begin);
+
+    if(!mesh.indexCount)
+        return MeshData{MeshPrimitive(mesh.primitive), std::move(vertexData), std::move(attributes), mesh.vertexCount};
+
+    Containers::Array<char> indexData{mesh.indexCount*sizeof(UnsignedInt)};
+    std::memcpy(indexData, _file->data + mesh.indexOffset, indexData.size());
+    return MeshData{MeshPrimitive(mesh.primitive), std::move(indexData), Mesh::IndexType::UnsignedInt, std::move(vertexData), std::move(attributes), mesh.vertexCount};
+}
+
+}}
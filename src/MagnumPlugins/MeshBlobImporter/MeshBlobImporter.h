@@ -0,0 +1,148 @@
+#ifndef Magnum_Trade_MeshBlobImporter_h
+#define Magnum_Trade_MeshBlobImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::MeshBlobImporter
+ */
+
+#include <vector>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Utility/VisibilityMacros.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+
+#include "MagnumPlugins/MeshBlobImporter/configure.h"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+#ifndef MAGNUM_MESHBLOBIMPORTER_BUILD_STATIC
+    #if defined(MeshBlobImporter_EXPORTS) || defined(MeshBlobImporterObjects_EXPORTS)
+        #define MAGNUM_MESHBLOBIMPORTER_EXPORT CORRADE_VISIBILITY_EXPORT
+    #else
+        #define MAGNUM_MESHBLOBIMPORTER_EXPORT CORRADE_VISIBILITY_IMPORT
+    #endif
+#else
+    #define MAGNUM_MESHBLOBIMPORTER_EXPORT CORRADE_VISIBILITY_STATIC
+#endif
+#define MAGNUM_MESHBLOBIMPORTER_LOCAL CORRADE_VISIBILITY_LOCAL
+#endif
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Mesh blob importer plugin
+
+Imports compact binary mesh cache files produced by @ref convertToMeshBlob()
+or the @ref magnum-meshblobconverter "magnum-meshblobconverter" utility. The
+file consists of @ref MeshBlobHeader, a table of @ref MeshBlobMeshHeader
+entries and aligned index and attribute arrays, so the data can be used
+directly without any parsing.
+
+Files opened using @ref openFile() are memory-mapped on Unix and Windows
+instead of being read into memory. Besides the usual @ref mesh3D() interface,
+which copies the data into @ref MeshData3D, the importer provides
+@ref meshView() that exposes index and attribute arrays as views directly on
+the mapped memory. The @ref mesh() interface copies all attribute arrays of a
+mesh into a @ref MeshData vertex buffer at once, without splitting them.
+
+The file is validated on opening, so all offsets and sizes are known to be in
+bounds afterwards. The format is little-endian, opening it on big-endian
+platforms is not supported.
+
+This plugin is built if `WITH_MESHBLOBIMPORTER` is enabled when building
+Magnum. To use dynamic plugin, you need to load `MeshBlobImporter` plugin from
+`MAGNUM_PLUGINS_IMPORTER_DIR`. To use static plugin or use this as a
+dependency of another plugin, you need to request `MeshBlobImporter` component
+of `Magnum` package in CMake and link to `Magnum::MeshBlobImporter` target.
+See @ref building, @ref cmake and @ref plugins for more information.
+*/
+class MAGNUM_MESHBLOBIMPORTER_EXPORT MeshBlobImporter: public AbstractImporter {
+    public:
+        /**
+         * @brief Mesh view
+         *
+         * Views point directly into the opened file and are valid until the
+         * file is closed.
+         * @see @ref meshView()
+         */
+        struct MeshView {
+            /** @brief Primitive */
+            MeshPrimitive primitive;
+
+            /** @brief Indices, empty if the mesh is not indexed */
+            Containers::ArrayView<const UnsignedInt> indices;
+
+            /** @brief Position arrays */
+            std::vector<Containers::ArrayView<const Vector3>> positions;
+
+            /** @brief Normal arrays */
+            std::vector<Containers::ArrayView<const Vector3>> normals;
+
+            /** @brief 2D texture coordinate arrays */
+            std::vector<Containers::ArrayView<const Vector2>> textureCoords2D;
+        };
+
+        /** @brief Default constructor */
+        explicit MeshBlobImporter();
+
+        /** @brief Plugin manager constructor */
+        explicit MeshBlobImporter(PluginManager::AbstractManager& manager, std::string plugin);
+
+        ~MeshBlobImporter();
+
+        /**
+         * @brief Zero-copy view on mesh data
+         * @param id    Mesh ID, from range [0, @ref mesh3DCount()).
+         *
+         * Unlike @ref mesh3D() doesn't copy any data. Expects that a file is
+         * opened.
+         */
+        MeshView meshView(UnsignedInt id) const;
+
+    private:
+        struct File;
+
+        Features MAGNUM_MESHBLOBIMPORTER_LOCAL doFeatures() const override;
+        bool MAGNUM_MESHBLOBIMPORTER_LOCAL doIsOpened() const override;
+        void MAGNUM_MESHBLOBIMPORTER_LOCAL doOpenData(Containers::ArrayView<const char> data) override;
+        void MAGNUM_MESHBLOBIMPORTER_LOCAL doOpenFile(const std::string& filename) override;
+        void MAGNUM_MESHBLOBIMPORTER_LOCAL doClose() override;
+
+        UnsignedInt MAGNUM_MESHBLOBIMPORTER_LOCAL doMesh3DCount() const override;
+        Int MAGNUM_MESHBLOBIMPORTER_LOCAL doMesh3DForName(const std::string& name) override;
+        std::string MAGNUM_MESHBLOBIMPORTER_LOCAL doMesh3DName(UnsignedInt id) override;
+        std::optional<MeshData3D> MAGNUM_MESHBLOBIMPORTER_LOCAL doMesh3D(UnsignedInt id) override;
+        std::optional<MeshData> MAGNUM_MESHBLOBIMPORTER_LOCAL doMesh(UnsignedInt id) override;
+
+        void MAGNUM_MESHBLOBIMPORTER_LOCAL openInternal(Containers::Array<char>&& data, const char* prefix);
+
+        std::unique_ptr<File> _file;
+};
+
+}}
+
+#endif
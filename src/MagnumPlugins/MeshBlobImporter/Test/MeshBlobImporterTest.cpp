@@ -0,0 +1,433 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/MeshBlobImporter/MeshBlobConverter.h"
+#include "MagnumPlugins/MeshBlobImporter/MeshBlobHeader.h"
+#include "MagnumPlugins/MeshBlobImporter/MeshBlobImporter.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+class MeshBlobImporterTest: public TestSuite::Tester {
+    public:
+        explicit MeshBlobImporterTest();
+
+        void openNonexistent();
+        void openShort();
+        void invalidSignature();
+        void unsupportedVersion();
+        void tooManyMeshes();
+        void invalidRange();
+        void noPositions();
+        void invalidPrimitive();
+
+        void convertDifferentSizes();
+        void convertImporterFailed();
+
+        void openData();
+        void openFile();
+        void meshView();
+        void mesh();
+        void emptyMeshName();
+
+        void useTwice();
+};
+
+MeshBlobImporterTest::MeshBlobImporterTest() {
+    addTests({&MeshBlobImporterTest::openNonexistent,
+              &MeshBlobImporterTest::openShort,
+              &MeshBlobImporterTest::invalidSignature,
+              &MeshBlobImporterTest::unsupportedVersion,
+              &MeshBlobImporterTest::tooManyMeshes,
+              &MeshBlobImporterTest::invalidRange,
+              &MeshBlobImporterTest::noPositions,
+              &MeshBlobImporterTest::invalidPrimitive,
+
+              &MeshBlobImporterTest::convertDifferentSizes,
+              &MeshBlobImporterTest::convertImporterFailed,
+
+              &MeshBlobImporterTest::openData,
+              &MeshBlobImporterTest::openFile,
+              &MeshBlobImporterTest::meshView,
+              &MeshBlobImporterTest::mesh,
+              &MeshBlobImporterTest::emptyMeshName,
+
+              &MeshBlobImporterTest::useTwice});
+}
+
+namespace {
+
+std::vector<std::pair<std::string, MeshData3D>> testMeshes() {
+    std::vector<std::pair<std::string, MeshData3D>> meshes;
+    meshes.emplace_back("Triangles", MeshData3D{MeshPrimitive::Triangles,
+        {0, 1, 2, 2, 1, 3},
+        {{{0.0f, 1.0f, 2.0f}, {3.0f, 4.0f, 5.0f}, {6.0f, 7.0f, 8.0f}, {9.0f, 10.0f, 11.0f}},
+         {{-0.0f, -1.0f, -2.0f}, {-3.0f, -4.0f, -5.0f}, {-6.0f, -7.0f, -8.0f}, {-9.0f, -10.0f, -11.0f}}},
+        {{{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}}},
+        {{{0.0f, 0.5f}, {1.0f, 0.5f}, {0.5f, 1.0f}, {0.5f, 0.0f}}}});
+    meshes.emplace_back("Points", MeshData3D{MeshPrimitive::Points,
+        {}, {{{1.5f, 2.5f, 3.5f}}}, {}, {}});
+    return meshes;
+}
+
+/* Importer that just hands over given meshes */
+class MemoryImporter: public AbstractImporter {
+    public:
+        explicit MemoryImporter(std::vector<std::pair<std::string, MeshData3D>> meshes): _meshes{std::move(meshes)} {}
+
+    private:
+        Features doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMesh3DCount() const override { return _meshes.size(); }
+        std::string doMesh3DName(UnsignedInt id) override { return _meshes[id].first; }
+        std::optional<MeshData3D> doMesh3D(UnsignedInt id) override {
+            /* Empty position array marks a mesh that fails to import */
+            if(_meshes[id].second.positions(0).empty()) return std::nullopt;
+
+            const MeshData3D& mesh = _meshes[id].second;
+            std::vector<std::vector<Vector3>> positions, normals;
+            std::vector<std::vector<Vector2>> textureCoords2D;
+            for(UnsignedInt i = 0; i != mesh.positionArrayCount(); ++i)
+                positions.push_back(mesh.positions(i));
+            for(UnsignedInt i = 0; i != mesh.normalArrayCount(); ++i)
+                normals.push_back(mesh.normals(i));
+            for(UnsignedInt i = 0; i != mesh.textureCoords2DArrayCount(); ++i)
+                textureCoords2D.push_back(mesh.textureCoords2D(i));
+            return MeshData3D{mesh.primitive(), mesh.isIndexed() ? mesh.indices() : std::vector<UnsignedInt>{}, std::move(positions), std::move(normals), std::move(textureCoords2D)};
+        }
+
+        std::vector<std::pair<std::string, MeshData3D>> _meshes;
+};
+
+}
+
+void MeshBlobImporterTest::openNonexistent() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshBlobImporter importer;
+    CORRADE_VERIFY(!importer.openFile("nonexistent.blob"));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlobImporter::openFile(): cannot open file nonexistent.blob\n");
+}
+
+void MeshBlobImporterTest::openShort() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshBlobImporter importer;
+    const char data[] = { 'M', 'B', 'L', 'B', 1, 0, 72, 0, 0, 0 };
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlobImporter::openData(): the file is too short: 10 bytes\n");
+}
+
+void MeshBlobImporterTest::invalidSignature() {
+    Containers::Array<char> data = convertToMeshBlob(testMeshes());
+    data[3] = 'A';
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshBlobImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlobImporter::openData(): invalid file signature\n");
+}
+
+void MeshBlobImporterTest::unsupportedVersion() {
+    Containers::Array<char> data = convertToMeshBlob(testMeshes());
+    reinterpret_cast<MeshBlobHeader*>(data.data())->version = 2;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshBlobImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlobImporter::openData(): unsupported file version 2\n");
+}
+
+void MeshBlobImporterTest::tooManyMeshes() {
+    Containers::Array<char> data = convertToMeshBlob(testMeshes());
+    reinterpret_cast<MeshBlobHeader*>(data.data())->meshCount = 0xffffffffu;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshBlobImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlobImporter::openData(): the file is too short for 4294967295 meshes\n");
+}
+
+void MeshBlobImporterTest::invalidRange() {
+    Containers::Array<char> data = convertToMeshBlob(testMeshes());
+    MeshBlobMeshHeader* const meshes = reinterpret_cast<MeshBlobMeshHeader*>(data.data() + sizeof(MeshBlobHeader));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshBlobImporter importer;
+
+    /* Out of bounds */
+    const UnsignedLong positionOffset = meshes[1].positionOffset;
+    meshes[1].positionOffset = data.size();
+    CORRADE_VERIFY(!importer.openData(data));
+
+    /* Misaligned */
+    meshes[1].positionOffset = positionOffset + 4;
+    CORRADE_VERIFY(!importer.openData(data));
+
+    /* Overflowing size */
+    meshes[1].positionOffset = positionOffset;
+    meshes[0].vertexCount = 0xffffffffu;
+    CORRADE_VERIFY(!importer.openData(data));
+
+    CORRADE_COMPARE(out.str(),
+        "Trade::MeshBlobImporter::openData(): invalid position data range in mesh 1\n"
+        "Trade::MeshBlobImporter::openData(): invalid position data range in mesh 1\n"
+        "Trade::MeshBlobImporter::openData(): invalid position data range in mesh 0\n");
+}
+
+void MeshBlobImporterTest::noPositions() {
+    Containers::Array<char> data = convertToMeshBlob(testMeshes());
+    reinterpret_cast<MeshBlobMeshHeader*>(data.data() + sizeof(MeshBlobHeader))[1].positionArrayCount = 0;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshBlobImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlobImporter::openData(): mesh 1 has no positions\n");
+}
+
+void MeshBlobImporterTest::invalidPrimitive() {
+    Containers::Array<char> data = convertToMeshBlob(testMeshes());
+    reinterpret_cast<MeshBlobMeshHeader*>(data.data() + sizeof(MeshBlobHeader))[1].primitive = 0xdead;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    MeshBlobImporter importer;
+    CORRADE_VERIFY(!importer.openData(data));
+    CORRADE_COMPARE(out.str(), "Trade::MeshBlobImporter::openData(): invalid primitive 57005 in mesh 1\n");
+}
+
+void MeshBlobImporterTest::convertDifferentSizes() {
+    std::vector<std::pair<std::string, MeshData3D>> meshes = testMeshes();
+    meshes[0].second.textureCoords2D(0).pop_back();
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    CORRADE_VERIFY(!convertToMeshBlob(meshes));
+    CORRADE_COMPARE(out.str(), "Trade::convertToMeshBlob(): attribute arrays of mesh 0 have different sizes\n");
+}
+
+void MeshBlobImporterTest::convertImporterFailed() {
+    std::vector<std::pair<std::string, MeshData3D>> meshes = testMeshes();
+    meshes[1].second.positions(0).clear();
+    MemoryImporter importer{std::move(meshes)};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    CORRADE_VERIFY(!convertToMeshBlob(importer));
+    CORRADE_COMPARE(out.str(), "Trade::convertToMeshBlob(): cannot import mesh 1\n");
+}
+
+void MeshBlobImporterTest::openData() {
+    const Containers::Array<char> data = convertToMeshBlob(testMeshes());
+    CORRADE_VERIFY(data);
+
+    MeshBlobImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+    CORRADE_COMPARE(importer.mesh3DCount(), 2);
+    CORRADE_COMPARE(importer.mesh3DName(0), "Triangles");
+    CORRADE_COMPARE(importer.mesh3DName(1), "Points");
+    CORRADE_COMPARE(importer.mesh3DForName("Points"), 1);
+    CORRADE_COMPARE(importer.mesh3DForName("Lines"), -1);
+
+    const std::vector<std::pair<std::string, MeshData3D>> expected = testMeshes();
+    for(UnsignedInt i = 0; i != 2; ++i) {
+        std::optional<MeshData3D> mesh = importer.mesh3D(i);
+        const MeshData3D& expectedMesh = expected[i].second;
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->primitive(), expectedMesh.primitive());
+        CORRADE_COMPARE(mesh->isIndexed(), expectedMesh.isIndexed());
+        if(mesh->isIndexed()) CORRADE_COMPARE_AS(mesh->indices(), expectedMesh.indices(),
+            TestSuite::Compare::Container);
+        CORRADE_COMPARE(mesh->positionArrayCount(), expectedMesh.positionArrayCount());
+        for(UnsignedInt j = 0; j != mesh->positionArrayCount(); ++j)
+            CORRADE_COMPARE_AS(mesh->positions(j), expectedMesh.positions(j),
+                TestSuite::Compare::Container);
+        CORRADE_COMPARE(mesh->normalArrayCount(), expectedMesh.normalArrayCount());
+        for(UnsignedInt j = 0; j != mesh->normalArrayCount(); ++j)
+            CORRADE_COMPARE_AS(mesh->normals(j), expectedMesh.normals(j),
+                TestSuite::Compare::Container);
+        CORRADE_COMPARE(mesh->textureCoords2DArrayCount(), expectedMesh.textureCoords2DArrayCount());
+        for(UnsignedInt j = 0; j != mesh->textureCoords2DArrayCount(); ++j)
+            CORRADE_COMPARE_AS(mesh->textureCoords2D(j), expectedMesh.textureCoords2D(j),
+                TestSuite::Compare::Container);
+    }
+}
+
+void MeshBlobImporterTest::openFile() {
+    const std::string filename = Utility::Directory::join(MESHBLOBIMPORTER_TEST_WRITE_DIR, "file.blob");
+    MemoryImporter source{testMeshes()};
+    CORRADE_VERIFY(convertToMeshBlobFile(source, filename));
+
+    MeshBlobImporter importer;
+    CORRADE_VERIFY(importer.openFile(filename));
+    CORRADE_COMPARE(importer.mesh3DCount(), 2);
+    CORRADE_COMPARE(importer.mesh3DName(1), "Points");
+
+    std::optional<MeshData3D> mesh = importer.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE_AS(mesh->indices(), (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->positionArrayCount(), 2);
+    CORRADE_COMPARE_AS(mesh->positions(1), (std::vector<Vector3>{
+        {-0.0f, -1.0f, -2.0f}, {-3.0f, -4.0f, -5.0f}, {-6.0f, -7.0f, -8.0f}, {-9.0f, -10.0f, -11.0f}}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->textureCoords2D(0), (std::vector<Vector2>{
+        {0.0f, 0.5f}, {1.0f, 0.5f}, {0.5f, 1.0f}, {0.5f, 0.0f}}),
+        TestSuite::Compare::Container);
+}
+
+void MeshBlobImporterTest::meshView() {
+    const std::string filename = Utility::Directory::join(MESHBLOBIMPORTER_TEST_WRITE_DIR, "view.blob");
+    MemoryImporter source{testMeshes()};
+    CORRADE_VERIFY(convertToMeshBlobFile(source, filename));
+
+    MeshBlobImporter importer;
+    CORRADE_VERIFY(importer.openFile(filename));
+
+    const MeshBlobImporter::MeshView view = importer.meshView(0);
+    CORRADE_COMPARE(view.primitive, MeshPrimitive::Triangles);
+    CORRADE_COMPARE(view.indices.size(), 6);
+    CORRADE_COMPARE(view.indices[3], 2);
+    CORRADE_COMPARE(view.positions.size(), 2);
+    CORRADE_COMPARE(view.positions[1].size(), 4);
+    CORRADE_COMPARE(view.positions[1][2], (Vector3{-6.0f, -7.0f, -8.0f}));
+    CORRADE_COMPARE(view.normals.size(), 1);
+    CORRADE_COMPARE(view.normals[0][1], (Vector3{0.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(view.textureCoords2D.size(), 1);
+    CORRADE_COMPARE(view.textureCoords2D[0][3], (Vector2{0.5f, 0.0f}));
+
+    /* Arrays of the same attribute are adjacent, all data are aligned in the
+       mapped file */
+    CORRADE_VERIFY(view.positions[1].data() == view.positions[0].data() + 4);
+    CORRADE_COMPARE(reinterpret_cast<std::size_t>(view.indices.data()) % MeshBlobAlignment, 0);
+    CORRADE_COMPARE(reinterpret_cast<std::size_t>(view.positions[0].data()) % MeshBlobAlignment, 0);
+    CORRADE_COMPARE(reinterpret_cast<std::size_t>(view.normals[0].data()) % MeshBlobAlignment, 0);
+    CORRADE_COMPARE(reinterpret_cast<std::size_t>(view.textureCoords2D[0].data()) % MeshBlobAlignment, 0);
+
+    /* No copies are made, the view points to the same memory every time */
+    CORRADE_VERIFY(importer.meshView(0).positions[0].data() == view.positions[0].data());
+
+    const MeshBlobImporter::MeshView points = importer.meshView(1);
+    CORRADE_COMPARE(points.primitive, MeshPrimitive::Points);
+    CORRADE_VERIFY(points.indices.empty());
+    CORRADE_COMPARE(points.positions.size(), 1);
+    CORRADE_COMPARE(points.positions[0].size(), 1);
+    CORRADE_COMPARE(points.positions[0][0], (Vector3{1.5f, 2.5f, 3.5f}));
+    CORRADE_VERIFY(points.normals.empty());
+    CORRADE_VERIFY(points.textureCoords2D.empty());
+}
+
+void MeshBlobImporterTest::mesh() {
+    const Containers::Array<char> data = convertToMeshBlob(testMeshes());
+
+    MeshBlobImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+
+    std::optional<MeshData> mesh = importer.mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh->indexType(), Mesh::IndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(mesh->indicesAsArray(), (std::vector<UnsignedInt>{0, 1, 2, 2, 1, 3}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->vertexCount(), 4);
+    CORRADE_COMPARE(mesh->attributeCount(), 4);
+    CORRADE_COMPARE(mesh->attributeCount(MeshAttribute::Position), 2);
+    CORRADE_COMPARE(mesh->attribute<Vector3>(MeshAttribute::Position, 1)[2], (Vector3{-6.0f, -7.0f, -8.0f}));
+    CORRADE_COMPARE(mesh->attribute<Vector3>(MeshAttribute::Normal)[1], (Vector3{0.0f, 1.0f, 0.0f}));
+    CORRADE_COMPARE(mesh->attribute<Vector2>(MeshAttribute::TextureCoordinates)[3], (Vector2{0.5f, 0.0f}));
+
+    /* The whole vertex data are copied at once, so the layout matches the
+       file */
+    const MeshBlobImporter::MeshView view = importer.meshView(0);
+    CORRADE_COMPARE(mesh->attributeData(3).offset(),
+        std::size_t(reinterpret_cast<const char*>(view.textureCoords2D[0].data()) - reinterpret_cast<const char*>(view.positions[0].data())));
+
+    std::optional<MeshData> points = importer.mesh(1);
+    CORRADE_VERIFY(points);
+    CORRADE_VERIFY(!points->isIndexed());
+    CORRADE_COMPARE(points->vertexCount(), 1);
+    CORRADE_COMPARE(points->attributeCount(), 1);
+    CORRADE_COMPARE(points->attribute<Vector3>(MeshAttribute::Position)[0], (Vector3{1.5f, 2.5f, 3.5f}));
+}
+
+void MeshBlobImporterTest::emptyMeshName() {
+    std::vector<std::pair<std::string, MeshData3D>> meshes = testMeshes();
+    meshes[0].first = {};
+
+    MeshBlobImporter importer;
+    CORRADE_VERIFY(importer.openData(convertToMeshBlob(meshes)));
+    CORRADE_COMPARE(importer.mesh3DName(0), "");
+    CORRADE_COMPARE(importer.mesh3DForName(""), -1);
+    CORRADE_COMPARE(importer.mesh3DForName("Points"), 1);
+}
+
+void MeshBlobImporterTest::useTwice() {
+    const Containers::Array<char> data = convertToMeshBlob(testMeshes());
+
+    MeshBlobImporter importer;
+    CORRADE_VERIFY(importer.openData(data));
+
+    /* Shouldn't crash, leak or anything */
+    {
+        std::optional<MeshData3D> mesh = importer.mesh3D(1);
+        CORRADE_VERIFY(mesh);
+    } {
+        std::optional<MeshData3D> mesh = importer.mesh3D(1);
+        CORRADE_VERIFY(mesh);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MeshBlobImporterTest)
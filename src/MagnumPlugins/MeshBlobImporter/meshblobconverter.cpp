@@ -0,0 +1,100 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Utility/Arguments.h>
+#include <Corrade/Utility/Directory.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "MagnumPlugins/MeshBlobImporter/MeshBlobConverter.h"
+
+#include "meshblobconverterConfigure.h"
+
+namespace Magnum {
+
+/**
+@page magnum-meshblobconverter Mesh blob conversion utility
+@brief Converts meshes from any importer to memory-mappable binary blob
+
+@section magnum-meshblobconverter-usage Usage
+
+    magnum-meshblobconverter [-h|--help] --importer IMPORTER [--plugin-dir DIR] [--] input output
+
+Arguments:
+
+-   `input` -- input file
+-   `output` -- output file
+-   `-h`, `--help` -- display help message and exit
+-   `--importer IMPORTER` -- importer plugin
+-   `--plugin-dir DIR` -- base plugin dir (defaults to plugin directory in
+    Magnum install location)
+
+All 3D meshes from the input file are imported and saved into a single file,
+which can be then loaded with the @ref Trade::MeshBlobImporter "MeshBlobImporter"
+plugin without any parsing.
+
+@section magnum-meshblobconverter-example Example usage
+
+Converting an OBJ file using @ref Trade::ObjImporter "ObjImporter" plugin:
+
+    magnum-meshblobconverter --importer ObjImporter scene.obj scene.blob
+*/
+
+}
+
+using namespace Magnum;
+
+int main(int argc, char** argv) {
+    Utility::Arguments args;
+    args.addArgument("input").setHelp("input", "input file")
+        .addArgument("output").setHelp("output", "output file")
+        .addNamedArgument("importer").setHelp("importer", "importer plugin")
+        .addOption("plugin-dir", MAGNUM_PLUGINS_DIR).setHelp("plugin-dir", "base plugin dir", "DIR")
+        .setHelp("Converts meshes from any importer to memory-mappable binary blob.")
+        .parse(argc, argv);
+
+    /* Load importer */
+    PluginManager::Manager<Trade::AbstractImporter> manager{Utility::Directory::join(args.value("plugin-dir"), "importers/")};
+    if(!(manager.load(args.value("importer")) & PluginManager::LoadState::Loaded))
+        return 1;
+    std::unique_ptr<Trade::AbstractImporter> importer = manager.instance(args.value("importer"));
+
+    /* Open input file */
+    if(!importer->openFile(args.value("input"))) {
+        Error() << "Cannot open file" << args.value("input");
+        return 2;
+    }
+
+    Debug() << "Converting" << importer->mesh3DCount() << "meshes...";
+
+    if(!Trade::convertToMeshBlobFile(*importer, args.value("output"))) {
+        Error() << "Cannot convert to" << args.value("output");
+        return 3;
+    }
+
+    Debug() << "Done.";
+
+    return 0;
+}
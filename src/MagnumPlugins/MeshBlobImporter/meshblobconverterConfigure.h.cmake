@@ -1,5 +1,3 @@
-#ifndef Magnum_MeshTools_Test_SubdivideRemoveDuplicatesBenchmark_h
-#define Magnum_MeshTools_Test_SubdivideRemoveDuplicatesBenchmark_h
 /*
     This file is part of Magnum.
 
@@ -25,26 +23,8 @@
     DEALINGS IN THE SOFTWARE.
 */
 
-#include <QtCore/QObject>
-
-#include "Magnum/Magnum.h"
-
-namespace Magnum { namespace MeshTools { namespace Test {
-
-class SubdivideRemoveDuplicatesBenchmark: public QObject {
-    Q_OBJECT
-
-    private slots:
-        void subdivide();
-        void subdivideAndRemoveDuplicatesMeshAfter();
-        void subdivideAndRemoveDuplicatesMeshBetween();
-
-    private:
-        static Magnum::Vector4 interpolator(const Magnum::Vector4& a, const Magnum::Vector4& b) {
-            return (a+b).xyz().normalized();
-        }
-};
-
-}}}
-
+#ifdef CORRADE_IS_DEBUG_BUILD
+#define MAGNUM_PLUGINS_DIR "${MAGNUM_PLUGINS_DEBUG_INSTALL_DIR}"
+#else
+#define MAGNUM_PLUGINS_DIR "${MAGNUM_PLUGINS_INSTALL_DIR}"
 #endif
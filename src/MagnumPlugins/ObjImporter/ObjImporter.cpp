@@ -25,76 +25,211 @@
 
 #include "ObjImporter.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
-#include <limits>
-#include <sstream>
 #include <unordered_map>
-#include <Corrade/Containers/ArrayView.h>
-#include <Corrade/Utility/String.h>
+#include <Corrade/Containers/Array.h>
 
 #include "Magnum/Mesh.h"
+#include "Magnum/Implementation/parallel.h"
 #include "Magnum/MeshTools/CombineIndexedArrays.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/Math/Vector3.h"
 #include "Magnum/Trade/MeshData3D.h"
 
-#if defined(CORRADE_TARGET_NACL_NEWLIB) || defined(CORRADE_TARGET_ANDROID)
-#include <sstream>
-#endif
-
 namespace Magnum { namespace Trade {
 
+namespace {
+
+struct Mesh {
+    /* Byte range of the mesh in the file */
+    std::size_t begin, end;
+
+    /* Index of first position, texture coordinate and normal in the file */
+    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
+
+    /* Counts used to reserve memory before parsing the mesh */
+    UnsignedInt positionCount, textureCoordinateCount, normalCount, indexCount;
+};
+
+}
+
 struct ObjImporter::File {
     std::unordered_map<std::string, UnsignedInt> meshesForName;
     std::vector<std::string> meshNames;
-    std::vector<std::tuple<std::streampos, std::streampos, UnsignedInt, UnsignedInt, UnsignedInt>> meshes;
-    std::unique_ptr<std::istream> in;
+    std::vector<Mesh> meshes;
+    Containers::Array<char> data;
 };
 
 namespace {
 
-void ignoreLine(std::istream& in) {
-    in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+inline bool isSpace(const char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+inline const char* skipSpace(const char* i, const char* const end) {
+    while(i != end && isSpace(*i)) ++i;
+    return i;
 }
 
-template<std::size_t size> Math::Vector<size, Float> extractFloatData(std::string str, Float* extra = nullptr) {
-    std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(str, ' ');
-    if(data.size() < size || data.size() > size + (extra ? 1 : 0)) {
-        Error() << "Trade::ObjImporter::mesh3D(): invalid float array size";
+inline const char* skipToken(const char* i, const char* const end) {
+    while(i != end && !isSpace(*i)) ++i;
+    return i;
+}
+
+inline const char* rtrim(const char* const begin, const char* end) {
+    while(end != begin && isSpace(*(end - 1))) --end;
+    return end;
+}
+
+/* Position of the newline character ending the line or @p end */
+inline const char* findLineEnd(const char* const i, const char* const end) {
+    const char* const found = static_cast<const char*>(std::memchr(i, '\n', end - i));
+    return found ? found : end;
+}
+
+template<std::size_t size> inline bool isKeyword(const char* const begin, const char* const end, const char(&keyword)[size]) {
+    return std::size_t(end - begin) == size - 1 && std::memcmp(begin, keyword, size - 1) == 0;
+}
+
+/* Decimal numbers with at most 19 significant digits and a small exponent
+   are converted directly, as both the mantissa and the power of ten are
+   exactly representable in a double and the result is thus correctly rounded.
+   Anything else (long mantissas, huge exponents, hexadecimal floats, `inf`,
+   `nan`) goes through std::strtod(). Returns false if the token is not a
+   number in its entirety. */
+bool parseFloat(const char* const begin, const char* const end, Float& out) {
+    static const Double powersOf10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    const char* i = begin;
+    bool negative = false;
+    if(i != end && (*i == '-' || *i == '+')) negative = *i++ == '-';
+
+    UnsignedLong mantissa = 0;
+    Int exponent = 0;
+    Int significantDigits = 0;
+    bool hasDigits = false;
+    bool exact = true;
+
+    for(; i != end && *i >= '0' && *i <= '9'; ++i) {
+        hasDigits = true;
+        if(significantDigits == 19) {
+            exact = false;
+            continue;
+        }
+        mantissa = mantissa*10 + (*i - '0');
+        if(mantissa) ++significantDigits;
+    }
+
+    if(i != end && *i == '.') for(++i; i != end && *i >= '0' && *i <= '9'; ++i) {
+        hasDigits = true;
+        if(significantDigits == 19) {
+            exact = false;
+            continue;
+        }
+        mantissa = mantissa*10 + (*i - '0');
+        if(mantissa) ++significantDigits;
+        --exponent;
+    }
+
+    if(hasDigits && i != end && (*i == 'e' || *i == 'E')) {
+        ++i;
+        bool negativeExponent = false;
+        if(i != end && (*i == '-' || *i == '+')) negativeExponent = *i++ == '-';
+        if(i == end || *i < '0' || *i > '9') return false;
+
+        Int value = 0;
+        for(; i != end && *i >= '0' && *i <= '9'; ++i)
+            if(value < 10000) value = value*10 + (*i - '0');
+        exponent += negativeExponent ? -value : value;
+    }
+
+    /* Fast path */
+    if(hasDigits && i == end && exact && mantissa <= (1ull << 53) && exponent >= -22 && exponent <= 22) {
+        Double value = Double(mantissa);
+        value = exponent < 0 ? value/powersOf10[-exponent] : value*powersOf10[exponent];
+        out = Float(negative ? -value : value);
+        return true;
+    }
+
+    /* Slow path, std::strtod() needs a null-terminated string */
+    const std::string token{begin, end};
+    char* parsedEnd;
+    const Double value = std::strtod(token.data(), &parsedEnd);
+    if(token.empty() || parsedEnd != token.data() + token.size()) return false;
+    out = Float(value);
+    return true;
+}
+
+bool parseIndex(const char* const begin, const char* const end, UnsignedInt& out) {
+    if(begin == end) return false;
+
+    UnsignedLong value = 0;
+    for(const char* i = begin; i != end; ++i) {
+        if(*i < '0' || *i > '9') return false;
+        value = value*10 + (*i - '0');
+        if(value > 0xffffffffull) return false;
+    }
+
+    out = UnsignedInt(value);
+    return true;
+}
+
+template<std::size_t size> Math::Vector<size, Float> extractFloatData(const char* const begin, const char* const end, const bool printErrors, Float* extra = nullptr) {
+    /* Find the tokens first so the array size is checked before any
+       conversion errors */
+    const char* tokens[2*(size + 2)];
+    std::size_t count = 0;
+    for(const char* i = skipSpace(begin, end); i != end; i = skipSpace(i, end)) {
+        const char* const tokenEnd = skipToken(i, end);
+        if(count != size + 2) {
+            tokens[2*count] = i;
+            tokens[2*count + 1] = tokenEnd;
+            ++count;
+        }
+        i = tokenEnd;
+    }
+
+    if(count < size || count > size + (extra ? 1 : 0)) {
+        if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): invalid float array size";
         throw 0;
     }
 
     Math::Vector<size, Float> output;
-
-    #if defined(CORRADE_TARGET_NACL_NEWLIB) || defined(CORRADE_TARGET_ANDROID)
-    std::istringstream in;
-    #endif
-
-    for(std::size_t i = 0; i != size; ++i) {
-        #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-        output[i] = std::stof(data[i]);
-        #else
-        in.str(data[i]);
-        in >> output[i];
-        #endif
+    for(std::size_t i = 0; i != size; ++i) if(!parseFloat(tokens[2*i], tokens[2*i + 1], output[i])) {
+        if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
+        throw 0;
     }
 
-    if(data.size() == size+1) {
+    if(count == size + 1) {
         /* This should be obvious from the first if, but add this just to make
            Clang Analyzer happy */
         CORRADE_INTERNAL_ASSERT(extra);
 
-        #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-        *extra = std::stof(data.back());
-        #else
-        in.str(data.back());
-        in >> *extra;
-        #endif
+        if(!parseFloat(tokens[2*size], tokens[2*size + 1], *extra)) {
+            if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
+            throw 0;
+        }
     }
 
     return output;
 }
 
+void extractIndex(const char* const begin, const char* const end, const UnsignedInt offset, std::vector<UnsignedInt>& indices, const bool printErrors) {
+    UnsignedInt index;
+    if(!parseIndex(begin, end, index)) {
+        if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
+        throw 0;
+    }
+
+    indices.push_back(index - offset);
+}
+
 template<class T> void reindex(const std::vector<UnsignedInt>& indices, std::vector<T>& data) {
     /* Check that indices are in range */
     for(UnsignedInt i: indices) if(i >= data.size()) {
@@ -105,11 +240,244 @@ template<class T> void reindex(const std::vector<UnsignedInt>& indices, std::vec
     data = MeshTools::duplicate(indices, data);
 }
 
+struct MeshChunk {
+    std::optional<MeshPrimitive> primitive;
+    std::vector<Vector3> positions;
+    std::vector<Vector2> textureCoordinates;
+    std::vector<Vector3> normals;
+    std::vector<UnsignedInt> positionIndices;
+    std::vector<UnsignedInt> textureCoordinateIndices;
+    std::vector<UnsignedInt> normalIndices;
+};
+
+/* Parses lines in given range. If printErrors is false, nothing is printed,
+   which makes it safe to call from multiple threads. */
+bool parseMeshChunk(const char* const begin, const char* const end, const Mesh& mesh, MeshChunk& out, const bool printErrors) {
+    try { for(const char* i = begin; i != end; ) {
+        const char* const newline = findLineEnd(i, end);
+        const char* const lineEnd = rtrim(i, newline);
+        const char* const keywordBegin = skipSpace(i, lineEnd);
+        i = newline == end ? end : newline + 1;
+
+        /* Ignore empty lines and comments */
+        if(keywordBegin == lineEnd || *keywordBegin == '#') continue;
+
+        /* Split the line into keyword and contents */
+        const char* const keywordEnd = skipToken(keywordBegin, lineEnd);
+        const char* const contents = skipSpace(keywordEnd, lineEnd);
+
+        /* Vertex position */
+        if(isKeyword(keywordBegin, keywordEnd, "v")) {
+            Float extra{1.0f};
+            const Vector3 data = extractFloatData<3>(contents, lineEnd, printErrors, &extra);
+            if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
+                if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): homogeneous coordinates are not supported";
+                return false;
+            }
+
+            out.positions.push_back(data);
+
+        /* Texture coordinate */
+        } else if(isKeyword(keywordBegin, keywordEnd, "vt")) {
+            Float extra{0.0f};
+            const auto data = extractFloatData<2>(contents, lineEnd, printErrors, &extra);
+            if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
+                if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): 3D texture coordinates are not supported";
+                return false;
+            }
+
+            out.textureCoordinates.push_back(data);
+
+        /* Normal */
+        } else if(isKeyword(keywordBegin, keywordEnd, "vn")) {
+            out.normals.push_back(extractFloatData<3>(contents, lineEnd, printErrors));
+
+        /* Indices */
+        } else if(keywordEnd - keywordBegin == 1 && (*keywordBegin == 'p' || *keywordBegin == 'l' || *keywordBegin == 'f')) {
+            /* Find the index tuples, remember at most four of them as that's
+               enough to detect wrong vertex count of any primitive */
+            const char* indexTuples[8];
+            std::size_t indexTupleCount = 0;
+            for(const char* j = contents; j != lineEnd; j = skipSpace(j, lineEnd)) {
+                const char* const tupleEnd = skipToken(j, lineEnd);
+                if(indexTupleCount < 4) {
+                    indexTuples[2*indexTupleCount] = j;
+                    indexTuples[2*indexTupleCount + 1] = tupleEnd;
+                }
+                ++indexTupleCount;
+                j = tupleEnd;
+            }
+
+            /* Points */
+            if(*keywordBegin == 'p') {
+                /* Check that we don't mix the primitives in one mesh */
+                if(out.primitive && out.primitive != MeshPrimitive::Points) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Points;
+                    return false;
+                }
+
+                /* Check vertex count per primitive */
+                if(indexTupleCount != 1) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): wrong index count for point";
+                    return false;
+                }
+
+                out.primitive = MeshPrimitive::Points;
+
+            /* Lines */
+            } else if(*keywordBegin == 'l') {
+                /* Check that we don't mix the primitives in one mesh */
+                if(out.primitive && out.primitive != MeshPrimitive::Lines) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Lines;
+                    return false;
+                }
+
+                /* Check vertex count per primitive */
+                if(indexTupleCount != 2) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): wrong index count for line";
+                    return false;
+                }
+
+                out.primitive = MeshPrimitive::Lines;
+
+            /* Faces */
+            } else if(*keywordBegin == 'f') {
+                /* Check that we don't mix the primitives in one mesh */
+                if(out.primitive && out.primitive != MeshPrimitive::Triangles) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *out.primitive << "and" << MeshPrimitive::Triangles;
+                    return false;
+                }
+
+                /* Check vertex count per primitive */
+                if(indexTupleCount < 3) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): wrong index count for triangle";
+                    return false;
+                } else if(indexTupleCount != 3) {
+                    if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): polygons are not supported";
+                    return false;
+                }
+
+                out.primitive = MeshPrimitive::Triangles;
+
+            } else CORRADE_ASSERT_UNREACHABLE();
+
+            for(std::size_t j = 0; j != indexTupleCount; ++j) {
+                /* Split the tuple on slashes */
+                const char* const tupleEnd = indexTuples[2*j + 1];
+                const char* indexBegin[3]{indexTuples[2*j]};
+                const char* indexEnd[3]{tupleEnd};
+                std::size_t indexCount = 1;
+                for(const char* k = indexBegin[0]; k != tupleEnd; ++k) if(*k == '/') {
+                    if(indexCount == 3) {
+                        if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): invalid index data";
+                        return false;
+                    }
+                    indexEnd[indexCount - 1] = k;
+                    indexBegin[indexCount] = k + 1;
+                    indexEnd[indexCount] = tupleEnd;
+                    ++indexCount;
+                }
+
+                /* Position indices */
+                extractIndex(indexBegin[0], indexEnd[0], mesh.positionIndexOffset, out.positionIndices, printErrors);
+
+                /* Texture coordinates */
+                if(indexCount == 2 || (indexCount == 3 && indexBegin[1] != indexEnd[1]))
+                    extractIndex(indexBegin[1], indexEnd[1], mesh.textureCoordinateIndexOffset, out.textureCoordinateIndices, printErrors);
+
+                /* Normal indices */
+                if(indexCount == 3)
+                    extractIndex(indexBegin[2], indexEnd[2], mesh.normalIndexOffset, out.normalIndices, printErrors);
+            }
+
+        /* Ignore unsupported keywords, error out on unknown keywords */
+        } else if(!isKeyword(keywordBegin, keywordEnd, "mtllib") &&
+                  !isKeyword(keywordBegin, keywordEnd, "usemtl") &&
+                  !isKeyword(keywordBegin, keywordEnd, "g") &&
+                  !isKeyword(keywordBegin, keywordEnd, "s")) {
+            if(printErrors) Error() << "Trade::ObjImporter::mesh3D(): unknown keyword" << std::string{keywordBegin, keywordEnd};
+            return false;
+        }
+
+    }} catch(...) {
+        /* Error message already printed */
+        return false;
+    }
+
+    return true;
+}
+
+/* Minimal size of a chunk parsed by one thread, smaller meshes are not worth
+   the thread startup overhead */
+constexpr std::size_t ParallelMinChunkSize = 256*1024;
+
+/* Splits the range into chunks at line boundaries, parses them concurrently
+   (the first one in the calling thread) and concatenates the results in
+   order. Index values don't depend on where the chunk starts, so the result
+   is the same as when parsing serially. Returns false without printing
+   anything if any chunk fails or the chunks have different primitives, the
+   caller is expected to parse the range serially again to get the error
+   message. */
+bool parseMeshChunksParallel(const char* const begin, const char* const end, const Mesh& mesh, const UnsignedInt chunkCount, MeshChunk& out) {
+    std::vector<const char*> splits(chunkCount + 1);
+    splits[0] = begin;
+    splits[chunkCount] = end;
+    for(std::size_t i = 1; i != chunkCount; ++i) {
+        const char* const split = std::max(splits[i - 1], begin + (end - begin)*i/chunkCount);
+        const char* const newline = findLineEnd(split, end);
+        splits[i] = newline == end ? end : newline + 1;
+    }
+
+    std::vector<MeshChunk> chunks(chunkCount);
+    std::unique_ptr<bool[]> succeeded{new bool[chunkCount]};
+    const auto parse = [&splits, &mesh, &chunks, &succeeded](const std::size_t i) {
+        succeeded[i] = parseMeshChunk(splits[i], splits[i + 1], mesh, chunks[i], false);
+    };
+
+    Magnum::Implementation::runInParallel(chunkCount, parse);
+
+    std::size_t positionCount = 0, textureCoordinateCount = 0, normalCount = 0;
+    std::size_t positionIndexCount = 0, textureCoordinateIndexCount = 0, normalIndexCount = 0;
+    for(std::size_t i = 0; i != chunkCount; ++i) {
+        if(!succeeded[i]) return false;
+
+        /* Mixed primitives across chunks */
+        if(chunks[i].primitive) {
+            if(out.primitive && out.primitive != chunks[i].primitive) return false;
+            out.primitive = chunks[i].primitive;
+        }
+
+        positionCount += chunks[i].positions.size();
+        textureCoordinateCount += chunks[i].textureCoordinates.size();
+        normalCount += chunks[i].normals.size();
+        positionIndexCount += chunks[i].positionIndices.size();
+        textureCoordinateIndexCount += chunks[i].textureCoordinateIndices.size();
+        normalIndexCount += chunks[i].normalIndices.size();
+    }
+
+    out.positions.reserve(positionCount);
+    out.textureCoordinates.reserve(textureCoordinateCount);
+    out.normals.reserve(normalCount);
+    out.positionIndices.reserve(positionIndexCount);
+    out.textureCoordinateIndices.reserve(textureCoordinateIndexCount);
+    out.normalIndices.reserve(normalIndexCount);
+    for(const MeshChunk& chunk: chunks) {
+        out.positions.insert(out.positions.end(), chunk.positions.begin(), chunk.positions.end());
+        out.textureCoordinates.insert(out.textureCoordinates.end(), chunk.textureCoordinates.begin(), chunk.textureCoordinates.end());
+        out.normals.insert(out.normals.end(), chunk.normals.begin(), chunk.normals.end());
+        out.positionIndices.insert(out.positionIndices.end(), chunk.positionIndices.begin(), chunk.positionIndices.end());
+        out.textureCoordinateIndices.insert(out.textureCoordinateIndices.end(), chunk.textureCoordinateIndices.begin(), chunk.textureCoordinateIndices.end());
+        out.normalIndices.insert(out.normalIndices.end(), chunk.normalIndices.begin(), chunk.normalIndices.end());
+    }
+
+    return true;
+}
+
 }
 
-ObjImporter::ObjImporter() = default;
+ObjImporter::ObjImporter(): _threadCount{1} {}
 
-ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)) {}
+ObjImporter::ObjImporter(PluginManager::AbstractManager& manager, std::string plugin): AbstractImporter(manager, std::move(plugin)), _threadCount{1} {}
 
 ObjImporter::~ObjImporter() = default;
 
@@ -120,56 +488,69 @@ void ObjImporter::doClose() { _file.reset(); }
 bool ObjImporter::doIsOpened() const { return !!_file; }
 
 void ObjImporter::doOpenFile(const std::string& filename) {
-    std::unique_ptr<std::istream> in{new std::ifstream{filename, std::ios::binary}};
-    if(!in->good()) {
+    /* Read the whole file at once, the parser then works directly on the
+       memory */
+    std::ifstream in{filename, std::ios::binary};
+    if(!in.good()) {
         Error() << "Trade::ObjImporter::openFile(): cannot open file" << filename;
         return;
     }
 
+    in.seekg(0, std::ios::end);
+    const std::size_t size = std::size_t(in.tellg());
+    in.seekg(0, std::ios::beg);
+    Containers::Array<char> data{size};
+    if(!in.read(data, size)) {
+        Error() << "Trade::ObjImporter::openFile(): cannot read file" << filename;
+        return;
+    }
+
     _file.reset(new File);
-    _file->in = std::move(in);
+    _file->data = std::move(data);
     parseMeshNames();
 }
 
 void ObjImporter::doOpenData(Containers::ArrayView<const char> data) {
     _file.reset(new File);
-    _file->in.reset(new std::istringstream{{data.begin(), data.size()}});
+    _file->data = Containers::Array<char>{data.size()};
+    std::copy(data.begin(), data.end(), _file->data.begin());
 
     parseMeshNames();
 }
 
 void ObjImporter::parseMeshNames() {
+    const char* const data = _file->data.begin();
+    const char* const end = _file->data.end();
+
     /* First mesh starts at the beginning, its indices start from 1. The end
        offset will be updated to proper value later. */
     UnsignedInt positionIndexOffset = 1;
     UnsignedInt normalIndexOffset = 1;
     UnsignedInt textureCoordinateIndexOffset = 1;
-    _file->meshes.emplace_back(0, 0, positionIndexOffset, normalIndexOffset, textureCoordinateIndexOffset);
+    _file->meshes.push_back({0, 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0, 0, 0, 0});
 
     /* The first mesh doesn't have name by default but we might find it later,
        so we need to track whether there are any data before first name */
     bool thisIsFirstMeshAndItHasNoData = true;
     _file->meshNames.emplace_back();
 
-    while(_file->in->good()) {
+    for(const char* i = data; i != end; ) {
         /* The previous object might end at the beginning of this line */
-        const std::streampos end = _file->in->tellg();
+        const std::size_t lineBegin = i - data;
+        const char* const lineEnd = findLineEnd(i, end);
+        const char* const keywordBegin = skipSpace(i, lineEnd);
+        i = lineEnd == end ? end : lineEnd + 1;
 
-        /* Comment line */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
+        /* Empty or comment line */
+        if(keywordBegin == lineEnd || *keywordBegin == '#') continue;
 
-        /* Parse the keyword */
-        std::string keyword;
-        *_file->in >> keyword;
+        const char* const keywordEnd = skipToken(keywordBegin, lineEnd);
+        Mesh& mesh = _file->meshes.back();
 
         /* Mesh name */
-        if(keyword == "o") {
-            std::string name;
-            std::getline(*_file->in, name);
-            name = Utility::String::trim(name);
+        if(isKeyword(keywordBegin, keywordEnd, "o")) {
+            const char* const nameBegin = skipSpace(keywordEnd, lineEnd);
+            std::string name{nameBegin, rtrim(nameBegin, lineEnd)};
 
             /* This is the name of first mesh */
             if(thisIsFirstMeshAndItHasNoData) {
@@ -181,54 +562,54 @@ void ObjImporter::parseMeshNames() {
                 _file->meshNames.back() = std::move(name);
 
                 /* Update its begin offset to be more precise */
-                std::get<0>(_file->meshes.back()) = _file->in->tellg();
+                mesh.begin = i - data;
 
             /* Otherwise this is a name of new mesh */
             } else {
                 /* Set end of the previous one */
-                std::get<1>(_file->meshes.back()) = end;
+                mesh.end = lineBegin;
 
                 /* Save name and offset of the new one. The end offset will be
                    updated later. */
                 if(!name.empty())
                     _file->meshesForName.emplace(name, _file->meshes.size());
                 _file->meshNames.emplace_back(std::move(name));
-                _file->meshes.emplace_back(_file->in->tellg(), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset);
+                _file->meshes.push_back({std::size_t(i - data), 0, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset, 0, 0, 0, 0});
             }
 
-            continue;
-
         /* If there are any data/indices before the first name, it means that
            the first object is unnamed. We need to check for them. */
 
         /* Vertex data, update index offset for the following meshes */
-        } else if(keyword == "v") {
+        } else if(isKeyword(keywordBegin, keywordEnd, "v")) {
             ++positionIndexOffset;
+            ++mesh.positionCount;
             thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vt") {
+        } else if(isKeyword(keywordBegin, keywordEnd, "vt")) {
             ++textureCoordinateIndexOffset;
+            ++mesh.textureCoordinateCount;
             thisIsFirstMeshAndItHasNoData = false;
-        } else if(keyword == "vn") {
+        } else if(isKeyword(keywordBegin, keywordEnd, "vn")) {
             ++normalIndexOffset;
+            ++mesh.normalCount;
             thisIsFirstMeshAndItHasNoData = false;
 
         /* Index data, just mark that we found something for first unnamed
            object */
-        } else if(thisIsFirstMeshAndItHasNoData) for(const std::string& data: {"p", "l", "f"}) {
-            if(keyword == data) {
-                thisIsFirstMeshAndItHasNoData = false;
-                break;
-            }
+        } else if(isKeyword(keywordBegin, keywordEnd, "p")) {
+            mesh.indexCount += 1;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(isKeyword(keywordBegin, keywordEnd, "l")) {
+            mesh.indexCount += 2;
+            thisIsFirstMeshAndItHasNoData = false;
+        } else if(isKeyword(keywordBegin, keywordEnd, "f")) {
+            mesh.indexCount += 3;
+            thisIsFirstMeshAndItHasNoData = false;
         }
-
-        /* Ignore the rest of the line */
-        ignoreLine(*_file->in);
     }
 
     /* Set end of the last object */
-    _file->in->clear();
-    _file->in->seekg(0, std::ios::end);
-    std::get<1>(_file->meshes.back()) = _file->in->tellg();
+    _file->meshes.back().end = end - data;
 }
 
 UnsignedInt ObjImporter::doMesh3DCount() const { return _file->meshes.size(); }
@@ -243,184 +624,35 @@ std::string ObjImporter::doMesh3DName(UnsignedInt id) {
 }
 
 std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
-    /* Seek the file, set mesh parsing parameters */
-    std::streampos begin, end;
-    UnsignedInt positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset;
-    std::tie(begin, end, positionIndexOffset, textureCoordinateIndexOffset, normalIndexOffset) = _file->meshes[id];
-    _file->in->seekg(begin);
+    const Mesh& mesh = _file->meshes[id];
+    const char* const begin = _file->data.begin() + mesh.begin;
+    const char* const end = _file->data.begin() + mesh.end;
+
+    /* Parse large meshes in parallel, if that fails parse them serially
+       again to print the error message */
+    MeshChunk data;
+    const UnsignedInt chunks = UnsignedInt(Magnum::Implementation::parallelThreadCount(end - begin, _threadCount, ParallelMinChunkSize));
+    if(chunks == 1 || !parseMeshChunksParallel(begin, end, mesh, chunks, data)) {
+        /* Reserve memory using the counts gathered in parseMeshNames() */
+        data = MeshChunk{};
+        data.positions.reserve(mesh.positionCount);
+        data.textureCoordinates.reserve(mesh.textureCoordinateCount);
+        data.normals.reserve(mesh.normalCount);
+        data.positionIndices.reserve(mesh.indexCount);
+        if(mesh.textureCoordinateCount) data.textureCoordinateIndices.reserve(mesh.indexCount);
+        if(mesh.normalCount) data.normalIndices.reserve(mesh.indexCount);
+
+        if(!parseMeshChunk(begin, end, mesh, data, true)) return std::nullopt;
+    }
 
-    std::optional<MeshPrimitive> primitive;
-    std::vector<Vector3> positions;
+    std::vector<Vector3> positions = std::move(data.positions);
     std::vector<std::vector<Vector2>> textureCoordinates;
+    if(!data.textureCoordinates.empty()) textureCoordinates.push_back(std::move(data.textureCoordinates));
     std::vector<std::vector<Vector3>> normals;
-    std::vector<UnsignedInt> positionIndices;
-    std::vector<UnsignedInt> textureCoordinateIndices;
-    std::vector<UnsignedInt> normalIndices;
-
-    try { while(_file->in->good() && _file->in->tellg() < end) {
-        /* Ignore comments */
-        if(_file->in->peek() == '#') {
-            ignoreLine(*_file->in);
-            continue;
-        }
-
-        /* Get the line */
-        std::string line;
-        std::getline(*_file->in, line);
-        line = Utility::String::trim(line);
-
-        /* Ignore empty lines */
-        if(line.empty()) continue;
-
-        /* Split the line into keyword and contents */
-        const std::size_t keywordEnd = line.find(' ');
-        const std::string keyword = line.substr(0, keywordEnd);
-        const std::string contents = keywordEnd != std::string::npos ?
-            Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
-
-        /* Vertex position */
-        if(keyword == "v") {
-            Float extra{1.0f};
-            const Vector3 data = extractFloatData<3>(contents, &extra);
-            if(!Math::TypeTraits<Float>::equals(extra, 1.0f)) {
-                Error() << "Trade::ObjImporter::mesh3D(): homogeneous coordinates are not supported";
-                return std::nullopt;
-            }
-
-            positions.push_back(data);
-
-        /* Texture coordinate */
-        } else if(keyword == "vt") {
-            Float extra{0.0f};
-            const auto data = extractFloatData<2>(contents, &extra);
-            if(!Math::TypeTraits<Float>::equals(extra, 0.0f)) {
-                Error() << "Trade::ObjImporter::mesh3D(): 3D texture coordinates are not supported";
-                return std::nullopt;
-            }
-
-            if(textureCoordinates.empty()) textureCoordinates.push_back({});
-            textureCoordinates.front().push_back(data);
-
-        /* Normal */
-        } else if(keyword == "vn") {
-            if(normals.empty()) normals.push_back({});
-            normals.front().push_back(extractFloatData<3>(contents));
-
-        /* Indices */
-        } else if(keyword == "p" || keyword == "l" || keyword == "f") {
-            const std::vector<std::string> indexTuples = Utility::String::splitWithoutEmptyParts(contents, ' ');
-
-            /* Points */
-            if(keyword == "p") {
-                /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Points) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
-                    return std::nullopt;
-                }
-
-                /* Check vertex count per primitive */
-                if(indexTuples.size() != 1) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for point";
-                    return std::nullopt;
-                }
-
-                primitive = MeshPrimitive::Points;
-
-            /* Lines */
-            } else if(keyword == "l") {
-                /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Lines) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
-                    return std::nullopt;
-                }
-
-                /* Check vertex count per primitive */
-                if(indexTuples.size() != 2) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for line";
-                    return std::nullopt;
-                }
-
-                primitive = MeshPrimitive::Lines;
-
-            /* Faces */
-            } else if(keyword == "f") {
-                /* Check that we don't mix the primitives in one mesh */
-                if(primitive && primitive != MeshPrimitive::Triangles) {
-                    Error() << "Trade::ObjImporter::mesh3D(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
-                    return std::nullopt;
-                }
-
-                /* Check vertex count per primitive */
-                if(indexTuples.size() < 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): wrong index count for triangle";
-                    return std::nullopt;
-                } else if(indexTuples.size() != 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): polygons are not supported";
-                    return std::nullopt;
-                }
-
-                primitive = MeshPrimitive::Triangles;
-
-            } else CORRADE_ASSERT_UNREACHABLE();
-
-            for(const std::string& indexTuple: indexTuples) {
-                std::vector<std::string> indices = Utility::String::split(indexTuple, '/');
-                if(indices.size() > 3) {
-                    Error() << "Trade::ObjImporter::mesh3D(): invalid index data";
-                    return std::nullopt;
-                }
-
-                /* Position indices */
-                #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-                positionIndices.push_back(std::stoul(indices[0]) - positionIndexOffset);
-                #else
-                std::istringstream in(indices[0]);
-                UnsignedInt index;
-                in >> index;
-                positionIndices.push_back(index - positionIndexOffset);
-                #endif
-
-                /* Texture coordinates */
-                if(indices.size() == 2 || (indices.size() == 3 && !indices[1].empty())) {
-                    #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-                    textureCoordinateIndices.push_back(std::stoul(indices[1]) - textureCoordinateIndexOffset);
-                    #else
-                    in.str(indices[1]);
-                    in >> index;
-                    textureCoordinateIndices.push_back(index - textureCoordinateIndexOffset);
-                    #endif
-                }
-
-                /* Normal indices */
-                if(indices.size() == 3) {
-                    #if !defined(CORRADE_TARGET_NACL_NEWLIB) && !defined(CORRADE_TARGET_ANDROID)
-                    normalIndices.push_back(std::stoul(indices[2]) - normalIndexOffset);
-                    #else
-                    in.str(indices[2]);
-                    in >> index;
-                    normalIndices.push_back(index - normalIndexOffset);
-                    #endif
-                }
-            }
-
-        /* Ignore unsupported keywords, error out on unknown keywords */
-        } else if(![&keyword](){
-            /* Using lambda to emulate for-else construct like in Python */
-            for(const std::string expected: {"mtllib", "usemtl", "g", "s"})
-                if(keyword == expected) return true;
-            return false;
-        }()) {
-            Error() << "Trade::ObjImporter::mesh3D(): unknown keyword" << keyword;
-            return std::nullopt;
-        }
-
-    }} catch(std::exception) {
-        Error() << "Trade::ObjImporter::mesh3D(): error while converting numeric data";
-        return std::nullopt;
-    } catch(...) {
-        /* Error message already printed */
-        return std::nullopt;
-    }
+    if(!data.normals.empty()) normals.push_back(std::move(data.normals));
+    std::vector<UnsignedInt>& positionIndices = data.positionIndices;
+    std::vector<UnsignedInt>& textureCoordinateIndices = data.textureCoordinateIndices;
+    std::vector<UnsignedInt>& normalIndices = data.normalIndices;
 
     /* There should be at least indexed position data */
     if(positions.empty() || positionIndices.empty()) {
@@ -458,7 +690,7 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
         arrays.push_back(positionIndices);
         if(!normalIndices.empty()) arrays.push_back(normalIndices);
         if(!textureCoordinateIndices.empty()) arrays.push_back(textureCoordinateIndices);
-        indices = MeshTools::combineIndexArrays(arrays);
+        indices = MeshTools::combineIndexArrays(arrays, _threadCount);
 
         /* Reindex data arrays */
         try {
@@ -480,7 +712,7 @@ std::optional<MeshData3D> ObjImporter::doMesh3D(UnsignedInt id) {
         }
     }
 
-    return MeshData3D(*primitive, std::move(indices), {std::move(positions)}, std::move(normals), std::move(textureCoordinates));
+    return MeshData3D(*data.primitive, std::move(indices), {std::move(positions)}, std::move(normals), std::move(textureCoordinates));
 }
 
 }}
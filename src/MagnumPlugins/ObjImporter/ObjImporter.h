@@ -61,6 +61,32 @@ class ObjImporter: public AbstractImporter {
 
         ~ObjImporter();
 
+        /**
+         * @brief Thread count for parsing mesh data
+         *
+         * @see @ref setThreadCount()
+         */
+        UnsignedInt threadCount() const { return _threadCount; }
+
+        /**
+         * @brief Set thread count for parsing mesh data
+         * @return Reference to self (for method chaining)
+         *
+         * If set to value other than `1`, @ref mesh3D() splits large meshes
+         * into chunks at line boundaries, parses them concurrently and
+         * concatenates the results in order, so the output is identical to
+         * the serial parsing. The count is also used when combining
+         * position, normal and texture coordinate indices, see
+         * @ref MeshTools::combineIndexArrays(). Value of `0` means thread
+         * count reported by `std::thread::hardware_concurrency()`. Small
+         * meshes are always parsed serially. On platforms without thread
+         * support the value is ignored. Default is `1`.
+         */
+        ObjImporter& setThreadCount(UnsignedInt count) {
+            _threadCount = count;
+            return *this;
+        }
+
     private:
         struct File;
 
@@ -79,6 +105,7 @@ class ObjImporter: public AbstractImporter {
         void parseMeshNames();
 
         std::unique_ptr<File> _file;
+        UnsignedInt _threadCount;
 };
 
 }}
@@ -0,0 +1,195 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/String.h>
+
+#include "Magnum/Mesh.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/MeshTools/CombineIndexedArrays.h"
+#include "Magnum/MeshTools/Duplicate.h"
+#include "Magnum/Test/BenchmarkTimer.h"
+#include "Magnum/Trade/MeshData3D.h"
+#include "MagnumPlugins/ObjImporter/ObjImporter.h"
+
+namespace Magnum { namespace Trade { namespace Test {
+
+struct ObjImporterBenchmark: TestSuite::Tester {
+    explicit ObjImporterBenchmark();
+
+    void streamParser();
+    void bufferParser();
+    void bufferParserParallel();
+};
+
+ObjImporterBenchmark::ObjImporterBenchmark() {
+    addTests({&ObjImporterBenchmark::streamParser,
+              &ObjImporterBenchmark::bufferParser,
+              &ObjImporterBenchmark::bufferParserParallel});
+}
+
+namespace {
+    /* Grid of 1001x1001 vertices with texture coordinates and normals, two
+       million triangles */
+    constexpr UnsignedInt GridSize = 1001;
+    constexpr std::size_t FaceCount = 2*(GridSize - 1)*(GridSize - 1);
+
+    const std::string& file() {
+        static const std::string file = []() {
+            std::ostringstream out;
+            out << "o Grid\n";
+            for(UnsignedInt y = 0; y != GridSize; ++y) for(UnsignedInt x = 0; x != GridSize; ++x)
+                out << "v " << x*0.125f << ' ' << y*0.125f << ' ' << ((x*7 + y*13) % 100)*0.0317f << '\n';
+            for(UnsignedInt y = 0; y != GridSize; ++y) for(UnsignedInt x = 0; x != GridSize; ++x)
+                out << "vt " << Float(x)/(GridSize - 1) << ' ' << Float(y)/(GridSize - 1) << '\n';
+            for(UnsignedInt y = 0; y != GridSize; ++y) for(UnsignedInt x = 0; x != GridSize; ++x)
+                out << "vn " << ((x*5) % 17)*0.0625f << ' ' << ((y*3) % 11)*0.125f << " 0.875\n";
+
+            const auto vertex = [&out](UnsignedInt i) {
+                out << ' ' << i << '/' << i << '/' << i;
+            };
+            for(UnsignedInt y = 0; y != GridSize - 1; ++y) for(UnsignedInt x = 0; x != GridSize - 1; ++x) {
+                const UnsignedInt i = y*GridSize + x + 1;
+                out << 'f';
+                vertex(i);
+                vertex(i + 1);
+                vertex(i + GridSize);
+                out << "\nf";
+                vertex(i + 1);
+                vertex(i + GridSize + 1);
+                vertex(i + GridSize);
+                out << '\n';
+            }
+            return out.str();
+        }();
+        return file;
+    }
+
+    /* The original std::istream based parser, without error handling and
+       limited to triangles with all three attributes, for comparison */
+    MeshData3D streamParserImplementation(std::istream& in) {
+        std::vector<Vector3> positions;
+        std::vector<Vector2> textureCoordinates;
+        std::vector<Vector3> normals;
+        std::vector<UnsignedInt> positionIndices;
+        std::vector<UnsignedInt> textureCoordinateIndices;
+        std::vector<UnsignedInt> normalIndices;
+
+        while(in.good()) {
+            std::string line;
+            std::getline(in, line);
+            line = Utility::String::trim(line);
+            if(line.empty()) continue;
+
+            const std::size_t keywordEnd = line.find(' ');
+            const std::string keyword = line.substr(0, keywordEnd);
+            const std::string contents = keywordEnd != std::string::npos ?
+                Utility::String::ltrim(line.substr(keywordEnd+1)) : "";
+            const std::vector<std::string> data = Utility::String::splitWithoutEmptyParts(contents, ' ');
+
+            if(keyword == "v")
+                positions.emplace_back(std::stof(data[0]), std::stof(data[1]), std::stof(data[2]));
+            else if(keyword == "vt")
+                textureCoordinates.emplace_back(std::stof(data[0]), std::stof(data[1]));
+            else if(keyword == "vn")
+                normals.emplace_back(std::stof(data[0]), std::stof(data[1]), std::stof(data[2]));
+            else if(keyword == "f") for(const std::string& indexTuple: data) {
+                const std::vector<std::string> indices = Utility::String::split(indexTuple, '/');
+                positionIndices.push_back(std::stoul(indices[0]) - 1);
+                textureCoordinateIndices.push_back(std::stoul(indices[1]) - 1);
+                normalIndices.push_back(std::stoul(indices[2]) - 1);
+            }
+        }
+
+        std::vector<UnsignedInt> indices = MeshTools::combineIndexArrays({
+            std::ref(positionIndices),
+            std::ref(normalIndices),
+            std::ref(textureCoordinateIndices)});
+        positions = MeshTools::duplicate(positionIndices, positions);
+        normals = MeshTools::duplicate(normalIndices, normals);
+        textureCoordinates = MeshTools::duplicate(textureCoordinateIndices, textureCoordinates);
+
+        return MeshData3D{MeshPrimitive::Triangles, std::move(indices), {std::move(positions)}, {std::move(normals)}, {std::move(textureCoordinates)}};
+    }
+
+    template<class F> std::optional<MeshData3D> measure(const char* name, F f) {
+        const std::string& data = file();
+
+        /* Both parsers are slow enough that the best of two is sufficient */
+        std::optional<MeshData3D> mesh;
+        Magnum::Test::BenchmarkTimer timer;
+        for(std::size_t i = 0; i != 2; ++i) {
+            mesh = std::nullopt;
+            timer.measure([&]() { mesh = f(data); });
+        }
+
+        Debug() << "   " << name << timer.milliseconds() << "ms for" << data.size()/(1024*1024) << "MB," << FaceCount << "faces";
+        return mesh;
+    }
+}
+
+void ObjImporterBenchmark::streamParser() {
+    const std::optional<MeshData3D> mesh = measure("std::istream parser:", [](const std::string& data) -> std::optional<MeshData3D> {
+        std::istringstream in{data};
+        return streamParserImplementation(in);
+    });
+
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->indices().size(), FaceCount*3);
+    CORRADE_COMPARE(mesh->positions(0).size(), GridSize*GridSize);
+}
+
+void ObjImporterBenchmark::bufferParser() {
+    const std::optional<MeshData3D> mesh = measure("buffer parser:", [](const std::string& data) {
+        ObjImporter importer;
+        importer.openData({data.data(), data.size()});
+        return importer.mesh3D(0);
+    });
+
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->indices().size(), FaceCount*3);
+    CORRADE_COMPARE(mesh->positions(0).size(), GridSize*GridSize);
+}
+
+void ObjImporterBenchmark::bufferParserParallel() {
+    for(UnsignedInt threadCount: {2, 4, 8}) {
+        const std::string name = "buffer parser, " + std::to_string(threadCount) + " threads:";
+        const std::optional<MeshData3D> mesh = measure(name.data(), [threadCount](const std::string& data) {
+            ObjImporter importer;
+            importer.setThreadCount(threadCount);
+            importer.openData({data.data(), data.size()});
+            return importer.mesh3D(0);
+        });
+
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->indices().size(), FaceCount*3);
+        CORRADE_COMPARE(mesh->positions(0).size(), GridSize*GridSize);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterBenchmark)
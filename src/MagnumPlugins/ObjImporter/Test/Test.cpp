@@ -56,6 +56,9 @@ class ObjImporterTest: public TestSuite::Tester {
         void moreMeshes();
         void unnamedFirstMesh();
 
+        void numberFormats();
+        void windowsLineEndings();
+
         void wrongFloat();
         void wrongInteger();
         void unmergedIndexOutOfRange();
@@ -89,6 +92,10 @@ class ObjImporterTest: public TestSuite::Tester {
 
         void unsupportedKeyword();
         void unknownKeyword();
+
+        void parallel();
+        void parallelMixedPrimitives();
+        void parallelError();
 };
 
 ObjImporterTest::ObjImporterTest() {
@@ -108,6 +115,9 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::moreMeshes,
               &ObjImporterTest::unnamedFirstMesh,
 
+              &ObjImporterTest::numberFormats,
+              &ObjImporterTest::windowsLineEndings,
+
               &ObjImporterTest::wrongFloat,
               &ObjImporterTest::wrongInteger,
               &ObjImporterTest::unmergedIndexOutOfRange,
@@ -139,7 +149,11 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::wrongNormalIndexCount,
 
               &ObjImporterTest::unsupportedKeyword,
-              &ObjImporterTest::unknownKeyword});
+              &ObjImporterTest::unknownKeyword,
+
+              &ObjImporterTest::parallel,
+              &ObjImporterTest::parallelMixedPrimitives,
+              &ObjImporterTest::parallelError});
 }
 
 void ObjImporterTest::pointMesh() {
@@ -399,6 +413,37 @@ void ObjImporterTest::unnamedFirstMesh() {
     CORRADE_COMPARE(importer.mesh3DForName("SecondMesh"), 1);
 }
 
+void ObjImporterTest::numberFormats() {
+    ObjImporter importer;
+    CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "numberFormats.obj")));
+    CORRADE_COMPARE(importer.mesh3DCount(), 1);
+
+    const std::optional<MeshData3D> data = importer.mesh3D(0);
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->positions(0), (std::vector<Vector3>{
+        {1.5f, -0.25f, 3.0f},
+        {100.0f, -0.25f, 0.000001f},
+        {1.0f, 0.25f, 12345678901234567890.0f}
+    }));
+}
+
+void ObjImporterTest::windowsLineEndings() {
+    ObjImporter importer;
+    const char data[] = "o Mesh\r\nv 1 2 3\r\nv\t4 5 6\r\n  # Indented comment\r\nl 1 2\r\n";
+    CORRADE_VERIFY(importer.openData({data, sizeof(data) - 1}));
+    CORRADE_COMPARE(importer.mesh3DCount(), 1);
+    CORRADE_COMPARE(importer.mesh3DName(0), "Mesh");
+
+    const std::optional<MeshData3D> mesh = importer.mesh3D(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE(mesh->positions(0), (std::vector<Vector3>{
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f}
+    }));
+    CORRADE_COMPARE(mesh->indices(), (std::vector<UnsignedInt>{0, 1}));
+}
+
 void ObjImporterTest::wrongFloat() {
     ObjImporter importer;
     CORRADE_VERIFY(importer.openFile(Utility::Directory::join(OBJIMPORTER_TEST_DIR, "wrongNumbers.obj")));
@@ -732,6 +777,76 @@ void ObjImporterTest::unknownKeyword() {
     CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): unknown keyword bleh\n");
 }
 
+namespace {
+    /* Large enough to be split into several chunks */
+    std::string gridMesh() {
+        std::ostringstream out;
+        constexpr UnsignedInt size = 150;
+        for(UnsignedInt i = 0; i != size*size; ++i)
+            out << "v " << i%size << ' ' << i/size << ' ' << (i%7)*0.25f << '\n'
+                << "vt " << (i%size)*0.5f << ' ' << (i/size)*0.25f << '\n'
+                << "vn 0 " << (i%3)*0.5f << " 1\n";
+        for(UnsignedInt y = 0; y != size - 1; ++y) for(UnsignedInt x = 0; x != size - 1; ++x) {
+            const UnsignedInt i = y*size + x + 1;
+            out << "f " << i << '/' << i << '/' << i << ' '
+                << i + 1 << '/' << i + 1 << '/' << i << ' '
+                << i + size << '/' << i << '/' << i + size << '\n';
+        }
+        return out.str();
+    }
+}
+
+void ObjImporterTest::parallel() {
+    const std::string data = gridMesh();
+    CORRADE_VERIFY(data.size() > 1024*1024);
+
+    ObjImporter serialImporter;
+    CORRADE_VERIFY(serialImporter.openData({data.data(), data.size()}));
+    const std::optional<MeshData3D> serial = serialImporter.mesh3D(0);
+    CORRADE_VERIFY(serial);
+
+    ObjImporter importer;
+    importer.setThreadCount(4);
+    CORRADE_COMPARE(importer.threadCount(), 4);
+    CORRADE_VERIFY(importer.openData({data.data(), data.size()}));
+    const std::optional<MeshData3D> parallel = importer.mesh3D(0);
+    CORRADE_VERIFY(parallel);
+
+    CORRADE_COMPARE(parallel->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(parallel->indices(), serial->indices());
+    CORRADE_COMPARE(parallel->positions(0), serial->positions(0));
+    CORRADE_COMPARE(parallel->normals(0), serial->normals(0));
+    CORRADE_COMPARE(parallel->textureCoords2D(0), serial->textureCoords2D(0));
+}
+
+void ObjImporterTest::parallelMixedPrimitives() {
+    /* Points in the last chunk, mixed with triangles in the first */
+    const std::string data = gridMesh() + "p 1\n";
+
+    ObjImporter importer;
+    importer.setThreadCount(4);
+    CORRADE_VERIFY(importer.openData({data.data(), data.size()}));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.mesh3D(0));
+    CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): mixed primitive MeshPrimitive::Triangles and MeshPrimitive::Points\n");
+}
+
+void ObjImporterTest::parallelError() {
+    /* Errors in the first and last chunk, only the first one is reported */
+    const std::string data = "v 1 2\n" + gridMesh() + "v 1 bleh 2\n";
+
+    ObjImporter importer;
+    importer.setThreadCount(4);
+    CORRADE_VERIFY(importer.openData({data.data(), data.size()}));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer.mesh3D(0));
+    CORRADE_COMPARE(out.str(), "Trade::ObjImporter::mesh3D(): invalid float array size\n");
+}
+
 }}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterTest)